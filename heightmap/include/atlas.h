@@ -0,0 +1,287 @@
+#ifndef _ATLAS_H_
+#define _ATLAS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glversion.h"
+#include "hmap.h"
+
+#define ATLAS_MAX_MAPS 8
+/* texels of repeated edge samples around each map of a shared atlas, a lone map clamps to the texture edge
+ * instead - maps start on multiples of it and their far gutters run on to the next multiple, so a texel of
+ * mip log2(gutter) or finer never mixes two maps and a linear fetch at a map's edge reaches one texel of
+ * gutter at most (see atlas_max_lod)
+ */
+#define ATLAS_GUTTER 16
+
+/* texel rectangle of one heightmap in the atlas */
+typedef struct {
+    uint32_t x, y, width, height;
+} atlas_region_t;
+
+/* several heightmaps packed into one texture - switching maps is a uniform change, never an upload */
+typedef struct {
+    uint32_t width, height;
+    uint32_t num_maps;
+    uint32_t gutter;
+    hmap_type_t type;
+    atlas_region_t regions[ATLAS_MAX_MAPS];
+#ifdef USE_GL2
+    GLuint texture;
+    uint32_t levels;    /* mip levels, 1 when the context cannot mipmap the atlas */
+#endif
+} atlas_t;
+
+/* texels reserved for a map side of size samples - its gutters, the far one padded to a multiple of the gutter */
+uint32_t atlas_extent(const atlas_t* atlas, uint32_t size) {
+    uint32_t g = atlas->gutter;
+    return g == 0 ? size : (size + g - 1) / g * g + 2 * g;
+}
+
+/* shelf packs the maps, tallest first, into a texture about as wide as it is tall */
+int atlas_pack(atlas_t* atlas, const hmap_t* hmaps, uint32_t num_maps) {
+    uint32_t order[ATLAS_MAX_MAPS];
+    uint64_t area = 0;
+    uint32_t i, j, x = 0, y = 0, shelf = 0;
+
+    memset(atlas, 0, sizeof(*atlas));
+    if (num_maps == 0 || num_maps > ATLAS_MAX_MAPS) {
+        printf("ERROR atlas holds 1 to %u heightmaps\n", ATLAS_MAX_MAPS);
+        return -1;
+    }
+
+    atlas->num_maps = num_maps;
+    atlas->type = hmaps[0].type;
+    atlas->gutter = num_maps > 1 ? ATLAS_GUTTER : 0;
+    for (i = 0; i < num_maps; ++i) {
+        /* one texture format for every map */
+        if (hmaps[i].type != atlas->type) {
+            printf("ERROR heightmaps in an atlas must share a sample type\n");
+            return -1;
+        }
+        if (atlas_extent(atlas, hmaps[i].width) > atlas->width)
+            atlas->width = atlas_extent(atlas, hmaps[i].width);
+        area += (uint64_t) atlas_extent(atlas, hmaps[i].width) * atlas_extent(atlas, hmaps[i].height);
+        order[i] = i;
+    }
+    while ((uint64_t) atlas->width * atlas->width < area)
+        ++atlas->width;
+
+    /* insertion sort by height - at most ATLAS_MAX_MAPS entries */
+    for (i = 1; i < num_maps; ++i) {
+        for (j = i; j > 0 && hmaps[order[j]].height > hmaps[order[j - 1]].height; --j) {
+            uint32_t swap = order[j];
+            order[j] = order[j - 1];
+            order[j - 1] = swap;
+        }
+    }
+
+    for (i = 0; i < num_maps; ++i) {
+        const hmap_t* hmap = &hmaps[order[i]];
+        atlas_region_t* region = &atlas->regions[order[i]];
+        uint32_t width = atlas_extent(atlas, hmap->width), height = atlas_extent(atlas, hmap->height);
+
+        /* start a new shelf when the map does not fit */
+        if (x + width > atlas->width) {
+            y += shelf;
+            x = 0;
+            shelf = 0;
+        }
+        region->x = x + atlas->gutter;
+        region->y = y + atlas->gutter;
+        region->width = hmap->width;
+        region->height = hmap->height;
+
+        x += width;
+        if (height > shelf)
+            shelf = height;
+    }
+    atlas->height = y + shelf;
+
+    return 0;
+}
+
+/* texture coordinate transform (offset xy, scale zw) taking a [0, 1] grid coordinate to the texel centres of a map */
+void atlas_uv(const atlas_t* atlas, uint32_t map, vec4 uv) {
+    const atlas_region_t* region = &atlas->regions[map];
+    uv[0] = (region->x + 0.5f) / atlas->width;
+    uv[1] = (region->y + 0.5f) / atlas->height;
+    uv[2] = (region->width - 1.f) / atlas->width;
+    uv[3] = (region->height - 1.f) / atlas->height;
+}
+
+#ifdef USE_GL2
+/* coarsest mip a map is fetched from - past log2 of the gutter a texel averages in the neighbouring map, see
+ * ATLAS_GUTTER
+ */
+float atlas_max_lod(const atlas_t* atlas) {
+    uint32_t lod = 0;
+
+    while (lod + 1 < atlas->levels && (atlas->gutter == 0 || (2u << lod) <= atlas->gutter))
+        ++lod;
+    return (float) lod;
+}
+
+/* one image of the whole atlas, each map's edge samples repeated over its gutters */
+uint8_t* atlas_image(const atlas_t* atlas, const hmap_t* hmaps) {
+    uint32_t size = hmap_sample_size(atlas->type), g = atlas->gutter, i, x, y;
+    uint8_t* image = calloc((size_t) atlas->width * atlas->height, size);
+
+    if (image == NULL) {
+        printf("ERROR could not allocate %ux%u atlas image\n", atlas->width, atlas->height);
+        return NULL;
+    }
+    for (i = 0; i < atlas->num_maps; ++i) {
+        const atlas_region_t* region = &atlas->regions[i];
+        uint32_t width = atlas_extent(atlas, region->width), height = atlas_extent(atlas, region->height);
+        for (y = 0; y < height; ++y) {
+            uint32_t h = y < g ? 0 : y - g < region->height ? y - g : region->height - 1;
+            const uint8_t* row = hmap_row(&hmaps[i], h);
+            uint8_t* out = image + ((size_t) (region->y - g + y) * atlas->width + region->x - g) * size;
+
+            for (x = 0; x < g; ++x)
+                memcpy(out + x * size, row, size);
+            memcpy(out + g * size, row, region->width * size);
+            for (x = g + region->width; x < width; ++x)
+                memcpy(out + x * size, row + (region->width - 1) * size, size);
+        }
+    }
+    return image;
+}
+
+/* next mip level of a width x height image, each texel the rounded mean of a 2x2 box -
+ * levels are sized like GL sizes them, so an odd last row or column is left out
+ */
+void atlas_mip_u8(const uint8_t* in, uint32_t in_width, uint32_t in_height, uint8_t* out, uint32_t width,
+                  uint32_t height) {
+    uint32_t dy = in_height > 1; /* a side already down to one texel is not halved */
+    int32_t y;
+
+#pragma omp parallel for schedule(static)
+    for (y = 0; y < (int32_t) height; ++y) {
+        const uint8_t* a = in + (size_t) 2 * y * dy * in_width;
+        const uint8_t* b = a + dy * in_width;
+        uint8_t* o = out + (size_t) y * width;
+        size_t x; /* 32 bit 2 * x may wrap, which keeps it from vectorising */
+
+        if (in_width == 1) {
+            o[0] = (uint8_t) ((a[0] + b[0] + 1) >> 1);
+            continue;
+        }
+#pragma omp simd
+        for (x = 0; x < width; ++x)
+            o[x] = (uint8_t) ((a[2 * x] + a[2 * x + 1] + b[2 * x] + b[2 * x + 1] + 2) >> 2);
+    }
+}
+
+/* atlas_mip_u8 of 16 bit samples */
+void atlas_mip_u16(const uint16_t* in, uint32_t in_width, uint32_t in_height, uint16_t* out, uint32_t width,
+                   uint32_t height) {
+    uint32_t dy = in_height > 1;
+    int32_t y;
+
+#pragma omp parallel for schedule(static)
+    for (y = 0; y < (int32_t) height; ++y) {
+        const uint16_t* a = in + (size_t) 2 * y * dy * in_width;
+        const uint16_t* b = a + dy * in_width;
+        uint16_t* o = out + (size_t) y * width;
+        size_t x;
+
+        if (in_width == 1) {
+            o[0] = (uint16_t) ((a[0] + b[0] + 1u) >> 1);
+            continue;
+        }
+#pragma omp simd
+        for (x = 0; x < width; ++x)
+            o[x] = (uint16_t) ((a[2 * x] + a[2 * x + 1] + b[2 * x] + b[2 * x + 1] + 2u) >> 2);
+    }
+}
+
+/* uploads every map once with a full mip chain built on the CPU, into immutable storage where the context has it */
+int atlas_upload(atlas_t* atlas, const hmap_t* hmaps) {
+    /* 16 bit samples are uploaded as packed (low, high) byte pairs and rebuilt in the vertex shader */
+    GLenum format = atlas->type == HMAP_U16 ? GL_RG : GL_RED;
+    GLenum sized = atlas->type == HMAP_U16 ? GL_RG8 : GL_R8;
+    /* interpolating packed bytes breaks the carry */
+    GLint filter = atlas->type == HMAP_U16 ? GL_NEAREST : GL_LINEAR;
+    GLint mip_filter = atlas->type == HMAP_U16 ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR;
+    uint32_t size = hmap_sample_size(atlas->type), width = atlas->width, height = atlas->height, l;
+    bool pot = (width & (width - 1)) == 0 && (height & (height - 1)) == 0;
+    uint8_t *image, *next;
+    GLint max_size;
+
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_size);
+    if (atlas->width > (uint32_t) max_size || atlas->height > (uint32_t) max_size) {
+        printf("ERROR atlas of %ux%u exceeds the %d texel texture limit\n", atlas->width, atlas->height, max_size);
+        return -1;
+    }
+
+    /* levels down to 1x1 - ES 2.0 mipmaps only power of two sizes without OES_texture_npot */
+    atlas->levels = 1;
+    if (pot || gl_npot_mips) {
+        while ((width | height) >> atlas->levels)
+            ++atlas->levels;
+    } else {
+        printf("WARNING atlas of %ux%u cannot be mipmapped by this context, distant terrain samples level 0\n",
+               width, height);
+    }
+
+    image = atlas_image(atlas, hmaps);
+    next = malloc((size_t) (width / 2 + 1) * (height / 2 + 1) * size);
+    if (image == NULL || next == NULL) {
+        printf("ERROR could not allocate atlas mip levels\n");
+        free(image);
+        return -1;
+    }
+
+    gl_debug_flush();
+    glGenTextures(1, &atlas->texture);
+    gl_bind_texture(0, atlas->texture);
+
+    /* texture params - regions are sampled at texel centres so linear filtering never bleeds between maps */
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, atlas->levels > 1 ? mip_filter : filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+
+    /* allocate every level at once, then fill them from the top down */
+    if (gl_tex_storage_2d != NULL)
+        gl_tex_storage_2d(GL_TEXTURE_2D, atlas->levels, sized, width, height);
+    gl_set_unpack_alignment(1);
+    for (l = 0; l < atlas->levels; ++l) {
+        uint32_t w = width >> l > 0 ? width >> l : 1, h = height >> l > 0 ? height >> l : 1;
+        uint8_t* swap;
+
+        if (gl_tex_storage_2d != NULL)
+            glTexSubImage2D(GL_TEXTURE_2D, l, 0, 0, w, h, format, GL_UNSIGNED_BYTE, image);
+        else
+            glTexImage2D(GL_TEXTURE_2D, l, format, w, h, 0, format, GL_UNSIGNED_BYTE, image);
+
+        if (l + 1 == atlas->levels)
+            break;
+        if (atlas->type == HMAP_U16) {
+            atlas_mip_u16((const uint16_t*) image, w, h, (uint16_t*) next, w / 2 > 0 ? w / 2 : 1,
+                          h / 2 > 0 ? h / 2 : 1);
+        } else {
+            atlas_mip_u8(image, w, h, next, w / 2 > 0 ? w / 2 : 1, h / 2 > 0 ? h / 2 : 1);
+        }
+        swap = image; image = next; next = swap;
+    }
+    free(image);
+    free(next);
+
+    if (gl_out_of_memory()) {
+        printf("ERROR could not allocate %ux%u atlas\n", width, height);
+        return -1;
+    }
+    printf("Heightmap atlas %ux%u holding %u maps, %u mip levels in %s storage\n", width, height, atlas->num_maps,
+           atlas->levels, gl_tex_storage_2d != NULL ? "immutable" : "mutable");
+    return 0;
+}
+#endif
+
+#endif /* _ATLAS_H_ */
@@ -0,0 +1,127 @@
+#ifndef _BUFFERS_H_
+#define _BUFFERS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "glversion.h"
+
+/*      buffer objects
+ * ---------------------------------
+ * Meshes that never change are uploaded once into static buffers, so a draw
+ * hands the driver offsets instead of having it copy every referenced vertex
+ * and index out of client memory on every call. Data rebuilt on the CPU goes
+ * through a stream - a ring written with glBufferSubData that is orphaned
+ * (reallocated with glBufferData(NULL)) when it wraps, so a write never waits
+ * on draws still reading the old storage. Anything written before an orphan
+ * is gone, so writers keep the stream's generation and write again when it
+ * has moved on.
+ *
+ * Every mesh keeps its client arrays - with buffers_enabled cleared (B) the
+ * same draws go through client arrays, for comparison.
+ */
+#define BUFFER_STREAM_SIZE (4u << 20)   /* initial ring size, grown to the largest write */
+#define BUFFER_STREAM_ALIGN 4u
+
+#ifdef USE_GL2
+/* pointer argument of glVertexAttribPointer and glDrawElements - an offset into the bound buffer */
+#define BUFFER_OFFSET(offset) ((const void*) (uintptr_t) (offset))
+
+typedef struct {
+    GLuint buffer;
+    GLenum target;
+    uint32_t size, head;
+    uint32_t generation;        /* orphans so far */
+    uint32_t bytes_written;     /* reset by whoever reports it */
+} buffer_stream_t;
+
+bool buffers_enabled = true;
+
+/* streams shared by everything rebuilt on the CPU */
+buffer_stream_t stream_vertices, stream_indices;
+
+void buffer_delete(GLuint* buffer) {
+    if (*buffer != 0) {
+        gl_forget_buffer(*buffer);
+        glDeleteBuffers(1, buffer);
+    }
+    *buffer = 0;
+}
+
+/* creates a static buffer holding size bytes of data */
+int buffer_create(GLuint* buffer, GLenum target, const void* data, size_t size) {
+    gl_debug_flush();
+    glGenBuffers(1, buffer);
+    gl_bind_buffer(target, *buffer);
+    glBufferData(target, size, data, GL_STATIC_DRAW);
+    gl_bind_buffer(target, 0);
+
+    if (gl_out_of_memory()) {
+        printf("ERROR could not allocate a %zu byte buffer\n", size);
+        buffer_delete(buffer);
+        return -1;
+    }
+    return 0;
+}
+
+/* binds the buffer to target, or unbinds it for client arrays */
+void buffer_bind(GLenum target, GLuint buffer) {
+    gl_bind_buffer(target, buffers_enabled ? buffer : 0);
+}
+
+/* where bytes [offset, ...) of a mesh are for the bound buffer, see buffer_bind */
+const void* buffer_pointer(GLuint buffer, const void* client, size_t offset) {
+    if (buffers_enabled && buffer != 0)
+        return BUFFER_OFFSET(offset);
+    return (const uint8_t*) client + offset;
+}
+
+int buffer_stream_init(buffer_stream_t* stream, GLenum target, uint32_t size) {
+    memset(stream, 0, sizeof(*stream));
+    stream->target = target;
+    stream->size = size;
+    gl_debug_flush();
+    glGenBuffers(1, &stream->buffer);
+    gl_bind_buffer(target, stream->buffer);
+    glBufferData(target, size, NULL, GL_STREAM_DRAW);
+    gl_bind_buffer(target, 0);
+
+    if (gl_out_of_memory()) {
+        printf("ERROR could not allocate a %u byte stream\n", size);
+        buffer_delete(&stream->buffer);
+        return -1;
+    }
+    return 0;
+}
+
+/* copies size bytes into the stream, leaving it bound - offset is where they landed
+ * errors are left for gl_draw_frame, a per frame glGetError here would stall the pipeline
+ */
+void buffer_stream_write(buffer_stream_t* stream, const void* data, uint32_t size, uint32_t* offset) {
+    uint32_t head = (stream->head + BUFFER_STREAM_ALIGN - 1) / BUFFER_STREAM_ALIGN * BUFFER_STREAM_ALIGN;
+
+    gl_bind_buffer(stream->target, stream->buffer);
+    if (head + size > stream->size) {
+        /* fresh storage - draws already issued keep the old one until they finish */
+        while (stream->size < size)
+            stream->size *= 2;
+        glBufferData(stream->target, stream->size, NULL, GL_STREAM_DRAW);
+        ++stream->generation;
+        head = 0;
+    }
+    glBufferSubData(stream->target, head, size, data);
+
+    *offset = head;
+    stream->head = head + size;
+    stream->bytes_written += size;
+}
+
+void buffer_stream_free(buffer_stream_t* stream) {
+    buffer_delete(&stream->buffer);
+    memset(stream, 0, sizeof(*stream));
+}
+#endif
+
+#endif /* _BUFFERS_H_ */
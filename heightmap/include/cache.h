@@ -0,0 +1,138 @@
+#ifndef _CACHE_H_
+#define _CACHE_H_
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "hmap.h"
+
+/*      derived data cache
+ * ---------------------------------
+ * Preprocessed terrain products are stored as CACHE_DIR/<key>.tcache - a
+ * header followed by the raw bytes of the product. The key hashes the source
+ * samples together with everything that changes the product (generation
+ * parameters, layout version, GL path), so a stale file is never matched and
+ * nothing needs to be invalidated by hand.
+ */
+#define CACHE_MAGIC   "TCHE"
+#define CACHE_VERSION 1u
+#define CACHE_DIR     "terrain_cache"
+#define CACHE_DATA_OFFSET 64u /* product starts on a cache line */
+
+typedef struct {
+    char     magic[4];
+    uint32_t version;
+    uint64_t key;
+    uint64_t size;
+} cache_header_t;
+
+/* word at a time multiply/xorshift hash - fast enough that hashing the samples costs far less than generating from them */
+uint64_t hash64(uint64_t h, const void* data, size_t size) {
+    const uint8_t* p = data;
+    const uint64_t prime = 0x9e3779b97f4a7c15ull;
+    uint64_t word;
+
+    for (; size >= 8; size -= 8, p += 8) {
+        memcpy(&word, p, 8);
+        h = (h ^ word) * prime;
+        h ^= h >> 29;
+    }
+    word = 0;
+    memcpy(&word, p, size);
+    h = (h ^ word ^ size) * prime;
+    return h ^ (h >> 32);
+}
+
+/* hashes the samples of every row, skipping the row padding */
+uint64_t hmap_hash(const hmap_t* hmap) {
+    uint32_t h, row_size = hmap->width * hmap_sample_size(hmap->type);
+    uint64_t hash = hash64(0, &hmap->type, sizeof(hmap->type));
+
+    hash = hash64(hash, &hmap->width, sizeof(hmap->width));
+    hash = hash64(hash, &hmap->height, sizeof(hmap->height));
+    for (h = 0; h < hmap->height; ++h)
+        hash = hash64(hash, hmap_row(hmap, h), row_size);
+    return hash;
+}
+
+void cache_path(char* path, size_t len, uint64_t key) {
+    snprintf(path, len, CACHE_DIR "/%016llx.tcache", (unsigned long long) key);
+}
+
+/* maps a cached product read only, returns NULL on a miss */
+const void* cache_map(uint64_t key, size_t size, void** map, size_t* map_size) {
+    char path[64];
+    cache_header_t header;
+    struct stat st;
+    int fd;
+
+    cache_path(path, sizeof(path), key);
+    fd = open(path, O_RDONLY);
+    if (fd == -1)
+        return NULL;
+
+    if (fstat(fd, &st) == -1 || (size_t) st.st_size != CACHE_DATA_OFFSET + size
+        || pread(fd, &header, sizeof(header), 0) != sizeof(header)
+        || memcmp(header.magic, CACHE_MAGIC, 4) != 0 || header.version != CACHE_VERSION
+        || header.key != key || header.size != size) {
+        printf("WARNING ignoring invalid cache file \"%s\"\n", path);
+        close(fd);
+        return NULL;
+    }
+
+    *map_size = st.st_size;
+    *map = mmap(NULL, *map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (*map == MAP_FAILED) {
+        *map = NULL;
+        return NULL;
+    }
+
+    return (const uint8_t*) *map + CACHE_DATA_OFFSET;
+}
+
+/* writes a product to the cache - written to a temporary file and renamed so readers never see a partial file */
+int cache_store(uint64_t key, const void* data, size_t size) {
+    char path[64], tmp_path[80];
+    cache_header_t header;
+    uint8_t pad[CACHE_DATA_OFFSET];
+    int fd, ok;
+
+    if (mkdir(CACHE_DIR, 0755) == -1 && errno != EEXIST) {
+        printf("WARNING could not create cache directory \"%s\"\n", CACHE_DIR);
+        return -1;
+    }
+
+    cache_path(path, sizeof(path), key);
+    snprintf(tmp_path, sizeof(tmp_path), "%s.%d", path, (int) getpid());
+    fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1) {
+        printf("WARNING could not write cache file \"%s\"\n", tmp_path);
+        return -1;
+    }
+
+    memset(pad, 0, sizeof(pad));
+    memcpy(header.magic, CACHE_MAGIC, 4);
+    header.version = CACHE_VERSION;
+    header.key = key;
+    header.size = size;
+    memcpy(pad, &header, sizeof(header));
+
+    ok = write(fd, pad, sizeof(pad)) == sizeof(pad) && write(fd, data, size) == (ssize_t) size;
+    ok = close(fd) == 0 && ok;
+    if (!ok || rename(tmp_path, path) == -1) {
+        printf("WARNING could not write cache file \"%s\"\n", path);
+        unlink(tmp_path);
+        return -1;
+    }
+
+    return 0;
+}
+
+#endif /* _CACHE_H_ */
@@ -0,0 +1,309 @@
+#ifndef _CDLOD_H_
+#define _CDLOD_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "buffers.h"
+#include "glversion.h"
+#include "hmap.h"
+#include "strip.h"
+#include "terrain.h"
+
+/*      continuous distance-dependent level of detail
+ * ---------------------------------
+ * An implicit quadtree over the samples. A node at level l covers
+ * CDLOD_GRID * 2^l samples and is drawn with one shared grid of CDLOD_GRID
+ * quads, so every level has the same triangle count per node. Nodes are
+ * selected by distance from the camera - level l is used out to ranges[l] -
+ * and the vertex shader morphs the odd grid vertices onto the next coarser
+ * level over the last part of each range, so there is no popping.
+ */
+#define CDLOD_GRID 32u                  /* quads along the shared grid */
+#define CDLOD_MAX_LEVELS 16
+#define CDLOD_MAX_NODES 2048
+#define CDLOD_LEAF_RANGE 2.f            /* level 0 range, in level 0 node sizes - ranges double per level */
+#define CDLOD_MORPH_START 0.66f         /* fraction of a range after which vertices morph */
+
+/* quarters of a node, in the order of the grid's quarter strips */
+#define CDLOD_ALL_QUARTERS 0xfu
+
+/* selected node - quarters holds the quarters drawn at this level */
+typedef struct {
+    uint32_t x, y;          /* origin in samples */
+    uint32_t level;
+    uint32_t quarters;
+} cdlod_node_t;
+
+/* grid shared by every node - the whole strip followed by one strip per quarter */
+typedef struct {
+    vec2 vertices[(CDLOD_GRID + 1) * (CDLOD_GRID + 1)];  /* [0, 1] across the node */
+    uint16_t* indices;
+    uint32_t num_indices;                   /* whole grid */
+    uint32_t quarter_first[4], quarter_count[4];
+#ifdef USE_GL2
+    GLuint vbo, ibo;
+#endif
+} cdlod_grid_t;
+
+typedef struct {
+    uint32_t width, height;         /* samples */
+    float spacing;                  /* world units between samples */
+    uint32_t num_levels;
+    float ranges[CDLOD_MAX_LEVELS]; /* world units */
+    /* altitude range of every node in [0, 1], (low, high) pairs, finest level first */
+    uint32_t nodes_x[CDLOD_MAX_LEVELS], nodes_y[CDLOD_MAX_LEVELS];
+    uint32_t level_first[CDLOD_MAX_LEVELS];
+    float* bounds;
+    /* rebuilt every frame by cdlod_select */
+    cdlod_node_t selection[CDLOD_MAX_NODES];
+    uint32_t num_selected;
+    uint32_t num_triangles;
+} cdlod_t;
+
+cdlod_grid_t cdlod_grid;
+
+/* builds the shared grid - quarter q covers columns (q % 2) and rows (q / 2) of the halves */
+int cdlod_grid_init(cdlod_grid_t* grid) {
+    uint32_t half = CDLOD_GRID / 2, r, c, q, i, n;
+    uint32_t quarter_indices = strip_blocked_num_indices(half + 1, half + 1, TERRAIN_STRIP_BLOCK);
+
+    for (r = 0; r <= CDLOD_GRID; ++r) {
+        for (c = 0; c <= CDLOD_GRID; ++c) {
+            grid->vertices[r * (CDLOD_GRID + 1) + c][0] = (float) c / CDLOD_GRID;
+            grid->vertices[r * (CDLOD_GRID + 1) + c][1] = (float) r / CDLOD_GRID;
+        }
+    }
+
+    grid->num_indices = strip_blocked_num_indices(CDLOD_GRID + 1, CDLOD_GRID + 1, TERRAIN_STRIP_BLOCK);
+    grid->indices = malloc((grid->num_indices + 4 * quarter_indices) * sizeof(uint16_t));
+    if (grid->indices == NULL) {
+        printf("ERROR could not allocate CDLOD grid\n");
+        return -1;
+    }
+    gen_strip_blocked(grid->indices, CDLOD_GRID + 1, CDLOD_GRID + 1, TERRAIN_STRIP_BLOCK);
+
+    /* quarter strips are built over a half sized grid and moved into place */
+    n = grid->num_indices;
+    for (q = 0; q < 4; ++q) {
+        uint16_t* out = grid->indices + n;
+        uint32_t first = (q / 2) * half * (CDLOD_GRID + 1) + (q % 2) * half;
+
+        gen_strip_blocked(out, half + 1, half + 1, TERRAIN_STRIP_BLOCK);
+        for (i = 0; i < quarter_indices; ++i)
+            out[i] = first + out[i] / (half + 1) * (CDLOD_GRID + 1) + out[i] % (half + 1);
+        grid->quarter_first[q] = n;
+        grid->quarter_count[q] = quarter_indices;
+        n += quarter_indices;
+    }
+
+#ifdef USE_GL2
+    if (buffer_create(&grid->vbo, GL_ARRAY_BUFFER, grid->vertices, sizeof(grid->vertices)) == -1
+        || buffer_create(&grid->ibo, GL_ELEMENT_ARRAY_BUFFER, grid->indices, n * sizeof(uint16_t)) == -1)
+        return -1;
+#endif
+    return 0;
+}
+
+void cdlod_grid_free(cdlod_grid_t* grid) {
+#ifdef USE_GL2
+    buffer_delete(&grid->vbo);
+    buffer_delete(&grid->ibo);
+#endif
+    free(grid->indices);
+    grid->indices = NULL;
+}
+
+/* (low, high) altitude of a node */
+float* cdlod_bounds(const cdlod_t* cdlod, uint32_t level, uint32_t nx, uint32_t ny) {
+    return &cdlod->bounds[2 * (cdlod->level_first[level] + ny * cdlod->nodes_x[level] + nx)];
+}
+
+/* builds the quadtree bounds of a heightmap */
+int cdlod_init(cdlod_t* cdlod, const hmap_t* hmap, float spacing) {
+    uint32_t l, nx, ny, h, w, total = 0, size = CDLOD_GRID;
+
+    memset(cdlod, 0, sizeof(*cdlod));
+    cdlod->width = hmap->width;
+    cdlod->height = hmap->height;
+    cdlod->spacing = spacing;
+
+    /* levels until one node covers the map */
+    do {
+        if (cdlod->num_levels == CDLOD_MAX_LEVELS) {
+            printf("ERROR heightmap too large for %d CDLOD levels\n", CDLOD_MAX_LEVELS);
+            return -1;
+        }
+        l = cdlod->num_levels++;
+        cdlod->nodes_x[l] = (hmap->width - 2) / size + 1;
+        cdlod->nodes_y[l] = (hmap->height - 2) / size + 1;
+        cdlod->level_first[l] = total;
+        cdlod->ranges[l] = CDLOD_LEAF_RANGE * CDLOD_GRID * spacing * (1u << l);
+        total += cdlod->nodes_x[l] * cdlod->nodes_y[l];
+        size *= 2;
+    } while (cdlod->nodes_x[l] > 1 || cdlod->nodes_y[l] > 1);
+
+    cdlod->bounds = malloc(2 * total * sizeof(float));
+    if (cdlod->bounds == NULL) {
+        printf("ERROR could not allocate CDLOD bounds\n");
+        return -1;
+    }
+
+    /* level 0 from the samples - nodes share their border samples */
+    for (ny = 0; ny < cdlod->nodes_y[0]; ++ny) {
+        for (nx = 0; nx < cdlod->nodes_x[0]; ++nx) {
+            float* bounds = cdlod_bounds(cdlod, 0, nx, ny);
+            bounds[0] = 1.f;
+            bounds[1] = 0.f;
+            for (h = ny * CDLOD_GRID; h <= (ny + 1) * CDLOD_GRID && h < hmap->height; ++h) {
+                const uint8_t* row = hmap_row(hmap, h);
+                for (w = nx * CDLOD_GRID; w <= (nx + 1) * CDLOD_GRID && w < hmap->width; ++w) {
+                    float alt = hmap_altitude(hmap, row, w) / 255.f;
+                    if (alt < bounds[0])
+                        bounds[0] = alt;
+                    if (alt > bounds[1])
+                        bounds[1] = alt;
+                }
+            }
+        }
+    }
+
+    /* coarser levels from their children */
+    for (l = 1; l < cdlod->num_levels; ++l) {
+        for (ny = 0; ny < cdlod->nodes_y[l]; ++ny) {
+            for (nx = 0; nx < cdlod->nodes_x[l]; ++nx) {
+                float* bounds = cdlod_bounds(cdlod, l, nx, ny);
+                bounds[0] = 1.f;
+                bounds[1] = 0.f;
+                for (h = 2 * ny; h < 2 * ny + 2 && h < cdlod->nodes_y[l - 1]; ++h) {
+                    for (w = 2 * nx; w < 2 * nx + 2 && w < cdlod->nodes_x[l - 1]; ++w) {
+                        const float* child = cdlod_bounds(cdlod, l - 1, w, h);
+                        if (child[0] < bounds[0])
+                            bounds[0] = child[0];
+                        if (child[1] > bounds[1])
+                            bounds[1] = child[1];
+                    }
+                }
+            }
+        }
+    }
+
+    printf("CDLOD quadtree over %ux%u: %u levels, %u nodes\n", cdlod->width, cdlod->height, cdlod->num_levels, total);
+    return 0;
+}
+
+void cdlod_free(cdlod_t* cdlod) {
+    free(cdlod->bounds);
+    cdlod->bounds = NULL;
+}
+
+/* world space box of a node, clamped to the map - see gen_vertices for the mapping */
+void cdlod_node_aabb(const cdlod_t* cdlod, uint32_t level, uint32_t nx, uint32_t ny, float x_offset, float z_scale,
+                     vec3 aabb[2]) {
+    uint32_t size = CDLOD_GRID << level;
+    uint32_t x0 = nx * size, y0 = ny * size;
+    uint32_t x1 = x0 + size < cdlod->width - 1 ? x0 + size : cdlod->width - 1;
+    uint32_t y1 = y0 + size < cdlod->height - 1 ? y0 + size : cdlod->height - 1;
+    const float* bounds = cdlod_bounds(cdlod, level, nx, ny);
+    float w_offset = (cdlod->width - 1) * cdlod->spacing / 2.f;
+    float h_offset = (cdlod->height - 1) * cdlod->spacing / 2.f;
+
+    aabb[0][0] = x0 * cdlod->spacing - w_offset + x_offset;
+    aabb[1][0] = x1 * cdlod->spacing - w_offset + x_offset;
+    aabb[0][1] = h_offset - y1 * cdlod->spacing;
+    aabb[1][1] = h_offset - y0 * cdlod->spacing;
+    aabb[0][2] = (z_scale < 0.f ? bounds[1] : bounds[0]) * z_scale;
+    aabb[1][2] = (z_scale < 0.f ? bounds[0] : bounds[1]) * z_scale;
+}
+
+/* true if the box is within range of the camera */
+bool cdlod_in_range(vec3 aabb[2], vec3 camera, float range) {
+    float d2 = 0.f;
+    int i;
+
+    for (i = 0; i < 3; ++i) {
+        float d = camera[i] < aabb[0][i] ? aabb[0][i] - camera[i] : camera[i] > aabb[1][i] ? camera[i] - aabb[1][i] : 0.f;
+        d2 += d * d;
+    }
+    return d2 <= range * range;
+}
+
+/* selects node (nx, ny) of level or its children - false if it is out of range, leaving it to its parent */
+bool cdlod_select_node(cdlod_t* cdlod, uint32_t level, uint32_t nx, uint32_t ny, vec4 planes[6], vec3 camera,
+                       float x_offset, float z_scale) {
+    uint32_t quarters = 0, q;
+    vec3 aabb[2];
+
+    /* past the edge of the map */
+    if (nx >= cdlod->nodes_x[level] || ny >= cdlod->nodes_y[level])
+        return true;
+
+    cdlod_node_aabb(cdlod, level, nx, ny, x_offset, z_scale, aabb);
+    if (level + 1 < cdlod->num_levels && !cdlod_in_range(aabb, camera, cdlod->ranges[level]))
+        return false;
+    if (!glm_aabb_frustum(aabb, planes))
+        return true;
+
+    /* children wholly beyond the next finer range are drawn here */
+    if (level == 0 || !cdlod_in_range(aabb, camera, cdlod->ranges[level - 1])) {
+        quarters = CDLOD_ALL_QUARTERS;
+    } else {
+        for (q = 0; q < 4; ++q) {
+            if (!cdlod_select_node(cdlod, level - 1, 2 * nx + q % 2, 2 * ny + q / 2, planes, camera, x_offset, z_scale))
+                quarters |= 1u << q;
+        }
+    }
+
+    if (quarters != 0 && cdlod->num_selected < CDLOD_MAX_NODES) {
+        cdlod_node_t* node = &cdlod->selection[cdlod->num_selected++];
+        node->x = nx * (CDLOD_GRID << level);
+        node->y = ny * (CDLOD_GRID << level);
+        node->level = level;
+        node->quarters = quarters;
+        cdlod->num_triangles += quarters == CDLOD_ALL_QUARTERS ? 2 * CDLOD_GRID * CDLOD_GRID
+                                                               : __builtin_popcount(quarters) * CDLOD_GRID * CDLOD_GRID / 2;
+    }
+    return true;
+}
+
+/* rebuilds the selection for the camera - z_scale takes [0, 1] altitudes to world units */
+uint32_t cdlod_select(cdlod_t* cdlod, vec4 planes[6], vec3 camera, float x_offset, float z_scale) {
+    cdlod->num_selected = 0;
+    cdlod->num_triangles = 0;
+    cdlod_select_node(cdlod, cdlod->num_levels - 1, 0, 0, planes, camera, x_offset, z_scale);
+    return cdlod->num_selected;
+}
+
+#ifdef USE_GL2
+/* draws the selection with the grid - the program must be in CDLOD mode, see vert_shader */
+void cdlod_draw(const cdlod_t* cdlod, const cdlod_grid_t* grid) {
+    uint32_t n, q;
+
+    gl_set_uniform3f(u_grid, cdlod->width - 1.f, cdlod->height - 1.f, cdlod->spacing);
+    buffer_bind(GL_ARRAY_BUFFER, grid->vbo);
+    buffer_bind(GL_ELEMENT_ARRAY_BUFFER, grid->ibo);
+    gl_set_positions(a_pos, buffer_pointer(grid->vbo, grid->vertices, 0));
+
+    for (n = 0; n < cdlod->num_selected; ++n) {
+        const cdlod_node_t* node = &cdlod->selection[n];
+        float range = cdlod->ranges[node->level];
+        float prev = node->level > 0 ? cdlod->ranges[node->level - 1] : 0.f;
+
+        gl_set_uniform4f(u_node, node->x, node->y, (float) (CDLOD_GRID << node->level), CDLOD_GRID);
+        gl_set_uniform2f(u_morph, prev + (range - prev) * CDLOD_MORPH_START, range);
+
+        if (node->quarters == CDLOD_ALL_QUARTERS) {
+            glDrawElements(GL_TRIANGLE_STRIP, grid->num_indices, GL_UNSIGNED_SHORT, buffer_pointer(grid->ibo, grid->indices, 0));
+            continue;
+        }
+        for (q = 0; q < 4; ++q) {
+            if (node->quarters & (1u << q))
+                glDrawElements(GL_TRIANGLE_STRIP, grid->quarter_count[q], GL_UNSIGNED_SHORT,
+                               buffer_pointer(grid->ibo, grid->indices, grid->quarter_first[q] * sizeof(uint16_t)));
+        }
+    }
+}
+#endif
+
+#endif /* _CDLOD_H_ */
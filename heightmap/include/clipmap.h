@@ -0,0 +1,351 @@
+#ifndef _CLIPMAP_H_
+#define _CLIPMAP_H_
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "buffers.h"
+#include "glversion.h"
+#include "hmap.h"
+#include "strip.h"
+#include "terrain.h"
+
+/*      geometry clipmap
+ * ---------------------------------
+ * Nested square windows centred on the camera. Level l samples every 2^l
+ * samples of the map over CLIPMAP_GRID quads, so every level has the same
+ * vertex count and the frame has a fixed budget whatever the map size.
+ * Level 0 is drawn whole, every coarser level as a ring around the hole the
+ * finer level fills.
+ *
+ * Each level keeps its window in a CLIPMAP_TEXELS square texture addressed
+ * toroidally - level sample (u, v) lives in texel (u mod N, v mod N) and the
+ * shader relies on GL_REPEAT to wrap. When the camera moves, only the rows
+ * and columns that came into view (an L shaped strip) are uploaded, over the
+ * texels of the ones that left.
+ *
+ * Window origins are snapped to even samples of their level, so a finer
+ * window starts GRID / 4 or GRID / 4 + 1 samples into the coarser one - the
+ * hole is at one of four offsets and each has a prebuilt ring. Odd
+ * vertices near the outer edge of a level morph onto their even neighbours,
+ * position and height, so the edge matches the coarser ring. The morph is
+ * measured from the camera - the window is up to 2 samples off it, so the
+ * morph is complete that far inside the edge.
+ */
+#define CLIPMAP_TEXELS 256u             /* power of two - GLES2 only repeats those */
+#define CLIPMAP_GRID 252u               /* quads across a level, a multiple of 4 within the texture */
+#define CLIPMAP_GRID_VERTICES ((CLIPMAP_GRID + 1) * (CLIPMAP_GRID + 1))
+#define CLIPMAP_MAX_LEVELS 12
+#define CLIPMAP_MORPH_WIDTH (CLIPMAP_GRID / 10) /* quads over which the outer edge of a level morphs */
+
+/* ring 0 is the whole grid, ring 1 + x + 2 * y has its hole at (GRID / 4 + x, GRID / 4 + y) */
+#define CLIPMAP_RINGS 5
+
+typedef struct {
+    GLuint texture;
+    int32_t x, y;           /* window origin in level samples - the texture holds [x, x + CLIPMAP_TEXELS) */
+    bool valid;             /* false until the texture is first filled */
+} clipmap_level_t;
+
+typedef struct {
+    vec2* vertices;         /* CLIPMAP_GRID_VERTICES, in grid quads */
+    uint16_t* indices;
+    uint32_t ring_first[CLIPMAP_RINGS], ring_count[CLIPMAP_RINGS];
+    uint32_t ring_triangles[CLIPMAP_RINGS];
+#ifdef USE_GL2
+    GLuint vbo, ibo;
+#endif
+} clipmap_grid_t;
+
+typedef struct {
+    const hmap_t* hmap;
+    float spacing;          /* world units between samples */
+    uint32_t num_levels;
+    clipmap_level_t levels[CLIPMAP_MAX_LEVELS];
+    uint8_t* scratch;       /* samples gathered for one upload */
+    /* reset by every clipmap_update */
+    uint32_t uploads, bytes_uploaded;
+    uint32_t num_triangles;
+} clipmap_t;
+
+clipmap_grid_t clipmap_grid;
+
+/* appends a blocked strip over the quads [x, x + w) x [y, y + h) of the grid, joined to the indices before it by
+ * a degenerate pair - returns the new index count, only counting if indices is NULL
+ */
+uint32_t clipmap_gen_rect(uint16_t* indices, uint32_t n, uint32_t x, uint32_t y, uint32_t w, uint32_t h) {
+    uint32_t count, i;
+    uint16_t* out;
+
+    if (w == 0 || h == 0)
+        return n;
+
+    count = strip_blocked_num_indices(h + 1, w + 1, TERRAIN_STRIP_BLOCK);
+    if (indices == NULL)
+        return n + (n > 0 ? 2 + n % 2 : 0) + count;
+
+    if (n > 0) {
+        uint16_t last = indices[n - 1];
+        uint32_t pad = n % 2;
+
+        indices[n++] = last;
+        if (pad)
+            indices[n++] = last;
+        indices[n++] = y * (CLIPMAP_GRID + 1) + x;
+    }
+
+    out = indices + n;
+    gen_strip_blocked(out, h + 1, w + 1, TERRAIN_STRIP_BLOCK);
+    for (i = 0; i < count; ++i)
+        out[i] = (y + out[i] / (w + 1)) * (CLIPMAP_GRID + 1) + x + out[i] % (w + 1);
+    return n + count;
+}
+
+/* ring around a hole of hole_size quads at (hole_x, hole_y) - the rows above and below, then the sides */
+uint32_t clipmap_gen_ring(uint16_t* indices, uint32_t n, uint32_t hole_x, uint32_t hole_y, uint32_t hole_size) {
+    uint32_t below = hole_y + hole_size;
+
+    if (hole_size == 0)
+        return clipmap_gen_rect(indices, n, 0, 0, CLIPMAP_GRID, CLIPMAP_GRID);
+
+    n = clipmap_gen_rect(indices, n, 0, 0, CLIPMAP_GRID, hole_y);
+    n = clipmap_gen_rect(indices, n, 0, hole_y, hole_x, hole_size);
+    n = clipmap_gen_rect(indices, n, hole_x + hole_size, hole_y, CLIPMAP_GRID - hole_x - hole_size, hole_size);
+    return clipmap_gen_rect(indices, n, 0, below, CLIPMAP_GRID, CLIPMAP_GRID - below);
+}
+
+/* indices of ring r, only counted if indices is NULL */
+uint32_t clipmap_gen_ring_variant(uint16_t* indices, uint32_t r) {
+    uint32_t hole = CLIPMAP_GRID / 2;
+    if (r == 0)
+        return clipmap_gen_ring(indices, 0, 0, 0, 0);
+    return clipmap_gen_ring(indices, 0, hole / 2 + (r - 1) % 2, hole / 2 + (r - 1) / 2, hole);
+}
+
+/* builds the grid shared by every level and map, with a strip per ring */
+int clipmap_grid_init(clipmap_grid_t* grid) {
+    uint32_t hole = CLIPMAP_GRID / 2, r, c, n = 0;
+
+    for (r = 0; r < CLIPMAP_RINGS; ++r)
+        n += clipmap_gen_ring_variant(NULL, r);
+    grid->vertices = malloc(CLIPMAP_GRID_VERTICES * sizeof(vec2));
+    grid->indices = malloc(n * sizeof(uint16_t));
+    if (grid->vertices == NULL || grid->indices == NULL) {
+        printf("ERROR could not allocate clipmap grid\n");
+        return -1;
+    }
+
+    for (r = 0; r <= CLIPMAP_GRID; ++r) {
+        for (c = 0; c <= CLIPMAP_GRID; ++c) {
+            grid->vertices[r * (CLIPMAP_GRID + 1) + c][0] = c;
+            grid->vertices[r * (CLIPMAP_GRID + 1) + c][1] = r;
+        }
+    }
+
+    /* each ring is its own strip, drawn on its own */
+    n = 0;
+    for (r = 0; r < CLIPMAP_RINGS; ++r) {
+        grid->ring_first[r] = n;
+        grid->ring_count[r] = clipmap_gen_ring_variant(grid->indices + n, r);
+        grid->ring_triangles[r] = 2 * (CLIPMAP_GRID * CLIPMAP_GRID - (r == 0 ? 0 : hole * hole));
+        n += grid->ring_count[r];
+    }
+
+#ifdef USE_GL2
+    if (buffer_create(&grid->vbo, GL_ARRAY_BUFFER, grid->vertices, CLIPMAP_GRID_VERTICES * sizeof(vec2)) == -1
+        || buffer_create(&grid->ibo, GL_ELEMENT_ARRAY_BUFFER, grid->indices, n * sizeof(uint16_t)) == -1)
+        return -1;
+#endif
+    return 0;
+}
+
+void clipmap_grid_free(clipmap_grid_t* grid) {
+#ifdef USE_GL2
+    buffer_delete(&grid->vbo);
+    buffer_delete(&grid->ibo);
+#endif
+    free(grid->vertices);
+    free(grid->indices);
+    grid->vertices = NULL;
+    grid->indices = NULL;
+}
+
+/* copies level samples [x, x + w) x [y, y + h) into out, row by row - samples past the map repeat its edge */
+void clipmap_gather(const clipmap_t* clipmap, uint32_t level, int32_t x, int32_t y, uint32_t w, uint32_t h,
+                    uint8_t* out) {
+    const hmap_t* hmap = clipmap->hmap;
+    uint32_t size = hmap_sample_size(hmap->type), r, c;
+    int32_t step = 1 << level;
+
+    for (r = 0; r < h; ++r) {
+        int32_t v = (y + (int32_t) r) * step;
+        const uint8_t* row = hmap_row(hmap, v < 0 ? 0 : v >= (int32_t) hmap->height ? hmap->height - 1 : v);
+
+        for (c = 0; c < w; ++c) {
+            int32_t u = (x + (int32_t) c) * step;
+            u = u < 0 ? 0 : u >= (int32_t) hmap->width ? hmap->width - 1 : u;
+            memcpy(out, row + u * size, size);
+            out += size;
+        }
+    }
+}
+
+#ifdef USE_GL2
+/* creates a texture per level - they are filled by the first clipmap_update */
+int clipmap_init(clipmap_t* clipmap, const hmap_t* hmap, float spacing) {
+    GLenum format = hmap->type == HMAP_U16 ? GL_RG : GL_RED;
+    uint32_t size = hmap->width > hmap->height ? hmap->width : hmap->height, l;
+
+    memset(clipmap, 0, sizeof(*clipmap));
+    clipmap->hmap = hmap;
+    clipmap->spacing = spacing;
+
+    /* levels until the coarsest window spans the map from any point on it */
+    do {
+        ++clipmap->num_levels;
+    } while (clipmap->num_levels < CLIPMAP_MAX_LEVELS && (CLIPMAP_GRID << (clipmap->num_levels - 1)) < 2 * size);
+
+    clipmap->scratch = malloc(CLIPMAP_TEXELS * CLIPMAP_TEXELS * hmap_sample_size(hmap->type));
+    if (clipmap->scratch == NULL) {
+        printf("ERROR could not allocate clipmap upload buffer\n");
+        return -1;
+    }
+
+    for (l = 0; l < clipmap->num_levels; ++l) {
+        glGenTextures(1, &clipmap->levels[l].texture);
+        gl_bind_texture(0, clipmap->levels[l].texture);
+
+        /* texture params - repeat is the toroidal addressing, samples are read at texel centres */
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexImage2D(GL_TEXTURE_2D, 0, format, CLIPMAP_TEXELS, CLIPMAP_TEXELS, 0, format, GL_UNSIGNED_BYTE, NULL);
+    }
+
+    printf("Clipmap over %ux%u: %u levels of %u quads\n", hmap->width, hmap->height, clipmap->num_levels,
+           CLIPMAP_GRID);
+    return 0;
+}
+
+void clipmap_free(clipmap_t* clipmap) {
+    uint32_t l;
+    for (l = 0; l < clipmap->num_levels; ++l) {
+        gl_forget_texture(clipmap->levels[l].texture);
+        glDeleteTextures(1, &clipmap->levels[l].texture);
+    }
+    free(clipmap->scratch);
+    clipmap->scratch = NULL;
+    clipmap->num_levels = 0;
+}
+
+/* uploads level samples [x, x + w) x [y, y + h) to their toroidal texels - split where they wrap, so up to four
+ * rectangles - the level's texture must be bound
+ */
+void clipmap_upload(clipmap_t* clipmap, uint32_t level, int32_t x, int32_t y, uint32_t w, uint32_t h) {
+    GLenum format = clipmap->hmap->type == HMAP_U16 ? GL_RG : GL_RED;
+    uint32_t size = hmap_sample_size(clipmap->hmap->type), tx, ty, i, j;
+    uint32_t xs[2], ws[2], ys[2], hs[2];
+
+    /* first texel of each part, then its size */
+    tx = (uint32_t) x & (CLIPMAP_TEXELS - 1);
+    ty = (uint32_t) y & (CLIPMAP_TEXELS - 1);
+    ws[0] = tx + w > CLIPMAP_TEXELS ? CLIPMAP_TEXELS - tx : w;
+    hs[0] = ty + h > CLIPMAP_TEXELS ? CLIPMAP_TEXELS - ty : h;
+    ws[1] = w - ws[0];
+    hs[1] = h - hs[0];
+    xs[0] = tx;
+    ys[0] = ty;
+    xs[1] = ys[1] = 0;
+
+    gl_set_unpack_alignment(1);
+    for (j = 0; j < 2; ++j) {
+        for (i = 0; i < 2; ++i) {
+            if (ws[i] == 0 || hs[j] == 0)
+                continue;
+            clipmap_gather(clipmap, level, x + (i ? ws[0] : 0), y + (j ? hs[0] : 0), ws[i], hs[j], clipmap->scratch);
+            glTexSubImage2D(GL_TEXTURE_2D, 0, xs[i], ys[j], ws[i], hs[j], format, GL_UNSIGNED_BYTE, clipmap->scratch);
+            ++clipmap->uploads;
+            clipmap->bytes_uploaded += ws[i] * hs[j] * size;
+        }
+    }
+}
+
+/* moves a level's window to (x, y), uploading the columns and rows that came into view */
+void clipmap_move_level(clipmap_t* clipmap, uint32_t l, int32_t x, int32_t y) {
+    clipmap_level_t* level = &clipmap->levels[l];
+    int32_t n = CLIPMAP_TEXELS, dx = x - level->x, dy = y - level->y;
+
+    if (level->valid && dx == 0 && dy == 0)
+        return;
+
+    gl_bind_texture(0, level->texture);
+    if (!level->valid || abs(dx) >= n || abs(dy) >= n) {
+        clipmap_upload(clipmap, l, x, y, n, n);
+    } else {
+        /* new columns over every row of the new window */
+        if (dx != 0)
+            clipmap_upload(clipmap, l, dx > 0 ? level->x + n : x, y, abs(dx), n);
+        /* new rows over the columns both windows share */
+        if (dy != 0)
+            clipmap_upload(clipmap, l, dx > 0 ? x : level->x, dy > 0 ? level->y + n : y, n - abs(dx), abs(dy));
+    }
+
+    level->x = x;
+    level->y = y;
+    level->valid = true;
+}
+
+/* recentres every level on the camera - x_offset is the world offset the map is drawn at */
+void clipmap_update(clipmap_t* clipmap, vec3 camera, float x_offset) {
+    const hmap_t* hmap = clipmap->hmap;
+    /* world to level 0 samples, see gen_vertices */
+    float cx = (camera[0] - x_offset + (hmap->width - 1) * clipmap->spacing / 2.f) / clipmap->spacing;
+    float cy = ((hmap->height - 1) * clipmap->spacing / 2.f - camera[1]) / clipmap->spacing;
+    uint32_t l;
+
+    clipmap->uploads = clipmap->bytes_uploaded = 0;
+    for (l = 0; l < clipmap->num_levels; ++l) {
+        float step = 2.f * (1u << l);
+        int32_t x = 2 * (int32_t) floorf(cx / step) - CLIPMAP_GRID / 2;
+        int32_t y = 2 * (int32_t) floorf(cy / step) - CLIPMAP_GRID / 2;
+        clipmap_move_level(clipmap, l, x, y);
+    }
+}
+
+/* draws every level, finest first - the program must be in clipmap mode, see vert_shader */
+void clipmap_draw(clipmap_t* clipmap, const clipmap_grid_t* grid) {
+    const hmap_t* hmap = clipmap->hmap;
+    uint32_t l, ring;
+
+    gl_set_uniform3f(u_grid, hmap->width - 1.f, hmap->height - 1.f, clipmap->spacing);
+    gl_set_uniform4f(u_atlas, 0.5f / CLIPMAP_TEXELS, 0.5f / CLIPMAP_TEXELS, 1.f / CLIPMAP_TEXELS, 1.f / CLIPMAP_TEXELS);
+    gl_set_uniform2f(u_morph, CLIPMAP_GRID / 2 - CLIPMAP_MORPH_WIDTH - 2.f, CLIPMAP_GRID / 2 - 2.f);
+    buffer_bind(GL_ARRAY_BUFFER, grid->vbo);
+    buffer_bind(GL_ELEMENT_ARRAY_BUFFER, grid->ibo);
+    gl_set_positions(a_pos, buffer_pointer(grid->vbo, grid->vertices, 0));
+
+    clipmap->num_triangles = 0;
+    for (l = 0; l < clipmap->num_levels; ++l) {
+        const clipmap_level_t* level = &clipmap->levels[l];
+
+        /* the finer window sits GRID / 4 or one more coarse sample in from this one */
+        ring = 0;
+        if (l > 0) {
+            const clipmap_level_t* finer = &clipmap->levels[l - 1];
+            ring = 1 + (finer->x / 2 - level->x - CLIPMAP_GRID / 4) + 2 * (finer->y / 2 - level->y - CLIPMAP_GRID / 4);
+        }
+
+        gl_bind_texture(0, level->texture);
+        gl_set_uniform4f(u_node, (float) level->x * (1u << l), (float) level->y * (1u << l), (float) (1u << l), CLIPMAP_GRID);
+        glDrawElements(GL_TRIANGLE_STRIP, grid->ring_count[ring], GL_UNSIGNED_SHORT,
+                       buffer_pointer(grid->ibo, grid->indices, grid->ring_first[ring] * sizeof(uint16_t)));
+        clipmap->num_triangles += grid->ring_triangles[ring];
+    }
+}
+#endif
+
+#endif /* _CLIPMAP_H_ */
@@ -0,0 +1,174 @@
+#ifndef _GL_DEBUG_H_
+#define _GL_DEBUG_H_
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/*      GL error reporting
+ * ---------------------------------
+ * glGetError has to wait for the driver to work through every call made
+ * before it, so checking it each frame keeps the CPU in step with the GPU.
+ * With KHR_debug (core in GL 4.3 and ES 3.2) the driver reports errors to a
+ * callback as it finds them, and a frame only looks at the count the callback
+ * keeps. Without it glGetError is sampled every GL_DEBUG_CHECK_FRAMES frames.
+ *
+ * Builds without NDEBUG ask for a debug context, make debug output
+ * synchronous so the callback runs inside the failing call, and sample
+ * every frame. Release builds (make RELEASE=1, which sets NDEBUG) leave the
+ * pipeline asynchronous. Either way the first frame seeing an error fails.
+ *
+ * Allocations checking for GL_OUT_OF_MEMORY report older errors first with
+ * gl_debug_flush and read their own with gl_out_of_memory, so a pending
+ * error is never taken for theirs and dropped.
+ *
+ * Included by glversion.h once the GL headers are in.
+ */
+#ifndef GL_DEBUG_CHECK_FRAMES
+#ifdef NDEBUG
+#define GL_DEBUG_CHECK_FRAMES 100
+#else
+#define GL_DEBUG_CHECK_FRAMES 1
+#endif
+#endif
+
+/* KHR_debug - not in the GL 1.3 or ES 2.0 headers */
+#ifndef GL_DEBUG_OUTPUT
+#define GL_DEBUG_OUTPUT                 0x92E0
+#define GL_DEBUG_OUTPUT_SYNCHRONOUS     0x8242
+#define GL_DEBUG_TYPE_ERROR             0x824C
+#define GL_DEBUG_SEVERITY_NOTIFICATION  0x826B
+#endif
+#ifdef USE_GL1
+#define GL_DEBUG_APIENTRY GLAPIENTRY
+#else
+#define GL_DEBUG_APIENTRY GL_APIENTRY
+#endif
+typedef void (GL_DEBUG_APIENTRY *gl_debug_proc_t)(GLenum source, GLenum type, GLuint id, GLenum severity,
+                                                  GLsizei length, const GLchar* message, const void* user);
+typedef void (GL_DEBUG_APIENTRY *gl_debug_message_callback_t)(gl_debug_proc_t callback, const void* user);
+typedef void (GL_DEBUG_APIENTRY *gl_debug_message_control_t)(GLenum source, GLenum type, GLenum severity,
+                                                             GLsizei count, const GLuint* ids, GLboolean enabled);
+
+typedef struct {
+    bool output;            /* errors come from the callback, else from sampled glGetError */
+    atomic_uint errors;     /* reported by the callback, possibly from a driver thread */
+    uint32_t frames;
+} gl_debug_t;
+
+gl_debug_t gl_debug;
+
+void GL_DEBUG_APIENTRY gl_debug_callback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length,
+                                         const GLchar* message, const void* user) {
+    if (type == GL_DEBUG_TYPE_ERROR) {
+        printf("OpenGL error 0x%04x: %s\n", id, message);
+        atomic_fetch_add_explicit(&gl_debug.errors, 1, memory_order_relaxed);
+    } else {
+        printf("WARNING OpenGL: %s\n", message);
+    }
+}
+
+/* true if the context is at least major.minor of its API */
+bool gl_debug_version(int major, int minor) {
+    const char* version = (const char*) glGetString(GL_VERSION);
+    int ma = 0, mi = 0;
+
+    if (version == NULL)
+        return false;
+#ifdef USE_GL2
+    if (sscanf(version, "OpenGL ES %d.%d", &ma, &mi) != 2)
+        return false;
+#else
+    if (sscanf(version, "%d.%d", &ma, &mi) != 2)
+        return false;
+#endif
+    return ma > major || (ma == major && mi >= minor);
+}
+
+/* installs the callback if the context has debug output, else falls back to sampling glGetError */
+void gl_debug_init(void) {
+    gl_debug_message_callback_t callback = NULL;
+    gl_debug_message_control_t control = NULL;
+
+    memset(&gl_debug, 0, sizeof(gl_debug));
+#ifdef USE_GL2
+    if (gl_debug_version(3, 2)) {
+#else
+    if (gl_debug_version(4, 3)) {
+#endif
+        callback = (gl_debug_message_callback_t) glfwGetProcAddress("glDebugMessageCallback");
+        control = (gl_debug_message_control_t) glfwGetProcAddress("glDebugMessageControl");
+    } else if (gl_has_extension("GL_KHR_debug")) {
+        /* suffixed on ES, not on desktop GL */
+#ifdef USE_GL2
+        callback = (gl_debug_message_callback_t) glfwGetProcAddress("glDebugMessageCallbackKHR");
+        control = (gl_debug_message_control_t) glfwGetProcAddress("glDebugMessageControlKHR");
+#else
+        callback = (gl_debug_message_callback_t) glfwGetProcAddress("glDebugMessageCallback");
+        control = (gl_debug_message_control_t) glfwGetProcAddress("glDebugMessageControl");
+#endif
+    }
+
+    if (callback == NULL) {
+        printf("GL errors sampled every %d frames\n", GL_DEBUG_CHECK_FRAMES);
+        return;
+    }
+
+    callback(gl_debug_callback, NULL);
+    if (control != NULL)
+        control(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, NULL, GL_FALSE);
+    glEnable(GL_DEBUG_OUTPUT);
+#ifndef NDEBUG
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+#endif
+    gl_debug.output = true;
+    printf("GL errors from debug output\n");
+}
+
+/* reports an error read with glGetError, failing the next gl_debug_check - debug output already printed it */
+void gl_debug_error(GLenum error) {
+    if (!gl_debug.output)
+        printf("OpenGL errorcode 0x%04x\n", error);
+    atomic_fetch_add_explicit(&gl_debug.errors, 1, memory_order_relaxed);
+}
+
+/* reports every pending error - before a call whose own error is checked, so older ones are not mistaken for it */
+void gl_debug_flush(void) {
+    GLenum error;
+    while ((error = glGetError()) != GL_NO_ERROR)
+        gl_debug_error(error);
+}
+
+/* true if a call since the last gl_debug_flush ran out of memory, other errors are reported */
+bool gl_out_of_memory(void) {
+    GLenum error;
+    bool out_of_memory = false;
+
+    while ((error = glGetError()) != GL_NO_ERROR) {
+        if (error == GL_OUT_OF_MEMORY)
+            out_of_memory = true;
+        else
+            gl_debug_error(error);
+    }
+    return out_of_memory;
+}
+
+/* -1 once an error was reported - with debug output this never waits on the driver */
+int gl_debug_check(void) {
+    GLenum error;
+
+    if (atomic_load_explicit(&gl_debug.errors, memory_order_relaxed) != 0)
+        return -1;
+    if (gl_debug.output || ++gl_debug.frames % GL_DEBUG_CHECK_FRAMES != 0)
+        return 0;
+    error = glGetError();
+    if (error != GL_NO_ERROR) {
+        printf("OpenGL errorcode 0x%04x\n", error);
+        return -1;
+    }
+    return 0;
+}
+
+#endif /* _GL_DEBUG_H_ */
@@ -0,0 +1,214 @@
+#ifndef _GL_STATE_H_
+#define _GL_STATE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/*      GL state cache
+ * ---------------------------------
+ * State set every frame goes through the calls below. Each keeps the last
+ * value it sent and drops calls that would not change it, since the driver
+ * validates a call whether or not it changes anything - with hundreds of
+ * patches or nodes a frame most uniform, bind and pointer calls repeat what
+ * is already set. Calls issued and filtered are counted for the reports.
+ *
+ * State changed behind the cache's back is not seen, so every bind goes
+ * through here and deleted objects are dropped with gl_forget_buffer and
+ * gl_forget_texture. gl_state_reset forgets everything.
+ *
+ * Included by glversion.h once the GL headers are in.
+ */
+#define GL_STATE_UNIFORMS 32    /* float uniform locations cached, higher ones are always sent */
+#define GL_STATE_UNITS    3     /* texture units - the atlas or clipmap level, the tile pages and their table */
+#define GL_STATE_UNKNOWN  0xffffffffu
+
+typedef struct {
+    GLint viewport[4];
+#ifdef USE_GL1
+    float projection[16], modelview[16];
+    bool matrices_valid;
+#endif
+#ifdef USE_GL2
+    float uniforms[GL_STATE_UNIFORMS][16];
+    uint8_t uniform_size[GL_STATE_UNIFORMS];    /* floats last sent to the location, 0 when unknown */
+    uint32_t unit;                              /* active texture unit */
+    GLuint textures[GL_STATE_UNITS];
+    GLuint array_buffer, element_buffer, unpack_buffer;
+    GLint unpack_alignment;
+    /* last glVertexAttribPointer of a_pos, with the array buffer it was made against */
+    GLuint attrib_buffer;
+    const void* attrib_pointer;
+    bool attrib_valid;
+#endif
+    /* calls that reached the driver and calls dropped, reset by whoever reports them */
+    uint32_t issued, filtered;
+} gl_state_t;
+
+gl_state_t gl_state;
+
+/* forgets every cached value, so the next call of each kind is sent */
+void gl_state_reset(void) {
+    uint32_t issued = gl_state.issued, filtered = gl_state.filtered;
+
+    memset(&gl_state, 0, sizeof(gl_state));
+    gl_state.viewport[2] = -1;
+#ifdef USE_GL2
+    memset(gl_state.textures, 0xff, sizeof(gl_state.textures));
+    gl_state.unit = GL_STATE_UNKNOWN;
+    gl_state.array_buffer = gl_state.element_buffer = gl_state.unpack_buffer = GL_STATE_UNKNOWN;
+#endif
+    gl_state.issued = issued;
+    gl_state.filtered = filtered;
+}
+
+/* true if the call can be dropped, counting it either way */
+bool gl_state_filter(bool unchanged) {
+    if (unchanged)
+        ++gl_state.filtered;
+    else
+        ++gl_state.issued;
+    return unchanged;
+}
+
+void gl_set_viewport(GLint x, GLint y, GLint width, GLint height) {
+    GLint viewport[4] = { x, y, width, height };
+
+    if (gl_state_filter(memcmp(gl_state.viewport, viewport, sizeof(viewport)) == 0))
+        return;
+    memcpy(gl_state.viewport, viewport, sizeof(viewport));
+    glViewport(x, y, width, height);
+}
+
+#ifdef USE_GL1
+/* loads both matrices, leaving the modelview current for the draws */
+void gl_set_matrices(const float* projection, const float* modelview) {
+    bool valid = gl_state.matrices_valid;
+
+    if (!gl_state_filter(valid && memcmp(gl_state.projection, projection, sizeof(gl_state.projection)) == 0)) {
+        glMatrixMode(GL_PROJECTION);
+        glLoadMatrixf(projection);
+        glMatrixMode(GL_MODELVIEW);
+        memcpy(gl_state.projection, projection, sizeof(gl_state.projection));
+    }
+    if (!gl_state_filter(valid && memcmp(gl_state.modelview, modelview, sizeof(gl_state.modelview)) == 0)) {
+        glLoadMatrixf(modelview);
+        memcpy(gl_state.modelview, modelview, sizeof(gl_state.modelview));
+    }
+    gl_state.matrices_valid = true;
+}
+#endif
+
+#ifdef USE_GL2
+/* sends size floats (1 to 4, or 16 for a matrix) to a float uniform of the program in use */
+void gl_set_uniform(GLint location, uint32_t size, const float* value) {
+    if (location < 0)
+        return;
+    if (location < GL_STATE_UNIFORMS) {
+        if (gl_state_filter(gl_state.uniform_size[location] == size
+                            && memcmp(gl_state.uniforms[location], value, size * sizeof(float)) == 0))
+            return;
+        gl_state.uniform_size[location] = (uint8_t) size;
+        memcpy(gl_state.uniforms[location], value, size * sizeof(float));
+    } else {
+        ++gl_state.issued;
+    }
+
+    switch (size) {
+    case 1:  glUniform1fv(location, 1, value); break;
+    case 2:  glUniform2fv(location, 1, value); break;
+    case 3:  glUniform3fv(location, 1, value); break;
+    case 4:  glUniform4fv(location, 1, value); break;
+    case 16: glUniformMatrix4fv(location, 1, false, value); break;
+    }
+}
+
+void gl_set_uniform1f(GLint location, float x) {
+    gl_set_uniform(location, 1, &x);
+}
+
+void gl_set_uniform2f(GLint location, float x, float y) {
+    float v[2] = { x, y };
+    gl_set_uniform(location, 2, v);
+}
+
+void gl_set_uniform3f(GLint location, float x, float y, float z) {
+    float v[3] = { x, y, z };
+    gl_set_uniform(location, 3, v);
+}
+
+void gl_set_uniform4f(GLint location, float x, float y, float z, float w) {
+    float v[4] = { x, y, z, w };
+    gl_set_uniform(location, 4, v);
+}
+
+/* binds a 2D texture to unit, making it the active unit for uploads */
+void gl_bind_texture(uint32_t unit, GLuint texture) {
+    if (gl_state.unit != unit) {
+        glActiveTexture(GL_TEXTURE0 + unit);
+        gl_state.unit = unit;
+    }
+    if (gl_state_filter(gl_state.textures[unit] == texture))
+        return;
+    gl_state.textures[unit] = texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+}
+
+GLuint* gl_buffer_binding(GLenum target) {
+    switch (target) {
+    case GL_ARRAY_BUFFER:         return &gl_state.array_buffer;
+    case GL_ELEMENT_ARRAY_BUFFER: return &gl_state.element_buffer;
+    default:                      return &gl_state.unpack_buffer;
+    }
+}
+
+/* binds buffer to GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER or GL_PIXEL_UNPACK_BUFFER */
+void gl_bind_buffer(GLenum target, GLuint buffer) {
+    GLuint* binding = gl_buffer_binding(target);
+
+    if (gl_state_filter(*binding == buffer))
+        return;
+    *binding = buffer;
+    glBindBuffer(target, buffer);
+}
+
+void gl_set_unpack_alignment(GLint alignment) {
+    if (gl_state_filter(gl_state.unpack_alignment == alignment))
+        return;
+    gl_state.unpack_alignment = alignment;
+    glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+}
+
+/* points a_pos at tightly packed vec2s - an offset into the bound array buffer, or client memory without one */
+void gl_set_positions(GLint attrib, const void* pointer) {
+    if (gl_state_filter(gl_state.attrib_valid && gl_state.attrib_buffer == gl_state.array_buffer
+                        && gl_state.attrib_pointer == pointer))
+        return;
+    gl_state.attrib_valid = true;
+    gl_state.attrib_buffer = gl_state.array_buffer;
+    gl_state.attrib_pointer = pointer;
+    glVertexAttribPointer(attrib, 2, GL_FLOAT, false, 0, pointer);
+}
+
+/* drops a buffer about to be deleted - deleting unbinds it, which the cache would not see */
+void gl_forget_buffer(GLuint buffer) {
+    if (gl_state.array_buffer == buffer)
+        gl_state.array_buffer = GL_STATE_UNKNOWN;
+    if (gl_state.element_buffer == buffer)
+        gl_state.element_buffer = GL_STATE_UNKNOWN;
+    if (gl_state.unpack_buffer == buffer)
+        gl_state.unpack_buffer = GL_STATE_UNKNOWN;
+    if (gl_state.attrib_buffer == buffer)
+        gl_state.attrib_valid = false;
+}
+
+void gl_forget_texture(GLuint texture) {
+    uint32_t i;
+    for (i = 0; i < GL_STATE_UNITS; ++i) {
+        if (gl_state.textures[i] == texture)
+            gl_state.textures[i] = GL_STATE_UNKNOWN;
+    }
+}
+#endif
+
+#endif /* _GL_STATE_H_ */
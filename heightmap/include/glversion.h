@@ -1,7 +1,9 @@
-#ifndef _GLVERSION_H_
+#ifndef _GL_VERSION_H_
 #define _GL_VERSION_H_
 
+#include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <cglm/cglm.h>
 #include <GLFW/glfw3.h>
@@ -29,24 +31,145 @@
 int success;
 char infoLog[512];
 GLuint fragShader, vertShader, shaderProgram;
-GLint u_mvp, a_pos, a_tex;
+GLint u_mvp, u_atlas, u_offset, u_mode, u_node, u_morph, u_grid, u_camera, u_tex, u_lod_range, u_max_lod, a_pos;
+GLint u_heightmap, u_height_unpack, u_alt_scale;
+GLint u_tiles, u_tile_table, u_stream, u_table, u_pages;
+
+/* ES 3.0 entry points missing from the ES 2.0 headers - loaded by gl_load_procs when the context has them */
+#ifndef GL_PIXEL_UNPACK_BUFFER
+#define GL_PIXEL_UNPACK_BUFFER       0x88EC
+#define GL_MAP_WRITE_BIT             0x0002
+#define GL_MAP_INVALIDATE_BUFFER_BIT 0x0008
+#endif
+#ifndef GL_R8
+#define GL_R8  0x8229
+#define GL_RG8 0x822B
+#endif
+typedef void* (GL_APIENTRYP gl_map_buffer_range_t)(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+typedef GLboolean (GL_APIENTRYP gl_unmap_buffer_t)(GLenum target);
+typedef void (GL_APIENTRYP gl_tex_storage_2d_t)(GLenum target, GLsizei levels, GLenum format, GLsizei width, GLsizei height);
+gl_map_buffer_range_t gl_map_buffer_range = NULL;
+gl_unmap_buffer_t gl_unmap_buffer = NULL;
+gl_tex_storage_2d_t gl_tex_storage_2d = NULL; /* also from EXT_texture_storage on 2.0, NULL without either */
+bool gl_es3 = false;
+bool gl_npot_mips = false;                  /* mipmaps of non power of two textures, core in 3.0 */
 const char* vert_shader =
 "uniform sampler2D heightmap;\n"
+"uniform vec2 height_unpack;\n" /* (1, 0) for 8 bit, weights of the (low, high) bytes for 16 bit */
 "uniform float alt_scale;\n"
 "uniform mat4 u_mvp;\n"
+"uniform vec4 u_atlas;\n" /* atlas region of the drawn map - texel centre offset xy, scale zw */
+"uniform vec2 u_offset;\n" /* world offset of the drawn map */
+"\n"
+"uniform float u_mode;\n" /* 0 patches, 1 CDLOD, 2 clipmap */
+"\n"
+/* patch mode - a_pos is a world position of the grid, u_tex maps it to the map texture in [0, 1], see gl_grid_tex */
+"uniform vec4 u_tex;\n" /* scale xy, bias zw */
+"uniform float u_lod_range;\n" /* distance mip 0 is fetched out to, doubling per level - 0 for mip 0 everywhere */
+/* CDLOD mode - a_pos is the position in a node's grid in [0, 1], see cdlod.h
+ * clipmap mode - a_pos is a vertex of a level's grid in quads, u_atlas maps level samples to its texture, see clipmap.h
+ */
+"uniform vec4 u_node;\n" /* origin xy and sample step (CDLOD node size) z in samples, grid quads w */
+"uniform vec2 u_morph;\n" /* distances (clipmap grid quads from the camera) the morph to the next level starts and ends at */
+"uniform vec3 u_grid;\n" /* last sample xy, world units between samples z */
+"uniform vec3 u_camera;\n"
+"uniform float u_max_lod;\n" /* coarsest mip fetched, see atlas_max_lod */
+"\n"
+/* streamed tiles of the drawn map, see tiletex.h */
+"uniform sampler2D tiles;\n" /* a page per tileset slot */
+"uniform sampler2D tile_table;\n" /* page of each tile, rg page xy and a 1 once uploaded - levels stacked in y */
+"uniform vec4 u_stream;\n" /* tile size in quads x, levels y (0 when the map is not streamed), last sample zw */
+"uniform vec3 u_table;\n" /* table rows per level x, 1 / table size yz */
+"uniform vec2 u_pages;\n" /* 1 / page texture size */
 "\n"
 "attribute vec2 a_pos;\n"
-"attribute vec2 a_tex;\n"
 "\n"
 "varying vec3 v_col;\n"
 // "varying vec2 v_tex;\n"
+"float sample_height(vec2 tex, float lod) {\n"
+"   return dot(texture2DLod(heightmap, tex, lod).rg, height_unpack);\n"
+"}\n"
+"bool tile_height(vec2 s, float l, out float height) {\n" /* sample s of level l's tile, false if not uploaded */
+"   float step = exp2(l);\n"
+"   vec2 q = clamp(s, vec2(0.0), u_stream.zw) / step;\n" /* level l samples */
+"   vec2 t = min(floor(q / u_stream.x), ceil(ceil(u_stream.zw / step) / u_stream.x) - 1.0);\n" /* tile counts as tiles.h */
+"   vec4 page = texture2DLod(tile_table, (vec2(t.x, t.y + l * u_table.x) + 0.5) * u_table.yz, 0.0);\n"
+"   if (page.a < 0.5) return false;\n"
+"   vec2 texel = floor(page.rg * 255.0 + 0.5) * (u_stream.x + 1.0) + q - t * u_stream.x + 0.5;\n"
+"   height = dot(texture2DLod(tiles, texel * u_pages, 0.0).rg, height_unpack);\n"
+"   return true;\n"
+"}\n"
+"float map_height(vec2 tex, vec2 s, float lod, float tile_lod) {\n" /* finest streamed level uploaded, else the atlas */
+"   float height;\n"
+"   for (int i = 0; i < 16; ++i) {\n" /* TILESET_MAX_LEVELS */
+"       float l = floor(tile_lod) + float(i);\n"
+"       if (l >= u_stream.y) break;\n"
+"       if (tile_height(s, l, height)) return height;\n"
+"   }\n"
+"   return sample_height(tex, lod);\n"
+"}\n"
+"vec2 node_tex(vec2 s) {\n"
+"   return u_atlas.xy + clamp(s, vec2(0.0), u_grid.xy) / u_grid.xy * u_atlas.zw;\n"
+"}\n"
+"vec2 node_pos(vec2 s) {\n" /* same mapping as gen_vertices */
+"   s = clamp(s, vec2(0.0), u_grid.xy);\n"
+"   return vec2(s.x - 0.5 * u_grid.x, 0.5 * u_grid.y - s.y) * u_grid.z;\n"
+"}\n"
+"vec2 camera_samples() {\n" /* inverse of node_pos, unclamped - as clipmap_update places the windows */
+"   return vec2((u_camera.x - u_offset.x) / u_grid.z + 0.5 * u_grid.x, 0.5 * u_grid.y - u_camera.y / u_grid.z);\n"
+"}\n"
+"vec2 level_tex(vec2 s) {\n" /* toroidal texel of a clipmap level, samples past the map edge round up onto the last */
+"   return u_atlas.xy + ceil(clamp(s, vec2(0.0), u_grid.xy) / u_node.z) * u_atlas.zw;\n"
+"}\n"
 "void main() {\n"
 // "   v_tex = a_tex;\n"
-"   float height = texture2D(heightmap, a_tex).r;\n"
+"   vec2 tex = u_atlas.xy + (a_pos * u_tex.xy + u_tex.zw) * u_atlas.zw;\n"
+"   vec2 pos = a_pos;\n"
+"   vec2 s = (a_pos * u_tex.xy + u_tex.zw) * u_stream.zw;\n" /* map sample, where streamed tiles are fetched */
+"   vec2 blend_s = s;\n"
+"   float lod = 0.0;\n" /* mip the height is fetched from */
+"   vec2 blend_tex = tex;\n" /* sample the height is blended towards, by blend */
+"   float blend = 0.0;\n"
+"   if (u_mode > 1.5) {\n"
+"       s = u_node.xy + a_pos * u_node.z;\n"
+         /* odd vertices slide onto their even neighbour, the only vertex the coarser ring has there, fetching
+          * both heights - the morph follows the camera rather than the window snapped to it, so it never steps */
+"       vec2 d = abs(s - camera_samples()) / u_node.z;\n"
+"       vec2 e = s - fract(a_pos * 0.5) * 2.0 * u_node.z;\n"
+"       blend = clamp((max(d.x, d.y) - u_morph.x) / (u_morph.y - u_morph.x), 0.0, 1.0);\n"
+"       tex = level_tex(s);\n"
+"       blend_tex = level_tex(e);\n"
+"       blend_s = e;\n"
+"       pos = node_pos(mix(s, e, blend));\n"
+"   } else if (u_mode > 0.5) {\n"
+"       s = u_node.xy + a_pos * u_node.z;\n"
+"       float dist = distance(vec3(node_pos(s) + u_offset, alt_scale * sample_height(node_tex(s), 0.0)), u_camera);\n"
+"       float morph = clamp((dist - u_morph.x) / (u_morph.y - u_morph.x), 0.0, 1.0);\n"
+         /* odd grid vertices slide one grid step onto their lower even neighbour, a vertex of the coarser level */
+"       s -= fract(a_pos * u_node.w * 0.5) * 2.0 / u_node.w * u_node.z * morph;\n"
+"       tex = node_tex(s);\n"
+"       pos = node_pos(s);\n"
+         /* mip level l where level l nodes start, reaching l + 1 where they hand over to l + 1 - a function of
+          * the final position alone, so vertices shared across a level change fetch the same height */
+"       float r0 = u_morph.y * u_node.w / u_node.z;\n" /* level 0 range, ranges double per level */
+"       lod = max(log2(distance(pos + u_offset, u_camera.xy) / r0) + 1.0, 0.0);\n"
+"   } else if (u_lod_range > 0.0) {\n"
+         /* the ranges terrain_select_lods picks patch levels by, from the vertex so patches sharing it agree -
+          * patches reach level l where this reaches l - 1, but measured from the nearest point of their box,
+          * so far corners lie up to a patch diagonal further and fetch up to about half a level coarser than
+          * the patch, more where neighbour refinement lowered its level */
+"       lod = max(log2(distance(pos + u_offset, u_camera.xy) / u_lod_range), 0.0);\n"
+"   }\n"
+"   float tile_lod = u_mode > 1.5 ? log2(u_node.z) : lod;\n" /* clipmap levels fetch their own texture at mip 0 */
+"   lod = min(lod, u_max_lod);\n"
+     /* packed 16 bit samples are fetched nearest - a whole level per range keeps one vertex per texel */
+"   if (height_unpack.y > 0.0) lod = floor(lod);\n"
+"   float height = map_height(tex, s, lod, tile_lod);\n"
+"   if (blend > 0.0) height = mix(height, map_height(blend_tex, blend_s, lod, tile_lod), blend);\n"
 "   v_col = vec3(height);\n"
 // "   v_col = vec3(a_tex, 0.0);\n"
 // "   v_col = texture2D(heightmap, a_tex).rgb;\n"
-"   gl_Position = u_mvp * vec4(a_pos, alt_scale * height , 1.0);\n"
+"   gl_Position = u_mvp * vec4(pos + u_offset, alt_scale * height , 1.0);\n"
 "}\0";
 // "uniform mat4 mvp_matrix; // model-view-projection matrix"
 // "uniform mat3 normal_matrix; // normal matrix"
@@ -85,7 +208,52 @@ const char* frag_shader =
 // "}";
 #endif
 
+/* true if the context lists extension name - GL 1.3 and ES 2.0 have only the one string */
+bool gl_has_extension(const char* name) {
+    const char* list = (const char*) glGetString(GL_EXTENSIONS);
+    size_t len = strlen(name);
+
+    while (list != NULL && (list = strstr(list, name)) != NULL) {
+        if (list[len] == ' ' || list[len] == '\0')
+            return true;
+        list += len;
+    }
+    return false;
+}
+
+#include "glstate.h"
+#include "gldebug.h"
+
+#ifdef USE_GL2
+
+/* drivers may hand out a 3.0 or later context for the 2.0 one asked for - its entry points are used if so,
+ * else the 2.0 extensions providing them
+ */
+void gl_load_procs(void) {
+    const char* version = (const char*) glGetString(GL_VERSION);
+    int major = 0;
+
+    gl_es3 = false;
+    if (version != NULL && sscanf(version, "OpenGL ES %d", &major) == 1 && major >= 3) {
+        gl_map_buffer_range = (gl_map_buffer_range_t) glfwGetProcAddress("glMapBufferRange");
+        gl_unmap_buffer = (gl_unmap_buffer_t) glfwGetProcAddress("glUnmapBuffer");
+        gl_tex_storage_2d = (gl_tex_storage_2d_t) glfwGetProcAddress("glTexStorage2D");
+        gl_es3 = gl_map_buffer_range != NULL && gl_unmap_buffer != NULL;
+        gl_npot_mips = true;
+        return;
+    }
+
+    if (gl_has_extension("GL_EXT_texture_storage"))
+        gl_tex_storage_2d = (gl_tex_storage_2d_t) glfwGetProcAddress("glTexStorage2DEXT");
+    gl_npot_mips = gl_has_extension("GL_OES_texture_npot");
+}
+#endif
+
 int gl_init(void) {
+    /* nothing is known about a new context */
+    gl_state_reset();
+    gl_debug_init();
+
     /* set clear color and enable depth testing */
     glClearColor(0.5, 0.5, 0.5, 1.0);
     glEnable(GL_DEPTH_TEST);
@@ -142,15 +310,33 @@ int gl_init(void) {
 
     /* Grab locations of uniforms and attributes */
     u_mvp = glGetUniformLocation(shaderProgram, "u_mvp");
+    u_atlas = glGetUniformLocation(shaderProgram, "u_atlas");
+    u_offset = glGetUniformLocation(shaderProgram, "u_offset");
+    u_mode = glGetUniformLocation(shaderProgram, "u_mode");
+    u_node = glGetUniformLocation(shaderProgram, "u_node");
+    u_morph = glGetUniformLocation(shaderProgram, "u_morph");
+    u_grid = glGetUniformLocation(shaderProgram, "u_grid");
+    u_camera = glGetUniformLocation(shaderProgram, "u_camera");
+    u_tex = glGetUniformLocation(shaderProgram, "u_tex");
+    u_lod_range = glGetUniformLocation(shaderProgram, "u_lod_range");
+    u_max_lod = glGetUniformLocation(shaderProgram, "u_max_lod");
+    u_heightmap = glGetUniformLocation(shaderProgram, "heightmap");
+    u_height_unpack = glGetUniformLocation(shaderProgram, "height_unpack");
+    u_alt_scale = glGetUniformLocation(shaderProgram, "alt_scale");
+    u_tiles = glGetUniformLocation(shaderProgram, "tiles");
+    u_tile_table = glGetUniformLocation(shaderProgram, "tile_table");
+    u_stream = glGetUniformLocation(shaderProgram, "u_stream");
+    u_table = glGetUniformLocation(shaderProgram, "u_table");
+    u_pages = glGetUniformLocation(shaderProgram, "u_pages");
     a_pos = glGetAttribLocation(shaderProgram, "a_pos");
-    a_tex = glGetAttribLocation(shaderProgram, "a_tex");
-    printf("u_mvp: %d, a_pos: %d, a_tex: %d\n", u_mvp, a_pos, a_tex);
+    printf("u_mvp: %d, a_pos: %d\n", u_mvp, a_pos);
     /* TODO - add check for if any uniforms or attributes are -1 */
 
-    /* TODO - replace with buffer object */
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    /* client arrays until a draw binds its buffers, see buffers.h */
+    gl_bind_buffer(GL_ARRAY_BUFFER, 0);
     glEnableVertexAttribArray(a_pos);
-    glEnableVertexAttribArray(a_tex);
+
+    gl_load_procs();
 #endif
 
     return 0;
@@ -160,34 +346,34 @@ void gl_window_update(int width, int height, vec4 *view, vec4* proj) {
     /* clear frame */
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-    /* resizes viewport to current window size */
-    glViewport(0, 0, width, height);
+    /* resizes viewport to current window size - both are only sent when they changed, see glstate.h */
+    gl_set_viewport(0, 0, width, height);
 
 #ifdef USE_GL1
-    /* Update projection matrix to fit window */
-    glMatrixMode(GL_PROJECTION);
-    glLoadMatrixf(&proj[0][0]);
-
-    /* Update model matrix to rotate */
-    glMatrixMode(GL_MODELVIEW);
-    glLoadMatrixf(&view[0][0]);
+    gl_set_matrices(&proj[0][0], &view[0][0]);
 #endif
 #ifdef USE_GL2
     /* create mvp matrices from view and projection */
     mat4 mvp;
     glm_mat4_mul(proj, view, mvp);
-    glUniformMatrix4fv(u_mvp, 1, false, &mvp[0][0]);
+    gl_set_uniform(u_mvp, 16, &mvp[0][0]);
 #endif
 }
 
-int gl_draw_frame(void) {
-    uint32_t error = glGetError();
-    if (error != 0) {
-        printf("OpenGL errorcode 0x%04x\n", error);
-        return -1;
-    }
+#ifdef USE_GL2
+/* u_tex for a grid of width x height samples placed by gen_vertices - the texture coordinates are
+ * affine in the positions, so they are derived in the vertex shader instead of fetched
+ * lod_range is the distance mip 0 is fetched out to, 0 to fetch it everywhere
+ */
+void gl_grid_tex(uint32_t width, uint32_t height, float spacing, float lod_range) {
+    gl_set_uniform4f(u_tex, 1.f / ((width - 1) * spacing), -1.f / ((height - 1) * spacing), 0.5f, 0.5f);
+    gl_set_uniform1f(u_lod_range, lod_range);
+}
+#endif
 
-    return 0;
+/* a glGetError every frame would wait on the driver, see gldebug.h */
+int gl_draw_frame(void) {
+    return gl_debug_check();
 }
 
 #endif /* _GL_VERSION_H_ */
\ No newline at end of file
@@ -8,263 +8,28 @@
 #define HEIGHTMAP_NUM_PIXELS 65536u
 #define HEIGHTMAP_SIZE_BYTES 65536u
 
+/* raw samples are linked in from "include/heightmap.bin" (.incbin path is relative to where the compiler runs) */
+#if defined(__has_embed)
+#if __has_embed("heightmap.bin")
+#define HEIGHTMAP_EMBED
 const uint8_t heightmap_pixels[256][256] = {
-	{ 90u, 87u, 90u, 90u, 87u, 77u, 69u, 62u, 59u, 60u, 61u, 59u, 66u, 68u, 68u, 70u, 66u, 67u, 65u, 58u, 46u, 37u, 33u, 33u, 37u, 40u, 47u, 54u, 55u, 56u, 53u, 51u, 47u, 49u, 50u, 46u, 42u, 43u, 44u, 43u, 44u, 45u, 50u, 50u, 48u, 53u, 57u, 60u, 61u, 65u, 68u, 75u, 81u, 90u, 99u, 108u, 113u, 116u, 126u, 134u, 140u, 142u, 143u, 143u, 143u, 140u, 133u, 136u, 141u, 147u, 150u, 151u, 148u, 147u, 147u, 148u, 147u, 150u, 153u, 155u, 157u, 166u, 168u, 164u, 158u, 154u, 146u, 144u, 142u, 148u, 154u, 152u, 150u, 137u, 120u, 108u, 111u, 120u, 121u, 127u, 136u, 135u, 135u, 135u, 136u, 136u, 138u, 138u, 142u, 149u, 153u, 155u, 157u, 157u, 161u, 160u, 160u, 167u, 173u, 174u, 174u, 173u, 166u, 160u, 156u, 157u, 153u, 149u, 139u, 129u, 116u, 112u, 110u, 106u, 108u, 114u, 123u, 130u, 131u, 129u, 123u, 123u, 121u, 119u, 119u, 114u, 112u, 107u, 105u, 106u, 102u, 91u, 82u, 82u, 87u, 94u, 94u, 91u, 93u, 92u, 93u, 95u, 94u, 84u, 72u, 73u, 79u, 77u, 77u, 75u, 73u, 66u, 62u, 59u, 57u, 58u, 62u, 56u, 55u, 61u, 63u, 58u, 57u, 58u, 55u, 50u, 46u, 44u, 38u, 35u, 32u, 29u, 26u, 28u, 28u, 28u, 31u, 33u, 35u, 34u, 34u, 35u, 36u, 37u, 38u, 38u, 39u, 40u, 41u, 43u, 45u, 46u, 49u, 51u, 53u, 52u, 52u, 56u, 60u, 64u, 67u, 63u, 61u, 66u, 68u, 70u, 66u, 65u, 66u, 62u, 56u, 51u, 46u, 39u, 35u, 27u, 20u, 16u, 14u, 15u, 16u, 16u, 17u, 18u, 20u, 22u, 25u, 27u, 33u, 36u, 39u, 40u, 45u, 51u, 53u, 54u }, 
-	{ 89u, 88u, 90u, 89u, 84u, 75u, 67u, 57u, 54u, 56u, 55u, 55u, 61u, 68u, 70u, 74u, 70u, 65u, 60u, 55u, 43u, 36u, 36u, 37u, 36u, 36u, 43u, 48u, 51u, 54u, 49u, 47u, 48u, 47u, 50u, 52u, 48u, 51u, 49u, 49u, 53u, 54u, 57u, 56u, 56u, 60u, 62u, 66u, 68u, 72u, 75u, 82u, 91u, 101u, 106u, 109u, 112u, 117u, 126u, 135u, 136u, 135u, 138u, 138u, 137u, 136u, 131u, 134u, 139u, 145u, 152u, 157u, 154u, 152u, 154u, 156u, 155u, 153u, 156u, 159u, 166u, 173u, 172u, 168u, 161u, 157u, 150u, 149u, 144u, 145u, 146u, 145u, 143u, 135u, 120u, 109u, 110u, 115u, 117u, 122u, 133u, 135u, 134u, 135u, 138u, 141u, 143u, 144u, 150u, 157u, 157u, 160u, 167u, 171u, 173u, 168u, 167u, 175u, 183u, 185u, 187u, 185u, 180u, 175u, 166u, 161u, 154u, 149u, 142u, 137u, 130u, 126u, 125u, 119u, 115u, 120u, 123u, 130u, 138u, 133u, 126u, 122u, 117u, 116u, 113u, 106u, 102u, 108u, 106u, 103u, 100u, 94u, 90u, 87u, 92u, 96u, 94u, 98u, 102u, 102u, 103u, 98u, 91u, 76u, 68u, 75u, 77u, 75u, 72u, 69u, 69u, 65u, 59u, 52u, 43u, 43u, 48u, 48u, 43u, 48u, 51u, 51u, 55u, 53u, 53u, 52u, 47u, 48u, 41u, 33u, 30u, 29u, 30u, 33u, 33u, 33u, 35u, 37u, 39u, 38u, 37u, 37u, 38u, 39u, 39u, 38u, 38u, 39u, 39u, 41u, 43u, 44u, 47u, 49u, 49u, 48u, 47u, 50u, 55u, 62u, 66u, 62u, 65u, 68u, 65u, 66u, 64u, 63u, 63u, 58u, 54u, 50u, 43u, 35u, 29u, 22u, 17u, 13u, 11u, 11u, 12u, 14u, 15u, 16u, 19u, 24u, 28u, 29u, 35u, 39u, 45u, 48u, 52u, 55u, 54u, 55u }, 
-	{ 85u, 83u, 83u, 82u, 77u, 75u, 70u, 60u, 56u, 54u, 53u, 59u, 66u, 70u, 69u, 74u, 74u, 67u, 63u, 57u, 45u, 42u, 45u, 42u, 41u, 39u, 43u, 44u, 49u, 48u, 46u, 46u, 44u, 42u, 49u, 53u, 51u, 55u, 54u, 58u, 60u, 62u, 63u, 61u, 63u, 64u, 69u, 73u, 75u, 80u, 85u, 90u, 97u, 106u, 109u, 116u, 121u, 124u, 123u, 127u, 130u, 131u, 134u, 135u, 128u, 129u, 131u, 135u, 139u, 143u, 151u, 155u, 154u, 156u, 155u, 157u, 156u, 154u, 160u, 165u, 175u, 178u, 178u, 172u, 164u, 161u, 155u, 153u, 146u, 144u, 138u, 138u, 133u, 131u, 119u, 110u, 108u, 111u, 114u, 117u, 127u, 134u, 137u, 140u, 142u, 147u, 151u, 155u, 161u, 168u, 171u, 172u, 177u, 182u, 186u, 184u, 184u, 190u, 199u, 199u, 199u, 198u, 191u, 186u, 175u, 165u, 159u, 151u, 145u, 143u, 139u, 133u, 131u, 125u, 119u, 123u, 123u, 129u, 129u, 125u, 123u, 122u, 116u, 108u, 99u, 95u, 99u, 101u, 96u, 94u, 94u, 100u, 97u, 86u, 89u, 93u, 90u, 94u, 107u, 115u, 117u, 103u, 93u, 80u, 73u, 79u, 87u, 83u, 72u, 73u, 71u, 62u, 54u, 43u, 39u, 39u, 39u, 37u, 33u, 39u, 44u, 48u, 55u, 52u, 55u, 51u, 45u, 50u, 47u, 36u, 33u, 32u, 36u, 38u, 39u, 38u, 37u, 39u, 41u, 41u, 40u, 39u, 40u, 41u, 39u, 39u, 39u, 39u, 38u, 40u, 41u, 43u, 45u, 47u, 48u, 48u, 47u, 48u, 51u, 58u, 65u, 66u, 67u, 65u, 63u, 58u, 57u, 56u, 57u, 52u, 46u, 45u, 36u, 29u, 23u, 18u, 14u, 10u, 9u, 9u, 10u, 13u, 14u, 13u, 15u, 21u, 26u, 28u, 35u, 44u, 50u, 54u, 54u, 55u, 57u, 56u }, 
-	{ 79u, 75u, 76u, 76u, 72u, 73u, 71u, 64u, 58u, 55u, 56u, 63u, 70u, 73u, 71u, 71u, 72u, 66u, 65u, 59u, 50u, 50u, 50u, 50u, 46u, 42u, 42u, 45u, 45u, 44u, 47u, 44u, 43u, 43u, 46u, 52u, 57u, 59u, 61u, 64u, 67u, 68u, 66u, 66u, 69u, 71u, 74u, 77u, 82u, 87u, 93u, 98u, 101u, 108u, 116u, 123u, 127u, 131u, 130u, 126u, 129u, 133u, 134u, 133u, 126u, 123u, 126u, 129u, 133u, 139u, 147u, 150u, 154u, 157u, 158u, 159u, 158u, 159u, 161u, 170u, 181u, 184u, 182u, 177u, 169u, 166u, 162u, 159u, 150u, 146u, 135u, 134u, 132u, 129u, 123u, 113u, 112u, 112u, 118u, 118u, 126u, 135u, 143u, 144u, 148u, 154u, 159u, 166u, 176u, 178u, 181u, 184u, 190u, 194u, 196u, 201u, 202u, 203u, 209u, 208u, 205u, 203u, 198u, 189u, 178u, 169u, 160u, 151u, 148u, 147u, 142u, 139u, 133u, 129u, 124u, 123u, 122u, 122u, 120u, 120u, 121u, 123u, 118u, 112u, 100u, 91u, 93u, 99u, 92u, 92u, 94u, 96u, 89u, 84u, 85u, 93u, 90u, 95u, 104u, 118u, 112u, 93u, 85u, 78u, 77u, 84u, 92u, 87u, 81u, 81u, 78u, 61u, 55u, 43u, 38u, 41u, 36u, 34u, 36u, 35u, 37u, 44u, 52u, 52u, 50u, 52u, 50u, 52u, 48u, 40u, 35u, 34u, 37u, 39u, 41u, 40u, 38u, 40u, 43u, 43u, 43u, 42u, 43u, 42u, 41u, 40u, 40u, 41u, 39u, 40u, 41u, 43u, 45u, 47u, 49u, 49u, 50u, 48u, 50u, 56u, 61u, 64u, 69u, 67u, 65u, 58u, 57u, 55u, 57u, 49u, 45u, 36u, 30u, 23u, 20u, 15u, 11u, 9u, 9u, 9u, 8u, 10u, 13u, 13u, 13u, 18u, 24u, 28u, 33u, 43u, 53u, 57u, 55u, 57u, 56u, 54u }, 
-	{ 76u, 70u, 67u, 69u, 72u, 72u, 68u, 60u, 58u, 56u, 58u, 65u, 72u, 70u, 67u, 68u, 71u, 70u, 67u, 62u, 55u, 49u, 47u, 50u, 48u, 45u, 43u, 43u, 41u, 42u, 46u, 45u, 42u, 44u, 49u, 53u, 59u, 60u, 62u, 64u, 68u, 69u, 68u, 70u, 75u, 78u, 79u, 82u, 87u, 94u, 97u, 97u, 105u, 114u, 121u, 128u, 129u, 135u, 139u, 137u, 133u, 134u, 135u, 134u, 128u, 126u, 122u, 124u, 129u, 133u, 140u, 147u, 153u, 159u, 160u, 161u, 162u, 162u, 164u, 173u, 183u, 186u, 189u, 186u, 178u, 168u, 165u, 162u, 155u, 148u, 137u, 133u, 128u, 119u, 118u, 114u, 117u, 119u, 122u, 123u, 124u, 133u, 144u, 148u, 155u, 157u, 163u, 173u, 183u, 185u, 187u, 192u, 201u, 206u, 207u, 212u, 213u, 211u, 214u, 210u, 205u, 201u, 198u, 194u, 186u, 175u, 164u, 156u, 151u, 150u, 148u, 145u, 139u, 133u, 126u, 123u, 119u, 119u, 120u, 120u, 119u, 123u, 125u, 121u, 104u, 93u, 93u, 96u, 91u, 92u, 89u, 87u, 85u, 87u, 91u, 98u, 97u, 97u, 103u, 106u, 98u, 80u, 74u, 76u, 76u, 78u, 92u, 94u, 90u, 80u, 74u, 61u, 51u, 42u, 40u, 42u, 34u, 36u, 37u, 31u, 35u, 43u, 48u, 47u, 43u, 48u, 53u, 53u, 45u, 37u, 33u, 36u, 38u, 40u, 41u, 40u, 40u, 42u, 44u, 43u, 44u, 45u, 46u, 45u, 44u, 43u, 41u, 41u, 41u, 41u, 42u, 44u, 46u, 47u, 48u, 49u, 50u, 49u, 52u, 54u, 56u, 63u, 69u, 70u, 71u, 69u, 67u, 62u, 60u, 52u, 46u, 36u, 27u, 21u, 17u, 12u, 12u, 11u, 10u, 9u, 8u, 9u, 10u, 11u, 15u, 19u, 25u, 33u, 37u, 44u, 51u, 56u, 59u, 58u, 57u, 58u }, 
-	{ 76u, 64u, 60u, 60u, 63u, 64u, 59u, 57u, 57u, 57u, 58u, 63u, 67u, 70u, 69u, 70u, 72u, 75u, 69u, 63u, 58u, 56u, 53u, 58u, 56u, 54u, 46u, 41u, 39u, 39u, 41u, 43u, 42u, 45u, 52u, 61u, 67u, 65u, 66u, 65u, 68u, 68u, 68u, 73u, 77u, 83u, 87u, 90u, 94u, 97u, 97u, 100u, 106u, 112u, 123u, 135u, 139u, 145u, 147u, 142u, 137u, 133u, 134u, 134u, 129u, 122u, 115u, 116u, 122u, 130u, 139u, 145u, 152u, 157u, 161u, 163u, 165u, 166u, 169u, 176u, 186u, 191u, 192u, 185u, 180u, 173u, 168u, 162u, 158u, 152u, 141u, 133u, 125u, 112u, 110u, 111u, 117u, 125u, 123u, 122u, 121u, 132u, 142u, 147u, 153u, 155u, 165u, 174u, 182u, 187u, 191u, 200u, 208u, 212u, 214u, 218u, 220u, 216u, 216u, 210u, 204u, 200u, 197u, 195u, 190u, 180u, 173u, 164u, 154u, 152u, 150u, 148u, 143u, 138u, 130u, 123u, 117u, 118u, 120u, 122u, 124u, 127u, 130u, 123u, 109u, 105u, 101u, 99u, 97u, 89u, 85u, 88u, 85u, 89u, 88u, 89u, 95u, 96u, 96u, 86u, 83u, 78u, 70u, 73u, 80u, 80u, 87u, 91u, 86u, 79u, 72u, 54u, 43u, 43u, 40u, 41u, 35u, 33u, 31u, 28u, 28u, 35u, 38u, 39u, 38u, 45u, 53u, 50u, 45u, 40u, 35u, 35u, 36u, 38u, 39u, 38u, 40u, 42u, 45u, 45u, 44u, 47u, 49u, 48u, 45u, 44u, 44u, 43u, 42u, 41u, 43u, 45u, 46u, 48u, 49u, 51u, 52u, 52u, 51u, 52u, 52u, 58u, 64u, 71u, 77u, 77u, 68u, 63u, 54u, 50u, 45u, 41u, 30u, 21u, 16u, 14u, 12u, 11u, 11u, 10u, 9u, 8u, 9u, 10u, 15u, 19u, 28u, 37u, 42u, 47u, 52u, 54u, 58u, 57u, 61u, 62u }, 
-	{ 71u, 61u, 54u, 52u, 57u, 60u, 59u, 55u, 57u, 61u, 62u, 62u, 67u, 71u, 66u, 70u, 72u, 73u, 71u, 71u, 68u, 67u, 65u, 69u, 63u, 56u, 50u, 42u, 37u, 37u, 38u, 40u, 42u, 47u, 54u, 65u, 71u, 72u, 74u, 71u, 71u, 70u, 69u, 77u, 80u, 83u, 89u, 95u, 99u, 97u, 99u, 101u, 107u, 111u, 119u, 130u, 141u, 147u, 151u, 140u, 130u, 127u, 130u, 130u, 123u, 117u, 114u, 117u, 121u, 127u, 135u, 143u, 149u, 154u, 159u, 164u, 168u, 169u, 172u, 177u, 190u, 198u, 200u, 194u, 187u, 179u, 171u, 162u, 162u, 157u, 145u, 134u, 121u, 110u, 109u, 111u, 115u, 125u, 125u, 123u, 127u, 137u, 141u, 147u, 152u, 154u, 162u, 174u, 181u, 186u, 195u, 202u, 207u, 211u, 217u, 220u, 222u, 218u, 216u, 211u, 207u, 202u, 199u, 198u, 192u, 187u, 179u, 170u, 160u, 154u, 149u, 149u, 144u, 139u, 132u, 123u, 120u, 119u, 118u, 121u, 127u, 129u, 126u, 120u, 115u, 109u, 102u, 96u, 93u, 82u, 76u, 83u, 83u, 88u, 88u, 77u, 82u, 85u, 72u, 72u, 75u, 75u, 70u, 71u, 75u, 77u, 77u, 78u, 72u, 73u, 59u, 44u, 34u, 34u, 36u, 36u, 36u, 33u, 30u, 27u, 25u, 27u, 30u, 33u, 35u, 38u, 43u, 41u, 42u, 41u, 38u, 39u, 39u, 38u, 37u, 37u, 41u, 43u, 46u, 48u, 47u, 47u, 48u, 49u, 48u, 47u, 45u, 43u, 42u, 42u, 43u, 45u, 45u, 48u, 51u, 52u, 53u, 51u, 47u, 47u, 47u, 48u, 53u, 61u, 73u, 74u, 62u, 57u, 50u, 47u, 44u, 38u, 30u, 22u, 18u, 16u, 14u, 12u, 12u, 11u, 9u, 7u, 9u, 9u, 13u, 19u, 26u, 34u, 41u, 50u, 54u, 55u, 60u, 60u, 62u, 68u }, 
-	{ 58u, 53u, 48u, 48u, 54u, 56u, 58u, 60u, 62u, 66u, 67u, 63u, 66u, 67u, 62u, 66u, 72u, 76u, 79u, 83u, 80u, 77u, 72u, 70u, 62u, 52u, 48u, 44u, 40u, 41u, 39u, 38u, 40u, 45u, 52u, 59u, 68u, 76u, 79u, 75u, 77u, 76u, 74u, 77u, 82u, 84u, 87u, 94u, 98u, 95u, 98u, 102u, 108u, 114u, 123u, 127u, 134u, 136u, 140u, 130u, 126u, 124u, 124u, 123u, 117u, 113u, 112u, 117u, 122u, 125u, 131u, 137u, 143u, 149u, 156u, 164u, 171u, 175u, 178u, 184u, 195u, 204u, 207u, 200u, 192u, 184u, 176u, 165u, 163u, 156u, 145u, 135u, 124u, 118u, 115u, 115u, 116u, 121u, 119u, 117u, 124u, 134u, 144u, 148u, 151u, 155u, 162u, 174u, 181u, 186u, 194u, 202u, 207u, 210u, 216u, 218u, 217u, 215u, 215u, 214u, 210u, 204u, 202u, 201u, 196u, 190u, 183u, 176u, 166u, 155u, 152u, 152u, 148u, 143u, 135u, 125u, 121u, 118u, 118u, 119u, 122u, 122u, 120u, 121u, 116u, 106u, 93u, 87u, 86u, 79u, 71u, 74u, 73u, 76u, 80u, 78u, 76u, 70u, 60u, 64u, 69u, 69u, 68u, 73u, 68u, 63u, 60u, 66u, 65u, 60u, 43u, 31u, 26u, 28u, 31u, 32u, 34u, 33u, 29u, 24u, 26u, 28u, 31u, 32u, 32u, 33u, 37u, 39u, 42u, 45u, 44u, 42u, 42u, 42u, 39u, 39u, 44u, 46u, 48u, 50u, 49u, 49u, 51u, 51u, 49u, 47u, 44u, 42u, 40u, 40u, 40u, 42u, 43u, 45u, 47u, 48u, 50u, 49u, 45u, 43u, 44u, 44u, 43u, 47u, 59u, 68u, 60u, 55u, 47u, 42u, 39u, 32u, 26u, 21u, 18u, 17u, 15u, 14u, 13u, 12u, 10u, 8u, 10u, 9u, 9u, 14u, 20u, 30u, 41u, 53u, 59u, 59u, 65u, 68u, 69u, 73u }, 
-	{ 55u, 54u, 53u, 58u, 58u, 56u, 58u, 64u, 66u, 72u, 73u, 68u, 65u, 63u, 69u, 73u, 76u, 82u, 89u, 93u, 87u, 82u, 79u, 73u, 62u, 54u, 50u, 45u, 44u, 43u, 39u, 39u, 37u, 40u, 46u, 55u, 64u, 78u, 81u, 74u, 76u, 73u, 78u, 82u, 83u, 86u, 91u, 92u, 96u, 96u, 100u, 104u, 110u, 119u, 119u, 118u, 123u, 122u, 122u, 119u, 116u, 117u, 119u, 115u, 111u, 107u, 108u, 110u, 115u, 122u, 127u, 135u, 142u, 149u, 157u, 166u, 175u, 183u, 184u, 192u, 204u, 212u, 213u, 207u, 202u, 192u, 183u, 173u, 170u, 163u, 155u, 141u, 133u, 126u, 120u, 118u, 112u, 110u, 112u, 115u, 121u, 131u, 140u, 141u, 146u, 155u, 162u, 172u, 178u, 188u, 193u, 201u, 208u, 211u, 212u, 212u, 211u, 212u, 213u, 216u, 212u, 209u, 208u, 203u, 198u, 192u, 186u, 180u, 173u, 162u, 157u, 152u, 149u, 146u, 135u, 124u, 118u, 116u, 118u, 120u, 123u, 121u, 116u, 114u, 111u, 104u, 90u, 78u, 74u, 70u, 69u, 71u, 72u, 70u, 79u, 80u, 71u, 69u, 63u, 58u, 62u, 58u, 65u, 66u, 54u, 46u, 46u, 55u, 54u, 50u, 39u, 25u, 18u, 20u, 25u, 26u, 29u, 28u, 27u, 24u, 23u, 23u, 29u, 32u, 27u, 27u, 28u, 35u, 38u, 41u, 43u, 45u, 45u, 42u, 41u, 42u, 45u, 49u, 51u, 52u, 51u, 52u, 52u, 52u, 49u, 46u, 42u, 38u, 37u, 37u, 38u, 38u, 39u, 39u, 42u, 43u, 43u, 44u, 39u, 38u, 40u, 38u, 39u, 40u, 46u, 52u, 49u, 46u, 45u, 40u, 39u, 31u, 26u, 22u, 18u, 16u, 15u, 16u, 14u, 12u, 11u, 10u, 8u, 8u, 8u, 10u, 15u, 24u, 41u, 56u, 64u, 61u, 67u, 75u, 78u, 84u }, 
-	{ 53u, 54u, 57u, 59u, 57u, 58u, 66u, 69u, 67u, 71u, 71u, 70u, 67u, 64u, 77u, 83u, 85u, 92u, 101u, 96u, 90u, 83u, 82u, 80u, 73u, 65u, 58u, 48u, 46u, 39u, 36u, 33u, 32u, 33u, 38u, 46u, 56u, 68u, 67u, 67u, 67u, 64u, 67u, 71u, 78u, 85u, 89u, 88u, 92u, 99u, 102u, 103u, 110u, 117u, 114u, 112u, 112u, 109u, 105u, 105u, 104u, 103u, 107u, 106u, 103u, 101u, 104u, 103u, 108u, 117u, 127u, 135u, 143u, 156u, 165u, 171u, 178u, 185u, 189u, 199u, 211u, 215u, 215u, 215u, 210u, 199u, 190u, 183u, 181u, 178u, 168u, 151u, 138u, 127u, 122u, 119u, 114u, 109u, 105u, 111u, 116u, 118u, 125u, 131u, 136u, 152u, 163u, 172u, 179u, 188u, 192u, 198u, 203u, 208u, 208u, 206u, 205u, 208u, 210u, 215u, 212u, 209u, 207u, 202u, 197u, 193u, 189u, 184u, 176u, 167u, 161u, 154u, 147u, 143u, 133u, 123u, 118u, 114u, 118u, 122u, 124u, 120u, 114u, 110u, 102u, 98u, 90u, 76u, 66u, 63u, 65u, 66u, 67u, 66u, 68u, 74u, 72u, 66u, 61u, 55u, 57u, 50u, 54u, 60u, 49u, 43u, 42u, 45u, 44u, 43u, 33u, 22u, 16u, 16u, 21u, 22u, 22u, 21u, 24u, 24u, 21u, 22u, 26u, 25u, 23u, 20u, 23u, 29u, 31u, 33u, 38u, 40u, 39u, 41u, 42u, 45u, 49u, 54u, 55u, 57u, 57u, 56u, 54u, 53u, 49u, 45u, 42u, 38u, 35u, 34u, 35u, 34u, 36u, 36u, 39u, 41u, 40u, 41u, 41u, 40u, 38u, 35u, 37u, 38u, 37u, 43u, 45u, 45u, 42u, 41u, 37u, 28u, 24u, 21u, 17u, 16u, 15u, 15u, 11u, 10u, 9u, 9u, 6u, 6u, 7u, 8u, 13u, 24u, 42u, 54u, 56u, 58u, 67u, 78u, 85u, 92u }, 
-	{ 47u, 56u, 60u, 62u, 64u, 64u, 70u, 69u, 61u, 63u, 71u, 72u, 65u, 64u, 77u, 85u, 95u, 104u, 107u, 98u, 92u, 88u, 87u, 89u, 85u, 75u, 62u, 48u, 45u, 40u, 37u, 33u, 34u, 31u, 31u, 34u, 43u, 56u, 60u, 67u, 64u, 59u, 59u, 62u, 68u, 73u, 82u, 85u, 90u, 98u, 101u, 103u, 106u, 111u, 106u, 107u, 103u, 96u, 96u, 100u, 98u, 97u, 100u, 102u, 102u, 102u, 103u, 101u, 107u, 114u, 124u, 134u, 145u, 160u, 170u, 177u, 183u, 187u, 191u, 198u, 209u, 213u, 219u, 219u, 211u, 200u, 192u, 188u, 189u, 187u, 174u, 160u, 144u, 130u, 119u, 114u, 112u, 109u, 102u, 103u, 109u, 112u, 117u, 129u, 138u, 155u, 167u, 173u, 178u, 184u, 188u, 196u, 201u, 203u, 202u, 200u, 203u, 209u, 212u, 212u, 207u, 204u, 202u, 198u, 195u, 192u, 188u, 181u, 173u, 166u, 162u, 157u, 147u, 137u, 128u, 125u, 124u, 121u, 119u, 120u, 120u, 115u, 109u, 106u, 100u, 92u, 81u, 75u, 68u, 67u, 67u, 63u, 59u, 64u, 68u, 68u, 67u, 59u, 56u, 49u, 49u, 50u, 55u, 52u, 47u, 44u, 39u, 38u, 37u, 36u, 26u, 19u, 16u, 15u, 18u, 21u, 21u, 19u, 20u, 18u, 16u, 19u, 21u, 19u, 19u, 17u, 17u, 19u, 23u, 26u, 32u, 39u, 40u, 44u, 46u, 51u, 55u, 62u, 61u, 63u, 63u, 61u, 57u, 55u, 51u, 45u, 42u, 38u, 35u, 31u, 30u, 29u, 31u, 34u, 36u, 37u, 38u, 41u, 41u, 40u, 39u, 38u, 35u, 35u, 37u, 44u, 49u, 46u, 40u, 40u, 36u, 25u, 20u, 18u, 17u, 16u, 14u, 12u, 9u, 8u, 6u, 6u, 5u, 6u, 8u, 8u, 13u, 24u, 40u, 49u, 54u, 65u, 75u, 82u, 85u, 87u }, 
-	{ 54u, 61u, 62u, 71u, 72u, 68u, 74u, 69u, 60u, 60u, 69u, 71u, 70u, 68u, 76u, 87u, 101u, 106u, 107u, 103u, 104u, 102u, 93u, 94u, 94u, 81u, 64u, 49u, 44u, 37u, 37u, 32u, 32u, 32u, 28u, 28u, 34u, 46u, 54u, 62u, 58u, 52u, 52u, 54u, 57u, 68u, 79u, 86u, 87u, 92u, 100u, 96u, 97u, 102u, 102u, 100u, 97u, 91u, 91u, 90u, 89u, 89u, 91u, 97u, 103u, 98u, 97u, 101u, 107u, 117u, 125u, 138u, 155u, 164u, 173u, 177u, 182u, 186u, 191u, 200u, 209u, 214u, 219u, 220u, 213u, 204u, 197u, 193u, 193u, 190u, 179u, 162u, 148u, 132u, 119u, 113u, 112u, 108u, 107u, 107u, 111u, 114u, 118u, 130u, 143u, 158u, 173u, 176u, 179u, 184u, 189u, 194u, 199u, 199u, 198u, 197u, 201u, 207u, 211u, 211u, 206u, 201u, 199u, 197u, 195u, 190u, 184u, 179u, 170u, 162u, 157u, 156u, 148u, 138u, 130u, 127u, 126u, 126u, 123u, 120u, 119u, 112u, 107u, 101u, 92u, 75u, 70u, 68u, 74u, 73u, 71u, 65u, 61u, 61u, 68u, 70u, 65u, 64u, 60u, 52u, 54u, 58u, 57u, 51u, 48u, 42u, 37u, 31u, 30u, 30u, 25u, 19u, 18u, 16u, 17u, 20u, 22u, 21u, 21u, 16u, 14u, 17u, 18u, 17u, 17u, 17u, 16u, 16u, 17u, 21u, 25u, 32u, 38u, 45u, 52u, 59u, 62u, 66u, 69u, 65u, 63u, 64u, 58u, 52u, 49u, 44u, 39u, 35u, 33u, 29u, 27u, 27u, 27u, 31u, 33u, 35u, 36u, 40u, 40u, 37u, 37u, 36u, 35u, 34u, 35u, 41u, 48u, 46u, 38u, 34u, 30u, 25u, 18u, 19u, 21u, 23u, 19u, 14u, 9u, 8u, 6u, 6u, 7u, 8u, 9u, 10u, 15u, 26u, 34u, 44u, 52u, 71u, 81u, 85u, 87u, 92u }, 
-	{ 59u, 62u, 62u, 70u, 77u, 73u, 75u, 72u, 63u, 66u, 69u, 73u, 73u, 76u, 83u, 87u, 97u, 102u, 100u, 106u, 113u, 115u, 109u, 99u, 89u, 75u, 62u, 51u, 46u, 37u, 34u, 30u, 29u, 29u, 26u, 31u, 33u, 37u, 44u, 50u, 47u, 43u, 45u, 52u, 58u, 71u, 83u, 87u, 86u, 89u, 98u, 99u, 95u, 96u, 104u, 100u, 95u, 94u, 87u, 82u, 88u, 89u, 92u, 96u, 101u, 96u, 95u, 103u, 111u, 121u, 131u, 143u, 159u, 168u, 175u, 178u, 179u, 186u, 192u, 206u, 215u, 215u, 214u, 218u, 215u, 208u, 203u, 199u, 193u, 191u, 184u, 171u, 158u, 137u, 124u, 116u, 114u, 112u, 116u, 122u, 124u, 126u, 123u, 133u, 148u, 163u, 177u, 177u, 179u, 184u, 190u, 191u, 191u, 190u, 191u, 194u, 197u, 205u, 211u, 212u, 207u, 201u, 198u, 196u, 195u, 189u, 184u, 179u, 169u, 159u, 153u, 152u, 151u, 145u, 136u, 131u, 129u, 129u, 125u, 121u, 121u, 115u, 106u, 95u, 78u, 62u, 58u, 64u, 69u, 69u, 70u, 68u, 66u, 64u, 64u, 66u, 69u, 72u, 68u, 64u, 66u, 64u, 55u, 47u, 44u, 37u, 30u, 26u, 25u, 25u, 22u, 20u, 19u, 20u, 21u, 23u, 24u, 24u, 24u, 19u, 13u, 13u, 13u, 14u, 16u, 17u, 15u, 13u, 12u, 17u, 22u, 26u, 36u, 46u, 60u, 67u, 66u, 66u, 68u, 65u, 62u, 62u, 57u, 51u, 45u, 40u, 35u, 32u, 31u, 29u, 28u, 27u, 25u, 27u, 31u, 33u, 36u, 38u, 35u, 33u, 34u, 35u, 37u, 37u, 36u, 38u, 44u, 42u, 33u, 27u, 24u, 22u, 19u, 19u, 26u, 32u, 26u, 18u, 13u, 9u, 8u, 8u, 10u, 11u, 11u, 12u, 17u, 25u, 32u, 37u, 48u, 72u, 89u, 90u, 96u, 109u }, 
-	{ 64u, 71u, 74u, 74u, 75u, 73u, 70u, 69u, 62u, 70u, 76u, 89u, 89u, 91u, 98u, 95u, 93u, 99u, 101u, 109u, 113u, 114u, 114u, 99u, 79u, 66u, 60u, 51u, 43u, 33u, 31u, 30u, 28u, 31u, 32u, 32u, 32u, 33u, 39u, 42u, 44u, 40u, 40u, 47u, 56u, 68u, 85u, 86u, 85u, 91u, 95u, 99u, 104u, 102u, 110u, 108u, 101u, 92u, 85u, 84u, 88u, 91u, 99u, 101u, 102u, 95u, 93u, 101u, 108u, 116u, 131u, 149u, 163u, 171u, 179u, 182u, 184u, 187u, 191u, 203u, 214u, 214u, 216u, 217u, 211u, 209u, 202u, 200u, 197u, 196u, 193u, 179u, 165u, 146u, 129u, 121u, 122u, 122u, 128u, 134u, 131u, 132u, 138u, 144u, 156u, 168u, 181u, 184u, 185u, 187u, 190u, 188u, 187u, 185u, 187u, 190u, 193u, 200u, 207u, 207u, 206u, 201u, 199u, 197u, 195u, 189u, 184u, 179u, 167u, 158u, 151u, 149u, 150u, 147u, 140u, 138u, 136u, 135u, 128u, 120u, 118u, 111u, 101u, 88u, 70u, 60u, 57u, 63u, 65u, 69u, 70u, 70u, 66u, 64u, 62u, 69u, 74u, 68u, 64u, 69u, 67u, 66u, 58u, 48u, 41u, 33u, 30u, 26u, 24u, 23u, 22u, 24u, 25u, 29u, 29u, 28u, 28u, 31u, 28u, 21u, 16u, 13u, 14u, 15u, 19u, 18u, 14u, 13u, 13u, 16u, 17u, 23u, 35u, 46u, 60u, 66u, 70u, 72u, 71u, 64u, 62u, 59u, 53u, 49u, 43u, 39u, 32u, 29u, 29u, 27u, 26u, 25u, 24u, 25u, 28u, 30u, 33u, 36u, 32u, 29u, 31u, 33u, 38u, 39u, 42u, 40u, 41u, 37u, 33u, 27u, 22u, 19u, 17u, 18u, 26u, 35u, 34u, 28u, 20u, 16u, 15u, 13u, 14u, 12u, 11u, 13u, 15u, 21u, 31u, 36u, 50u, 72u, 89u, 99u, 115u, 123u }, 
-	{ 78u, 81u, 83u, 75u, 80u, 84u, 81u, 76u, 75u, 78u, 85u, 98u, 103u, 102u, 99u, 96u, 95u, 97u, 100u, 105u, 111u, 114u, 116u, 100u, 84u, 67u, 61u, 53u, 39u, 33u, 31u, 30u, 33u, 38u, 38u, 36u, 37u, 36u, 37u, 37u, 40u, 39u, 42u, 48u, 52u, 66u, 81u, 86u, 88u, 90u, 93u, 102u, 109u, 115u, 115u, 112u, 104u, 98u, 85u, 88u, 93u, 94u, 101u, 100u, 98u, 92u, 93u, 97u, 110u, 121u, 137u, 152u, 166u, 171u, 177u, 185u, 186u, 191u, 194u, 204u, 212u, 216u, 218u, 215u, 212u, 211u, 204u, 205u, 204u, 202u, 195u, 181u, 169u, 154u, 139u, 127u, 132u, 135u, 138u, 140u, 141u, 147u, 156u, 160u, 171u, 183u, 187u, 193u, 192u, 191u, 190u, 190u, 186u, 184u, 186u, 188u, 192u, 200u, 204u, 203u, 204u, 201u, 197u, 197u, 193u, 189u, 183u, 179u, 168u, 159u, 154u, 150u, 152u, 149u, 147u, 147u, 146u, 141u, 135u, 124u, 114u, 104u, 97u, 82u, 68u, 60u, 60u, 59u, 64u, 66u, 67u, 62u, 58u, 55u, 60u, 73u, 77u, 72u, 69u, 71u, 67u, 64u, 61u, 52u, 40u, 36u, 31u, 27u, 23u, 21u, 22u, 28u, 33u, 37u, 37u, 35u, 35u, 39u, 31u, 26u, 22u, 15u, 12u, 13u, 13u, 14u, 14u, 12u, 14u, 13u, 17u, 25u, 39u, 49u, 59u, 64u, 70u, 72u, 75u, 67u, 63u, 58u, 52u, 45u, 38u, 34u, 29u, 27u, 26u, 25u, 24u, 23u, 23u, 23u, 24u, 27u, 31u, 31u, 30u, 27u, 28u, 31u, 35u, 42u, 46u, 42u, 41u, 34u, 29u, 23u, 19u, 15u, 18u, 19u, 26u, 35u, 36u, 31u, 26u, 23u, 23u, 21u, 18u, 16u, 15u, 19u, 20u, 26u, 38u, 44u, 57u, 81u, 94u, 108u, 121u, 127u }, 
-	{ 87u, 94u, 96u, 90u, 96u, 96u, 89u, 85u, 88u, 85u, 86u, 98u, 110u, 108u, 106u, 101u, 101u, 99u, 94u, 100u, 110u, 120u, 120u, 106u, 83u, 64u, 56u, 46u, 34u, 33u, 29u, 32u, 42u, 48u, 47u, 39u, 39u, 38u, 36u, 37u, 39u, 34u, 35u, 45u, 53u, 71u, 92u, 97u, 97u, 91u, 96u, 105u, 115u, 120u, 121u, 121u, 113u, 100u, 87u, 88u, 88u, 89u, 97u, 95u, 88u, 84u, 89u, 98u, 115u, 129u, 143u, 152u, 163u, 170u, 175u, 184u, 188u, 192u, 197u, 206u, 213u, 217u, 217u, 215u, 214u, 215u, 208u, 212u, 212u, 206u, 198u, 183u, 173u, 165u, 154u, 142u, 138u, 146u, 152u, 154u, 155u, 160u, 169u, 176u, 193u, 200u, 199u, 199u, 198u, 197u, 196u, 193u, 186u, 182u, 183u, 188u, 195u, 203u, 206u, 202u, 201u, 199u, 195u, 195u, 190u, 185u, 180u, 173u, 165u, 159u, 155u, 153u, 154u, 149u, 149u, 150u, 148u, 144u, 140u, 128u, 110u, 98u, 91u, 81u, 71u, 63u, 57u, 57u, 61u, 57u, 54u, 49u, 49u, 46u, 52u, 67u, 76u, 79u, 78u, 76u, 71u, 67u, 66u, 56u, 43u, 38u, 35u, 28u, 22u, 23u, 26u, 34u, 40u, 42u, 39u, 44u, 47u, 41u, 33u, 31u, 25u, 16u, 11u, 10u, 12u, 15u, 16u, 16u, 15u, 13u, 18u, 26u, 41u, 48u, 49u, 55u, 63u, 67u, 73u, 75u, 68u, 58u, 47u, 38u, 31u, 28u, 24u, 23u, 23u, 22u, 22u, 21u, 20u, 20u, 21u, 23u, 28u, 29u, 28u, 26u, 26u, 29u, 32u, 39u, 45u, 44u, 43u, 34u, 28u, 23u, 22u, 18u, 20u, 23u, 27u, 31u, 34u, 37u, 37u, 29u, 29u, 28u, 22u, 19u, 20u, 26u, 31u, 33u, 44u, 56u, 72u, 92u, 97u, 112u, 125u, 131u }, 
-	{ 94u, 102u, 103u, 97u, 92u, 97u, 94u, 91u, 92u, 83u, 91u, 102u, 108u, 106u, 109u, 99u, 97u, 94u, 92u, 100u, 110u, 124u, 114u, 103u, 86u, 62u, 52u, 51u, 40u, 33u, 32u, 45u, 54u, 52u, 55u, 52u, 52u, 49u, 48u, 53u, 47u, 40u, 36u, 41u, 55u, 76u, 93u, 99u, 100u, 99u, 109u, 114u, 123u, 124u, 130u, 123u, 117u, 108u, 97u, 91u, 91u, 92u, 97u, 94u, 87u, 86u, 93u, 103u, 113u, 125u, 130u, 137u, 149u, 162u, 174u, 178u, 185u, 193u, 201u, 207u, 211u, 213u, 215u, 217u, 218u, 219u, 214u, 215u, 211u, 196u, 188u, 183u, 173u, 171u, 159u, 150u, 150u, 159u, 162u, 171u, 176u, 178u, 184u, 191u, 204u, 209u, 210u, 209u, 210u, 204u, 198u, 193u, 188u, 187u, 183u, 186u, 190u, 195u, 202u, 203u, 199u, 199u, 196u, 193u, 188u, 181u, 174u, 167u, 161u, 157u, 153u, 152u, 148u, 145u, 147u, 150u, 149u, 147u, 140u, 128u, 106u, 93u, 84u, 77u, 69u, 62u, 56u, 54u, 55u, 55u, 51u, 49u, 50u, 47u, 51u, 58u, 67u, 78u, 80u, 76u, 71u, 64u, 64u, 58u, 51u, 41u, 33u, 26u, 23u, 25u, 30u, 41u, 47u, 47u, 49u, 48u, 44u, 38u, 30u, 30u, 25u, 19u, 12u, 11u, 14u, 19u, 19u, 19u, 17u, 19u, 24u, 30u, 42u, 43u, 46u, 54u, 64u, 73u, 73u, 75u, 69u, 57u, 43u, 31u, 27u, 24u, 22u, 22u, 21u, 20u, 18u, 18u, 17u, 18u, 20u, 22u, 26u, 29u, 29u, 28u, 26u, 28u, 33u, 36u, 38u, 39u, 40u, 36u, 30u, 26u, 26u, 25u, 27u, 28u, 27u, 31u, 36u, 49u, 48u, 41u, 40u, 35u, 27u, 24u, 29u, 33u, 40u, 45u, 56u, 70u, 86u, 100u, 107u, 115u, 125u, 131u }, 
-	{ 108u, 116u, 117u, 110u, 96u, 98u, 92u, 91u, 89u, 85u, 94u, 98u, 106u, 112u, 110u, 103u, 99u, 99u, 94u, 97u, 105u, 119u, 103u, 91u, 79u, 55u, 46u, 47u, 48u, 40u, 46u, 63u, 66u, 66u, 62u, 67u, 68u, 62u, 66u, 70u, 64u, 49u, 48u, 49u, 59u, 75u, 88u, 101u, 104u, 110u, 118u, 124u, 125u, 138u, 139u, 127u, 124u, 119u, 102u, 90u, 92u, 93u, 96u, 92u, 88u, 90u, 95u, 104u, 108u, 117u, 122u, 123u, 139u, 154u, 166u, 170u, 180u, 190u, 201u, 211u, 214u, 215u, 214u, 219u, 215u, 213u, 211u, 210u, 207u, 200u, 184u, 181u, 185u, 180u, 169u, 166u, 167u, 170u, 179u, 190u, 189u, 189u, 190u, 200u, 206u, 212u, 218u, 217u, 217u, 210u, 202u, 196u, 190u, 189u, 184u, 185u, 183u, 191u, 198u, 198u, 199u, 199u, 195u, 193u, 186u, 176u, 168u, 160u, 157u, 153u, 147u, 143u, 139u, 140u, 141u, 146u, 144u, 144u, 133u, 121u, 105u, 95u, 87u, 77u, 69u, 62u, 53u, 51u, 51u, 51u, 50u, 50u, 53u, 56u, 55u, 52u, 60u, 70u, 73u, 73u, 66u, 61u, 60u, 58u, 50u, 41u, 31u, 28u, 26u, 28u, 34u, 48u, 58u, 52u, 54u, 49u, 38u, 28u, 25u, 23u, 22u, 18u, 14u, 15u, 23u, 27u, 26u, 24u, 26u, 30u, 38u, 44u, 48u, 49u, 52u, 60u, 72u, 79u, 73u, 70u, 62u, 52u, 39u, 27u, 24u, 22u, 21u, 20u, 18u, 17u, 16u, 15u, 15u, 17u, 21u, 23u, 26u, 29u, 30u, 29u, 30u, 31u, 32u, 36u, 33u, 32u, 38u, 38u, 31u, 31u, 31u, 31u, 32u, 34u, 37u, 34u, 41u, 52u, 59u, 62u, 55u, 45u, 37u, 32u, 34u, 41u, 49u, 55u, 65u, 75u, 90u, 96u, 106u, 117u, 128u, 137u }, 
-	{ 103u, 106u, 112u, 116u, 109u, 103u, 88u, 89u, 93u, 93u, 92u, 92u, 105u, 115u, 114u, 103u, 100u, 101u, 92u, 96u, 104u, 104u, 94u, 89u, 71u, 51u, 43u, 46u, 51u, 48u, 49u, 62u, 72u, 75u, 70u, 75u, 83u, 84u, 87u, 83u, 66u, 54u, 55u, 59u, 66u, 74u, 88u, 107u, 121u, 121u, 126u, 133u, 143u, 158u, 154u, 149u, 146u, 128u, 109u, 96u, 94u, 97u, 99u, 97u, 92u, 92u, 94u, 103u, 113u, 116u, 117u, 119u, 127u, 140u, 159u, 167u, 174u, 189u, 205u, 219u, 224u, 221u, 213u, 214u, 205u, 198u, 203u, 208u, 205u, 203u, 192u, 183u, 186u, 181u, 178u, 182u, 188u, 190u, 195u, 199u, 196u, 195u, 194u, 204u, 210u, 212u, 218u, 219u, 220u, 217u, 209u, 203u, 194u, 191u, 184u, 183u, 184u, 192u, 198u, 197u, 197u, 194u, 192u, 190u, 181u, 171u, 165u, 154u, 150u, 145u, 140u, 137u, 134u, 135u, 135u, 140u, 139u, 138u, 132u, 117u, 102u, 96u, 89u, 78u, 71u, 62u, 52u, 47u, 47u, 52u, 54u, 56u, 62u, 63u, 56u, 58u, 62u, 64u, 64u, 68u, 67u, 65u, 63u, 58u, 47u, 37u, 29u, 28u, 28u, 30u, 37u, 50u, 60u, 55u, 53u, 49u, 39u, 26u, 23u, 20u, 18u, 16u, 17u, 19u, 28u, 35u, 37u, 37u, 37u, 42u, 51u, 52u, 54u, 58u, 64u, 72u, 77u, 80u, 74u, 68u, 59u, 49u, 34u, 26u, 24u, 22u, 20u, 18u, 16u, 16u, 15u, 14u, 14u, 16u, 21u, 24u, 27u, 29u, 31u, 33u, 34u, 32u, 33u, 34u, 30u, 29u, 34u, 34u, 29u, 33u, 34u, 32u, 35u, 42u, 47u, 43u, 48u, 55u, 67u, 69u, 62u, 58u, 47u, 42u, 49u, 54u, 53u, 54u, 65u, 79u, 89u, 91u, 102u, 114u, 130u, 147u }, 
-	{ 107u, 108u, 111u, 117u, 118u, 110u, 94u, 91u, 96u, 94u, 99u, 98u, 100u, 104u, 110u, 106u, 105u, 106u, 97u, 96u, 93u, 92u, 89u, 85u, 67u, 58u, 49u, 47u, 46u, 45u, 45u, 60u, 74u, 87u, 91u, 92u, 100u, 104u, 95u, 89u, 73u, 62u, 54u, 58u, 69u, 79u, 86u, 97u, 120u, 123u, 131u, 143u, 159u, 162u, 160u, 158u, 152u, 141u, 121u, 109u, 107u, 113u, 115u, 111u, 103u, 94u, 97u, 98u, 106u, 111u, 112u, 119u, 121u, 135u, 150u, 162u, 170u, 184u, 208u, 221u, 224u, 221u, 215u, 204u, 193u, 187u, 197u, 198u, 202u, 201u, 195u, 186u, 185u, 183u, 180u, 181u, 190u, 201u, 205u, 204u, 202u, 199u, 193u, 199u, 210u, 221u, 227u, 223u, 217u, 218u, 216u, 213u, 204u, 198u, 191u, 187u, 191u, 193u, 199u, 200u, 196u, 191u, 188u, 185u, 177u, 169u, 163u, 153u, 146u, 142u, 137u, 135u, 130u, 129u, 129u, 135u, 141u, 140u, 133u, 117u, 107u, 99u, 94u, 84u, 74u, 63u, 53u, 48u, 49u, 54u, 58u, 59u, 66u, 73u, 67u, 64u, 66u, 70u, 65u, 67u, 64u, 66u, 61u, 57u, 49u, 39u, 32u, 28u, 25u, 27u, 35u, 42u, 52u, 56u, 52u, 46u, 41u, 34u, 27u, 20u, 20u, 16u, 16u, 20u, 25u, 32u, 35u, 41u, 45u, 49u, 53u, 60u, 65u, 72u, 72u, 76u, 76u, 75u, 72u, 62u, 52u, 45u, 33u, 28u, 23u, 20u, 18u, 16u, 15u, 14u, 13u, 13u, 14u, 17u, 21u, 25u, 28u, 29u, 35u, 36u, 36u, 34u, 34u, 32u, 33u, 36u, 41u, 36u, 31u, 38u, 40u, 39u, 48u, 59u, 57u, 56u, 56u, 59u, 64u, 64u, 69u, 64u, 54u, 54u, 58u, 66u, 61u, 59u, 69u, 78u, 91u, 94u, 107u, 122u, 138u, 147u }, 
-	{ 105u, 110u, 115u, 117u, 119u, 119u, 113u, 106u, 97u, 92u, 99u, 102u, 99u, 101u, 101u, 103u, 105u, 108u, 105u, 101u, 99u, 93u, 89u, 87u, 81u, 67u, 56u, 45u, 42u, 46u, 51u, 56u, 72u, 91u, 100u, 96u, 112u, 126u, 107u, 86u, 76u, 60u, 54u, 58u, 66u, 80u, 91u, 96u, 117u, 124u, 134u, 153u, 167u, 159u, 151u, 152u, 148u, 138u, 121u, 122u, 116u, 117u, 121u, 118u, 107u, 91u, 93u, 92u, 98u, 109u, 112u, 126u, 132u, 139u, 146u, 152u, 162u, 179u, 203u, 216u, 217u, 216u, 212u, 196u, 185u, 183u, 193u, 199u, 203u, 200u, 192u, 185u, 182u, 181u, 173u, 174u, 186u, 201u, 211u, 206u, 206u, 203u, 196u, 192u, 206u, 225u, 230u, 224u, 216u, 221u, 221u, 217u, 209u, 206u, 197u, 191u, 195u, 196u, 194u, 194u, 190u, 185u, 181u, 178u, 170u, 166u, 159u, 151u, 145u, 141u, 138u, 135u, 130u, 128u, 129u, 135u, 142u, 142u, 136u, 125u, 117u, 104u, 92u, 84u, 71u, 63u, 55u, 50u, 53u, 55u, 59u, 65u, 74u, 86u, 81u, 70u, 72u, 74u, 68u, 62u, 62u, 64u, 63u, 58u, 50u, 40u, 32u, 28u, 27u, 28u, 32u, 34u, 42u, 45u, 46u, 44u, 44u, 41u, 30u, 23u, 20u, 16u, 13u, 14u, 17u, 25u, 29u, 37u, 43u, 46u, 52u, 61u, 66u, 75u, 74u, 70u, 76u, 75u, 65u, 57u, 49u, 41u, 34u, 29u, 24u, 20u, 16u, 15u, 14u, 13u, 12u, 12u, 13u, 15u, 20u, 24u, 27u, 29u, 34u, 37u, 35u, 30u, 34u, 37u, 43u, 47u, 44u, 37u, 38u, 50u, 53u, 51u, 59u, 62u, 59u, 59u, 64u, 64u, 62u, 62u, 69u, 67u, 62u, 60u, 65u, 63u, 69u, 74u, 76u, 86u, 102u, 106u, 120u, 134u, 139u, 143u }, 
-	{ 101u, 109u, 109u, 112u, 128u, 135u, 133u, 125u, 119u, 110u, 105u, 105u, 98u, 95u, 89u, 89u, 92u, 100u, 107u, 104u, 108u, 102u, 100u, 99u, 89u, 74u, 58u, 42u, 37u, 39u, 51u, 60u, 78u, 95u, 104u, 109u, 122u, 136u, 133u, 101u, 79u, 70u, 66u, 59u, 69u, 85u, 93u, 96u, 113u, 130u, 147u, 169u, 174u, 157u, 147u, 141u, 134u, 128u, 112u, 119u, 119u, 117u, 118u, 121u, 119u, 105u, 99u, 94u, 102u, 114u, 119u, 131u, 136u, 137u, 144u, 148u, 163u, 173u, 187u, 197u, 200u, 204u, 197u, 187u, 183u, 188u, 190u, 192u, 192u, 189u, 187u, 183u, 182u, 183u, 177u, 174u, 173u, 187u, 203u, 207u, 212u, 210u, 202u, 197u, 209u, 215u, 216u, 214u, 210u, 216u, 216u, 217u, 213u, 206u, 200u, 195u, 196u, 197u, 195u, 191u, 185u, 178u, 173u, 168u, 160u, 156u, 148u, 144u, 144u, 142u, 136u, 130u, 126u, 128u, 132u, 135u, 142u, 140u, 131u, 123u, 116u, 111u, 95u, 83u, 69u, 65u, 60u, 56u, 58u, 59u, 61u, 69u, 83u, 92u, 85u, 78u, 79u, 69u, 68u, 63u, 64u, 62u, 63u, 60u, 50u, 39u, 34u, 29u, 28u, 30u, 32u, 36u, 42u, 47u, 48u, 50u, 52u, 46u, 30u, 22u, 23u, 21u, 14u, 12u, 14u, 18u, 24u, 34u, 42u, 48u, 58u, 64u, 63u, 68u, 73u, 67u, 67u, 70u, 58u, 49u, 46u, 40u, 33u, 30u, 25u, 20u, 16u, 13u, 13u, 13u, 13u, 13u, 13u, 15u, 18u, 22u, 25u, 29u, 32u, 34u, 34u, 32u, 33u, 39u, 46u, 51u, 47u, 49u, 54u, 63u, 68u, 66u, 66u, 65u, 62u, 65u, 68u, 67u, 64u, 56u, 60u, 66u, 70u, 71u, 74u, 65u, 70u, 73u, 76u, 94u, 112u, 115u, 128u, 138u, 135u, 132u }, 
-	{ 98u, 99u, 106u, 121u, 133u, 144u, 139u, 133u, 136u, 118u, 104u, 103u, 104u, 99u, 93u, 93u, 98u, 108u, 122u, 115u, 118u, 113u, 109u, 93u, 83u, 76u, 61u, 46u, 40u, 41u, 51u, 63u, 82u, 98u, 115u, 122u, 127u, 150u, 151u, 119u, 103u, 94u, 90u, 87u, 91u, 91u, 106u, 114u, 125u, 149u, 160u, 179u, 186u, 170u, 155u, 141u, 137u, 123u, 111u, 119u, 125u, 131u, 125u, 124u, 132u, 121u, 110u, 113u, 111u, 113u, 122u, 132u, 134u, 133u, 134u, 140u, 155u, 164u, 165u, 176u, 184u, 196u, 195u, 189u, 183u, 186u, 189u, 192u, 191u, 186u, 188u, 194u, 191u, 189u, 177u, 177u, 174u, 181u, 194u, 205u, 211u, 207u, 199u, 200u, 202u, 200u, 208u, 207u, 207u, 208u, 213u, 215u, 212u, 205u, 203u, 198u, 195u, 194u, 189u, 182u, 173u, 167u, 162u, 156u, 152u, 151u, 141u, 136u, 138u, 138u, 136u, 126u, 122u, 125u, 132u, 133u, 137u, 133u, 126u, 116u, 112u, 103u, 90u, 83u, 71u, 66u, 68u, 66u, 68u, 69u, 67u, 74u, 87u, 93u, 89u, 86u, 86u, 78u, 76u, 73u, 75u, 72u, 72u, 67u, 53u, 40u, 31u, 28u, 29u, 34u, 33u, 35u, 38u, 49u, 52u, 53u, 49u, 43u, 32u, 26u, 25u, 23u, 14u, 11u, 16u, 19u, 25u, 31u, 41u, 47u, 57u, 61u, 58u, 57u, 61u, 66u, 61u, 60u, 52u, 47u, 41u, 35u, 33u, 29u, 23u, 18u, 16u, 13u, 13u, 13u, 13u, 13u, 14u, 15u, 16u, 20u, 24u, 28u, 31u, 36u, 34u, 31u, 31u, 39u, 48u, 54u, 60u, 66u, 81u, 81u, 82u, 78u, 68u, 71u, 65u, 66u, 69u, 64u, 61u, 57u, 56u, 63u, 69u, 71u, 77u, 68u, 71u, 73u, 83u, 99u, 117u, 121u, 134u, 138u, 137u, 140u }, 
-	{ 88u, 90u, 111u, 127u, 141u, 153u, 153u, 144u, 139u, 121u, 103u, 98u, 101u, 101u, 101u, 110u, 115u, 123u, 140u, 139u, 137u, 124u, 109u, 90u, 81u, 71u, 59u, 49u, 41u, 45u, 55u, 70u, 83u, 99u, 119u, 130u, 145u, 159u, 166u, 146u, 132u, 129u, 122u, 120u, 123u, 119u, 117u, 128u, 142u, 162u, 171u, 184u, 188u, 179u, 162u, 141u, 125u, 116u, 109u, 124u, 129u, 143u, 142u, 129u, 130u, 131u, 127u, 122u, 116u, 118u, 125u, 132u, 133u, 129u, 128u, 131u, 141u, 147u, 150u, 158u, 169u, 181u, 189u, 189u, 189u, 193u, 200u, 208u, 208u, 201u, 200u, 201u, 190u, 183u, 174u, 171u, 171u, 178u, 190u, 198u, 206u, 204u, 194u, 193u, 196u, 194u, 198u, 199u, 203u, 204u, 210u, 213u, 206u, 197u, 198u, 193u, 190u, 185u, 179u, 169u, 162u, 158u, 156u, 150u, 147u, 147u, 141u, 136u, 134u, 134u, 129u, 123u, 122u, 128u, 136u, 138u, 136u, 131u, 123u, 118u, 108u, 91u, 82u, 79u, 69u, 66u, 68u, 70u, 72u, 72u, 75u, 80u, 93u, 98u, 95u, 91u, 87u, 80u, 76u, 78u, 80u, 77u, 75u, 67u, 50u, 35u, 27u, 23u, 26u, 34u, 33u, 34u, 34u, 43u, 48u, 48u, 45u, 42u, 38u, 31u, 26u, 22u, 17u, 15u, 19u, 23u, 26u, 30u, 32u, 35u, 45u, 52u, 49u, 48u, 53u, 55u, 58u, 56u, 50u, 41u, 34u, 30u, 28u, 25u, 20u, 17u, 15u, 12u, 12u, 12u, 14u, 13u, 15u, 16u, 16u, 18u, 21u, 26u, 28u, 32u, 32u, 29u, 32u, 39u, 47u, 58u, 68u, 84u, 97u, 94u, 96u, 91u, 77u, 82u, 81u, 74u, 69u, 71u, 72u, 67u, 63u, 65u, 70u, 76u, 81u, 75u, 76u, 90u, 98u, 111u, 123u, 133u, 143u, 142u, 141u, 147u }, 
-	{ 75u, 93u, 117u, 130u, 150u, 160u, 167u, 165u, 151u, 129u, 111u, 106u, 113u, 119u, 123u, 126u, 130u, 132u, 150u, 158u, 157u, 132u, 114u, 101u, 86u, 74u, 60u, 47u, 39u, 44u, 51u, 67u, 80u, 104u, 128u, 140u, 155u, 159u, 166u, 170u, 174u, 172u, 163u, 161u, 150u, 141u, 142u, 149u, 157u, 170u, 172u, 179u, 182u, 175u, 151u, 140u, 126u, 114u, 107u, 117u, 124u, 141u, 141u, 138u, 126u, 125u, 135u, 129u, 126u, 125u, 130u, 135u, 135u, 124u, 117u, 123u, 133u, 138u, 143u, 142u, 157u, 168u, 173u, 176u, 184u, 198u, 208u, 212u, 212u, 204u, 198u, 198u, 184u, 179u, 179u, 172u, 171u, 176u, 187u, 195u, 200u, 201u, 199u, 193u, 190u, 188u, 185u, 191u, 200u, 198u, 200u, 202u, 196u, 195u, 195u, 187u, 182u, 174u, 166u, 160u, 158u, 154u, 153u, 149u, 150u, 146u, 141u, 137u, 134u, 134u, 129u, 125u, 124u, 127u, 132u, 136u, 136u, 134u, 126u, 119u, 103u, 94u, 87u, 78u, 69u, 66u, 65u, 70u, 73u, 76u, 78u, 78u, 86u, 97u, 100u, 99u, 88u, 82u, 79u, 84u, 80u, 71u, 64u, 59u, 46u, 33u, 28u, 24u, 26u, 32u, 33u, 36u, 37u, 44u, 44u, 43u, 40u, 38u, 39u, 31u, 27u, 22u, 20u, 17u, 20u, 22u, 23u, 24u, 27u, 31u, 41u, 42u, 38u, 35u, 43u, 45u, 47u, 44u, 43u, 38u, 32u, 28u, 26u, 24u, 20u, 16u, 14u, 12u, 11u, 11u, 12u, 13u, 15u, 16u, 17u, 17u, 19u, 24u, 27u, 28u, 29u, 28u, 33u, 39u, 48u, 57u, 65u, 82u, 101u, 105u, 105u, 106u, 90u, 84u, 88u, 93u, 87u, 92u, 84u, 78u, 73u, 78u, 78u, 81u, 83u, 89u, 99u, 111u, 118u, 131u, 132u, 140u, 138u, 135u, 137u, 141u }, 
-	{ 74u, 93u, 103u, 119u, 135u, 148u, 158u, 164u, 156u, 134u, 121u, 121u, 128u, 132u, 148u, 150u, 150u, 150u, 158u, 162u, 163u, 144u, 126u, 112u, 92u, 81u, 63u, 46u, 40u, 39u, 48u, 64u, 83u, 108u, 128u, 138u, 137u, 161u, 177u, 194u, 189u, 180u, 164u, 161u, 161u, 161u, 158u, 158u, 163u, 163u, 168u, 186u, 191u, 178u, 154u, 136u, 128u, 122u, 118u, 116u, 115u, 127u, 134u, 135u, 130u, 127u, 131u, 129u, 125u, 130u, 133u, 144u, 141u, 132u, 125u, 131u, 138u, 140u, 138u, 135u, 145u, 153u, 160u, 169u, 176u, 190u, 205u, 207u, 206u, 206u, 199u, 192u, 187u, 181u, 182u, 179u, 176u, 175u, 188u, 187u, 185u, 196u, 199u, 192u, 197u, 190u, 184u, 185u, 194u, 196u, 192u, 187u, 189u, 194u, 190u, 186u, 179u, 170u, 162u, 160u, 159u, 155u, 152u, 153u, 152u, 149u, 143u, 140u, 136u, 135u, 129u, 126u, 125u, 129u, 129u, 135u, 136u, 131u, 126u, 115u, 108u, 100u, 96u, 85u, 73u, 70u, 70u, 72u, 74u, 74u, 77u, 82u, 90u, 104u, 103u, 102u, 89u, 92u, 96u, 98u, 88u, 74u, 63u, 58u, 46u, 33u, 28u, 28u, 27u, 30u, 29u, 32u, 36u, 40u, 42u, 44u, 45u, 40u, 38u, 33u, 27u, 23u, 21u, 16u, 17u, 17u, 16u, 15u, 18u, 25u, 33u, 34u, 31u, 28u, 34u, 42u, 42u, 39u, 40u, 36u, 31u, 27u, 25u, 23u, 19u, 16u, 14u, 12u, 11u, 10u, 11u, 13u, 14u, 15u, 15u, 18u, 18u, 22u, 25u, 26u, 31u, 35u, 40u, 51u, 55u, 56u, 66u, 85u, 93u, 104u, 111u, 110u, 95u, 83u, 89u, 100u, 101u, 102u, 100u, 91u, 87u, 89u, 85u, 84u, 90u, 94u, 108u, 121u, 134u, 147u, 145u, 146u, 138u, 130u, 135u, 135u }, 
-	{ 87u, 96u, 98u, 105u, 123u, 136u, 144u, 148u, 143u, 133u, 123u, 131u, 137u, 148u, 167u, 176u, 175u, 173u, 162u, 160u, 162u, 151u, 130u, 111u, 89u, 81u, 70u, 50u, 37u, 35u, 44u, 57u, 81u, 105u, 126u, 134u, 135u, 161u, 176u, 186u, 179u, 176u, 155u, 143u, 146u, 152u, 163u, 167u, 159u, 164u, 173u, 186u, 182u, 167u, 151u, 130u, 118u, 116u, 115u, 112u, 117u, 127u, 132u, 132u, 132u, 135u, 141u, 136u, 124u, 131u, 138u, 151u, 149u, 141u, 139u, 145u, 149u, 140u, 137u, 144u, 150u, 149u, 155u, 162u, 167u, 179u, 195u, 203u, 203u, 204u, 202u, 199u, 192u, 188u, 194u, 190u, 180u, 183u, 189u, 186u, 182u, 193u, 198u, 201u, 205u, 199u, 185u, 176u, 187u, 194u, 188u, 185u, 187u, 189u, 186u, 180u, 172u, 165u, 162u, 158u, 159u, 158u, 153u, 153u, 151u, 150u, 147u, 142u, 137u, 135u, 130u, 127u, 126u, 131u, 131u, 131u, 132u, 129u, 128u, 118u, 115u, 109u, 107u, 95u, 79u, 76u, 79u, 76u, 77u, 80u, 82u, 88u, 94u, 103u, 111u, 108u, 99u, 101u, 105u, 101u, 91u, 85u, 67u, 52u, 42u, 31u, 26u, 28u, 28u, 25u, 24u, 27u, 28u, 31u, 39u, 46u, 47u, 46u, 41u, 34u, 27u, 22u, 17u, 14u, 13u, 12u, 11u, 10u, 13u, 19u, 26u, 28u, 29u, 28u, 35u, 42u, 42u, 39u, 37u, 32u, 30u, 27u, 25u, 21u, 17u, 15u, 13u, 12u, 10u, 10u, 11u, 13u, 14u, 14u, 15u, 16u, 17u, 21u, 24u, 28u, 34u, 40u, 48u, 57u, 57u, 58u, 70u, 88u, 99u, 110u, 111u, 110u, 103u, 97u, 98u, 103u, 101u, 102u, 108u, 105u, 102u, 103u, 94u, 89u, 88u, 89u, 104u, 127u, 146u, 164u, 165u, 162u, 148u, 136u, 134u, 138u }, 
-	{ 88u, 91u, 87u, 88u, 108u, 122u, 129u, 135u, 131u, 139u, 143u, 148u, 146u, 156u, 170u, 177u, 174u, 174u, 170u, 164u, 159u, 145u, 123u, 110u, 94u, 86u, 70u, 57u, 42u, 40u, 53u, 66u, 85u, 97u, 112u, 125u, 131u, 151u, 169u, 175u, 177u, 170u, 152u, 152u, 155u, 156u, 166u, 179u, 162u, 167u, 172u, 172u, 160u, 142u, 130u, 109u, 91u, 88u, 93u, 90u, 98u, 113u, 120u, 122u, 131u, 148u, 153u, 149u, 138u, 137u, 146u, 155u, 151u, 144u, 146u, 147u, 148u, 152u, 152u, 157u, 166u, 157u, 154u, 160u, 164u, 182u, 193u, 198u, 196u, 197u, 200u, 199u, 193u, 196u, 197u, 189u, 186u, 193u, 192u, 187u, 183u, 193u, 195u, 206u, 206u, 200u, 188u, 183u, 182u, 188u, 186u, 185u, 186u, 185u, 183u, 177u, 166u, 159u, 157u, 157u, 159u, 158u, 155u, 154u, 147u, 144u, 144u, 142u, 138u, 136u, 128u, 123u, 122u, 127u, 131u, 136u, 136u, 136u, 130u, 119u, 121u, 119u, 115u, 103u, 91u, 86u, 83u, 80u, 83u, 85u, 89u, 95u, 96u, 93u, 104u, 116u, 116u, 113u, 111u, 105u, 109u, 102u, 70u, 48u, 37u, 30u, 29u, 28u, 24u, 24u, 26u, 26u, 27u, 32u, 36u, 44u, 42u, 39u, 37u, 34u, 25u, 22u, 17u, 12u, 9u, 8u, 10u, 11u, 13u, 16u, 20u, 23u, 29u, 28u, 32u, 36u, 35u, 31u, 30u, 28u, 27u, 24u, 24u, 20u, 17u, 15u, 14u, 12u, 10u, 11u, 11u, 12u, 13u, 14u, 14u, 14u, 16u, 23u, 30u, 34u, 38u, 45u, 51u, 53u, 52u, 55u, 70u, 82u, 98u, 109u, 117u, 112u, 107u, 100u, 96u, 104u, 102u, 103u, 110u, 112u, 112u, 110u, 102u, 99u, 99u, 97u, 111u, 134u, 157u, 174u, 174u, 168u, 155u, 148u, 146u, 146u }, 
-	{ 87u, 82u, 78u, 88u, 101u, 112u, 120u, 132u, 136u, 151u, 159u, 151u, 150u, 152u, 169u, 175u, 180u, 182u, 179u, 171u, 163u, 143u, 128u, 115u, 105u, 96u, 82u, 65u, 56u, 46u, 49u, 68u, 83u, 98u, 111u, 132u, 139u, 144u, 151u, 154u, 161u, 161u, 156u, 161u, 156u, 160u, 164u, 172u, 167u, 167u, 171u, 166u, 147u, 127u, 112u, 100u, 72u, 70u, 73u, 66u, 78u, 95u, 108u, 116u, 135u, 159u, 167u, 165u, 149u, 137u, 146u, 151u, 152u, 143u, 146u, 145u, 153u, 161u, 159u, 162u, 166u, 167u, 164u, 164u, 172u, 183u, 186u, 187u, 182u, 188u, 198u, 198u, 201u, 198u, 194u, 197u, 193u, 192u, 188u, 179u, 178u, 185u, 187u, 200u, 204u, 201u, 196u, 189u, 182u, 177u, 177u, 182u, 183u, 182u, 182u, 176u, 162u, 156u, 155u, 160u, 160u, 161u, 159u, 156u, 146u, 144u, 146u, 144u, 139u, 140u, 134u, 126u, 126u, 128u, 134u, 138u, 137u, 136u, 132u, 127u, 127u, 127u, 118u, 108u, 99u, 87u, 87u, 88u, 86u, 91u, 102u, 101u, 101u, 97u, 103u, 114u, 124u, 110u, 101u, 103u, 110u, 102u, 75u, 49u, 33u, 29u, 30u, 27u, 23u, 22u, 25u, 25u, 27u, 34u, 34u, 35u, 31u, 31u, 38u, 34u, 29u, 22u, 20u, 16u, 10u, 8u, 9u, 11u, 14u, 16u, 19u, 22u, 27u, 29u, 30u, 31u, 31u, 27u, 25u, 26u, 24u, 22u, 21u, 19u, 17u, 15u, 14u, 13u, 11u, 11u, 12u, 13u, 14u, 13u, 13u, 15u, 18u, 24u, 33u, 39u, 44u, 50u, 53u, 51u, 49u, 53u, 64u, 76u, 88u, 108u, 114u, 112u, 107u, 99u, 104u, 108u, 108u, 114u, 114u, 119u, 113u, 116u, 116u, 107u, 108u, 115u, 125u, 149u, 171u, 181u, 180u, 175u, 162u, 157u, 154u, 153u }, 
-	{ 77u, 78u, 86u, 92u, 95u, 101u, 109u, 117u, 133u, 157u, 168u, 159u, 154u, 161u, 169u, 175u, 183u, 185u, 175u, 170u, 164u, 152u, 134u, 122u, 120u, 112u, 98u, 72u, 62u, 55u, 48u, 57u, 65u, 83u, 109u, 133u, 141u, 138u, 144u, 152u, 161u, 163u, 162u, 177u, 168u, 167u, 160u, 158u, 150u, 155u, 155u, 143u, 125u, 112u, 106u, 94u, 72u, 68u, 65u, 62u, 71u, 84u, 92u, 114u, 137u, 164u, 177u, 174u, 162u, 148u, 151u, 152u, 152u, 152u, 153u, 152u, 165u, 172u, 171u, 173u, 168u, 167u, 163u, 167u, 177u, 181u, 181u, 178u, 177u, 187u, 206u, 210u, 214u, 211u, 206u, 205u, 195u, 186u, 173u, 165u, 167u, 171u, 181u, 192u, 196u, 196u, 193u, 187u, 179u, 175u, 178u, 178u, 177u, 184u, 182u, 176u, 170u, 165u, 161u, 165u, 167u, 169u, 164u, 159u, 157u, 154u, 152u, 146u, 142u, 140u, 139u, 133u, 131u, 138u, 144u, 148u, 145u, 142u, 141u, 138u, 137u, 136u, 125u, 111u, 102u, 94u, 91u, 93u, 95u, 104u, 112u, 111u, 106u, 106u, 109u, 117u, 121u, 108u, 102u, 101u, 96u, 97u, 83u, 60u, 40u, 28u, 26u, 27u, 27u, 23u, 24u, 26u, 28u, 30u, 29u, 25u, 22u, 24u, 30u, 29u, 26u, 22u, 20u, 15u, 10u, 8u, 9u, 11u, 14u, 16u, 17u, 18u, 23u, 27u, 27u, 27u, 28u, 26u, 23u, 21u, 18u, 18u, 20u, 18u, 15u, 14u, 13u, 13u, 12u, 12u, 14u, 15u, 15u, 13u, 14u, 18u, 23u, 25u, 31u, 39u, 44u, 49u, 58u, 58u, 54u, 49u, 57u, 73u, 80u, 96u, 103u, 104u, 107u, 101u, 106u, 109u, 115u, 124u, 124u, 124u, 118u, 120u, 116u, 109u, 108u, 121u, 139u, 164u, 181u, 195u, 193u, 191u, 182u, 175u, 168u, 162u }, 
-	{ 76u, 85u, 90u, 77u, 73u, 82u, 93u, 111u, 133u, 155u, 158u, 154u, 157u, 159u, 153u, 162u, 174u, 179u, 171u, 169u, 165u, 151u, 128u, 116u, 114u, 109u, 100u, 78u, 66u, 52u, 42u, 48u, 58u, 66u, 97u, 132u, 150u, 152u, 157u, 170u, 174u, 178u, 169u, 172u, 171u, 165u, 150u, 145u, 140u, 134u, 132u, 122u, 107u, 100u, 97u, 87u, 76u, 67u, 59u, 64u, 64u, 84u, 92u, 103u, 117u, 146u, 166u, 162u, 156u, 151u, 152u, 152u, 153u, 169u, 173u, 175u, 181u, 181u, 177u, 172u, 168u, 166u, 160u, 166u, 179u, 183u, 187u, 180u, 186u, 194u, 208u, 216u, 219u, 216u, 215u, 206u, 198u, 190u, 178u, 169u, 175u, 173u, 178u, 182u, 189u, 188u, 183u, 181u, 179u, 179u, 182u, 186u, 187u, 187u, 179u, 179u, 173u, 167u, 161u, 165u, 172u, 177u, 177u, 172u, 167u, 160u, 155u, 152u, 152u, 146u, 141u, 142u, 142u, 148u, 152u, 154u, 152u, 145u, 142u, 141u, 141u, 135u, 126u, 111u, 104u, 105u, 102u, 105u, 107u, 115u, 112u, 110u, 106u, 107u, 102u, 106u, 109u, 102u, 99u, 100u, 97u, 92u, 77u, 62u, 47u, 29u, 24u, 23u, 23u, 23u, 22u, 25u, 28u, 24u, 21u, 18u, 17u, 19u, 22u, 24u, 23u, 20u, 20u, 16u, 13u, 9u, 8u, 10u, 12u, 14u, 15u, 16u, 21u, 26u, 27u, 26u, 25u, 24u, 20u, 19u, 15u, 15u, 17u, 18u, 17u, 15u, 13u, 13u, 12u, 13u, 14u, 17u, 17u, 17u, 17u, 20u, 25u, 28u, 35u, 44u, 47u, 53u, 58u, 56u, 51u, 46u, 59u, 70u, 80u, 94u, 107u, 104u, 105u, 105u, 111u, 115u, 126u, 136u, 133u, 136u, 135u, 124u, 114u, 112u, 113u, 126u, 154u, 175u, 183u, 195u, 200u, 201u, 192u, 185u, 181u, 179u }, 
-	{ 75u, 83u, 83u, 64u, 57u, 74u, 88u, 107u, 130u, 145u, 144u, 134u, 139u, 140u, 132u, 145u, 157u, 161u, 158u, 156u, 162u, 149u, 131u, 114u, 105u, 96u, 96u, 83u, 66u, 58u, 49u, 50u, 56u, 67u, 98u, 130u, 159u, 163u, 173u, 181u, 185u, 180u, 176u, 168u, 169u, 153u, 137u, 138u, 144u, 135u, 124u, 106u, 98u, 88u, 93u, 89u, 76u, 73u, 75u, 77u, 74u, 78u, 92u, 93u, 100u, 124u, 155u, 152u, 150u, 155u, 149u, 155u, 166u, 180u, 184u, 187u, 191u, 183u, 175u, 171u, 170u, 159u, 159u, 163u, 177u, 187u, 196u, 192u, 195u, 203u, 214u, 221u, 222u, 213u, 210u, 212u, 212u, 205u, 198u, 182u, 179u, 177u, 181u, 183u, 179u, 180u, 180u, 183u, 177u, 179u, 182u, 194u, 195u, 190u, 185u, 181u, 172u, 166u, 163u, 167u, 176u, 180u, 182u, 180u, 174u, 167u, 162u, 159u, 157u, 154u, 150u, 147u, 149u, 155u, 160u, 158u, 151u, 146u, 140u, 143u, 142u, 135u, 124u, 112u, 113u, 117u, 117u, 118u, 123u, 125u, 118u, 116u, 110u, 103u, 97u, 101u, 99u, 104u, 106u, 103u, 104u, 92u, 82u, 68u, 52u, 38u, 30u, 22u, 20u, 19u, 19u, 21u, 24u, 21u, 20u, 18u, 16u, 18u, 23u, 23u, 21u, 21u, 19u, 16u, 14u, 10u, 9u, 9u, 12u, 13u, 13u, 14u, 20u, 23u, 24u, 24u, 20u, 19u, 16u, 15u, 14u, 15u, 16u, 17u, 17u, 15u, 14u, 14u, 14u, 14u, 15u, 17u, 20u, 19u, 19u, 23u, 28u, 34u, 40u, 44u, 52u, 58u, 60u, 55u, 51u, 47u, 54u, 69u, 81u, 94u, 112u, 113u, 114u, 116u, 121u, 129u, 140u, 145u, 147u, 145u, 145u, 138u, 127u, 123u, 117u, 129u, 151u, 169u, 183u, 189u, 197u, 197u, 192u, 188u, 182u, 183u }, 
-	{ 79u, 72u, 66u, 59u, 63u, 72u, 83u, 102u, 123u, 139u, 141u, 125u, 121u, 129u, 124u, 125u, 134u, 142u, 150u, 146u, 148u, 139u, 128u, 114u, 110u, 98u, 88u, 77u, 65u, 59u, 60u, 60u, 61u, 70u, 93u, 127u, 161u, 170u, 182u, 191u, 187u, 173u, 169u, 156u, 151u, 142u, 136u, 133u, 134u, 115u, 101u, 99u, 91u, 79u, 81u, 83u, 81u, 80u, 77u, 83u, 84u, 78u, 85u, 76u, 86u, 119u, 140u, 139u, 148u, 157u, 152u, 161u, 176u, 186u, 192u, 187u, 184u, 179u, 176u, 169u, 171u, 161u, 155u, 167u, 185u, 196u, 205u, 204u, 211u, 216u, 224u, 227u, 226u, 220u, 218u, 222u, 216u, 208u, 204u, 191u, 178u, 174u, 180u, 186u, 184u, 177u, 173u, 180u, 180u, 180u, 183u, 194u, 194u, 192u, 189u, 183u, 175u, 171u, 170u, 173u, 179u, 185u, 186u, 183u, 178u, 173u, 171u, 168u, 161u, 155u, 156u, 152u, 155u, 159u, 163u, 164u, 158u, 151u, 145u, 145u, 141u, 135u, 128u, 121u, 119u, 126u, 130u, 130u, 136u, 142u, 137u, 130u, 118u, 108u, 105u, 109u, 106u, 103u, 106u, 103u, 102u, 86u, 78u, 67u, 51u, 43u, 32u, 24u, 24u, 21u, 20u, 20u, 22u, 21u, 19u, 19u, 18u, 20u, 24u, 23u, 18u, 19u, 19u, 17u, 16u, 10u, 9u, 10u, 14u, 14u, 13u, 15u, 18u, 19u, 20u, 21u, 18u, 18u, 16u, 16u, 15u, 14u, 16u, 16u, 16u, 13u, 14u, 16u, 16u, 16u, 17u, 21u, 25u, 25u, 24u, 27u, 30u, 36u, 41u, 45u, 54u, 59u, 65u, 59u, 52u, 48u, 54u, 64u, 79u, 96u, 113u, 123u, 132u, 136u, 141u, 147u, 155u, 162u, 159u, 160u, 165u, 161u, 151u, 141u, 136u, 143u, 155u, 163u, 179u, 189u, 200u, 203u, 199u, 194u, 189u, 194u }, 
-	{ 71u, 63u, 51u, 58u, 59u, 61u, 78u, 97u, 112u, 136u, 142u, 122u, 112u, 116u, 118u, 122u, 124u, 128u, 132u, 137u, 131u, 132u, 130u, 125u, 109u, 104u, 91u, 80u, 76u, 62u, 59u, 57u, 58u, 77u, 88u, 115u, 142u, 163u, 174u, 195u, 185u, 167u, 174u, 162u, 142u, 145u, 132u, 123u, 127u, 106u, 74u, 72u, 75u, 71u, 73u, 79u, 97u, 89u, 80u, 92u, 89u, 77u, 74u, 70u, 88u, 112u, 135u, 141u, 149u, 157u, 157u, 163u, 179u, 184u, 187u, 177u, 177u, 175u, 178u, 171u, 162u, 162u, 161u, 173u, 182u, 190u, 198u, 205u, 213u, 215u, 224u, 231u, 229u, 227u, 224u, 225u, 214u, 201u, 197u, 182u, 171u, 169u, 177u, 186u, 178u, 174u, 169u, 181u, 193u, 191u, 193u, 195u, 193u, 191u, 187u, 183u, 179u, 178u, 181u, 184u, 185u, 188u, 187u, 184u, 179u, 175u, 175u, 170u, 162u, 159u, 158u, 157u, 159u, 164u, 166u, 170u, 170u, 161u, 155u, 151u, 148u, 143u, 134u, 128u, 128u, 138u, 142u, 145u, 149u, 154u, 155u, 145u, 137u, 122u, 121u, 120u, 116u, 104u, 99u, 95u, 91u, 81u, 79u, 63u, 46u, 43u, 36u, 29u, 27u, 23u, 21u, 20u, 20u, 20u, 21u, 20u, 18u, 20u, 20u, 19u, 18u, 21u, 21u, 17u, 14u, 12u, 11u, 13u, 16u, 15u, 14u, 14u, 13u, 16u, 19u, 19u, 18u, 18u, 16u, 16u, 18u, 17u, 17u, 18u, 16u, 14u, 14u, 16u, 18u, 19u, 21u, 27u, 29u, 31u, 32u, 37u, 37u, 40u, 44u, 44u, 52u, 60u, 63u, 59u, 51u, 49u, 58u, 69u, 75u, 94u, 105u, 123u, 133u, 141u, 149u, 159u, 161u, 178u, 177u, 178u, 177u, 172u, 169u, 156u, 155u, 162u, 170u, 175u, 184u, 189u, 202u, 208u, 210u, 203u, 201u, 196u }, 
-	{ 61u, 55u, 47u, 48u, 55u, 57u, 72u, 89u, 120u, 144u, 145u, 127u, 114u, 117u, 118u, 124u, 118u, 114u, 114u, 121u, 124u, 127u, 134u, 124u, 103u, 97u, 89u, 90u, 80u, 66u, 65u, 60u, 61u, 78u, 95u, 110u, 138u, 153u, 166u, 176u, 177u, 172u, 171u, 168u, 154u, 142u, 123u, 115u, 117u, 106u, 78u, 64u, 60u, 64u, 66u, 78u, 89u, 87u, 86u, 99u, 86u, 67u, 61u, 71u, 88u, 112u, 138u, 146u, 151u, 160u, 161u, 166u, 183u, 187u, 183u, 177u, 173u, 173u, 175u, 169u, 164u, 164u, 169u, 178u, 187u, 187u, 190u, 199u, 205u, 209u, 223u, 231u, 231u, 233u, 229u, 221u, 215u, 203u, 188u, 178u, 167u, 169u, 176u, 181u, 179u, 176u, 178u, 185u, 194u, 196u, 198u, 193u, 187u, 187u, 186u, 185u, 184u, 187u, 187u, 188u, 187u, 189u, 188u, 183u, 179u, 178u, 176u, 170u, 165u, 163u, 162u, 160u, 161u, 165u, 167u, 174u, 178u, 171u, 160u, 155u, 152u, 150u, 144u, 138u, 136u, 141u, 154u, 161u, 159u, 161u, 158u, 155u, 150u, 143u, 137u, 124u, 120u, 112u, 100u, 97u, 90u, 85u, 79u, 61u, 51u, 47u, 40u, 31u, 30u, 26u, 22u, 21u, 20u, 23u, 23u, 21u, 21u, 21u, 20u, 20u, 20u, 24u, 24u, 18u, 14u, 14u, 13u, 15u, 16u, 16u, 16u, 14u, 14u, 15u, 17u, 18u, 18u, 18u, 18u, 16u, 18u, 17u, 18u, 18u, 17u, 17u, 16u, 18u, 22u, 24u, 26u, 30u, 35u, 40u, 43u, 41u, 41u, 41u, 45u, 51u, 57u, 63u, 66u, 57u, 49u, 54u, 68u, 73u, 80u, 93u, 107u, 122u, 137u, 150u, 158u, 169u, 172u, 179u, 181u, 186u, 187u, 176u, 173u, 171u, 176u, 180u, 183u, 184u, 183u, 188u, 201u, 212u, 213u, 209u, 207u, 192u }, 
-	{ 51u, 50u, 56u, 54u, 47u, 52u, 71u, 96u, 119u, 129u, 130u, 128u, 127u, 131u, 128u, 132u, 137u, 131u, 120u, 118u, 118u, 122u, 128u, 115u, 100u, 97u, 93u, 91u, 83u, 78u, 71u, 66u, 75u, 81u, 102u, 121u, 144u, 154u, 160u, 159u, 170u, 178u, 172u, 172u, 162u, 144u, 124u, 110u, 111u, 108u, 89u, 71u, 53u, 55u, 56u, 63u, 65u, 75u, 76u, 86u, 95u, 80u, 70u, 69u, 83u, 113u, 145u, 158u, 158u, 159u, 162u, 178u, 187u, 185u, 180u, 177u, 171u, 173u, 174u, 172u, 165u, 161u, 165u, 178u, 190u, 190u, 192u, 202u, 206u, 210u, 222u, 228u, 226u, 224u, 218u, 207u, 205u, 203u, 191u, 180u, 173u, 176u, 187u, 188u, 183u, 181u, 186u, 189u, 193u, 194u, 190u, 185u, 181u, 178u, 181u, 185u, 186u, 189u, 188u, 189u, 187u, 187u, 186u, 182u, 179u, 179u, 175u, 167u, 165u, 162u, 161u, 159u, 162u, 166u, 168u, 174u, 179u, 175u, 167u, 156u, 149u, 151u, 151u, 149u, 145u, 142u, 152u, 165u, 165u, 162u, 156u, 155u, 158u, 157u, 143u, 132u, 125u, 111u, 97u, 94u, 92u, 85u, 72u, 62u, 52u, 45u, 45u, 38u, 35u, 31u, 25u, 22u, 22u, 25u, 22u, 19u, 20u, 21u, 20u, 20u, 24u, 27u, 25u, 21u, 17u, 16u, 13u, 15u, 18u, 18u, 19u, 18u, 18u, 18u, 21u, 20u, 19u, 18u, 18u, 17u, 18u, 18u, 17u, 18u, 18u, 18u, 19u, 22u, 27u, 30u, 33u, 34u, 40u, 47u, 54u, 47u, 39u, 37u, 45u, 52u, 56u, 65u, 67u, 60u, 58u, 63u, 75u, 86u, 98u, 109u, 119u, 134u, 151u, 165u, 171u, 174u, 173u, 173u, 183u, 188u, 188u, 180u, 175u, 173u, 184u, 187u, 185u, 182u, 178u, 184u, 191u, 201u, 203u, 203u, 204u, 188u }, 
-	{ 49u, 51u, 58u, 56u, 49u, 53u, 68u, 89u, 101u, 117u, 126u, 140u, 142u, 150u, 148u, 154u, 160u, 143u, 126u, 117u, 118u, 126u, 130u, 123u, 114u, 97u, 92u, 92u, 89u, 84u, 71u, 80u, 85u, 90u, 115u, 132u, 150u, 170u, 176u, 174u, 175u, 182u, 179u, 183u, 182u, 169u, 152u, 133u, 127u, 124u, 98u, 69u, 50u, 53u, 51u, 50u, 47u, 57u, 67u, 71u, 83u, 85u, 72u, 75u, 89u, 116u, 142u, 150u, 154u, 158u, 170u, 179u, 180u, 181u, 181u, 180u, 175u, 175u, 170u, 168u, 164u, 162u, 166u, 180u, 184u, 183u, 187u, 197u, 202u, 209u, 217u, 219u, 219u, 214u, 203u, 199u, 200u, 194u, 194u, 189u, 187u, 183u, 192u, 194u, 189u, 188u, 193u, 194u, 191u, 191u, 186u, 180u, 177u, 176u, 178u, 184u, 186u, 185u, 186u, 188u, 188u, 186u, 185u, 181u, 178u, 175u, 171u, 163u, 160u, 161u, 164u, 161u, 163u, 164u, 163u, 166u, 173u, 173u, 169u, 158u, 155u, 156u, 160u, 158u, 155u, 148u, 154u, 164u, 167u, 163u, 156u, 152u, 155u, 163u, 151u, 138u, 121u, 110u, 98u, 90u, 92u, 83u, 71u, 60u, 55u, 46u, 49u, 49u, 42u, 36u, 32u, 28u, 24u, 21u, 19u, 18u, 18u, 20u, 21u, 22u, 25u, 29u, 28u, 21u, 20u, 17u, 14u, 14u, 17u, 18u, 19u, 20u, 21u, 22u, 24u, 24u, 20u, 18u, 20u, 18u, 19u, 20u, 19u, 20u, 20u, 21u, 24u, 25u, 31u, 36u, 37u, 38u, 42u, 52u, 61u, 56u, 45u, 40u, 46u, 54u, 56u, 65u, 75u, 71u, 73u, 78u, 85u, 96u, 114u, 125u, 135u, 146u, 157u, 163u, 172u, 169u, 164u, 164u, 170u, 178u, 179u, 180u, 181u, 178u, 184u, 187u, 185u, 180u, 177u, 172u, 175u, 185u, 190u, 194u, 198u, 182u }, 
-	{ 55u, 57u, 64u, 58u, 57u, 60u, 74u, 80u, 88u, 105u, 118u, 131u, 136u, 152u, 161u, 169u, 163u, 158u, 144u, 123u, 125u, 131u, 136u, 133u, 126u, 108u, 91u, 96u, 93u, 87u, 87u, 96u, 102u, 103u, 121u, 139u, 164u, 190u, 196u, 192u, 189u, 187u, 185u, 189u, 190u, 182u, 180u, 170u, 148u, 129u, 103u, 72u, 55u, 53u, 54u, 42u, 36u, 40u, 54u, 62u, 75u, 78u, 71u, 81u, 97u, 120u, 139u, 152u, 160u, 162u, 174u, 175u, 172u, 172u, 176u, 181u, 173u, 166u, 163u, 167u, 170u, 173u, 177u, 180u, 183u, 183u, 184u, 189u, 200u, 205u, 209u, 214u, 211u, 202u, 194u, 191u, 193u, 190u, 195u, 198u, 198u, 195u, 198u, 198u, 195u, 199u, 197u, 195u, 192u, 189u, 186u, 178u, 175u, 178u, 179u, 183u, 185u, 183u, 183u, 186u, 188u, 186u, 184u, 181u, 178u, 175u, 170u, 159u, 156u, 158u, 162u, 163u, 166u, 161u, 159u, 161u, 165u, 169u, 168u, 166u, 168u, 167u, 166u, 164u, 163u, 163u, 166u, 172u, 176u, 170u, 165u, 157u, 159u, 160u, 151u, 139u, 124u, 108u, 99u, 89u, 85u, 74u, 66u, 65u, 57u, 51u, 57u, 56u, 46u, 40u, 34u, 28u, 23u, 20u, 20u, 18u, 17u, 18u, 19u, 20u, 25u, 28u, 29u, 26u, 21u, 16u, 14u, 13u, 15u, 18u, 21u, 24u, 23u, 26u, 26u, 25u, 22u, 22u, 21u, 20u, 22u, 24u, 22u, 22u, 24u, 25u, 25u, 27u, 35u, 41u, 45u, 46u, 48u, 54u, 64u, 63u, 55u, 49u, 49u, 54u, 62u, 72u, 83u, 84u, 83u, 87u, 95u, 106u, 119u, 131u, 150u, 159u, 161u, 165u, 168u, 163u, 154u, 153u, 168u, 173u, 175u, 187u, 189u, 186u, 188u, 186u, 182u, 174u, 166u, 164u, 165u, 171u, 174u, 183u, 185u, 180u }, 
-	{ 63u, 75u, 93u, 85u, 86u, 85u, 97u, 100u, 98u, 105u, 118u, 127u, 133u, 145u, 157u, 161u, 154u, 163u, 150u, 130u, 131u, 142u, 143u, 139u, 129u, 116u, 99u, 98u, 93u, 98u, 105u, 110u, 108u, 117u, 135u, 144u, 164u, 180u, 191u, 190u, 195u, 187u, 183u, 183u, 184u, 179u, 183u, 183u, 157u, 142u, 122u, 88u, 65u, 49u, 43u, 38u, 37u, 36u, 51u, 59u, 67u, 70u, 70u, 74u, 96u, 129u, 136u, 151u, 156u, 154u, 164u, 168u, 166u, 160u, 164u, 172u, 170u, 170u, 169u, 169u, 173u, 178u, 180u, 178u, 186u, 191u, 193u, 195u, 196u, 199u, 205u, 207u, 203u, 198u, 194u, 193u, 189u, 187u, 189u, 193u, 200u, 202u, 201u, 201u, 205u, 205u, 200u, 198u, 194u, 187u, 182u, 175u, 174u, 178u, 180u, 186u, 186u, 185u, 184u, 186u, 188u, 185u, 182u, 181u, 179u, 175u, 170u, 164u, 159u, 159u, 164u, 168u, 170u, 164u, 162u, 160u, 163u, 168u, 171u, 175u, 181u, 175u, 167u, 163u, 167u, 173u, 173u, 174u, 177u, 173u, 180u, 175u, 168u, 158u, 150u, 137u, 129u, 116u, 112u, 101u, 89u, 80u, 76u, 69u, 59u, 55u, 60u, 55u, 46u, 41u, 36u, 30u, 25u, 23u, 22u, 21u, 19u, 18u, 21u, 23u, 27u, 28u, 29u, 28u, 21u, 17u, 16u, 14u, 15u, 19u, 24u, 25u, 23u, 27u, 27u, 26u, 24u, 23u, 19u, 19u, 22u, 25u, 26u, 26u, 29u, 27u, 25u, 29u, 37u, 43u, 47u, 49u, 53u, 63u, 73u, 72u, 62u, 57u, 52u, 52u, 64u, 71u, 80u, 85u, 86u, 88u, 99u, 118u, 130u, 142u, 150u, 157u, 159u, 163u, 167u, 162u, 161u, 159u, 169u, 176u, 178u, 185u, 187u, 189u, 189u, 187u, 182u, 169u, 155u, 152u, 151u, 153u, 159u, 172u, 172u, 169u }, 
-	{ 85u, 95u, 117u, 118u, 123u, 127u, 134u, 123u, 108u, 99u, 111u, 121u, 130u, 133u, 145u, 146u, 152u, 151u, 152u, 145u, 140u, 149u, 151u, 152u, 141u, 125u, 102u, 93u, 92u, 97u, 104u, 115u, 120u, 127u, 132u, 136u, 148u, 171u, 183u, 184u, 189u, 186u, 184u, 186u, 180u, 183u, 189u, 180u, 169u, 147u, 122u, 88u, 60u, 41u, 36u, 39u, 41u, 45u, 60u, 67u, 70u, 76u, 68u, 70u, 94u, 123u, 123u, 134u, 140u, 148u, 149u, 156u, 157u, 152u, 151u, 158u, 163u, 166u, 169u, 168u, 174u, 180u, 178u, 178u, 183u, 191u, 195u, 198u, 200u, 198u, 202u, 205u, 201u, 200u, 198u, 191u, 189u, 187u, 180u, 184u, 200u, 203u, 204u, 202u, 204u, 202u, 206u, 199u, 190u, 184u, 180u, 173u, 174u, 177u, 181u, 185u, 188u, 187u, 186u, 186u, 186u, 185u, 182u, 183u, 181u, 176u, 173u, 167u, 163u, 163u, 166u, 175u, 176u, 171u, 165u, 166u, 171u, 170u, 171u, 180u, 182u, 175u, 170u, 165u, 172u, 171u, 174u, 181u, 173u, 175u, 185u, 179u, 172u, 163u, 159u, 151u, 136u, 122u, 115u, 104u, 87u, 82u, 79u, 75u, 63u, 58u, 59u, 53u, 44u, 41u, 37u, 32u, 26u, 23u, 23u, 24u, 20u, 21u, 21u, 25u, 28u, 29u, 29u, 24u, 20u, 17u, 17u, 15u, 16u, 20u, 23u, 22u, 22u, 26u, 29u, 25u, 25u, 24u, 21u, 21u, 24u, 31u, 33u, 33u, 34u, 30u, 27u, 29u, 35u, 45u, 49u, 51u, 57u, 65u, 75u, 77u, 65u, 63u, 57u, 58u, 66u, 74u, 78u, 87u, 91u, 92u, 104u, 118u, 135u, 148u, 153u, 153u, 158u, 171u, 173u, 174u, 172u, 171u, 181u, 183u, 188u, 191u, 189u, 191u, 189u, 188u, 179u, 162u, 149u, 143u, 141u, 140u, 151u, 161u, 161u, 161u }, 
-	{ 102u, 107u, 127u, 140u, 145u, 158u, 160u, 143u, 122u, 118u, 127u, 129u, 132u, 130u, 138u, 134u, 145u, 148u, 141u, 135u, 139u, 147u, 152u, 155u, 141u, 135u, 124u, 107u, 100u, 104u, 106u, 110u, 121u, 128u, 131u, 142u, 160u, 174u, 175u, 180u, 184u, 183u, 184u, 192u, 198u, 201u, 190u, 177u, 163u, 139u, 110u, 85u, 61u, 45u, 36u, 40u, 51u, 59u, 68u, 74u, 85u, 80u, 65u, 80u, 103u, 114u, 114u, 127u, 134u, 143u, 151u, 153u, 150u, 145u, 146u, 152u, 161u, 161u, 160u, 159u, 167u, 173u, 173u, 172u, 175u, 187u, 194u, 197u, 200u, 199u, 205u, 204u, 204u, 200u, 195u, 189u, 188u, 189u, 183u, 182u, 193u, 202u, 199u, 195u, 195u, 196u, 198u, 197u, 192u, 186u, 176u, 169u, 172u, 175u, 178u, 182u, 188u, 187u, 185u, 183u, 186u, 184u, 182u, 183u, 181u, 177u, 172u, 166u, 166u, 166u, 168u, 177u, 182u, 180u, 175u, 172u, 177u, 179u, 178u, 184u, 183u, 177u, 169u, 167u, 170u, 173u, 176u, 176u, 168u, 176u, 185u, 182u, 179u, 172u, 171u, 166u, 152u, 132u, 109u, 95u, 88u, 86u, 81u, 74u, 60u, 54u, 56u, 55u, 48u, 42u, 39u, 38u, 32u, 26u, 24u, 25u, 23u, 24u, 23u, 26u, 29u, 28u, 24u, 22u, 19u, 16u, 16u, 15u, 16u, 18u, 21u, 21u, 20u, 23u, 28u, 27u, 27u, 22u, 19u, 21u, 26u, 35u, 39u, 39u, 36u, 35u, 34u, 34u, 34u, 43u, 47u, 53u, 60u, 67u, 75u, 79u, 69u, 60u, 57u, 62u, 75u, 84u, 88u, 96u, 104u, 107u, 109u, 119u, 132u, 144u, 149u, 150u, 163u, 178u, 180u, 184u, 183u, 182u, 190u, 191u, 189u, 189u, 191u, 188u, 187u, 186u, 170u, 159u, 146u, 134u, 135u, 136u, 142u, 154u, 158u, 152u }, 
-	{ 116u, 129u, 146u, 165u, 165u, 177u, 170u, 159u, 145u, 151u, 156u, 151u, 154u, 151u, 160u, 152u, 145u, 148u, 144u, 132u, 144u, 150u, 147u, 152u, 151u, 150u, 138u, 120u, 108u, 116u, 124u, 120u, 130u, 136u, 149u, 161u, 186u, 191u, 185u, 196u, 200u, 199u, 202u, 215u, 220u, 220u, 203u, 188u, 169u, 137u, 100u, 77u, 55u, 46u, 36u, 34u, 48u, 59u, 61u, 66u, 78u, 77u, 73u, 78u, 100u, 114u, 114u, 129u, 133u, 132u, 144u, 144u, 138u, 134u, 136u, 139u, 147u, 146u, 140u, 138u, 150u, 160u, 167u, 170u, 174u, 182u, 192u, 199u, 197u, 194u, 195u, 197u, 202u, 195u, 185u, 177u, 177u, 178u, 178u, 181u, 181u, 190u, 187u, 183u, 184u, 187u, 183u, 182u, 181u, 179u, 170u, 161u, 169u, 175u, 179u, 184u, 188u, 184u, 180u, 178u, 185u, 186u, 184u, 183u, 184u, 180u, 170u, 162u, 166u, 165u, 167u, 174u, 179u, 177u, 173u, 176u, 176u, 183u, 186u, 189u, 190u, 183u, 168u, 166u, 165u, 172u, 168u, 166u, 162u, 173u, 179u, 179u, 172u, 165u, 161u, 166u, 158u, 140u, 120u, 106u, 97u, 92u, 81u, 65u, 55u, 54u, 50u, 54u, 51u, 43u, 43u, 39u, 35u, 27u, 24u, 23u, 22u, 23u, 24u, 25u, 27u, 25u, 23u, 22u, 19u, 17u, 17u, 17u, 18u, 19u, 23u, 24u, 23u, 24u, 26u, 26u, 27u, 24u, 23u, 26u, 31u, 40u, 43u, 45u, 43u, 39u, 37u, 35u, 34u, 42u, 49u, 57u, 66u, 70u, 74u, 76u, 66u, 54u, 57u, 62u, 81u, 87u, 95u, 105u, 123u, 124u, 117u, 117u, 126u, 140u, 145u, 148u, 163u, 173u, 174u, 183u, 187u, 185u, 189u, 192u, 187u, 189u, 192u, 184u, 182u, 184u, 172u, 161u, 147u, 143u, 142u, 141u, 144u, 151u, 156u, 155u }, 
-	{ 131u, 155u, 164u, 175u, 172u, 183u, 185u, 180u, 171u, 172u, 175u, 167u, 172u, 176u, 177u, 168u, 154u, 160u, 158u, 150u, 156u, 153u, 159u, 158u, 162u, 160u, 152u, 134u, 123u, 131u, 137u, 136u, 140u, 149u, 169u, 185u, 198u, 200u, 200u, 209u, 218u, 218u, 219u, 229u, 232u, 230u, 212u, 193u, 179u, 143u, 110u, 78u, 59u, 41u, 36u, 41u, 46u, 55u, 61u, 61u, 75u, 81u, 78u, 79u, 96u, 109u, 115u, 127u, 123u, 113u, 125u, 124u, 114u, 111u, 115u, 122u, 128u, 129u, 127u, 127u, 136u, 149u, 159u, 165u, 174u, 181u, 190u, 196u, 195u, 186u, 184u, 182u, 189u, 187u, 178u, 168u, 164u, 163u, 172u, 177u, 176u, 178u, 179u, 170u, 167u, 164u, 166u, 166u, 168u, 170u, 166u, 161u, 167u, 173u, 178u, 182u, 185u, 183u, 179u, 177u, 179u, 183u, 184u, 185u, 186u, 180u, 172u, 164u, 164u, 163u, 164u, 165u, 169u, 173u, 171u, 173u, 178u, 188u, 192u, 190u, 190u, 188u, 178u, 170u, 165u, 168u, 167u, 165u, 163u, 167u, 173u, 173u, 166u, 155u, 158u, 164u, 157u, 146u, 137u, 118u, 108u, 98u, 75u, 59u, 51u, 53u, 54u, 56u, 51u, 45u, 46u, 40u, 32u, 27u, 24u, 21u, 20u, 21u, 23u, 23u, 23u, 23u, 21u, 20u, 19u, 19u, 18u, 19u, 19u, 19u, 21u, 24u, 26u, 23u, 22u, 24u, 24u, 25u, 25u, 29u, 36u, 41u, 43u, 47u, 47u, 45u, 43u, 36u, 33u, 41u, 50u, 62u, 76u, 78u, 77u, 67u, 59u, 53u, 58u, 69u, 79u, 90u, 99u, 112u, 126u, 131u, 128u, 126u, 131u, 133u, 139u, 147u, 163u, 166u, 172u, 182u, 190u, 188u, 190u, 188u, 182u, 182u, 182u, 179u, 175u, 177u, 167u, 158u, 148u, 145u, 139u, 140u, 147u, 156u, 157u, 153u }, 
-	{ 148u, 160u, 169u, 177u, 180u, 188u, 191u, 188u, 182u, 190u, 187u, 180u, 180u, 190u, 185u, 185u, 172u, 169u, 171u, 169u, 165u, 166u, 171u, 169u, 169u, 165u, 160u, 156u, 150u, 147u, 152u, 151u, 156u, 166u, 184u, 198u, 204u, 211u, 220u, 230u, 228u, 219u, 219u, 225u, 226u, 230u, 218u, 195u, 172u, 144u, 114u, 83u, 68u, 45u, 40u, 47u, 49u, 53u, 57u, 63u, 82u, 91u, 87u, 80u, 93u, 108u, 111u, 115u, 108u, 96u, 105u, 110u, 106u, 100u, 95u, 106u, 113u, 112u, 118u, 123u, 130u, 139u, 149u, 158u, 168u, 171u, 174u, 178u, 178u, 175u, 176u, 170u, 173u, 170u, 161u, 154u, 151u, 152u, 162u, 163u, 167u, 173u, 169u, 160u, 155u, 154u, 158u, 161u, 165u, 168u, 167u, 162u, 166u, 175u, 180u, 183u, 186u, 182u, 177u, 178u, 179u, 182u, 186u, 185u, 183u, 179u, 175u, 172u, 173u, 169u, 168u, 164u, 163u, 168u, 167u, 171u, 181u, 192u, 194u, 189u, 187u, 187u, 181u, 173u, 163u, 166u, 171u, 169u, 167u, 171u, 171u, 175u, 167u, 157u, 160u, 152u, 146u, 146u, 147u, 128u, 104u, 91u, 73u, 63u, 52u, 50u, 55u, 56u, 50u, 47u, 47u, 38u, 29u, 27u, 25u, 21u, 20u, 19u, 19u, 19u, 18u, 19u, 17u, 17u, 16u, 17u, 18u, 19u, 18u, 17u, 18u, 19u, 23u, 22u, 21u, 22u, 22u, 24u, 25u, 27u, 34u, 40u, 46u, 51u, 51u, 46u, 46u, 40u, 37u, 46u, 58u, 70u, 85u, 95u, 87u, 72u, 60u, 53u, 58u, 76u, 85u, 98u, 98u, 108u, 119u, 121u, 121u, 126u, 126u, 120u, 127u, 138u, 154u, 166u, 176u, 189u, 191u, 189u, 190u, 190u, 187u, 185u, 182u, 178u, 171u, 167u, 158u, 148u, 138u, 132u, 128u, 131u, 141u, 148u, 149u, 150u }, 
-	{ 156u, 171u, 176u, 178u, 179u, 184u, 187u, 190u, 183u, 195u, 197u, 198u, 195u, 190u, 178u, 179u, 180u, 174u, 182u, 193u, 187u, 181u, 181u, 188u, 189u, 190u, 184u, 174u, 173u, 174u, 180u, 171u, 177u, 190u, 207u, 215u, 216u, 220u, 228u, 237u, 234u, 226u, 222u, 218u, 212u, 223u, 214u, 199u, 169u, 137u, 113u, 90u, 78u, 53u, 46u, 49u, 47u, 47u, 46u, 60u, 77u, 86u, 86u, 78u, 86u, 88u, 93u, 90u, 86u, 86u, 89u, 98u, 100u, 87u, 84u, 92u, 97u, 101u, 111u, 117u, 125u, 130u, 140u, 151u, 158u, 159u, 160u, 161u, 163u, 164u, 163u, 160u, 161u, 152u, 146u, 146u, 146u, 145u, 146u, 148u, 157u, 162u, 161u, 158u, 150u, 149u, 147u, 154u, 161u, 161u, 163u, 160u, 163u, 170u, 176u, 179u, 181u, 175u, 175u, 177u, 181u, 182u, 185u, 180u, 177u, 177u, 175u, 174u, 177u, 172u, 166u, 162u, 159u, 168u, 168u, 174u, 184u, 191u, 191u, 188u, 182u, 183u, 181u, 175u, 166u, 169u, 172u, 174u, 174u, 179u, 177u, 183u, 177u, 161u, 149u, 138u, 137u, 133u, 137u, 126u, 105u, 84u, 65u, 55u, 50u, 49u, 56u, 55u, 49u, 40u, 37u, 30u, 25u, 22u, 20u, 19u, 17u, 15u, 14u, 15u, 14u, 13u, 14u, 15u, 15u, 15u, 14u, 16u, 15u, 14u, 14u, 16u, 19u, 21u, 21u, 22u, 20u, 22u, 26u, 27u, 32u, 37u, 44u, 50u, 49u, 48u, 52u, 48u, 46u, 56u, 67u, 85u, 94u, 98u, 88u, 82u, 67u, 59u, 65u, 81u, 88u, 100u, 104u, 113u, 115u, 115u, 114u, 123u, 125u, 121u, 124u, 134u, 154u, 164u, 172u, 187u, 188u, 189u, 190u, 192u, 191u, 187u, 184u, 179u, 170u, 161u, 155u, 148u, 139u, 128u, 119u, 118u, 128u, 136u, 141u, 141u }, 
-	{ 161u, 180u, 188u, 187u, 188u, 190u, 186u, 189u, 193u, 199u, 210u, 205u, 200u, 189u, 177u, 180u, 181u, 189u, 198u, 209u, 213u, 204u, 193u, 200u, 213u, 216u, 212u, 202u, 196u, 195u, 197u, 195u, 192u, 202u, 213u, 227u, 231u, 236u, 237u, 236u, 234u, 230u, 218u, 209u, 208u, 219u, 218u, 199u, 168u, 143u, 112u, 87u, 77u, 62u, 48u, 50u, 58u, 57u, 53u, 60u, 77u, 85u, 86u, 80u, 80u, 72u, 77u, 85u, 79u, 78u, 75u, 82u, 86u, 80u, 76u, 80u, 87u, 94u, 99u, 104u, 116u, 125u, 134u, 142u, 143u, 144u, 145u, 150u, 153u, 153u, 148u, 154u, 152u, 140u, 138u, 144u, 143u, 137u, 137u, 141u, 149u, 160u, 159u, 151u, 144u, 142u, 137u, 143u, 154u, 157u, 157u, 157u, 159u, 163u, 169u, 170u, 171u, 171u, 172u, 178u, 179u, 180u, 181u, 174u, 169u, 173u, 172u, 169u, 168u, 168u, 166u, 165u, 162u, 166u, 170u, 175u, 182u, 191u, 189u, 189u, 187u, 184u, 177u, 172u, 168u, 164u, 170u, 174u, 177u, 182u, 182u, 188u, 184u, 167u, 145u, 131u, 126u, 128u, 129u, 124u, 107u, 83u, 68u, 54u, 51u, 54u, 55u, 47u, 45u, 36u, 33u, 26u, 22u, 18u, 17u, 14u, 13u, 12u, 12u, 12u, 10u, 10u, 11u, 12u, 12u, 12u, 11u, 11u, 12u, 13u, 13u, 15u, 18u, 20u, 21u, 21u, 21u, 22u, 23u, 25u, 27u, 32u, 42u, 49u, 49u, 50u, 54u, 51u, 53u, 66u, 76u, 95u, 106u, 108u, 102u, 97u, 78u, 72u, 75u, 86u, 95u, 107u, 106u, 109u, 112u, 109u, 105u, 118u, 122u, 118u, 121u, 137u, 153u, 161u, 175u, 188u, 195u, 198u, 197u, 196u, 196u, 187u, 181u, 176u, 167u, 157u, 150u, 146u, 135u, 121u, 114u, 112u, 120u, 125u, 129u, 130u }, 
-	{ 173u, 178u, 194u, 193u, 190u, 195u, 191u, 182u, 189u, 197u, 199u, 196u, 194u, 191u, 189u, 191u, 194u, 212u, 222u, 231u, 238u, 237u, 224u, 221u, 220u, 222u, 226u, 220u, 209u, 205u, 212u, 215u, 206u, 209u, 214u, 235u, 240u, 238u, 241u, 234u, 229u, 232u, 225u, 217u, 209u, 206u, 205u, 194u, 171u, 147u, 119u, 102u, 78u, 63u, 57u, 60u, 73u, 70u, 69u, 74u, 83u, 85u, 83u, 80u, 82u, 76u, 71u, 76u, 71u, 69u, 61u, 64u, 68u, 67u, 63u, 65u, 72u, 81u, 87u, 93u, 103u, 114u, 120u, 123u, 121u, 125u, 134u, 145u, 144u, 142u, 137u, 139u, 139u, 139u, 136u, 140u, 133u, 132u, 139u, 138u, 142u, 151u, 153u, 143u, 135u, 128u, 125u, 131u, 141u, 145u, 149u, 152u, 154u, 159u, 166u, 164u, 164u, 168u, 167u, 173u, 170u, 168u, 170u, 166u, 162u, 164u, 165u, 167u, 164u, 166u, 165u, 165u, 167u, 173u, 176u, 178u, 181u, 188u, 187u, 185u, 185u, 183u, 176u, 174u, 169u, 161u, 164u, 174u, 182u, 184u, 180u, 181u, 176u, 168u, 152u, 136u, 125u, 121u, 118u, 115u, 107u, 89u, 77u, 63u, 55u, 54u, 48u, 39u, 40u, 34u, 31u, 26u, 21u, 16u, 15u, 11u, 10u, 8u, 9u, 9u, 8u, 8u, 9u, 9u, 10u, 11u, 11u, 10u, 11u, 12u, 13u, 16u, 20u, 24u, 23u, 22u, 22u, 24u, 25u, 29u, 30u, 33u, 39u, 47u, 50u, 51u, 54u, 54u, 58u, 69u, 77u, 92u, 105u, 109u, 107u, 103u, 94u, 92u, 93u, 102u, 109u, 109u, 109u, 108u, 104u, 104u, 104u, 113u, 117u, 114u, 125u, 137u, 143u, 151u, 165u, 177u, 187u, 194u, 193u, 191u, 191u, 185u, 182u, 178u, 167u, 155u, 146u, 137u, 124u, 114u, 111u, 110u, 112u, 114u, 120u, 125u }, 
-	{ 170u, 176u, 191u, 192u, 194u, 191u, 195u, 183u, 187u, 182u, 186u, 200u, 198u, 202u, 207u, 210u, 212u, 226u, 238u, 249u, 249u, 247u, 241u, 231u, 223u, 223u, 228u, 230u, 221u, 222u, 224u, 221u, 215u, 218u, 220u, 236u, 244u, 244u, 242u, 237u, 240u, 239u, 236u, 225u, 218u, 205u, 200u, 191u, 163u, 143u, 123u, 111u, 93u, 67u, 64u, 65u, 75u, 74u, 82u, 85u, 92u, 92u, 87u, 85u, 84u, 76u, 70u, 68u, 68u, 68u, 61u, 58u, 58u, 56u, 55u, 56u, 61u, 65u, 75u, 81u, 93u, 105u, 109u, 114u, 113u, 121u, 128u, 132u, 132u, 129u, 127u, 132u, 131u, 133u, 134u, 138u, 132u, 132u, 135u, 138u, 141u, 144u, 146u, 141u, 133u, 125u, 127u, 128u, 128u, 128u, 131u, 137u, 142u, 149u, 156u, 157u, 157u, 160u, 161u, 163u, 159u, 155u, 154u, 152u, 152u, 153u, 162u, 164u, 160u, 163u, 167u, 163u, 169u, 178u, 175u, 174u, 178u, 181u, 181u, 178u, 182u, 182u, 175u, 171u, 164u, 156u, 159u, 167u, 176u, 177u, 175u, 174u, 173u, 165u, 151u, 134u, 120u, 119u, 115u, 107u, 100u, 94u, 80u, 65u, 54u, 52u, 46u, 37u, 36u, 31u, 28u, 24u, 20u, 14u, 12u, 10u, 9u, 8u, 8u, 8u, 7u, 8u, 9u, 9u, 9u, 11u, 11u, 11u, 11u, 13u, 14u, 18u, 24u, 28u, 28u, 27u, 27u, 28u, 31u, 35u, 37u, 37u, 41u, 47u, 51u, 55u, 56u, 62u, 68u, 68u, 74u, 86u, 100u, 105u, 112u, 110u, 103u, 100u, 99u, 105u, 121u, 117u, 111u, 111u, 110u, 103u, 106u, 111u, 116u, 117u, 128u, 133u, 143u, 149u, 157u, 168u, 177u, 184u, 183u, 184u, 179u, 176u, 176u, 171u, 164u, 156u, 146u, 135u, 126u, 115u, 110u, 108u, 104u, 103u, 113u, 118u }, 
-	{ 151u, 159u, 166u, 165u, 177u, 183u, 193u, 197u, 190u, 184u, 188u, 201u, 210u, 213u, 221u, 230u, 232u, 243u, 251u, 253u, 250u, 247u, 245u, 238u, 227u, 219u, 223u, 229u, 228u, 231u, 226u, 219u, 217u, 222u, 228u, 239u, 249u, 251u, 246u, 245u, 248u, 247u, 243u, 231u, 218u, 212u, 209u, 197u, 163u, 142u, 123u, 113u, 91u, 68u, 72u, 76u, 76u, 74u, 88u, 94u, 95u, 95u, 94u, 87u, 80u, 70u, 68u, 69u, 67u, 69u, 64u, 61u, 54u, 52u, 53u, 53u, 56u, 58u, 64u, 70u, 83u, 96u, 103u, 106u, 115u, 121u, 121u, 122u, 127u, 132u, 126u, 125u, 132u, 133u, 134u, 133u, 131u, 129u, 130u, 133u, 137u, 138u, 139u, 139u, 135u, 130u, 124u, 121u, 114u, 109u, 113u, 121u, 130u, 138u, 147u, 149u, 148u, 152u, 151u, 152u, 149u, 146u, 143u, 143u, 148u, 152u, 156u, 156u, 156u, 162u, 167u, 165u, 168u, 171u, 171u, 171u, 171u, 171u, 176u, 177u, 175u, 175u, 174u, 174u, 169u, 162u, 159u, 164u, 172u, 171u, 168u, 166u, 166u, 156u, 143u, 135u, 125u, 115u, 111u, 102u, 97u, 89u, 79u, 63u, 57u, 52u, 43u, 37u, 32u, 29u, 28u, 27u, 20u, 14u, 11u, 9u, 8u, 7u, 7u, 7u, 7u, 7u, 8u, 9u, 10u, 11u, 12u, 13u, 13u, 14u, 16u, 21u, 26u, 29u, 33u, 34u, 33u, 35u, 40u, 44u, 45u, 46u, 48u, 54u, 55u, 57u, 59u, 65u, 74u, 73u, 77u, 83u, 96u, 101u, 109u, 111u, 105u, 102u, 107u, 112u, 123u, 128u, 120u, 116u, 118u, 116u, 108u, 108u, 119u, 126u, 138u, 147u, 146u, 147u, 152u, 164u, 169u, 169u, 166u, 168u, 171u, 166u, 160u, 162u, 160u, 155u, 146u, 135u, 129u, 122u, 110u, 101u, 100u, 103u, 112u, 116u }, 
-	{ 113u, 121u, 144u, 153u, 166u, 181u, 197u, 207u, 198u, 191u, 188u, 200u, 216u, 215u, 223u, 232u, 238u, 249u, 249u, 250u, 244u, 238u, 236u, 230u, 222u, 212u, 222u, 229u, 229u, 229u, 222u, 217u, 223u, 229u, 235u, 247u, 253u, 254u, 251u, 249u, 246u, 243u, 241u, 235u, 222u, 217u, 205u, 199u, 174u, 151u, 127u, 117u, 95u, 73u, 70u, 81u, 80u, 79u, 86u, 89u, 95u, 100u, 101u, 99u, 88u, 75u, 67u, 69u, 66u, 67u, 64u, 60u, 53u, 52u, 48u, 48u, 49u, 53u, 58u, 63u, 72u, 83u, 90u, 96u, 108u, 112u, 109u, 113u, 123u, 132u, 123u, 122u, 134u, 132u, 129u, 126u, 123u, 121u, 121u, 129u, 133u, 130u, 131u, 131u, 124u, 120u, 110u, 106u, 107u, 106u, 108u, 113u, 122u, 127u, 132u, 133u, 139u, 146u, 145u, 145u, 142u, 135u, 131u, 133u, 137u, 144u, 147u, 150u, 152u, 155u, 161u, 160u, 159u, 162u, 168u, 167u, 169u, 167u, 167u, 173u, 174u, 169u, 169u, 172u, 169u, 165u, 166u, 171u, 178u, 174u, 167u, 161u, 158u, 149u, 144u, 138u, 131u, 119u, 106u, 96u, 93u, 88u, 82u, 68u, 61u, 51u, 45u, 40u, 31u, 30u, 29u, 25u, 20u, 15u, 9u, 9u, 8u, 7u, 7u, 7u, 6u, 7u, 8u, 9u, 11u, 13u, 14u, 15u, 17u, 18u, 20u, 23u, 27u, 31u, 34u, 37u, 38u, 43u, 50u, 53u, 54u, 59u, 62u, 66u, 65u, 65u, 66u, 71u, 74u, 73u, 74u, 81u, 93u, 97u, 98u, 101u, 108u, 105u, 113u, 121u, 124u, 129u, 128u, 126u, 124u, 121u, 106u, 105u, 117u, 127u, 143u, 154u, 145u, 147u, 148u, 154u, 158u, 155u, 155u, 156u, 162u, 160u, 153u, 157u, 157u, 153u, 142u, 131u, 125u, 119u, 110u, 100u, 97u, 107u, 116u, 115u }, 
-	{ 89u, 100u, 116u, 130u, 148u, 163u, 188u, 200u, 201u, 196u, 194u, 202u, 214u, 215u, 222u, 233u, 238u, 248u, 248u, 250u, 241u, 238u, 238u, 232u, 221u, 207u, 213u, 224u, 223u, 222u, 222u, 221u, 229u, 236u, 241u, 246u, 248u, 253u, 251u, 247u, 243u, 242u, 243u, 237u, 229u, 222u, 211u, 199u, 179u, 162u, 139u, 118u, 92u, 76u, 77u, 93u, 89u, 90u, 92u, 91u, 97u, 105u, 108u, 104u, 87u, 75u, 73u, 70u, 67u, 62u, 63u, 61u, 55u, 50u, 42u, 40u, 42u, 45u, 50u, 55u, 64u, 70u, 76u, 83u, 95u, 99u, 101u, 110u, 123u, 129u, 124u, 121u, 125u, 122u, 118u, 123u, 119u, 116u, 116u, 122u, 129u, 126u, 128u, 126u, 115u, 104u, 102u, 97u, 97u, 93u, 95u, 102u, 110u, 116u, 116u, 118u, 126u, 133u, 134u, 134u, 130u, 126u, 120u, 126u, 130u, 132u, 134u, 139u, 145u, 146u, 148u, 151u, 149u, 155u, 159u, 162u, 161u, 159u, 160u, 163u, 169u, 170u, 174u, 176u, 174u, 171u, 170u, 172u, 172u, 169u, 160u, 149u, 145u, 139u, 138u, 140u, 128u, 118u, 106u, 102u, 91u, 82u, 69u, 62u, 60u, 51u, 43u, 40u, 33u, 31u, 28u, 27u, 24u, 18u, 11u, 7u, 6u, 6u, 6u, 6u, 6u, 7u, 8u, 10u, 12u, 13u, 15u, 16u, 19u, 20u, 23u, 26u, 29u, 34u, 39u, 43u, 48u, 53u, 59u, 63u, 67u, 70u, 72u, 75u, 75u, 74u, 74u, 74u, 75u, 77u, 75u, 83u, 90u, 95u, 93u, 99u, 104u, 100u, 104u, 111u, 113u, 123u, 130u, 130u, 129u, 120u, 119u, 116u, 118u, 130u, 145u, 154u, 148u, 148u, 147u, 145u, 144u, 141u, 142u, 149u, 152u, 153u, 155u, 154u, 152u, 151u, 141u, 132u, 124u, 122u, 116u, 103u, 99u, 107u, 111u, 112u }, 
-	{ 77u, 84u, 85u, 95u, 119u, 143u, 166u, 178u, 188u, 192u, 195u, 200u, 209u, 213u, 220u, 231u, 237u, 249u, 253u, 252u, 245u, 245u, 244u, 238u, 224u, 206u, 203u, 210u, 213u, 217u, 223u, 227u, 232u, 239u, 239u, 236u, 236u, 243u, 246u, 241u, 237u, 236u, 238u, 235u, 228u, 227u, 221u, 199u, 182u, 168u, 149u, 119u, 89u, 76u, 85u, 92u, 93u, 95u, 93u, 94u, 100u, 107u, 106u, 97u, 84u, 80u, 76u, 69u, 63u, 57u, 56u, 54u, 50u, 44u, 38u, 36u, 36u, 38u, 43u, 51u, 56u, 59u, 63u, 70u, 78u, 87u, 93u, 103u, 114u, 120u, 120u, 119u, 116u, 116u, 116u, 114u, 109u, 104u, 103u, 113u, 122u, 120u, 124u, 124u, 109u, 96u, 93u, 84u, 84u, 84u, 86u, 90u, 101u, 106u, 109u, 110u, 112u, 117u, 123u, 124u, 121u, 118u, 120u, 126u, 126u, 127u, 125u, 128u, 131u, 133u, 134u, 140u, 141u, 147u, 152u, 155u, 153u, 155u, 159u, 160u, 164u, 173u, 179u, 187u, 182u, 177u, 176u, 174u, 169u, 164u, 158u, 145u, 139u, 135u, 135u, 132u, 126u, 116u, 110u, 103u, 79u, 68u, 63u, 56u, 59u, 54u, 45u, 43u, 40u, 36u, 32u, 28u, 25u, 20u, 11u, 7u, 6u, 6u, 6u, 8u, 8u, 8u, 10u, 11u, 13u, 14u, 17u, 20u, 23u, 26u, 30u, 33u, 36u, 40u, 46u, 52u, 59u, 60u, 64u, 72u, 79u, 82u, 81u, 82u, 82u, 81u, 78u, 79u, 78u, 81u, 81u, 87u, 91u, 94u, 93u, 98u, 99u, 99u, 99u, 105u, 112u, 123u, 132u, 127u, 120u, 123u, 131u, 126u, 125u, 138u, 147u, 152u, 149u, 147u, 142u, 136u, 139u, 138u, 134u, 143u, 147u, 151u, 150u, 151u, 151u, 149u, 140u, 134u, 126u, 121u, 114u, 103u, 102u, 104u, 106u, 111u }, 
-	{ 61u, 69u, 73u, 86u, 107u, 125u, 142u, 156u, 178u, 191u, 190u, 195u, 208u, 222u, 229u, 234u, 240u, 251u, 253u, 249u, 246u, 240u, 242u, 237u, 221u, 204u, 201u, 209u, 218u, 222u, 226u, 230u, 229u, 239u, 238u, 231u, 228u, 225u, 224u, 216u, 214u, 217u, 220u, 221u, 223u, 229u, 221u, 193u, 179u, 168u, 154u, 125u, 99u, 85u, 85u, 87u, 90u, 98u, 93u, 93u, 100u, 108u, 107u, 95u, 84u, 75u, 71u, 62u, 56u, 53u, 52u, 47u, 42u, 36u, 31u, 31u, 30u, 31u, 36u, 40u, 44u, 47u, 51u, 59u, 63u, 66u, 73u, 82u, 96u, 103u, 108u, 104u, 99u, 103u, 104u, 96u, 89u, 86u, 86u, 93u, 99u, 98u, 97u, 102u, 94u, 84u, 82u, 79u, 77u, 82u, 81u, 83u, 94u, 100u, 104u, 102u, 102u, 103u, 108u, 111u, 114u, 116u, 121u, 122u, 121u, 118u, 111u, 113u, 114u, 116u, 120u, 128u, 130u, 136u, 145u, 151u, 149u, 154u, 160u, 161u, 164u, 171u, 177u, 188u, 190u, 187u, 185u, 177u, 165u, 163u, 157u, 143u, 140u, 133u, 126u, 127u, 130u, 121u, 113u, 105u, 80u, 67u, 66u, 60u, 62u, 58u, 52u, 51u, 47u, 37u, 32u, 29u, 24u, 19u, 13u, 10u, 8u, 7u, 7u, 11u, 13u, 13u, 14u, 15u, 16u, 17u, 21u, 25u, 31u, 35u, 39u, 42u, 44u, 48u, 53u, 59u, 66u, 68u, 71u, 76u, 83u, 89u, 90u, 89u, 89u, 90u, 81u, 79u, 81u, 86u, 87u, 92u, 91u, 93u, 89u, 92u, 99u, 100u, 97u, 100u, 109u, 117u, 125u, 120u, 122u, 122u, 127u, 131u, 130u, 140u, 144u, 143u, 141u, 140u, 135u, 129u, 129u, 133u, 135u, 145u, 150u, 148u, 147u, 154u, 153u, 148u, 141u, 129u, 120u, 118u, 115u, 105u, 102u, 105u, 109u, 120u }, 
-	{ 58u, 59u, 68u, 85u, 100u, 104u, 126u, 152u, 172u, 182u, 184u, 189u, 201u, 216u, 218u, 225u, 236u, 240u, 248u, 246u, 243u, 238u, 239u, 233u, 221u, 207u, 203u, 205u, 220u, 229u, 233u, 234u, 232u, 234u, 237u, 229u, 218u, 205u, 200u, 194u, 197u, 197u, 202u, 207u, 217u, 227u, 221u, 191u, 178u, 167u, 146u, 123u, 105u, 87u, 89u, 88u, 83u, 91u, 88u, 93u, 97u, 98u, 95u, 88u, 73u, 64u, 59u, 51u, 49u, 47u, 45u, 37u, 33u, 31u, 29u, 25u, 23u, 25u, 29u, 33u, 35u, 38u, 42u, 45u, 50u, 53u, 60u, 71u, 83u, 89u, 90u, 91u, 89u, 88u, 84u, 79u, 77u, 80u, 76u, 75u, 75u, 73u, 72u, 70u, 75u, 75u, 71u, 72u, 71u, 79u, 81u, 83u, 95u, 98u, 97u, 98u, 95u, 94u, 93u, 94u, 98u, 105u, 113u, 114u, 108u, 99u, 98u, 98u, 100u, 99u, 105u, 112u, 118u, 123u, 138u, 146u, 145u, 150u, 158u, 164u, 166u, 170u, 178u, 187u, 193u, 194u, 188u, 182u, 171u, 169u, 163u, 155u, 147u, 133u, 125u, 125u, 120u, 119u, 113u, 106u, 87u, 75u, 70u, 59u, 59u, 55u, 53u, 57u, 50u, 37u, 30u, 30u, 26u, 20u, 15u, 11u, 10u, 9u, 10u, 14u, 17u, 19u, 18u, 20u, 19u, 20u, 25u, 30u, 37u, 43u, 48u, 51u, 54u, 56u, 59u, 68u, 76u, 78u, 77u, 82u, 90u, 95u, 94u, 94u, 91u, 95u, 85u, 76u, 76u, 85u, 85u, 91u, 89u, 90u, 85u, 87u, 93u, 94u, 95u, 99u, 109u, 115u, 119u, 116u, 121u, 122u, 124u, 127u, 132u, 136u, 133u, 132u, 129u, 130u, 123u, 118u, 122u, 129u, 134u, 143u, 147u, 147u, 149u, 153u, 154u, 150u, 138u, 123u, 114u, 114u, 113u, 105u, 105u, 107u, 114u, 124u }, 
-	{ 61u, 59u, 58u, 74u, 89u, 94u, 120u, 154u, 173u, 177u, 186u, 191u, 192u, 205u, 211u, 218u, 227u, 232u, 237u, 238u, 234u, 233u, 231u, 222u, 217u, 211u, 215u, 210u, 216u, 222u, 228u, 231u, 231u, 226u, 220u, 210u, 202u, 190u, 190u, 187u, 186u, 180u, 187u, 200u, 213u, 219u, 208u, 182u, 171u, 161u, 146u, 125u, 119u, 97u, 92u, 93u, 86u, 77u, 75u, 79u, 86u, 87u, 82u, 76u, 64u, 52u, 47u, 48u, 44u, 38u, 36u, 33u, 30u, 28u, 24u, 21u, 19u, 19u, 23u, 28u, 29u, 32u, 36u, 38u, 42u, 45u, 56u, 65u, 72u, 76u, 79u, 80u, 80u, 73u, 70u, 66u, 67u, 73u, 70u, 65u, 58u, 55u, 56u, 54u, 61u, 70u, 67u, 65u, 67u, 75u, 81u, 82u, 90u, 89u, 88u, 92u, 86u, 80u, 77u, 75u, 80u, 90u, 89u, 88u, 87u, 79u, 79u, 79u, 80u, 79u, 88u, 96u, 105u, 114u, 128u, 135u, 135u, 140u, 147u, 155u, 163u, 169u, 175u, 188u, 195u, 198u, 193u, 187u, 176u, 175u, 166u, 158u, 154u, 139u, 130u, 122u, 114u, 117u, 116u, 110u, 100u, 87u, 76u, 70u, 62u, 56u, 54u, 58u, 51u, 39u, 34u, 31u, 30u, 23u, 16u, 14u, 12u, 13u, 15u, 17u, 20u, 22u, 22u, 22u, 21u, 24u, 29u, 34u, 43u, 52u, 58u, 61u, 65u, 68u, 71u, 79u, 88u, 90u, 90u, 95u, 102u, 102u, 98u, 98u, 95u, 94u, 86u, 77u, 74u, 79u, 82u, 82u, 81u, 84u, 81u, 82u, 85u, 87u, 90u, 95u, 102u, 110u, 108u, 104u, 112u, 120u, 121u, 118u, 119u, 120u, 124u, 122u, 118u, 121u, 113u, 105u, 108u, 118u, 132u, 136u, 138u, 136u, 140u, 148u, 146u, 141u, 133u, 124u, 114u, 109u, 108u, 102u, 101u, 104u, 115u, 122u }, 
-	{ 55u, 58u, 56u, 66u, 73u, 92u, 119u, 147u, 169u, 176u, 182u, 192u, 197u, 204u, 215u, 214u, 216u, 226u, 231u, 234u, 222u, 219u, 217u, 213u, 214u, 206u, 211u, 216u, 216u, 215u, 214u, 212u, 209u, 209u, 205u, 196u, 191u, 182u, 182u, 180u, 177u, 175u, 184u, 192u, 201u, 196u, 184u, 162u, 148u, 141u, 141u, 131u, 123u, 102u, 95u, 86u, 81u, 74u, 64u, 63u, 72u, 75u, 73u, 67u, 59u, 47u, 40u, 43u, 38u, 32u, 32u, 28u, 28u, 25u, 21u, 20u, 15u, 15u, 18u, 20u, 23u, 25u, 31u, 35u, 37u, 42u, 52u, 56u, 63u, 66u, 70u, 70u, 71u, 64u, 60u, 54u, 55u, 60u, 61u, 55u, 47u, 44u, 43u, 43u, 52u, 59u, 58u, 61u, 63u, 71u, 75u, 72u, 77u, 78u, 79u, 80u, 74u, 66u, 65u, 68u, 68u, 70u, 67u, 69u, 65u, 63u, 67u, 68u, 70u, 71u, 79u, 88u, 99u, 111u, 121u, 126u, 128u, 133u, 139u, 147u, 158u, 168u, 172u, 182u, 190u, 197u, 196u, 195u, 186u, 178u, 167u, 160u, 150u, 140u, 138u, 135u, 132u, 129u, 127u, 116u, 108u, 105u, 95u, 80u, 64u, 61u, 57u, 57u, 51u, 39u, 36u, 35u, 34u, 26u, 22u, 18u, 15u, 15u, 17u, 21u, 24u, 24u, 24u, 25u, 25u, 29u, 36u, 41u, 49u, 59u, 66u, 71u, 75u, 81u, 88u, 94u, 99u, 100u, 104u, 111u, 118u, 115u, 112u, 106u, 101u, 96u, 88u, 79u, 75u, 72u, 75u, 79u, 78u, 79u, 78u, 78u, 83u, 87u, 91u, 96u, 94u, 99u, 103u, 102u, 111u, 117u, 115u, 113u, 111u, 110u, 115u, 115u, 113u, 107u, 98u, 96u, 101u, 108u, 118u, 126u, 130u, 130u, 132u, 135u, 136u, 130u, 130u, 124u, 116u, 105u, 103u, 100u, 99u, 101u, 115u, 124u }, 
-	{ 53u, 57u, 57u, 59u, 62u, 88u, 109u, 130u, 154u, 171u, 183u, 184u, 190u, 204u, 210u, 210u, 219u, 226u, 228u, 230u, 220u, 210u, 214u, 215u, 209u, 202u, 196u, 205u, 215u, 208u, 201u, 204u, 197u, 190u, 184u, 180u, 175u, 173u, 171u, 168u, 177u, 182u, 182u, 185u, 180u, 178u, 166u, 151u, 137u, 129u, 129u, 124u, 124u, 112u, 98u, 81u, 76u, 67u, 58u, 57u, 70u, 75u, 68u, 61u, 59u, 52u, 46u, 40u, 33u, 31u, 33u, 27u, 24u, 22u, 19u, 17u, 16u, 15u, 15u, 18u, 20u, 23u, 26u, 31u, 36u, 41u, 47u, 53u, 59u, 63u, 67u, 66u, 59u, 56u, 51u, 47u, 47u, 49u, 48u, 42u, 38u, 32u, 32u, 38u, 44u, 46u, 48u, 52u, 50u, 58u, 65u, 62u, 62u, 66u, 70u, 68u, 65u, 55u, 54u, 57u, 55u, 52u, 53u, 53u, 49u, 49u, 57u, 62u, 63u, 66u, 71u, 82u, 93u, 106u, 115u, 118u, 122u, 132u, 136u, 144u, 155u, 162u, 170u, 179u, 186u, 192u, 194u, 199u, 195u, 183u, 174u, 163u, 151u, 146u, 145u, 151u, 143u, 138u, 128u, 114u, 110u, 109u, 95u, 78u, 65u, 59u, 61u, 58u, 51u, 42u, 38u, 34u, 31u, 30u, 26u, 21u, 17u, 16u, 21u, 24u, 25u, 26u, 27u, 29u, 32u, 35u, 41u, 50u, 56u, 67u, 76u, 82u, 86u, 94u, 100u, 105u, 111u, 113u, 119u, 124u, 128u, 127u, 122u, 117u, 113u, 103u, 96u, 81u, 70u, 65u, 73u, 81u, 81u, 79u, 81u, 79u, 80u, 85u, 86u, 90u, 85u, 90u, 95u, 100u, 106u, 111u, 112u, 110u, 109u, 106u, 106u, 111u, 104u, 100u, 98u, 97u, 97u, 105u, 112u, 120u, 126u, 127u, 127u, 123u, 122u, 123u, 123u, 120u, 115u, 105u, 102u, 102u, 101u, 104u, 117u, 125u }, 
-	{ 43u, 48u, 53u, 54u, 54u, 73u, 91u, 104u, 133u, 161u, 182u, 180u, 185u, 194u, 206u, 217u, 225u, 230u, 234u, 230u, 219u, 213u, 214u, 212u, 203u, 197u, 194u, 197u, 206u, 197u, 189u, 192u, 185u, 175u, 169u, 167u, 165u, 168u, 168u, 164u, 171u, 187u, 186u, 179u, 165u, 155u, 150u, 147u, 137u, 123u, 124u, 121u, 115u, 104u, 94u, 86u, 84u, 69u, 66u, 65u, 69u, 69u, 64u, 60u, 60u, 55u, 48u, 40u, 36u, 33u, 33u, 27u, 21u, 17u, 15u, 16u, 17u, 15u, 15u, 18u, 19u, 21u, 24u, 30u, 37u, 41u, 45u, 50u, 56u, 59u, 60u, 59u, 53u, 48u, 47u, 45u, 42u, 42u, 36u, 28u, 26u, 26u, 25u, 33u, 35u, 38u, 40u, 39u, 40u, 47u, 51u, 51u, 53u, 56u, 58u, 58u, 54u, 45u, 41u, 43u, 39u, 37u, 40u, 43u, 46u, 45u, 51u, 53u, 55u, 62u, 67u, 77u, 91u, 102u, 107u, 112u, 120u, 131u, 137u, 142u, 151u, 164u, 171u, 177u, 187u, 192u, 194u, 200u, 202u, 196u, 188u, 179u, 165u, 157u, 150u, 150u, 143u, 137u, 119u, 103u, 94u, 98u, 91u, 76u, 64u, 62u, 59u, 53u, 49u, 45u, 41u, 37u, 31u, 32u, 30u, 24u, 18u, 17u, 21u, 23u, 26u, 29u, 32u, 33u, 36u, 40u, 45u, 55u, 63u, 74u, 85u, 94u, 98u, 101u, 108u, 113u, 119u, 123u, 128u, 133u, 137u, 137u, 131u, 127u, 121u, 113u, 105u, 88u, 75u, 71u, 81u, 86u, 89u, 90u, 88u, 82u, 84u, 85u, 83u, 82u, 77u, 85u, 94u, 100u, 103u, 110u, 114u, 112u, 111u, 105u, 98u, 101u, 99u, 94u, 93u, 99u, 101u, 108u, 108u, 111u, 118u, 118u, 117u, 111u, 112u, 114u, 111u, 109u, 109u, 106u, 98u, 103u, 109u, 110u, 116u, 124u }, 
-	{ 42u, 50u, 59u, 57u, 59u, 66u, 86u, 103u, 130u, 157u, 174u, 174u, 178u, 188u, 211u, 220u, 227u, 232u, 231u, 228u, 220u, 216u, 213u, 209u, 201u, 193u, 189u, 194u, 203u, 196u, 183u, 181u, 174u, 167u, 163u, 156u, 152u, 158u, 160u, 158u, 164u, 178u, 181u, 175u, 159u, 142u, 136u, 139u, 128u, 120u, 124u, 117u, 110u, 97u, 88u, 90u, 89u, 81u, 76u, 64u, 65u, 62u, 63u, 64u, 62u, 61u, 52u, 46u, 39u, 37u, 32u, 25u, 19u, 16u, 15u, 16u, 16u, 15u, 15u, 17u, 19u, 20u, 23u, 27u, 34u, 40u, 45u, 49u, 51u, 54u, 52u, 49u, 49u, 48u, 45u, 42u, 37u, 32u, 23u, 17u, 16u, 18u, 20u, 29u, 33u, 33u, 36u, 37u, 39u, 40u, 44u, 43u, 39u, 44u, 42u, 42u, 40u, 40u, 36u, 37u, 32u, 32u, 35u, 40u, 41u, 40u, 47u, 49u, 51u, 57u, 66u, 75u, 89u, 98u, 102u, 110u, 121u, 128u, 134u, 140u, 152u, 165u, 171u, 178u, 186u, 191u, 196u, 201u, 208u, 207u, 204u, 200u, 186u, 173u, 159u, 153u, 147u, 134u, 105u, 90u, 77u, 78u, 77u, 66u, 54u, 55u, 51u, 42u, 42u, 43u, 39u, 35u, 34u, 33u, 31u, 23u, 20u, 19u, 21u, 25u, 30u, 33u, 37u, 39u, 43u, 45u, 48u, 58u, 68u, 79u, 92u, 100u, 106u, 110u, 114u, 120u, 127u, 133u, 139u, 141u, 144u, 145u, 143u, 136u, 127u, 116u, 105u, 96u, 89u, 88u, 94u, 98u, 101u, 96u, 89u, 86u, 84u, 79u, 78u, 77u, 74u, 80u, 90u, 95u, 103u, 105u, 108u, 107u, 111u, 103u, 96u, 94u, 98u, 99u, 94u, 100u, 104u, 108u, 102u, 98u, 107u, 110u, 108u, 101u, 101u, 103u, 103u, 104u, 102u, 97u, 92u, 103u, 111u, 117u, 120u, 124u }, 
-	{ 42u, 53u, 61u, 62u, 68u, 73u, 84u, 104u, 120u, 146u, 160u, 174u, 181u, 196u, 216u, 224u, 223u, 223u, 225u, 221u, 217u, 215u, 208u, 198u, 194u, 190u, 188u, 193u, 197u, 194u, 181u, 169u, 165u, 168u, 166u, 160u, 155u, 155u, 154u, 154u, 153u, 164u, 167u, 158u, 144u, 137u, 129u, 129u, 120u, 120u, 116u, 111u, 111u, 99u, 91u, 87u, 89u, 84u, 72u, 62u, 58u, 61u, 61u, 58u, 59u, 53u, 49u, 44u, 38u, 36u, 30u, 24u, 18u, 17u, 17u, 16u, 16u, 17u, 16u, 19u, 20u, 21u, 24u, 26u, 31u, 36u, 42u, 45u, 43u, 44u, 46u, 47u, 44u, 43u, 40u, 38u, 31u, 23u, 17u, 13u, 11u, 12u, 17u, 26u, 30u, 32u, 36u, 38u, 36u, 38u, 38u, 37u, 35u, 38u, 38u, 35u, 33u, 37u, 34u, 33u, 33u, 35u, 36u, 36u, 35u, 39u, 42u, 46u, 49u, 55u, 61u, 67u, 82u, 90u, 93u, 105u, 116u, 124u, 136u, 142u, 151u, 165u, 171u, 175u, 186u, 197u, 204u, 205u, 209u, 216u, 218u, 210u, 197u, 191u, 177u, 161u, 160u, 140u, 109u, 91u, 80u, 72u, 65u, 54u, 49u, 48u, 41u, 35u, 40u, 40u, 35u, 33u, 33u, 34u, 33u, 25u, 23u, 22u, 22u, 27u, 33u, 37u, 40u, 45u, 48u, 51u, 54u, 63u, 74u, 84u, 96u, 106u, 113u, 119u, 122u, 125u, 130u, 139u, 147u, 150u, 151u, 154u, 151u, 143u, 139u, 127u, 109u, 103u, 105u, 104u, 103u, 104u, 104u, 96u, 90u, 88u, 87u, 81u, 81u, 78u, 77u, 79u, 85u, 93u, 101u, 105u, 104u, 103u, 101u, 96u, 95u, 102u, 111u, 108u, 103u, 104u, 106u, 103u, 97u, 94u, 100u, 101u, 97u, 91u, 89u, 96u, 97u, 98u, 96u, 91u, 92u, 103u, 111u, 120u, 127u, 129u }, 
-	{ 39u, 46u, 60u, 65u, 68u, 78u, 91u, 99u, 109u, 130u, 149u, 175u, 186u, 199u, 215u, 218u, 215u, 212u, 214u, 208u, 204u, 200u, 192u, 185u, 185u, 185u, 184u, 187u, 188u, 185u, 179u, 168u, 171u, 175u, 175u, 168u, 162u, 151u, 152u, 152u, 148u, 153u, 158u, 152u, 132u, 123u, 120u, 120u, 118u, 120u, 112u, 106u, 106u, 102u, 102u, 90u, 88u, 80u, 68u, 59u, 51u, 55u, 54u, 51u, 52u, 47u, 38u, 34u, 33u, 31u, 27u, 24u, 19u, 18u, 18u, 16u, 18u, 20u, 18u, 19u, 20u, 21u, 23u, 26u, 30u, 34u, 36u, 37u, 36u, 37u, 40u, 42u, 38u, 36u, 32u, 30u, 21u, 16u, 13u, 10u, 9u, 10u, 14u, 20u, 24u, 27u, 31u, 35u, 30u, 30u, 31u, 29u, 29u, 33u, 33u, 29u, 30u, 33u, 32u, 33u, 37u, 37u, 37u, 34u, 35u, 40u, 41u, 45u, 47u, 52u, 55u, 60u, 70u, 77u, 81u, 92u, 107u, 120u, 132u, 141u, 150u, 159u, 167u, 174u, 184u, 197u, 204u, 204u, 206u, 209u, 219u, 217u, 201u, 196u, 182u, 164u, 161u, 140u, 115u, 99u, 76u, 66u, 59u, 54u, 48u, 45u, 37u, 31u, 34u, 34u, 30u, 29u, 32u, 34u, 30u, 26u, 26u, 27u, 26u, 31u, 34u, 38u, 40u, 46u, 49u, 54u, 59u, 67u, 76u, 87u, 102u, 112u, 119u, 124u, 130u, 133u, 135u, 143u, 152u, 160u, 163u, 165u, 155u, 148u, 149u, 142u, 124u, 119u, 118u, 112u, 102u, 99u, 99u, 95u, 94u, 97u, 94u, 89u, 87u, 82u, 83u, 87u, 91u, 97u, 100u, 103u, 103u, 103u, 100u, 99u, 97u, 107u, 117u, 119u, 114u, 114u, 113u, 106u, 98u, 94u, 95u, 94u, 89u, 88u, 93u, 97u, 90u, 88u, 88u, 89u, 96u, 107u, 113u, 121u, 131u, 137u }, 
-	{ 38u, 44u, 59u, 67u, 75u, 80u, 97u, 106u, 117u, 122u, 134u, 164u, 183u, 199u, 210u, 206u, 201u, 196u, 197u, 191u, 189u, 183u, 173u, 168u, 172u, 181u, 184u, 186u, 183u, 181u, 179u, 168u, 168u, 174u, 179u, 177u, 171u, 157u, 151u, 147u, 139u, 131u, 142u, 142u, 129u, 124u, 115u, 107u, 113u, 115u, 108u, 101u, 94u, 103u, 100u, 87u, 80u, 71u, 65u, 53u, 49u, 51u, 49u, 45u, 42u, 37u, 33u, 28u, 27u, 26u, 24u, 21u, 18u, 17u, 18u, 17u, 18u, 20u, 19u, 19u, 20u, 19u, 21u, 24u, 28u, 30u, 29u, 30u, 29u, 31u, 34u, 34u, 29u, 25u, 23u, 22u, 17u, 16u, 11u, 8u, 7u, 9u, 13u, 16u, 20u, 25u, 26u, 28u, 25u, 23u, 25u, 23u, 22u, 22u, 23u, 27u, 30u, 33u, 32u, 32u, 34u, 33u, 35u, 35u, 38u, 40u, 44u, 46u, 47u, 49u, 49u, 56u, 62u, 68u, 79u, 85u, 91u, 110u, 125u, 136u, 147u, 156u, 164u, 171u, 181u, 196u, 199u, 196u, 196u, 202u, 210u, 209u, 195u, 184u, 176u, 168u, 157u, 136u, 108u, 97u, 75u, 58u, 51u, 47u, 42u, 43u, 40u, 32u, 28u, 28u, 27u, 27u, 29u, 29u, 26u, 24u, 21u, 23u, 25u, 30u, 34u, 37u, 40u, 45u, 50u, 57u, 63u, 69u, 78u, 91u, 106u, 119u, 125u, 132u, 138u, 138u, 142u, 146u, 154u, 161u, 166u, 169u, 163u, 154u, 148u, 143u, 132u, 125u, 122u, 114u, 110u, 102u, 103u, 101u, 106u, 109u, 109u, 106u, 93u, 89u, 88u, 94u, 101u, 102u, 104u, 105u, 103u, 106u, 104u, 103u, 106u, 113u, 124u, 125u, 118u, 117u, 116u, 110u, 105u, 100u, 90u, 88u, 86u, 91u, 97u, 97u, 91u, 88u, 87u, 86u, 93u, 107u, 115u, 122u, 131u, 141u }, 
-	{ 43u, 48u, 57u, 68u, 79u, 85u, 102u, 121u, 122u, 114u, 125u, 153u, 176u, 188u, 194u, 185u, 181u, 181u, 181u, 179u, 175u, 171u, 165u, 158u, 157u, 164u, 173u, 180u, 179u, 182u, 178u, 171u, 169u, 172u, 175u, 170u, 166u, 164u, 154u, 149u, 134u, 122u, 127u, 128u, 131u, 127u, 113u, 101u, 106u, 108u, 106u, 96u, 87u, 93u, 96u, 83u, 70u, 64u, 56u, 46u, 42u, 44u, 42u, 40u, 39u, 33u, 29u, 24u, 22u, 20u, 19u, 19u, 15u, 13u, 14u, 14u, 15u, 17u, 16u, 16u, 17u, 17u, 16u, 17u, 23u, 25u, 24u, 23u, 24u, 28u, 28u, 24u, 18u, 17u, 16u, 16u, 14u, 13u, 10u, 7u, 5u, 7u, 10u, 13u, 20u, 23u, 22u, 22u, 20u, 18u, 19u, 21u, 18u, 13u, 15u, 22u, 28u, 30u, 30u, 29u, 27u, 27u, 32u, 39u, 40u, 40u, 43u, 46u, 47u, 44u, 44u, 48u, 56u, 61u, 74u, 80u, 87u, 102u, 114u, 132u, 148u, 158u, 162u, 166u, 175u, 190u, 192u, 183u, 181u, 185u, 191u, 190u, 179u, 166u, 165u, 165u, 149u, 111u, 92u, 78u, 59u, 42u, 37u, 42u, 38u, 40u, 42u, 37u, 29u, 29u, 28u, 28u, 29u, 27u, 24u, 22u, 21u, 18u, 19u, 25u, 29u, 32u, 39u, 47u, 54u, 60u, 65u, 71u, 80u, 94u, 108u, 120u, 127u, 137u, 147u, 147u, 149u, 154u, 159u, 162u, 164u, 166u, 163u, 152u, 140u, 140u, 135u, 132u, 130u, 122u, 119u, 111u, 108u, 110u, 116u, 118u, 122u, 114u, 100u, 93u, 99u, 107u, 110u, 108u, 106u, 105u, 108u, 115u, 115u, 110u, 111u, 116u, 120u, 120u, 120u, 114u, 114u, 110u, 107u, 96u, 85u, 88u, 89u, 92u, 97u, 92u, 92u, 90u, 84u, 87u, 95u, 109u, 117u, 122u, 131u, 138u }, 
-	{ 50u, 56u, 59u, 67u, 75u, 89u, 106u, 115u, 117u, 110u, 117u, 144u, 165u, 170u, 177u, 174u, 171u, 172u, 170u, 167u, 162u, 160u, 156u, 149u, 150u, 157u, 169u, 175u, 176u, 181u, 181u, 175u, 167u, 168u, 168u, 166u, 161u, 162u, 156u, 153u, 141u, 125u, 122u, 123u, 126u, 115u, 103u, 92u, 96u, 94u, 99u, 96u, 85u, 88u, 86u, 79u, 63u, 55u, 49u, 43u, 41u, 42u, 40u, 37u, 35u, 29u, 24u, 19u, 17u, 15u, 14u, 13u, 11u, 10u, 10u, 10u, 13u, 13u, 13u, 13u, 14u, 14u, 14u, 15u, 21u, 23u, 23u, 21u, 20u, 23u, 21u, 18u, 13u, 10u, 9u, 8u, 8u, 8u, 8u, 6u, 4u, 5u, 7u, 10u, 16u, 17u, 16u, 17u, 16u, 15u, 16u, 17u, 15u, 13u, 14u, 17u, 21u, 22u, 23u, 26u, 27u, 29u, 34u, 43u, 48u, 45u, 44u, 45u, 45u, 43u, 43u, 43u, 47u, 53u, 64u, 72u, 79u, 91u, 108u, 127u, 143u, 151u, 154u, 160u, 168u, 180u, 179u, 174u, 171u, 172u, 179u, 181u, 168u, 154u, 152u, 141u, 122u, 89u, 67u, 52u, 42u, 35u, 35u, 40u, 41u, 43u, 41u, 39u, 29u, 28u, 26u, 26u, 27u, 26u, 23u, 20u, 20u, 18u, 17u, 22u, 27u, 32u, 39u, 47u, 56u, 61u, 67u, 74u, 84u, 97u, 108u, 117u, 125u, 135u, 145u, 149u, 156u, 160u, 164u, 169u, 170u, 165u, 154u, 148u, 141u, 141u, 137u, 140u, 138u, 132u, 130u, 121u, 115u, 116u, 117u, 117u, 119u, 114u, 109u, 105u, 110u, 112u, 113u, 109u, 108u, 110u, 115u, 117u, 124u, 121u, 112u, 112u, 115u, 118u, 124u, 118u, 113u, 106u, 102u, 97u, 90u, 91u, 94u, 96u, 98u, 90u, 89u, 88u, 83u, 89u, 100u, 114u, 125u, 128u, 134u, 138u }, 
-	{ 50u, 56u, 58u, 65u, 82u, 102u, 109u, 117u, 123u, 113u, 118u, 135u, 152u, 158u, 160u, 165u, 167u, 161u, 159u, 156u, 155u, 154u, 148u, 147u, 148u, 154u, 164u, 173u, 172u, 179u, 184u, 177u, 165u, 164u, 161u, 159u, 163u, 157u, 148u, 147u, 143u, 137u, 125u, 127u, 124u, 113u, 101u, 90u, 92u, 87u, 87u, 88u, 85u, 87u, 82u, 74u, 60u, 52u, 49u, 45u, 42u, 39u, 37u, 33u, 30u, 24u, 20u, 16u, 14u, 11u, 10u, 9u, 7u, 7u, 8u, 9u, 12u, 12u, 11u, 11u, 11u, 12u, 12u, 16u, 19u, 22u, 19u, 19u, 18u, 17u, 15u, 11u, 9u, 5u, 4u, 4u, 5u, 7u, 5u, 5u, 4u, 4u, 5u, 7u, 10u, 10u, 12u, 14u, 17u, 15u, 15u, 16u, 16u, 16u, 15u, 18u, 22u, 21u, 22u, 26u, 29u, 34u, 42u, 47u, 51u, 49u, 48u, 48u, 49u, 47u, 47u, 44u, 44u, 48u, 54u, 62u, 71u, 87u, 102u, 114u, 132u, 141u, 149u, 151u, 160u, 169u, 170u, 172u, 165u, 165u, 169u, 171u, 157u, 148u, 133u, 125u, 98u, 71u, 50u, 39u, 30u, 30u, 34u, 40u, 46u, 41u, 37u, 34u, 27u, 23u, 22u, 24u, 24u, 25u, 26u, 25u, 21u, 19u, 19u, 20u, 25u, 32u, 40u, 48u, 55u, 62u, 68u, 75u, 84u, 95u, 107u, 115u, 124u, 134u, 144u, 150u, 157u, 161u, 166u, 171u, 174u, 164u, 155u, 145u, 136u, 135u, 135u, 140u, 143u, 146u, 139u, 129u, 120u, 118u, 115u, 113u, 113u, 115u, 111u, 110u, 113u, 114u, 115u, 117u, 115u, 116u, 116u, 116u, 122u, 126u, 116u, 108u, 115u, 119u, 120u, 122u, 113u, 109u, 101u, 96u, 100u, 101u, 96u, 90u, 90u, 85u, 86u, 86u, 91u, 97u, 108u, 120u, 127u, 135u, 136u, 140u }, 
-	{ 48u, 50u, 56u, 71u, 98u, 117u, 121u, 125u, 130u, 122u, 122u, 129u, 141u, 155u, 159u, 159u, 157u, 155u, 151u, 149u, 150u, 151u, 150u, 152u, 154u, 157u, 161u, 163u, 166u, 173u, 179u, 173u, 167u, 161u, 154u, 154u, 158u, 156u, 148u, 145u, 147u, 145u, 135u, 128u, 123u, 112u, 102u, 95u, 99u, 91u, 87u, 86u, 86u, 85u, 73u, 71u, 61u, 55u, 50u, 47u, 42u, 37u, 34u, 30u, 26u, 21u, 17u, 13u, 11u, 9u, 7u, 6u, 5u, 5u, 6u, 8u, 12u, 13u, 12u, 11u, 13u, 13u, 13u, 17u, 19u, 20u, 17u, 19u, 16u, 13u, 12u, 8u, 6u, 4u, 3u, 3u, 5u, 6u, 4u, 4u, 3u, 3u, 5u, 5u, 5u, 6u, 9u, 13u, 16u, 15u, 14u, 14u, 17u, 19u, 17u, 18u, 20u, 21u, 24u, 26u, 30u, 35u, 41u, 46u, 50u, 51u, 51u, 51u, 54u, 51u, 51u, 48u, 45u, 46u, 50u, 58u, 65u, 80u, 91u, 102u, 122u, 134u, 141u, 140u, 149u, 156u, 162u, 164u, 166u, 166u, 168u, 163u, 145u, 135u, 126u, 117u, 90u, 60u, 41u, 31u, 31u, 30u, 35u, 41u, 44u, 39u, 34u, 31u, 24u, 18u, 18u, 21u, 23u, 26u, 29u, 30u, 25u, 24u, 23u, 21u, 24u, 31u, 39u, 48u, 55u, 62u, 67u, 74u, 83u, 94u, 104u, 111u, 124u, 136u, 142u, 149u, 158u, 162u, 168u, 176u, 179u, 170u, 157u, 148u, 138u, 135u, 134u, 131u, 142u, 144u, 131u, 126u, 117u, 114u, 114u, 115u, 114u, 110u, 105u, 108u, 110u, 112u, 111u, 116u, 119u, 116u, 114u, 113u, 116u, 123u, 119u, 116u, 118u, 118u, 116u, 120u, 116u, 112u, 103u, 105u, 111u, 106u, 94u, 88u, 88u, 86u, 85u, 86u, 97u, 107u, 121u, 129u, 133u, 139u, 137u, 139u }, 
-	{ 45u, 52u, 63u, 82u, 105u, 123u, 128u, 128u, 130u, 129u, 130u, 131u, 137u, 148u, 155u, 158u, 154u, 153u, 145u, 144u, 146u, 148u, 150u, 153u, 157u, 155u, 156u, 155u, 160u, 165u, 173u, 169u, 165u, 162u, 159u, 154u, 156u, 161u, 162u, 156u, 155u, 149u, 140u, 126u, 118u, 109u, 107u, 102u, 98u, 88u, 87u, 86u, 87u, 89u, 80u, 73u, 61u, 55u, 52u, 50u, 44u, 39u, 34u, 29u, 24u, 19u, 15u, 12u, 10u, 8u, 6u, 5u, 4u, 5u, 6u, 8u, 10u, 12u, 14u, 13u, 15u, 14u, 15u, 18u, 17u, 16u, 14u, 16u, 15u, 11u, 9u, 7u, 6u, 3u, 2u, 4u, 5u, 4u, 2u, 2u, 3u, 3u, 3u, 3u, 2u, 4u, 7u, 11u, 13u, 13u, 12u, 12u, 17u, 20u, 19u, 21u, 23u, 24u, 26u, 30u, 36u, 40u, 43u, 47u, 50u, 52u, 52u, 54u, 56u, 53u, 50u, 48u, 45u, 47u, 51u, 58u, 64u, 76u, 83u, 95u, 113u, 125u, 130u, 131u, 140u, 145u, 150u, 150u, 158u, 161u, 163u, 155u, 139u, 124u, 117u, 107u, 81u, 59u, 42u, 28u, 27u, 32u, 40u, 44u, 40u, 37u, 32u, 31u, 25u, 22u, 25u, 26u, 28u, 33u, 37u, 40u, 34u, 30u, 30u, 27u, 30u, 36u, 44u, 52u, 57u, 62u, 67u, 74u, 83u, 93u, 102u, 112u, 123u, 133u, 143u, 150u, 159u, 170u, 176u, 182u, 178u, 174u, 164u, 154u, 142u, 138u, 138u, 133u, 132u, 128u, 121u, 118u, 110u, 109u, 111u, 112u, 117u, 113u, 110u, 110u, 106u, 109u, 114u, 116u, 115u, 112u, 112u, 109u, 112u, 119u, 116u, 119u, 119u, 115u, 112u, 116u, 112u, 112u, 110u, 111u, 109u, 103u, 91u, 88u, 88u, 90u, 93u, 98u, 108u, 115u, 128u, 133u, 135u, 138u, 137u, 142u }, 
-	{ 49u, 54u, 62u, 80u, 104u, 115u, 119u, 121u, 123u, 131u, 141u, 140u, 140u, 147u, 152u, 157u, 154u, 150u, 143u, 143u, 147u, 147u, 147u, 152u, 156u, 151u, 153u, 154u, 156u, 160u, 163u, 163u, 160u, 159u, 160u, 158u, 160u, 163u, 165u, 167u, 167u, 161u, 152u, 133u, 117u, 105u, 110u, 114u, 107u, 95u, 91u, 94u, 92u, 90u, 89u, 80u, 67u, 59u, 57u, 55u, 48u, 41u, 35u, 29u, 23u, 19u, 15u, 12u, 11u, 9u, 6u, 5u, 5u, 5u, 6u, 8u, 8u, 10u, 13u, 13u, 13u, 16u, 16u, 16u, 15u, 14u, 14u, 13u, 11u, 7u, 5u, 5u, 4u, 2u, 3u, 4u, 4u, 2u, 2u, 2u, 3u, 4u, 3u, 2u, 2u, 4u, 6u, 9u, 12u, 11u, 11u, 12u, 16u, 20u, 24u, 24u, 25u, 27u, 29u, 34u, 38u, 45u, 47u, 48u, 51u, 55u, 55u, 57u, 55u, 53u, 51u, 50u, 48u, 49u, 52u, 58u, 63u, 68u, 78u, 90u, 104u, 109u, 110u, 117u, 123u, 133u, 139u, 140u, 142u, 146u, 148u, 142u, 126u, 114u, 103u, 84u, 66u, 46u, 31u, 25u, 27u, 38u, 42u, 45u, 38u, 39u, 38u, 37u, 32u, 31u, 35u, 35u, 34u, 41u, 44u, 48u, 46u, 41u, 36u, 36u, 38u, 43u, 51u, 56u, 62u, 63u, 68u, 80u, 87u, 90u, 100u, 108u, 117u, 129u, 141u, 145u, 156u, 169u, 178u, 183u, 180u, 172u, 163u, 149u, 142u, 139u, 140u, 134u, 128u, 117u, 110u, 109u, 102u, 106u, 108u, 110u, 116u, 116u, 108u, 105u, 100u, 108u, 118u, 122u, 118u, 114u, 112u, 110u, 115u, 120u, 118u, 116u, 121u, 118u, 118u, 115u, 110u, 110u, 114u, 113u, 107u, 99u, 97u, 92u, 92u, 95u, 103u, 109u, 110u, 117u, 128u, 138u, 136u, 131u, 130u, 137u }, 
-	{ 48u, 56u, 62u, 75u, 92u, 103u, 108u, 109u, 117u, 133u, 150u, 154u, 154u, 157u, 160u, 156u, 150u, 146u, 144u, 145u, 148u, 149u, 149u, 151u, 150u, 147u, 152u, 152u, 154u, 156u, 159u, 161u, 160u, 155u, 158u, 164u, 166u, 165u, 171u, 177u, 181u, 171u, 161u, 147u, 129u, 112u, 113u, 118u, 115u, 112u, 108u, 108u, 105u, 101u, 95u, 87u, 72u, 63u, 60u, 55u, 47u, 40u, 33u, 29u, 24u, 19u, 15u, 12u, 11u, 9u, 7u, 6u, 7u, 7u, 6u, 6u, 7u, 9u, 11u, 13u, 13u, 15u, 14u, 14u, 13u, 14u, 14u, 11u, 8u, 6u, 4u, 5u, 3u, 2u, 2u, 3u, 2u, 2u, 3u, 3u, 3u, 3u, 3u, 2u, 3u, 4u, 5u, 7u, 11u, 11u, 10u, 11u, 16u, 19u, 24u, 26u, 28u, 30u, 31u, 35u, 40u, 45u, 49u, 52u, 55u, 60u, 60u, 59u, 55u, 53u, 53u, 51u, 49u, 48u, 51u, 59u, 64u, 68u, 77u, 86u, 92u, 98u, 98u, 107u, 110u, 116u, 123u, 124u, 127u, 130u, 129u, 121u, 110u, 95u, 80u, 66u, 50u, 31u, 24u, 23u, 26u, 35u, 41u, 43u, 37u, 41u, 39u, 39u, 36u, 35u, 39u, 42u, 41u, 44u, 48u, 52u, 50u, 49u, 43u, 42u, 47u, 52u, 57u, 60u, 64u, 68u, 69u, 80u, 87u, 91u, 98u, 102u, 109u, 121u, 134u, 141u, 152u, 165u, 175u, 178u, 175u, 166u, 152u, 142u, 142u, 143u, 140u, 128u, 125u, 111u, 100u, 95u, 91u, 95u, 99u, 100u, 108u, 111u, 105u, 103u, 101u, 109u, 119u, 124u, 123u, 117u, 112u, 110u, 109u, 112u, 111u, 114u, 121u, 124u, 122u, 118u, 112u, 111u, 116u, 112u, 106u, 98u, 98u, 98u, 101u, 102u, 108u, 117u, 117u, 121u, 130u, 137u, 134u, 127u, 125u, 125u }, 
-	{ 48u, 52u, 57u, 66u, 82u, 94u, 98u, 104u, 114u, 128u, 144u, 154u, 159u, 161u, 161u, 156u, 151u, 147u, 146u, 146u, 145u, 145u, 146u, 147u, 147u, 147u, 149u, 148u, 153u, 156u, 156u, 160u, 160u, 154u, 158u, 163u, 168u, 171u, 176u, 177u, 182u, 181u, 172u, 158u, 144u, 126u, 118u, 120u, 126u, 123u, 120u, 121u, 115u, 110u, 100u, 91u, 75u, 68u, 64u, 56u, 47u, 40u, 32u, 27u, 24u, 19u, 14u, 11u, 10u, 9u, 8u, 8u, 9u, 8u, 7u, 6u, 7u, 9u, 11u, 12u, 12u, 13u, 13u, 15u, 13u, 13u, 12u, 9u, 6u, 6u, 3u, 2u, 2u, 2u, 2u, 2u, 1u, 2u, 2u, 2u, 2u, 3u, 3u, 3u, 4u, 5u, 6u, 6u, 7u, 9u, 9u, 11u, 14u, 18u, 21u, 27u, 29u, 33u, 36u, 36u, 39u, 43u, 47u, 49u, 51u, 56u, 61u, 60u, 55u, 54u, 56u, 53u, 50u, 49u, 49u, 53u, 59u, 69u, 77u, 83u, 89u, 92u, 91u, 98u, 101u, 99u, 103u, 101u, 108u, 110u, 115u, 109u, 101u, 91u, 78u, 57u, 41u, 29u, 24u, 23u, 28u, 30u, 36u, 34u, 29u, 30u, 30u, 35u, 38u, 45u, 49u, 50u, 49u, 47u, 57u, 61u, 61u, 56u, 53u, 52u, 60u, 64u, 68u, 69u, 66u, 69u, 71u, 79u, 84u, 89u, 92u, 99u, 105u, 117u, 128u, 141u, 151u, 159u, 171u, 173u, 166u, 159u, 149u, 139u, 141u, 138u, 134u, 124u, 116u, 102u, 94u, 90u, 92u, 92u, 98u, 97u, 102u, 107u, 105u, 101u, 102u, 108u, 120u, 124u, 125u, 120u, 113u, 110u, 106u, 109u, 114u, 123u, 126u, 133u, 128u, 123u, 122u, 118u, 122u, 119u, 115u, 104u, 102u, 108u, 113u, 110u, 116u, 120u, 123u, 127u, 133u, 135u, 132u, 122u, 121u, 120u }, 
-	{ 45u, 50u, 55u, 68u, 81u, 94u, 104u, 109u, 119u, 130u, 138u, 147u, 155u, 159u, 158u, 154u, 151u, 147u, 146u, 144u, 143u, 141u, 143u, 142u, 143u, 145u, 147u, 146u, 153u, 159u, 160u, 159u, 160u, 154u, 156u, 164u, 170u, 173u, 176u, 179u, 180u, 182u, 173u, 162u, 156u, 138u, 123u, 125u, 132u, 129u, 128u, 128u, 122u, 116u, 105u, 89u, 75u, 70u, 69u, 59u, 48u, 40u, 32u, 26u, 22u, 19u, 14u, 11u, 10u, 9u, 9u, 9u, 9u, 9u, 8u, 7u, 8u, 9u, 10u, 11u, 11u, 11u, 12u, 13u, 11u, 10u, 10u, 8u, 5u, 5u, 2u, 1u, 1u, 1u, 1u, 1u, 1u, 2u, 2u, 1u, 1u, 2u, 2u, 3u, 4u, 5u, 5u, 5u, 5u, 6u, 8u, 9u, 10u, 13u, 17u, 22u, 27u, 32u, 39u, 40u, 41u, 42u, 43u, 46u, 48u, 51u, 60u, 61u, 57u, 55u, 57u, 53u, 51u, 50u, 49u, 49u, 57u, 67u, 74u, 77u, 84u, 89u, 90u, 93u, 89u, 93u, 98u, 101u, 101u, 102u, 107u, 96u, 91u, 91u, 83u, 64u, 41u, 32u, 23u, 19u, 20u, 25u, 27u, 25u, 24u, 22u, 22u, 25u, 34u, 47u, 54u, 59u, 60u, 62u, 74u, 77u, 70u, 65u, 65u, 68u, 73u, 74u, 76u, 73u, 70u, 74u, 78u, 83u, 85u, 88u, 92u, 101u, 111u, 118u, 127u, 141u, 148u, 154u, 158u, 159u, 155u, 148u, 145u, 136u, 134u, 127u, 120u, 113u, 105u, 95u, 95u, 96u, 92u, 88u, 88u, 94u, 98u, 99u, 104u, 103u, 103u, 111u, 117u, 120u, 122u, 114u, 112u, 111u, 112u, 116u, 127u, 131u, 129u, 133u, 127u, 120u, 123u, 126u, 126u, 126u, 122u, 118u, 117u, 120u, 120u, 117u, 117u, 124u, 131u, 132u, 138u, 139u, 131u, 120u, 119u, 122u }, 
-	{ 41u, 45u, 56u, 74u, 83u, 94u, 107u, 120u, 129u, 136u, 136u, 138u, 143u, 150u, 151u, 151u, 149u, 146u, 147u, 145u, 141u, 138u, 141u, 142u, 142u, 145u, 149u, 146u, 152u, 155u, 159u, 157u, 154u, 148u, 151u, 161u, 169u, 174u, 176u, 177u, 175u, 178u, 173u, 165u, 164u, 149u, 136u, 132u, 137u, 140u, 139u, 134u, 127u, 119u, 104u, 90u, 79u, 73u, 69u, 58u, 48u, 40u, 31u, 25u, 22u, 18u, 14u, 12u, 10u, 10u, 9u, 10u, 10u, 10u, 10u, 9u, 9u, 9u, 9u, 10u, 10u, 10u, 9u, 9u, 9u, 9u, 8u, 6u, 4u, 4u, 2u, 1u, 1u, 1u, 1u, 2u, 2u, 2u, 2u, 1u, 1u, 1u, 2u, 3u, 3u, 3u, 3u, 3u, 3u, 4u, 6u, 7u, 7u, 10u, 14u, 20u, 26u, 31u, 37u, 42u, 44u, 42u, 40u, 43u, 48u, 52u, 61u, 66u, 63u, 59u, 56u, 52u, 51u, 49u, 48u, 51u, 58u, 67u, 69u, 73u, 80u, 84u, 88u, 91u, 89u, 94u, 99u, 104u, 103u, 106u, 104u, 89u, 79u, 80u, 79u, 63u, 43u, 34u, 26u, 20u, 16u, 17u, 18u, 17u, 20u, 22u, 22u, 20u, 26u, 43u, 56u, 67u, 79u, 88u, 96u, 96u, 86u, 80u, 77u, 77u, 80u, 77u, 76u, 78u, 77u, 80u, 84u, 87u, 88u, 91u, 95u, 103u, 112u, 117u, 126u, 138u, 143u, 146u, 148u, 147u, 146u, 141u, 138u, 131u, 126u, 117u, 111u, 108u, 103u, 95u, 92u, 91u, 87u, 86u, 86u, 92u, 93u, 91u, 95u, 96u, 100u, 110u, 115u, 117u, 120u, 117u, 122u, 125u, 126u, 127u, 130u, 131u, 130u, 126u, 121u, 123u, 126u, 131u, 133u, 135u, 134u, 134u, 138u, 138u, 128u, 123u, 120u, 122u, 130u, 136u, 137u, 133u, 123u, 116u, 119u, 120u }, 
-	{ 38u, 50u, 62u, 76u, 91u, 101u, 112u, 121u, 126u, 131u, 129u, 131u, 135u, 141u, 143u, 143u, 141u, 142u, 144u, 143u, 140u, 138u, 138u, 142u, 144u, 148u, 147u, 146u, 151u, 152u, 157u, 153u, 150u, 149u, 153u, 160u, 166u, 172u, 176u, 174u, 179u, 180u, 179u, 171u, 168u, 154u, 143u, 135u, 147u, 150u, 144u, 134u, 123u, 116u, 102u, 90u, 82u, 76u, 69u, 60u, 52u, 42u, 32u, 26u, 23u, 19u, 16u, 12u, 11u, 11u, 10u, 11u, 11u, 11u, 11u, 10u, 10u, 10u, 10u, 9u, 10u, 10u, 9u, 8u, 8u, 8u, 6u, 4u, 3u, 2u, 1u, 2u, 1u, 2u, 3u, 3u, 2u, 1u, 2u, 1u, 1u, 0u, 1u, 2u, 1u, 1u, 1u, 1u, 2u, 3u, 4u, 5u, 6u, 9u, 14u, 20u, 25u, 30u, 34u, 38u, 40u, 41u, 39u, 42u, 46u, 51u, 58u, 62u, 57u, 57u, 55u, 51u, 50u, 49u, 50u, 51u, 54u, 64u, 68u, 70u, 73u, 77u, 85u, 86u, 89u, 91u, 97u, 102u, 105u, 102u, 93u, 81u, 77u, 70u, 68u, 62u, 47u, 35u, 26u, 20u, 16u, 16u, 19u, 18u, 19u, 20u, 20u, 18u, 29u, 45u, 62u, 79u, 87u, 100u, 102u, 106u, 98u, 92u, 83u, 90u, 93u, 84u, 84u, 83u, 85u, 90u, 93u, 92u, 94u, 97u, 98u, 102u, 109u, 116u, 124u, 133u, 140u, 143u, 143u, 140u, 138u, 134u, 130u, 126u, 122u, 115u, 109u, 105u, 102u, 98u, 92u, 86u, 87u, 88u, 91u, 92u, 96u, 96u, 92u, 90u, 95u, 107u, 112u, 116u, 116u, 117u, 126u, 131u, 135u, 136u, 137u, 127u, 123u, 122u, 116u, 123u, 129u, 126u, 133u, 140u, 149u, 150u, 154u, 150u, 137u, 125u, 118u, 120u, 122u, 131u, 130u, 127u, 119u, 115u, 115u, 119u }, 
-	{ 42u, 54u, 67u, 76u, 94u, 107u, 112u, 117u, 123u, 127u, 122u, 126u, 131u, 135u, 140u, 137u, 136u, 140u, 140u, 140u, 138u, 137u, 139u, 143u, 145u, 148u, 148u, 148u, 150u, 152u, 155u, 157u, 153u, 152u, 155u, 156u, 163u, 169u, 174u, 176u, 183u, 185u, 181u, 176u, 172u, 160u, 152u, 151u, 155u, 160u, 150u, 136u, 126u, 119u, 106u, 92u, 83u, 78u, 68u, 61u, 52u, 43u, 34u, 28u, 23u, 20u, 18u, 15u, 13u, 13u, 13u, 12u, 13u, 13u, 13u, 12u, 12u, 12u, 11u, 10u, 10u, 10u, 9u, 7u, 7u, 6u, 4u, 3u, 1u, 0u, 1u, 1u, 1u, 2u, 3u, 4u, 3u, 2u, 1u, 1u, 0u, 0u, 0u, 1u, 1u, 0u, 0u, 0u, 1u, 2u, 3u, 4u, 6u, 9u, 13u, 19u, 24u, 26u, 29u, 34u, 37u, 39u, 41u, 43u, 44u, 50u, 54u, 55u, 53u, 53u, 51u, 48u, 49u, 52u, 53u, 55u, 54u, 60u, 65u, 67u, 73u, 83u, 89u, 85u, 88u, 88u, 89u, 90u, 90u, 90u, 85u, 73u, 70u, 65u, 56u, 53u, 44u, 33u, 26u, 22u, 19u, 18u, 17u, 17u, 20u, 22u, 22u, 24u, 36u, 51u, 65u, 80u, 94u, 105u, 106u, 116u, 116u, 105u, 95u, 97u, 100u, 99u, 94u, 89u, 93u, 98u, 97u, 95u, 98u, 98u, 100u, 102u, 105u, 111u, 118u, 127u, 135u, 139u, 136u, 129u, 128u, 128u, 124u, 120u, 117u, 115u, 108u, 104u, 101u, 100u, 94u, 86u, 83u, 87u, 92u, 92u, 93u, 95u, 94u, 91u, 94u, 100u, 106u, 110u, 110u, 116u, 126u, 131u, 136u, 137u, 138u, 129u, 120u, 116u, 114u, 122u, 123u, 126u, 129u, 141u, 152u, 160u, 160u, 152u, 139u, 118u, 111u, 119u, 120u, 126u, 129u, 123u, 120u, 117u, 115u, 112u }, 
-	{ 51u, 60u, 68u, 73u, 87u, 98u, 104u, 118u, 123u, 124u, 121u, 124u, 125u, 127u, 134u, 134u, 134u, 139u, 140u, 139u, 139u, 139u, 142u, 143u, 143u, 147u, 148u, 149u, 150u, 150u, 154u, 159u, 158u, 156u, 153u, 157u, 166u, 174u, 181u, 183u, 184u, 185u, 183u, 180u, 178u, 172u, 168u, 169u, 166u, 166u, 156u, 140u, 130u, 121u, 109u, 97u, 86u, 78u, 66u, 60u, 51u, 44u, 38u, 32u, 26u, 22u, 20u, 18u, 17u, 16u, 15u, 14u, 14u, 14u, 14u, 13u, 13u, 13u, 13u, 12u, 11u, 10u, 9u, 8u, 7u, 6u, 4u, 2u, 1u, 1u, 1u, 2u, 2u, 2u, 2u, 3u, 3u, 2u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 3u, 5u, 7u, 9u, 12u, 16u, 21u, 23u, 27u, 30u, 35u, 39u, 43u, 46u, 48u, 50u, 52u, 55u, 55u, 53u, 53u, 51u, 51u, 52u, 54u, 57u, 56u, 59u, 59u, 64u, 77u, 84u, 85u, 81u, 84u, 81u, 78u, 78u, 78u, 76u, 74u, 62u, 54u, 51u, 44u, 41u, 36u, 33u, 33u, 32u, 30u, 24u, 17u, 16u, 22u, 27u, 27u, 31u, 43u, 54u, 67u, 83u, 89u, 103u, 123u, 131u, 126u, 113u, 106u, 102u, 101u, 104u, 99u, 100u, 103u, 102u, 101u, 100u, 99u, 98u, 101u, 103u, 103u, 109u, 115u, 123u, 132u, 132u, 126u, 124u, 123u, 124u, 119u, 115u, 112u, 109u, 108u, 107u, 102u, 100u, 94u, 88u, 82u, 83u, 87u, 84u, 87u, 89u, 90u, 87u, 91u, 97u, 99u, 103u, 106u, 115u, 123u, 131u, 137u, 138u, 138u, 130u, 121u, 114u, 111u, 114u, 117u, 123u, 127u, 144u, 155u, 157u, 162u, 157u, 141u, 122u, 117u, 114u, 115u, 125u, 127u, 120u, 117u, 114u, 110u, 103u }, 
-	{ 48u, 54u, 60u, 67u, 81u, 94u, 102u, 113u, 119u, 116u, 117u, 122u, 120u, 123u, 130u, 132u, 133u, 137u, 139u, 138u, 140u, 141u, 143u, 144u, 144u, 146u, 149u, 151u, 151u, 153u, 160u, 162u, 163u, 164u, 160u, 164u, 172u, 177u, 182u, 187u, 193u, 193u, 194u, 189u, 178u, 177u, 178u, 176u, 173u, 172u, 166u, 148u, 133u, 125u, 115u, 105u, 95u, 83u, 71u, 64u, 53u, 45u, 41u, 36u, 30u, 26u, 24u, 22u, 21u, 19u, 17u, 16u, 16u, 16u, 15u, 15u, 15u, 15u, 16u, 14u, 12u, 11u, 10u, 9u, 7u, 6u, 4u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 1u, 1u, 1u, 0u, 0u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 2u, 4u, 5u, 7u, 10u, 12u, 15u, 18u, 22u, 28u, 36u, 38u, 42u, 48u, 51u, 53u, 55u, 59u, 57u, 56u, 55u, 54u, 54u, 53u, 61u, 62u, 59u, 56u, 60u, 66u, 80u, 83u, 75u, 81u, 87u, 83u, 77u, 69u, 72u, 71u, 65u, 55u, 42u, 36u, 39u, 37u, 34u, 35u, 40u, 40u, 40u, 33u, 25u, 23u, 26u, 28u, 33u, 42u, 51u, 61u, 71u, 82u, 87u, 105u, 125u, 138u, 128u, 123u, 117u, 112u, 105u, 105u, 101u, 106u, 105u, 105u, 103u, 102u, 102u, 102u, 105u, 104u, 100u, 103u, 110u, 115u, 123u, 124u, 120u, 118u, 122u, 121u, 118u, 111u, 109u, 106u, 110u, 108u, 103u, 102u, 96u, 90u, 81u, 83u, 86u, 84u, 84u, 87u, 87u, 87u, 94u, 97u, 98u, 103u, 112u, 126u, 129u, 134u, 140u, 140u, 137u, 125u, 122u, 120u, 122u, 118u, 121u, 120u, 129u, 140u, 152u, 154u, 155u, 151u, 140u, 129u, 120u, 115u, 115u, 116u, 116u, 116u, 109u, 107u, 109u, 101u }, 
-	{ 48u, 52u, 54u, 61u, 77u, 92u, 103u, 112u, 114u, 111u, 114u, 119u, 118u, 121u, 128u, 127u, 128u, 130u, 134u, 137u, 139u, 143u, 143u, 143u, 143u, 144u, 148u, 153u, 157u, 159u, 164u, 167u, 170u, 173u, 173u, 174u, 179u, 185u, 187u, 192u, 199u, 200u, 197u, 193u, 185u, 183u, 180u, 179u, 178u, 175u, 168u, 153u, 134u, 123u, 119u, 111u, 102u, 91u, 81u, 71u, 60u, 49u, 44u, 40u, 35u, 31u, 28u, 26u, 24u, 22u, 21u, 19u, 19u, 18u, 18u, 17u, 17u, 16u, 17u, 16u, 14u, 13u, 12u, 10u, 8u, 6u, 5u, 3u, 4u, 4u, 3u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 3u, 3u, 5u, 7u, 8u, 12u, 14u, 18u, 26u, 34u, 39u, 42u, 47u, 52u, 56u, 60u, 63u, 62u, 59u, 57u, 58u, 59u, 61u, 69u, 67u, 63u, 59u, 62u, 67u, 73u, 74u, 69u, 78u, 86u, 85u, 77u, 70u, 67u, 62u, 56u, 47u, 32u, 31u, 35u, 37u, 35u, 37u, 46u, 47u, 47u, 44u, 42u, 36u, 35u, 36u, 42u, 54u, 61u, 60u, 66u, 71u, 74u, 97u, 116u, 121u, 123u, 127u, 124u, 118u, 113u, 106u, 102u, 108u, 104u, 101u, 103u, 101u, 102u, 106u, 107u, 103u, 97u, 99u, 104u, 108u, 110u, 113u, 111u, 112u, 117u, 121u, 119u, 114u, 110u, 107u, 106u, 104u, 104u, 104u, 99u, 90u, 84u, 83u, 86u, 86u, 85u, 86u, 84u, 87u, 94u, 98u, 100u, 106u, 118u, 129u, 135u, 136u, 139u, 141u, 135u, 125u, 124u, 123u, 128u, 124u, 123u, 121u, 128u, 129u, 138u, 144u, 143u, 141u, 133u, 126u, 124u, 118u, 112u, 110u, 105u, 100u, 96u, 97u, 98u, 95u }, 
-	{ 48u, 53u, 56u, 62u, 71u, 87u, 101u, 112u, 116u, 116u, 123u, 127u, 130u, 131u, 132u, 129u, 130u, 133u, 139u, 142u, 142u, 144u, 142u, 142u, 140u, 139u, 146u, 153u, 161u, 164u, 170u, 175u, 178u, 180u, 182u, 184u, 184u, 189u, 194u, 195u, 198u, 200u, 196u, 193u, 193u, 190u, 187u, 185u, 185u, 183u, 172u, 154u, 141u, 131u, 123u, 115u, 108u, 99u, 92u, 78u, 63u, 54u, 48u, 43u, 39u, 36u, 33u, 30u, 28u, 26u, 24u, 23u, 22u, 21u, 20u, 20u, 20u, 20u, 19u, 19u, 15u, 13u, 11u, 10u, 8u, 7u, 7u, 5u, 6u, 5u, 3u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 2u, 3u, 4u, 5u, 7u, 9u, 11u, 16u, 24u, 31u, 34u, 37u, 44u, 49u, 56u, 63u, 66u, 67u, 67u, 62u, 64u, 66u, 66u, 71u, 73u, 69u, 64u, 61u, 62u, 63u, 62u, 63u, 71u, 75u, 77u, 67u, 63u, 60u, 57u, 44u, 39u, 31u, 29u, 30u, 33u, 36u, 43u, 53u, 53u, 55u, 51u, 52u, 48u, 46u, 44u, 47u, 60u, 64u, 61u, 67u, 67u, 75u, 98u, 106u, 109u, 126u, 132u, 129u, 127u, 125u, 112u, 107u, 108u, 103u, 106u, 106u, 100u, 102u, 106u, 103u, 100u, 96u, 98u, 98u, 102u, 103u, 105u, 108u, 112u, 114u, 119u, 116u, 112u, 104u, 103u, 102u, 104u, 103u, 104u, 100u, 93u, 88u, 82u, 80u, 82u, 83u, 85u, 84u, 88u, 90u, 93u, 99u, 107u, 117u, 125u, 135u, 138u, 139u, 140u, 134u, 123u, 123u, 123u, 126u, 121u, 119u, 111u, 111u, 121u, 135u, 139u, 137u, 138u, 126u, 115u, 110u, 110u, 102u, 98u, 92u, 82u, 77u, 80u, 79u, 81u }, 
-	{ 52u, 55u, 60u, 64u, 71u, 86u, 101u, 114u, 119u, 125u, 129u, 131u, 134u, 136u, 130u, 128u, 131u, 139u, 144u, 146u, 144u, 143u, 140u, 140u, 140u, 138u, 144u, 153u, 164u, 168u, 172u, 178u, 180u, 181u, 185u, 186u, 189u, 194u, 197u, 196u, 196u, 198u, 194u, 194u, 200u, 199u, 196u, 192u, 191u, 189u, 178u, 163u, 152u, 145u, 134u, 128u, 120u, 113u, 100u, 86u, 69u, 59u, 53u, 48u, 44u, 42u, 38u, 36u, 33u, 31u, 29u, 28u, 26u, 25u, 24u, 23u, 22u, 22u, 22u, 21u, 17u, 14u, 13u, 12u, 9u, 8u, 7u, 8u, 8u, 7u, 5u, 3u, 2u, 2u, 1u, 0u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 2u, 3u, 4u, 6u, 7u, 9u, 13u, 19u, 24u, 28u, 33u, 41u, 47u, 54u, 63u, 66u, 71u, 72u, 68u, 69u, 70u, 70u, 71u, 72u, 69u, 66u, 65u, 65u, 62u, 61u, 63u, 60u, 60u, 63u, 57u, 51u, 52u, 44u, 33u, 31u, 29u, 27u, 29u, 34u, 40u, 46u, 60u, 65u, 69u, 67u, 60u, 58u, 58u, 52u, 51u, 54u, 61u, 64u, 68u, 69u, 78u, 87u, 102u, 117u, 130u, 138u, 141u, 143u, 144u, 132u, 125u, 121u, 115u, 114u, 110u, 104u, 102u, 101u, 98u, 97u, 98u, 96u, 94u, 95u, 94u, 97u, 103u, 108u, 110u, 113u, 111u, 107u, 103u, 102u, 104u, 104u, 105u, 107u, 105u, 99u, 92u, 84u, 78u, 81u, 83u, 85u, 86u, 90u, 89u, 91u, 96u, 101u, 111u, 124u, 128u, 134u, 140u, 146u, 137u, 123u, 125u, 126u, 120u, 120u, 114u, 101u, 103u, 120u, 132u, 135u, 134u, 134u, 125u, 108u, 100u, 93u, 91u, 84u, 74u, 67u, 64u, 67u, 64u, 65u }, 
-	{ 53u, 59u, 66u, 72u, 76u, 90u, 105u, 116u, 123u, 128u, 135u, 134u, 136u, 136u, 133u, 129u, 133u, 142u, 146u, 146u, 142u, 142u, 136u, 136u, 140u, 140u, 144u, 155u, 166u, 170u, 174u, 178u, 181u, 181u, 185u, 189u, 193u, 197u, 198u, 197u, 195u, 194u, 192u, 195u, 201u, 200u, 197u, 194u, 193u, 188u, 180u, 172u, 165u, 160u, 153u, 146u, 136u, 127u, 112u, 97u, 82u, 69u, 60u, 55u, 52u, 49u, 45u, 42u, 40u, 37u, 35u, 33u, 32u, 30u, 28u, 27u, 26u, 25u, 25u, 23u, 20u, 17u, 16u, 14u, 11u, 10u, 10u, 10u, 11u, 9u, 8u, 6u, 4u, 4u, 2u, 2u, 2u, 3u, 3u, 2u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 2u, 3u, 4u, 6u, 7u, 11u, 15u, 19u, 24u, 30u, 37u, 45u, 51u, 58u, 63u, 67u, 70u, 70u, 73u, 76u, 76u, 74u, 73u, 71u, 67u, 71u, 73u, 63u, 63u, 61u, 54u, 49u, 51u, 53u, 47u, 46u, 36u, 27u, 25u, 26u, 28u, 33u, 39u, 42u, 46u, 64u, 72u, 78u, 73u, 64u, 66u, 60u, 50u, 49u, 49u, 52u, 60u, 70u, 76u, 74u, 82u, 97u, 116u, 129u, 137u, 148u, 155u, 158u, 151u, 139u, 127u, 119u, 116u, 115u, 111u, 107u, 100u, 95u, 95u, 97u, 95u, 92u, 92u, 91u, 95u, 104u, 106u, 105u, 108u, 109u, 106u, 105u, 106u, 108u, 108u, 105u, 106u, 106u, 102u, 96u, 91u, 86u, 86u, 88u, 89u, 91u, 91u, 88u, 87u, 89u, 93u, 106u, 117u, 124u, 129u, 136u, 143u, 134u, 123u, 120u, 121u, 117u, 116u, 108u, 103u, 105u, 116u, 125u, 125u, 119u, 116u, 112u, 100u, 86u, 81u, 76u, 68u, 61u, 58u, 54u, 53u, 51u, 49u }, 
-	{ 61u, 66u, 70u, 76u, 77u, 87u, 96u, 108u, 124u, 130u, 135u, 136u, 141u, 140u, 140u, 136u, 138u, 145u, 150u, 149u, 145u, 139u, 132u, 135u, 140u, 145u, 148u, 155u, 163u, 169u, 173u, 178u, 181u, 184u, 188u, 194u, 198u, 201u, 200u, 197u, 193u, 189u, 189u, 190u, 196u, 195u, 196u, 197u, 197u, 191u, 182u, 178u, 174u, 168u, 164u, 156u, 145u, 137u, 124u, 110u, 95u, 84u, 75u, 66u, 61u, 56u, 52u, 48u, 45u, 43u, 42u, 40u, 38u, 36u, 34u, 32u, 31u, 29u, 28u, 25u, 22u, 20u, 19u, 17u, 15u, 13u, 13u, 11u, 12u, 9u, 9u, 10u, 9u, 7u, 5u, 4u, 4u, 4u, 4u, 3u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 2u, 3u, 3u, 5u, 7u, 9u, 13u, 17u, 22u, 28u, 34u, 42u, 47u, 53u, 57u, 60u, 63u, 65u, 72u, 76u, 78u, 76u, 77u, 80u, 75u, 76u, 81u, 71u, 65u, 55u, 49u, 41u, 38u, 37u, 32u, 32u, 30u, 28u, 29u, 34u, 37u, 39u, 40u, 43u, 55u, 73u, 78u, 80u, 78u, 71u, 70u, 66u, 60u, 52u, 51u, 54u, 58u, 63u, 64u, 64u, 84u, 109u, 121u, 130u, 134u, 151u, 157u, 161u, 157u, 147u, 134u, 124u, 120u, 122u, 121u, 114u, 105u, 99u, 96u, 98u, 95u, 93u, 93u, 93u, 98u, 108u, 109u, 107u, 110u, 110u, 108u, 110u, 111u, 111u, 110u, 108u, 107u, 105u, 104u, 98u, 94u, 92u, 93u, 94u, 92u, 91u, 87u, 85u, 85u, 89u, 93u, 101u, 111u, 121u, 124u, 125u, 127u, 119u, 116u, 109u, 111u, 111u, 106u, 100u, 108u, 110u, 110u, 117u, 115u, 106u, 98u, 92u, 88u, 76u, 66u, 60u, 56u, 51u, 49u, 44u, 39u, 38u, 37u }, 
-	{ 70u, 70u, 69u, 74u, 72u, 77u, 88u, 100u, 116u, 127u, 136u, 147u, 152u, 151u, 145u, 143u, 143u, 148u, 149u, 146u, 146u, 140u, 138u, 140u, 145u, 151u, 151u, 155u, 160u, 163u, 168u, 174u, 182u, 185u, 189u, 193u, 200u, 202u, 201u, 196u, 191u, 188u, 186u, 186u, 189u, 192u, 194u, 195u, 192u, 187u, 180u, 183u, 180u, 175u, 169u, 163u, 154u, 145u, 133u, 120u, 109u, 99u, 89u, 79u, 71u, 65u, 61u, 55u, 52u, 51u, 50u, 48u, 46u, 43u, 40u, 38u, 36u, 34u, 31u, 28u, 25u, 24u, 23u, 21u, 19u, 18u, 16u, 14u, 15u, 14u, 13u, 14u, 16u, 12u, 9u, 8u, 6u, 6u, 5u, 3u, 2u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 2u, 3u, 4u, 6u, 8u, 12u, 16u, 20u, 25u, 31u, 39u, 44u, 48u, 50u, 52u, 54u, 59u, 68u, 75u, 80u, 80u, 81u, 85u, 81u, 83u, 82u, 76u, 66u, 58u, 48u, 38u, 33u, 29u, 26u, 25u, 28u, 28u, 33u, 40u, 41u, 42u, 40u, 49u, 63u, 79u, 90u, 88u, 82u, 83u, 78u, 77u, 69u, 55u, 54u, 55u, 53u, 56u, 57u, 64u, 81u, 108u, 124u, 124u, 128u, 141u, 150u, 154u, 148u, 144u, 138u, 128u, 126u, 128u, 133u, 127u, 117u, 109u, 103u, 103u, 103u, 102u, 100u, 100u, 105u, 113u, 116u, 114u, 111u, 111u, 111u, 111u, 113u, 114u, 114u, 113u, 108u, 106u, 106u, 103u, 98u, 97u, 96u, 96u, 95u, 91u, 84u, 82u, 85u, 91u, 97u, 103u, 113u, 114u, 114u, 116u, 108u, 101u, 99u, 92u, 99u, 103u, 101u, 99u, 107u, 114u, 110u, 107u, 101u, 93u, 82u, 75u, 73u, 63u, 52u, 50u, 44u, 40u, 39u, 36u, 31u, 28u, 27u }, 
-	{ 73u, 71u, 70u, 73u, 71u, 71u, 79u, 89u, 105u, 123u, 141u, 154u, 160u, 158u, 154u, 151u, 153u, 154u, 154u, 149u, 147u, 142u, 142u, 141u, 145u, 152u, 154u, 157u, 162u, 165u, 168u, 173u, 179u, 182u, 185u, 191u, 198u, 200u, 202u, 197u, 190u, 185u, 181u, 179u, 181u, 187u, 192u, 193u, 190u, 186u, 183u, 187u, 186u, 181u, 175u, 168u, 159u, 154u, 144u, 133u, 120u, 113u, 105u, 91u, 80u, 74u, 71u, 66u, 63u, 62u, 59u, 56u, 53u, 50u, 47u, 44u, 41u, 39u, 35u, 31u, 28u, 27u, 25u, 24u, 22u, 21u, 19u, 18u, 16u, 17u, 19u, 21u, 22u, 18u, 14u, 10u, 7u, 8u, 8u, 5u, 3u, 2u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 2u, 2u, 4u, 6u, 8u, 10u, 14u, 19u, 23u, 29u, 34u, 40u, 44u, 45u, 47u, 50u, 54u, 65u, 76u, 80u, 83u, 85u, 89u, 90u, 92u, 84u, 75u, 63u, 55u, 45u, 33u, 30u, 27u, 28u, 27u, 29u, 33u, 41u, 49u, 49u, 53u, 49u, 58u, 69u, 79u, 94u, 93u, 88u, 90u, 85u, 74u, 62u, 59u, 55u, 52u, 55u, 61u, 66u, 77u, 89u, 103u, 121u, 127u, 138u, 143u, 145u, 146u, 141u, 135u, 132u, 130u, 134u, 140u, 144u, 138u, 127u, 119u, 113u, 110u, 108u, 110u, 110u, 111u, 111u, 115u, 119u, 117u, 112u, 112u, 114u, 114u, 112u, 114u, 116u, 114u, 112u, 112u, 111u, 109u, 105u, 102u, 101u, 97u, 93u, 89u, 87u, 84u, 84u, 88u, 95u, 101u, 105u, 102u, 101u, 105u, 101u, 92u, 85u, 82u, 85u, 89u, 92u, 98u, 106u, 106u, 99u, 93u, 92u, 80u, 65u, 59u, 57u, 49u, 42u, 40u, 34u, 30u, 30u, 28u, 25u, 21u, 18u }, 
-	{ 76u, 78u, 77u, 73u, 71u, 71u, 81u, 90u, 106u, 123u, 143u, 153u, 166u, 169u, 170u, 167u, 163u, 156u, 155u, 152u, 149u, 142u, 145u, 146u, 150u, 154u, 156u, 157u, 163u, 166u, 166u, 168u, 174u, 179u, 184u, 189u, 194u, 198u, 200u, 199u, 193u, 190u, 186u, 185u, 184u, 187u, 191u, 192u, 192u, 190u, 190u, 192u, 189u, 184u, 180u, 177u, 168u, 159u, 150u, 141u, 132u, 124u, 118u, 105u, 93u, 85u, 80u, 75u, 73u, 69u, 67u, 63u, 60u, 57u, 53u, 48u, 45u, 42u, 39u, 36u, 33u, 31u, 29u, 26u, 23u, 22u, 21u, 18u, 18u, 22u, 25u, 27u, 26u, 24u, 17u, 12u, 11u, 13u, 11u, 8u, 5u, 3u, 2u, 2u, 2u, 2u, 1u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 2u, 3u, 4u, 5u, 7u, 10u, 13u, 18u, 22u, 27u, 31u, 37u, 40u, 42u, 43u, 46u, 52u, 63u, 73u, 78u, 86u, 91u, 97u, 102u, 105u, 93u, 83u, 74u, 64u, 49u, 38u, 40u, 37u, 34u, 31u, 36u, 44u, 54u, 61u, 59u, 63u, 58u, 65u, 73u, 80u, 97u, 100u, 88u, 84u, 78u, 68u, 62u, 62u, 58u, 56u, 57u, 66u, 81u, 88u, 96u, 105u, 121u, 133u, 142u, 144u, 139u, 137u, 139u, 136u, 131u, 134u, 138u, 143u, 144u, 141u, 135u, 127u, 120u, 116u, 113u, 115u, 117u, 118u, 118u, 119u, 121u, 118u, 114u, 115u, 116u, 119u, 115u, 115u, 115u, 115u, 118u, 118u, 118u, 118u, 113u, 108u, 104u, 99u, 93u, 90u, 90u, 85u, 85u, 88u, 95u, 95u, 97u, 99u, 99u, 99u, 95u, 91u, 77u, 76u, 80u, 78u, 80u, 88u, 93u, 92u, 85u, 78u, 73u, 65u, 54u, 49u, 45u, 36u, 30u, 27u, 25u, 22u, 20u, 20u, 18u, 16u, 14u }, 
-	{ 74u, 75u, 74u, 77u, 74u, 75u, 84u, 96u, 109u, 127u, 144u, 161u, 176u, 180u, 173u, 174u, 172u, 162u, 157u, 155u, 146u, 143u, 145u, 151u, 158u, 162u, 159u, 157u, 162u, 165u, 165u, 164u, 170u, 177u, 179u, 185u, 191u, 196u, 199u, 199u, 196u, 193u, 193u, 191u, 188u, 188u, 190u, 192u, 195u, 195u, 195u, 194u, 192u, 188u, 185u, 181u, 175u, 166u, 157u, 148u, 139u, 132u, 125u, 117u, 108u, 99u, 90u, 86u, 82u, 77u, 73u, 70u, 67u, 63u, 59u, 54u, 49u, 46u, 43u, 41u, 38u, 36u, 32u, 29u, 25u, 23u, 21u, 20u, 22u, 25u, 27u, 29u, 27u, 26u, 20u, 14u, 15u, 14u, 13u, 11u, 7u, 4u, 4u, 3u, 2u, 2u, 1u, 1u, 0u, 0u, 1u, 1u, 2u, 2u, 2u, 3u, 4u, 5u, 7u, 9u, 12u, 16u, 20u, 25u, 28u, 33u, 38u, 38u, 40u, 43u, 51u, 65u, 71u, 76u, 84u, 92u, 104u, 110u, 112u, 103u, 92u, 85u, 77u, 65u, 56u, 51u, 46u, 44u, 40u, 43u, 50u, 61u, 72u, 70u, 72u, 67u, 71u, 85u, 94u, 93u, 96u, 87u, 77u, 70u, 66u, 63u, 66u, 57u, 55u, 59u, 79u, 97u, 101u, 106u, 111u, 126u, 138u, 145u, 144u, 133u, 129u, 133u, 136u, 135u, 139u, 141u, 141u, 140u, 142u, 141u, 136u, 128u, 123u, 120u, 120u, 120u, 122u, 120u, 121u, 122u, 121u, 118u, 118u, 119u, 119u, 116u, 116u, 119u, 121u, 120u, 121u, 123u, 123u, 122u, 116u, 108u, 103u, 97u, 92u, 92u, 93u, 90u, 92u, 93u, 92u, 93u, 94u, 97u, 94u, 92u, 88u, 78u, 75u, 73u, 70u, 66u, 70u, 75u, 72u, 70u, 64u, 57u, 50u, 44u, 39u, 33u, 25u, 20u, 17u, 15u, 14u, 13u, 12u, 10u, 10u, 9u }, 
-	{ 70u, 73u, 73u, 76u, 72u, 76u, 88u, 99u, 113u, 133u, 154u, 168u, 179u, 183u, 172u, 170u, 172u, 168u, 164u, 157u, 149u, 150u, 151u, 159u, 162u, 164u, 162u, 160u, 159u, 158u, 160u, 162u, 169u, 174u, 178u, 183u, 188u, 194u, 195u, 195u, 194u, 192u, 194u, 193u, 191u, 191u, 191u, 190u, 193u, 195u, 197u, 197u, 196u, 193u, 189u, 184u, 181u, 171u, 162u, 155u, 145u, 141u, 135u, 129u, 120u, 110u, 102u, 98u, 91u, 84u, 79u, 77u, 74u, 70u, 65u, 60u, 55u, 52u, 49u, 46u, 43u, 39u, 36u, 33u, 31u, 28u, 25u, 25u, 24u, 27u, 31u, 32u, 28u, 24u, 21u, 17u, 15u, 15u, 16u, 11u, 8u, 6u, 5u, 4u, 3u, 2u, 2u, 1u, 1u, 1u, 1u, 2u, 2u, 2u, 2u, 3u, 4u, 5u, 6u, 8u, 11u, 14u, 18u, 22u, 28u, 31u, 34u, 37u, 41u, 45u, 52u, 64u, 70u, 75u, 81u, 92u, 103u, 110u, 110u, 102u, 94u, 93u, 87u, 75u, 68u, 62u, 59u, 55u, 51u, 55u, 61u, 73u, 82u, 80u, 82u, 80u, 84u, 99u, 103u, 93u, 89u, 86u, 79u, 71u, 66u, 62u, 67u, 61u, 60u, 69u, 92u, 105u, 114u, 122u, 125u, 132u, 140u, 144u, 138u, 130u, 122u, 128u, 136u, 138u, 144u, 142u, 143u, 143u, 145u, 143u, 139u, 134u, 130u, 127u, 126u, 125u, 124u, 123u, 123u, 122u, 121u, 119u, 119u, 120u, 121u, 120u, 122u, 121u, 124u, 124u, 126u, 126u, 128u, 127u, 124u, 115u, 106u, 100u, 96u, 95u, 96u, 92u, 91u, 91u, 90u, 90u, 89u, 89u, 84u, 79u, 76u, 70u, 66u, 62u, 60u, 56u, 56u, 58u, 58u, 56u, 51u, 45u, 40u, 37u, 31u, 23u, 17u, 13u, 10u, 9u, 8u, 7u, 6u, 6u, 6u, 5u }, 
-	{ 68u, 68u, 70u, 71u, 72u, 82u, 92u, 103u, 120u, 139u, 155u, 166u, 175u, 183u, 180u, 173u, 170u, 174u, 169u, 158u, 156u, 153u, 151u, 163u, 170u, 172u, 170u, 165u, 157u, 155u, 159u, 164u, 169u, 171u, 178u, 183u, 187u, 190u, 191u, 192u, 192u, 192u, 195u, 195u, 195u, 196u, 197u, 194u, 195u, 197u, 199u, 197u, 197u, 195u, 192u, 188u, 188u, 181u, 171u, 164u, 154u, 147u, 140u, 134u, 125u, 117u, 110u, 104u, 99u, 92u, 88u, 84u, 81u, 76u, 71u, 66u, 62u, 58u, 55u, 51u, 47u, 44u, 41u, 38u, 36u, 34u, 33u, 32u, 32u, 34u, 33u, 30u, 28u, 23u, 21u, 19u, 18u, 19u, 17u, 14u, 9u, 8u, 7u, 6u, 4u, 3u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 3u, 3u, 3u, 4u, 5u, 7u, 9u, 12u, 16u, 21u, 25u, 29u, 31u, 35u, 43u, 47u, 53u, 63u, 72u, 79u, 86u, 92u, 99u, 108u, 108u, 100u, 97u, 97u, 95u, 84u, 77u, 73u, 70u, 68u, 65u, 63u, 62u, 74u, 86u, 87u, 91u, 90u, 91u, 100u, 104u, 101u, 96u, 83u, 73u, 69u, 71u, 69u, 74u, 73u, 71u, 81u, 94u, 110u, 122u, 127u, 129u, 136u, 142u, 145u, 130u, 125u, 125u, 134u, 143u, 146u, 150u, 148u, 146u, 146u, 146u, 144u, 141u, 138u, 135u, 132u, 130u, 129u, 128u, 126u, 126u, 126u, 124u, 121u, 119u, 119u, 121u, 125u, 130u, 130u, 129u, 132u, 131u, 125u, 130u, 132u, 126u, 120u, 109u, 98u, 96u, 94u, 93u, 90u, 90u, 92u, 89u, 85u, 85u, 83u, 74u, 68u, 64u, 63u, 59u, 56u, 56u, 55u, 52u, 50u, 44u, 39u, 37u, 32u, 27u, 27u, 22u, 17u, 13u, 9u, 7u, 5u, 4u, 3u, 3u, 3u, 2u, 2u }, 
-	{ 62u, 64u, 65u, 67u, 77u, 81u, 90u, 106u, 122u, 144u, 160u, 165u, 170u, 182u, 185u, 178u, 169u, 169u, 165u, 161u, 160u, 154u, 157u, 171u, 175u, 175u, 175u, 170u, 157u, 151u, 156u, 162u, 164u, 169u, 175u, 181u, 185u, 187u, 189u, 191u, 191u, 193u, 196u, 197u, 198u, 200u, 200u, 200u, 199u, 199u, 201u, 200u, 200u, 197u, 196u, 195u, 193u, 189u, 182u, 175u, 161u, 151u, 146u, 140u, 133u, 123u, 115u, 111u, 105u, 100u, 96u, 92u, 88u, 83u, 78u, 73u, 69u, 65u, 61u, 56u, 52u, 49u, 46u, 44u, 42u, 41u, 41u, 39u, 38u, 36u, 33u, 30u, 26u, 24u, 24u, 22u, 21u, 21u, 20u, 16u, 12u, 10u, 8u, 7u, 5u, 4u, 4u, 4u, 4u, 4u, 3u, 3u, 3u, 2u, 3u, 3u, 3u, 4u, 5u, 6u, 8u, 11u, 14u, 19u, 23u, 27u, 31u, 36u, 43u, 47u, 52u, 62u, 71u, 80u, 87u, 92u, 98u, 105u, 104u, 100u, 97u, 97u, 98u, 89u, 81u, 81u, 81u, 79u, 73u, 67u, 63u, 70u, 83u, 91u, 93u, 97u, 95u, 99u, 103u, 103u, 97u, 88u, 75u, 72u, 77u, 79u, 78u, 83u, 83u, 88u, 97u, 112u, 128u, 136u, 132u, 134u, 140u, 139u, 134u, 130u, 134u, 143u, 149u, 153u, 157u, 155u, 153u, 150u, 150u, 148u, 145u, 142u, 139u, 137u, 135u, 133u, 131u, 130u, 130u, 130u, 128u, 123u, 122u, 122u, 125u, 131u, 136u, 134u, 134u, 138u, 138u, 133u, 134u, 133u, 130u, 123u, 110u, 98u, 92u, 90u, 92u, 89u, 88u, 90u, 85u, 81u, 79u, 75u, 67u, 61u, 56u, 53u, 52u, 53u, 52u, 50u, 49u, 43u, 36u, 32u, 28u, 24u, 19u, 17u, 15u, 12u, 9u, 6u, 4u, 3u, 2u, 2u, 1u, 1u, 0u, 0u }, 
-	{ 55u, 60u, 66u, 72u, 84u, 95u, 105u, 110u, 126u, 151u, 167u, 172u, 178u, 177u, 181u, 183u, 172u, 166u, 163u, 160u, 157u, 159u, 165u, 170u, 175u, 174u, 174u, 167u, 154u, 152u, 155u, 159u, 165u, 170u, 174u, 177u, 182u, 186u, 188u, 191u, 192u, 194u, 196u, 197u, 199u, 201u, 202u, 202u, 202u, 201u, 201u, 202u, 203u, 200u, 201u, 199u, 195u, 197u, 194u, 186u, 173u, 161u, 154u, 149u, 142u, 131u, 124u, 122u, 118u, 111u, 105u, 100u, 95u, 90u, 84u, 80u, 76u, 71u, 66u, 61u, 57u, 53u, 49u, 47u, 47u, 46u, 46u, 45u, 41u, 35u, 32u, 31u, 29u, 28u, 28u, 25u, 24u, 22u, 21u, 19u, 17u, 13u, 9u, 7u, 6u, 4u, 4u, 5u, 5u, 5u, 5u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 4u, 6u, 7u, 10u, 13u, 17u, 22u, 26u, 31u, 36u, 42u, 46u, 51u, 59u, 68u, 79u, 84u, 88u, 95u, 100u, 97u, 99u, 97u, 95u, 96u, 89u, 79u, 79u, 79u, 82u, 82u, 78u, 71u, 75u, 80u, 85u, 84u, 87u, 86u, 92u, 100u, 98u, 91u, 88u, 78u, 75u, 75u, 77u, 82u, 88u, 89u, 91u, 104u, 126u, 137u, 143u, 141u, 134u, 134u, 139u, 140u, 134u, 140u, 149u, 155u, 160u, 164u, 164u, 161u, 156u, 153u, 153u, 151u, 148u, 144u, 142u, 139u, 136u, 133u, 133u, 133u, 132u, 130u, 127u, 125u, 128u, 132u, 131u, 136u, 140u, 140u, 143u, 145u, 140u, 137u, 137u, 133u, 124u, 113u, 102u, 97u, 91u, 90u, 85u, 84u, 87u, 84u, 80u, 75u, 64u, 56u, 51u, 49u, 45u, 45u, 45u, 45u, 46u, 45u, 38u, 31u, 28u, 23u, 19u, 15u, 13u, 10u, 9u, 7u, 5u, 3u, 2u, 1u, 1u, 1u, 0u, 0u, 0u }, 
-	{ 49u, 57u, 67u, 75u, 95u, 116u, 121u, 124u, 141u, 156u, 168u, 175u, 176u, 174u, 173u, 178u, 172u, 164u, 158u, 156u, 154u, 157u, 170u, 171u, 171u, 174u, 170u, 160u, 152u, 153u, 157u, 162u, 165u, 169u, 171u, 174u, 178u, 183u, 187u, 189u, 191u, 194u, 197u, 198u, 200u, 202u, 202u, 202u, 202u, 201u, 200u, 201u, 204u, 203u, 203u, 199u, 198u, 199u, 201u, 194u, 184u, 172u, 168u, 164u, 154u, 143u, 137u, 135u, 131u, 124u, 116u, 109u, 103u, 96u, 91u, 87u, 82u, 77u, 71u, 66u, 62u, 57u, 52u, 50u, 49u, 47u, 45u, 47u, 44u, 38u, 34u, 34u, 33u, 32u, 31u, 29u, 27u, 26u, 24u, 22u, 20u, 16u, 12u, 8u, 6u, 5u, 5u, 6u, 7u, 6u, 5u, 4u, 3u, 3u, 3u, 3u, 3u, 4u, 4u, 6u, 7u, 9u, 12u, 16u, 21u, 25u, 30u, 36u, 41u, 46u, 53u, 59u, 66u, 74u, 78u, 84u, 91u, 95u, 94u, 99u, 98u, 97u, 94u, 92u, 84u, 82u, 81u, 82u, 88u, 84u, 72u, 76u, 79u, 81u, 76u, 76u, 80u, 83u, 96u, 95u, 87u, 79u, 78u, 73u, 76u, 84u, 85u, 84u, 87u, 95u, 115u, 133u, 143u, 142u, 141u, 140u, 138u, 143u, 143u, 140u, 142u, 153u, 159u, 167u, 170u, 170u, 166u, 162u, 160u, 159u, 157u, 153u, 148u, 146u, 142u, 139u, 135u, 134u, 133u, 131u, 128u, 127u, 126u, 130u, 133u, 132u, 137u, 141u, 144u, 143u, 144u, 143u, 135u, 134u, 136u, 127u, 117u, 107u, 102u, 95u, 90u, 83u, 82u, 80u, 77u, 76u, 70u, 59u, 48u, 43u, 42u, 41u, 40u, 39u, 41u, 41u, 42u, 35u, 29u, 27u, 23u, 19u, 15u, 11u, 8u, 7u, 6u, 4u, 2u, 1u, 1u, 1u, 0u, 0u, 0u, 0u }, 
-	{ 49u, 60u, 72u, 82u, 104u, 125u, 140u, 152u, 161u, 168u, 171u, 174u, 170u, 164u, 162u, 170u, 169u, 161u, 158u, 156u, 159u, 159u, 168u, 172u, 169u, 168u, 162u, 155u, 153u, 156u, 160u, 164u, 167u, 171u, 172u, 173u, 175u, 179u, 183u, 186u, 190u, 192u, 195u, 197u, 198u, 200u, 201u, 201u, 201u, 201u, 200u, 202u, 206u, 205u, 204u, 202u, 200u, 202u, 205u, 203u, 193u, 183u, 176u, 170u, 163u, 162u, 154u, 150u, 146u, 139u, 129u, 120u, 112u, 104u, 98u, 93u, 88u, 82u, 76u, 70u, 64u, 59u, 55u, 51u, 48u, 46u, 47u, 48u, 47u, 43u, 40u, 39u, 37u, 34u, 34u, 33u, 33u, 32u, 29u, 26u, 23u, 19u, 15u, 10u, 7u, 7u, 7u, 7u, 7u, 6u, 5u, 5u, 4u, 3u, 3u, 3u, 3u, 4u, 5u, 6u, 8u, 10u, 12u, 16u, 20u, 25u, 30u, 36u, 43u, 49u, 55u, 61u, 67u, 72u, 76u, 84u, 89u, 89u, 91u, 95u, 95u, 100u, 100u, 98u, 92u, 86u, 90u, 87u, 91u, 88u, 78u, 78u, 78u, 75u, 73u, 72u, 74u, 78u, 85u, 88u, 83u, 76u, 76u, 73u, 76u, 86u, 83u, 82u, 93u, 106u, 122u, 137u, 146u, 143u, 144u, 146u, 147u, 146u, 149u, 149u, 153u, 163u, 168u, 174u, 179u, 178u, 174u, 170u, 167u, 165u, 162u, 157u, 152u, 149u, 146u, 142u, 138u, 135u, 133u, 131u, 128u, 126u, 126u, 127u, 131u, 134u, 136u, 140u, 142u, 142u, 143u, 141u, 135u, 130u, 134u, 132u, 122u, 110u, 103u, 97u, 90u, 84u, 82u, 77u, 70u, 69u, 66u, 56u, 45u, 38u, 37u, 38u, 39u, 39u, 41u, 42u, 40u, 33u, 29u, 27u, 23u, 18u, 14u, 11u, 8u, 6u, 4u, 3u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u }, 
-	{ 60u, 73u, 87u, 97u, 113u, 130u, 152u, 170u, 177u, 179u, 181u, 178u, 163u, 158u, 158u, 165u, 168u, 161u, 156u, 154u, 161u, 162u, 166u, 171u, 170u, 167u, 160u, 156u, 157u, 157u, 158u, 163u, 167u, 170u, 171u, 172u, 173u, 175u, 177u, 180u, 185u, 188u, 190u, 192u, 195u, 197u, 198u, 198u, 199u, 200u, 200u, 203u, 208u, 206u, 204u, 203u, 200u, 201u, 204u, 203u, 199u, 197u, 188u, 181u, 175u, 177u, 173u, 168u, 163u, 156u, 145u, 132u, 121u, 114u, 107u, 101u, 95u, 87u, 81u, 74u, 66u, 61u, 56u, 53u, 49u, 48u, 50u, 49u, 47u, 46u, 44u, 41u, 40u, 41u, 40u, 38u, 36u, 37u, 34u, 29u, 25u, 21u, 17u, 14u, 11u, 10u, 9u, 9u, 8u, 7u, 6u, 5u, 4u, 4u, 3u, 3u, 4u, 4u, 5u, 7u, 9u, 11u, 13u, 16u, 20u, 25u, 30u, 36u, 44u, 51u, 57u, 62u, 68u, 74u, 79u, 84u, 89u, 87u, 88u, 91u, 91u, 94u, 100u, 105u, 101u, 91u, 93u, 94u, 95u, 87u, 82u, 83u, 83u, 75u, 75u, 71u, 67u, 70u, 72u, 76u, 73u, 71u, 74u, 70u, 71u, 84u, 86u, 88u, 102u, 120u, 127u, 138u, 149u, 148u, 145u, 146u, 150u, 155u, 157u, 155u, 161u, 171u, 176u, 178u, 184u, 185u, 181u, 177u, 174u, 170u, 167u, 162u, 158u, 154u, 150u, 146u, 142u, 138u, 134u, 132u, 130u, 129u, 128u, 127u, 130u, 134u, 135u, 137u, 139u, 141u, 139u, 139u, 140u, 136u, 134u, 130u, 122u, 111u, 106u, 98u, 92u, 88u, 86u, 79u, 70u, 61u, 58u, 49u, 42u, 37u, 36u, 38u, 43u, 41u, 41u, 43u, 40u, 34u, 30u, 26u, 22u, 19u, 16u, 12u, 8u, 5u, 3u, 2u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u }, 
-	{ 80u, 91u, 96u, 109u, 119u, 130u, 145u, 170u, 179u, 186u, 191u, 183u, 170u, 159u, 162u, 162u, 156u, 159u, 158u, 162u, 172u, 171u, 170u, 170u, 165u, 161u, 156u, 154u, 156u, 155u, 153u, 159u, 164u, 166u, 170u, 171u, 172u, 171u, 172u, 175u, 178u, 181u, 184u, 187u, 191u, 193u, 194u, 194u, 195u, 197u, 199u, 202u, 205u, 204u, 200u, 199u, 198u, 198u, 201u, 203u, 202u, 202u, 197u, 189u, 189u, 190u, 187u, 183u, 176u, 168u, 154u, 140u, 129u, 120u, 113u, 107u, 101u, 93u, 86u, 78u, 70u, 63u, 58u, 54u, 50u, 50u, 53u, 50u, 48u, 47u, 46u, 45u, 44u, 44u, 43u, 41u, 39u, 40u, 37u, 33u, 28u, 25u, 21u, 18u, 15u, 13u, 11u, 10u, 9u, 8u, 7u, 6u, 5u, 4u, 4u, 4u, 5u, 5u, 6u, 8u, 10u, 12u, 15u, 18u, 21u, 26u, 31u, 38u, 45u, 52u, 58u, 64u, 71u, 77u, 82u, 86u, 89u, 88u, 89u, 92u, 89u, 91u, 99u, 108u, 109u, 103u, 104u, 106u, 93u, 83u, 88u, 89u, 90u, 84u, 81u, 72u, 68u, 65u, 67u, 70u, 67u, 67u, 69u, 65u, 69u, 81u, 87u, 94u, 112u, 126u, 135u, 140u, 148u, 148u, 150u, 151u, 160u, 164u, 162u, 163u, 169u, 180u, 184u, 186u, 189u, 190u, 186u, 184u, 180u, 175u, 171u, 167u, 163u, 158u, 153u, 149u, 145u, 140u, 136u, 134u, 131u, 130u, 130u, 131u, 130u, 133u, 137u, 137u, 138u, 137u, 135u, 138u, 141u, 139u, 135u, 131u, 121u, 115u, 106u, 97u, 94u, 89u, 86u, 75u, 66u, 59u, 56u, 48u, 39u, 36u, 37u, 41u, 46u, 43u, 42u, 44u, 42u, 37u, 31u, 27u, 22u, 18u, 14u, 11u, 7u, 4u, 2u, 2u, 2u, 2u, 1u, 0u, 0u, 0u, 0u, 0u }, 
-	{ 86u, 92u, 95u, 109u, 116u, 125u, 139u, 161u, 167u, 176u, 193u, 187u, 174u, 162u, 159u, 153u, 153u, 158u, 166u, 173u, 179u, 178u, 172u, 167u, 166u, 161u, 155u, 152u, 153u, 154u, 151u, 156u, 161u, 164u, 168u, 168u, 169u, 170u, 170u, 170u, 171u, 175u, 178u, 181u, 185u, 187u, 189u, 189u, 190u, 195u, 199u, 200u, 200u, 200u, 196u, 196u, 197u, 199u, 200u, 200u, 201u, 205u, 202u, 196u, 199u, 202u, 197u, 190u, 183u, 174u, 163u, 150u, 138u, 127u, 119u, 111u, 105u, 98u, 90u, 81u, 75u, 67u, 60u, 55u, 50u, 49u, 52u, 51u, 47u, 47u, 48u, 49u, 49u, 47u, 45u, 44u, 43u, 43u, 40u, 37u, 32u, 27u, 24u, 21u, 18u, 15u, 13u, 12u, 11u, 10u, 8u, 7u, 6u, 6u, 5u, 5u, 5u, 6u, 7u, 9u, 11u, 14u, 16u, 19u, 23u, 27u, 33u, 39u, 46u, 53u, 60u, 67u, 74u, 80u, 84u, 87u, 90u, 91u, 92u, 93u, 89u, 88u, 94u, 107u, 119u, 119u, 115u, 114u, 99u, 89u, 93u, 94u, 93u, 86u, 81u, 75u, 70u, 71u, 69u, 68u, 72u, 71u, 64u, 65u, 73u, 83u, 92u, 104u, 122u, 129u, 136u, 142u, 150u, 153u, 158u, 163u, 173u, 177u, 174u, 174u, 180u, 189u, 193u, 198u, 197u, 193u, 192u, 189u, 185u, 180u, 174u, 170u, 167u, 162u, 157u, 152u, 148u, 142u, 138u, 134u, 132u, 132u, 131u, 129u, 128u, 132u, 135u, 136u, 136u, 135u, 133u, 134u, 138u, 142u, 139u, 133u, 123u, 113u, 103u, 95u, 94u, 90u, 80u, 70u, 65u, 59u, 53u, 46u, 41u, 39u, 40u, 43u, 45u, 45u, 45u, 44u, 41u, 36u, 31u, 25u, 20u, 16u, 13u, 10u, 6u, 4u, 3u, 3u, 2u, 1u, 1u, 0u, 0u, 0u, 0u, 0u }, 
-	{ 87u, 89u, 88u, 101u, 109u, 120u, 132u, 153u, 162u, 175u, 184u, 179u, 173u, 169u, 163u, 158u, 163u, 164u, 170u, 170u, 171u, 172u, 167u, 164u, 164u, 161u, 159u, 159u, 158u, 158u, 154u, 155u, 160u, 166u, 167u, 166u, 166u, 167u, 168u, 166u, 167u, 169u, 170u, 173u, 180u, 182u, 183u, 185u, 186u, 192u, 196u, 196u, 196u, 198u, 193u, 194u, 198u, 200u, 202u, 205u, 208u, 210u, 205u, 202u, 208u, 209u, 207u, 199u, 192u, 183u, 174u, 160u, 147u, 135u, 128u, 120u, 112u, 103u, 95u, 86u, 79u, 71u, 65u, 58u, 52u, 50u, 50u, 49u, 46u, 46u, 47u, 50u, 52u, 51u, 49u, 48u, 47u, 46u, 44u, 40u, 36u, 31u, 28u, 25u, 22u, 19u, 17u, 16u, 14u, 12u, 10u, 9u, 8u, 7u, 7u, 7u, 7u, 7u, 8u, 10u, 12u, 15u, 18u, 21u, 24u, 29u, 34u, 41u, 48u, 55u, 61u, 69u, 76u, 82u, 84u, 87u, 91u, 92u, 91u, 91u, 87u, 91u, 94u, 105u, 115u, 120u, 118u, 117u, 106u, 98u, 102u, 100u, 96u, 89u, 88u, 81u, 74u, 79u, 81u, 74u, 70u, 75u, 63u, 62u, 75u, 86u, 96u, 105u, 115u, 125u, 132u, 140u, 152u, 161u, 170u, 177u, 187u, 190u, 190u, 192u, 196u, 201u, 206u, 205u, 202u, 198u, 196u, 193u, 189u, 183u, 176u, 171u, 169u, 164u, 159u, 153u, 148u, 142u, 138u, 134u, 132u, 130u, 126u, 124u, 125u, 127u, 128u, 131u, 132u, 133u, 132u, 134u, 135u, 134u, 134u, 127u, 117u, 110u, 105u, 100u, 93u, 85u, 73u, 66u, 60u, 57u, 49u, 47u, 44u, 40u, 42u, 45u, 47u, 45u, 45u, 43u, 41u, 37u, 30u, 23u, 19u, 16u, 13u, 10u, 8u, 6u, 4u, 3u, 2u, 1u, 1u, 0u, 0u, 0u, 0u, 0u }, 
-	{ 78u, 81u, 84u, 95u, 103u, 115u, 132u, 148u, 156u, 173u, 180u, 177u, 168u, 167u, 163u, 165u, 170u, 176u, 173u, 164u, 168u, 167u, 167u, 163u, 159u, 161u, 159u, 160u, 160u, 159u, 156u, 156u, 160u, 164u, 166u, 166u, 165u, 165u, 164u, 162u, 163u, 165u, 163u, 167u, 174u, 174u, 175u, 179u, 181u, 186u, 193u, 192u, 194u, 192u, 191u, 193u, 199u, 204u, 210u, 211u, 213u, 210u, 206u, 207u, 215u, 217u, 215u, 206u, 199u, 192u, 180u, 167u, 154u, 142u, 134u, 127u, 119u, 110u, 101u, 92u, 84u, 75u, 68u, 60u, 53u, 50u, 48u, 48u, 47u, 47u, 49u, 53u, 56u, 56u, 55u, 52u, 51u, 49u, 46u, 43u, 38u, 34u, 31u, 29u, 27u, 24u, 22u, 20u, 17u, 15u, 13u, 11u, 10u, 9u, 9u, 8u, 8u, 9u, 10u, 11u, 13u, 16u, 19u, 22u, 26u, 31u, 37u, 43u, 50u, 58u, 64u, 71u, 78u, 83u, 86u, 88u, 90u, 92u, 90u, 87u, 87u, 93u, 100u, 104u, 110u, 112u, 113u, 116u, 115u, 107u, 106u, 102u, 100u, 94u, 95u, 92u, 81u, 85u, 86u, 72u, 64u, 66u, 65u, 64u, 68u, 78u, 93u, 103u, 109u, 121u, 132u, 140u, 155u, 164u, 178u, 191u, 196u, 199u, 204u, 207u, 210u, 214u, 213u, 209u, 204u, 200u, 198u, 196u, 192u, 187u, 180u, 174u, 171u, 167u, 161u, 154u, 149u, 143u, 138u, 134u, 131u, 127u, 124u, 122u, 121u, 123u, 125u, 126u, 127u, 132u, 133u, 132u, 130u, 129u, 127u, 124u, 115u, 114u, 110u, 105u, 95u, 83u, 74u, 64u, 58u, 55u, 50u, 48u, 45u, 42u, 44u, 49u, 49u, 47u, 43u, 43u, 42u, 38u, 33u, 26u, 20u, 16u, 13u, 10u, 9u, 7u, 5u, 3u, 3u, 2u, 1u, 0u, 0u, 0u, 0u, 0u }, 
-	{ 63u, 74u, 80u, 90u, 105u, 115u, 126u, 134u, 141u, 161u, 170u, 169u, 167u, 165u, 170u, 181u, 182u, 182u, 176u, 171u, 172u, 167u, 164u, 160u, 155u, 155u, 154u, 158u, 156u, 154u, 156u, 160u, 160u, 163u, 163u, 166u, 164u, 162u, 162u, 163u, 160u, 155u, 154u, 161u, 167u, 168u, 171u, 175u, 177u, 181u, 188u, 190u, 190u, 186u, 184u, 188u, 197u, 205u, 212u, 212u, 212u, 209u, 208u, 212u, 217u, 218u, 213u, 205u, 201u, 195u, 184u, 173u, 160u, 150u, 141u, 133u, 126u, 118u, 108u, 97u, 88u, 78u, 69u, 61u, 56u, 52u, 49u, 49u, 49u, 51u, 54u, 56u, 58u, 60u, 60u, 58u, 54u, 51u, 50u, 46u, 42u, 39u, 35u, 33u, 31u, 29u, 26u, 23u, 20u, 18u, 15u, 14u, 12u, 11u, 11u, 10u, 10u, 11u, 12u, 13u, 15u, 18u, 22u, 25u, 29u, 34u, 39u, 45u, 53u, 61u, 68u, 74u, 80u, 85u, 88u, 91u, 93u, 94u, 92u, 89u, 89u, 96u, 101u, 101u, 106u, 107u, 111u, 113u, 117u, 114u, 106u, 97u, 99u, 96u, 95u, 92u, 85u, 85u, 85u, 75u, 68u, 66u, 67u, 64u, 69u, 82u, 90u, 104u, 117u, 129u, 139u, 145u, 156u, 166u, 182u, 194u, 195u, 200u, 210u, 217u, 220u, 219u, 214u, 210u, 207u, 204u, 201u, 198u, 196u, 190u, 183u, 178u, 173u, 169u, 162u, 154u, 148u, 143u, 138u, 133u, 129u, 125u, 123u, 122u, 121u, 120u, 122u, 122u, 123u, 127u, 128u, 127u, 123u, 121u, 119u, 119u, 114u, 110u, 106u, 104u, 97u, 87u, 74u, 64u, 62u, 58u, 51u, 46u, 46u, 48u, 51u, 52u, 50u, 48u, 44u, 43u, 42u, 39u, 33u, 28u, 21u, 17u, 13u, 11u, 10u, 8u, 6u, 4u, 3u, 1u, 1u, 1u, 0u, 0u, 0u, 0u }, 
-	{ 54u, 61u, 73u, 86u, 103u, 110u, 116u, 125u, 136u, 156u, 166u, 159u, 159u, 161u, 176u, 183u, 182u, 175u, 172u, 174u, 168u, 161u, 155u, 158u, 158u, 155u, 154u, 157u, 155u, 155u, 155u, 162u, 162u, 163u, 161u, 164u, 161u, 156u, 154u, 155u, 151u, 145u, 147u, 153u, 159u, 165u, 166u, 168u, 173u, 178u, 180u, 183u, 183u, 183u, 181u, 178u, 189u, 198u, 205u, 209u, 211u, 210u, 212u, 211u, 210u, 211u, 210u, 206u, 201u, 194u, 185u, 175u, 163u, 154u, 147u, 140u, 133u, 125u, 114u, 104u, 94u, 82u, 72u, 63u, 58u, 55u, 53u, 52u, 52u, 55u, 58u, 60u, 61u, 63u, 63u, 61u, 58u, 54u, 52u, 50u, 47u, 44u, 41u, 38u, 35u, 33u, 30u, 26u, 23u, 21u, 18u, 16u, 15u, 14u, 13u, 13u, 13u, 13u, 15u, 16u, 18u, 21u, 24u, 28u, 32u, 37u, 42u, 49u, 56u, 64u, 71u, 78u, 84u, 88u, 91u, 93u, 94u, 96u, 95u, 91u, 91u, 96u, 99u, 100u, 102u, 101u, 104u, 112u, 118u, 114u, 110u, 99u, 100u, 98u, 87u, 85u, 93u, 89u, 83u, 83u, 73u, 72u, 70u, 70u, 78u, 85u, 96u, 112u, 124u, 133u, 141u, 146u, 156u, 169u, 184u, 193u, 192u, 198u, 209u, 219u, 222u, 220u, 215u, 213u, 209u, 207u, 205u, 203u, 199u, 193u, 187u, 181u, 176u, 170u, 163u, 155u, 148u, 143u, 137u, 132u, 128u, 125u, 123u, 122u, 121u, 120u, 120u, 123u, 123u, 123u, 123u, 119u, 114u, 113u, 113u, 113u, 106u, 100u, 97u, 98u, 93u, 87u, 76u, 66u, 61u, 56u, 50u, 48u, 49u, 53u, 56u, 53u, 52u, 51u, 50u, 43u, 37u, 36u, 33u, 30u, 24u, 20u, 17u, 13u, 11u, 8u, 6u, 4u, 3u, 1u, 1u, 1u, 0u, 0u, 0u, 0u }, 
-	{ 50u, 54u, 66u, 84u, 107u, 105u, 109u, 124u, 138u, 149u, 159u, 161u, 155u, 163u, 171u, 178u, 179u, 173u, 173u, 174u, 165u, 155u, 149u, 147u, 156u, 158u, 156u, 156u, 156u, 154u, 154u, 156u, 158u, 160u, 155u, 156u, 154u, 148u, 140u, 142u, 141u, 139u, 141u, 147u, 153u, 159u, 160u, 163u, 168u, 174u, 177u, 177u, 176u, 174u, 175u, 172u, 181u, 189u, 197u, 205u, 211u, 214u, 215u, 212u, 206u, 205u, 206u, 205u, 199u, 192u, 186u, 177u, 167u, 160u, 152u, 145u, 138u, 131u, 121u, 111u, 99u, 86u, 76u, 66u, 61u, 59u, 58u, 56u, 55u, 57u, 60u, 62u, 63u, 65u, 65u, 62u, 60u, 58u, 56u, 54u, 52u, 49u, 46u, 43u, 40u, 37u, 34u, 30u, 28u, 25u, 22u, 20u, 18u, 17u, 16u, 16u, 16u, 16u, 18u, 20u, 22u, 24u, 28u, 32u, 36u, 41u, 47u, 53u, 59u, 67u, 74u, 81u, 87u, 92u, 95u, 97u, 97u, 98u, 100u, 97u, 97u, 96u, 98u, 99u, 99u, 99u, 99u, 108u, 120u, 123u, 120u, 113u, 109u, 97u, 90u, 88u, 93u, 91u, 88u, 84u, 79u, 73u, 76u, 78u, 84u, 92u, 102u, 118u, 131u, 140u, 146u, 153u, 160u, 173u, 182u, 187u, 191u, 198u, 208u, 218u, 220u, 218u, 217u, 214u, 211u, 210u, 209u, 206u, 201u, 196u, 190u, 185u, 178u, 171u, 165u, 157u, 151u, 143u, 137u, 132u, 127u, 125u, 123u, 122u, 121u, 120u, 121u, 124u, 123u, 119u, 118u, 113u, 108u, 103u, 103u, 102u, 95u, 89u, 87u, 88u, 87u, 82u, 73u, 65u, 58u, 52u, 49u, 49u, 48u, 52u, 56u, 57u, 58u, 57u, 52u, 45u, 38u, 32u, 32u, 32u, 29u, 24u, 20u, 16u, 13u, 10u, 7u, 5u, 3u, 2u, 1u, 1u, 1u, 1u, 0u, 0u }, 
-	{ 53u, 59u, 71u, 91u, 105u, 105u, 113u, 123u, 138u, 146u, 155u, 166u, 164u, 168u, 168u, 168u, 167u, 160u, 162u, 162u, 155u, 145u, 144u, 146u, 152u, 156u, 158u, 156u, 156u, 156u, 155u, 152u, 150u, 151u, 146u, 145u, 144u, 137u, 132u, 131u, 128u, 126u, 131u, 139u, 146u, 153u, 152u, 154u, 158u, 165u, 167u, 166u, 166u, 164u, 165u, 172u, 185u, 193u, 200u, 210u, 213u, 214u, 215u, 214u, 209u, 207u, 204u, 204u, 199u, 192u, 186u, 178u, 170u, 164u, 157u, 150u, 143u, 135u, 126u, 115u, 103u, 90u, 79u, 71u, 66u, 63u, 62u, 60u, 60u, 60u, 61u, 63u, 64u, 64u, 64u, 62u, 62u, 61u, 59u, 58u, 56u, 53u, 50u, 47u, 44u, 42u, 39u, 35u, 32u, 29u, 27u, 24u, 22u, 21u, 20u, 20u, 20u, 20u, 21u, 23u, 25u, 28u, 32u, 37u, 42u, 47u, 53u, 59u, 65u, 73u, 81u, 86u, 91u, 96u, 99u, 100u, 102u, 103u, 103u, 102u, 101u, 100u, 99u, 98u, 97u, 99u, 104u, 112u, 121u, 127u, 128u, 123u, 111u, 97u, 91u, 94u, 94u, 88u, 81u, 75u, 71u, 69u, 80u, 90u, 96u, 103u, 114u, 129u, 142u, 153u, 154u, 157u, 167u, 182u, 187u, 187u, 191u, 197u, 205u, 215u, 219u, 218u, 217u, 216u, 214u, 212u, 210u, 207u, 203u, 198u, 193u, 187u, 179u, 173u, 167u, 159u, 153u, 144u, 137u, 132u, 127u, 125u, 122u, 121u, 121u, 121u, 122u, 123u, 122u, 117u, 115u, 111u, 104u, 96u, 96u, 93u, 85u, 80u, 77u, 75u, 75u, 70u, 67u, 60u, 51u, 47u, 47u, 47u, 49u, 53u, 54u, 57u, 56u, 56u, 50u, 45u, 40u, 33u, 32u, 34u, 35u, 29u, 23u, 19u, 16u, 13u, 9u, 6u, 4u, 3u, 3u, 3u, 3u, 2u, 0u, 0u }, 
-	{ 67u, 72u, 79u, 98u, 108u, 111u, 115u, 126u, 134u, 140u, 148u, 159u, 158u, 159u, 161u, 156u, 157u, 150u, 150u, 147u, 148u, 146u, 145u, 150u, 158u, 160u, 161u, 158u, 157u, 154u, 151u, 147u, 142u, 139u, 140u, 139u, 141u, 135u, 127u, 125u, 120u, 119u, 127u, 133u, 137u, 144u, 145u, 142u, 148u, 155u, 157u, 157u, 162u, 164u, 170u, 178u, 190u, 195u, 201u, 208u, 213u, 212u, 215u, 215u, 213u, 209u, 206u, 205u, 200u, 196u, 190u, 182u, 174u, 169u, 162u, 156u, 149u, 140u, 131u, 120u, 109u, 95u, 84u, 76u, 72u, 69u, 67u, 65u, 64u, 63u, 63u, 64u, 64u, 65u, 65u, 65u, 64u, 64u, 63u, 62u, 60u, 57u, 55u, 52u, 49u, 45u, 42u, 38u, 35u, 33u, 32u, 30u, 27u, 26u, 25u, 24u, 24u, 24u, 25u, 27u, 28u, 31u, 36u, 41u, 47u, 52u, 59u, 66u, 73u, 81u, 87u, 92u, 96u, 100u, 103u, 105u, 106u, 107u, 107u, 107u, 105u, 104u, 100u, 101u, 103u, 104u, 113u, 123u, 128u, 131u, 130u, 127u, 119u, 109u, 99u, 95u, 90u, 85u, 76u, 75u, 72u, 74u, 81u, 95u, 103u, 111u, 121u, 131u, 145u, 159u, 157u, 164u, 177u, 192u, 195u, 194u, 196u, 199u, 200u, 209u, 214u, 217u, 218u, 217u, 217u, 214u, 210u, 207u, 203u, 198u, 193u, 186u, 179u, 172u, 167u, 161u, 154u, 146u, 136u, 131u, 127u, 124u, 122u, 122u, 122u, 123u, 125u, 123u, 118u, 116u, 113u, 108u, 103u, 95u, 92u, 83u, 74u, 69u, 64u, 65u, 66u, 63u, 61u, 55u, 49u, 46u, 44u, 45u, 49u, 53u, 56u, 58u, 58u, 57u, 53u, 47u, 44u, 38u, 35u, 35u, 37u, 34u, 28u, 23u, 19u, 16u, 11u, 8u, 6u, 5u, 5u, 4u, 3u, 2u, 1u, 0u }, 
-	{ 80u, 88u, 99u, 108u, 106u, 110u, 124u, 137u, 136u, 135u, 140u, 147u, 153u, 160u, 158u, 160u, 157u, 150u, 141u, 143u, 143u, 146u, 145u, 148u, 154u, 154u, 156u, 151u, 151u, 151u, 150u, 144u, 139u, 135u, 139u, 138u, 136u, 132u, 125u, 124u, 120u, 119u, 126u, 129u, 128u, 135u, 137u, 141u, 146u, 147u, 147u, 152u, 161u, 169u, 176u, 183u, 189u, 191u, 196u, 206u, 209u, 210u, 213u, 212u, 213u, 211u, 207u, 205u, 202u, 197u, 192u, 186u, 179u, 173u, 167u, 161u, 154u, 146u, 137u, 126u, 114u, 102u, 92u, 83u, 79u, 75u, 72u, 70u, 68u, 67u, 67u, 67u, 68u, 68u, 68u, 68u, 68u, 68u, 67u, 66u, 64u, 62u, 59u, 56u, 53u, 49u, 46u, 42u, 40u, 38u, 36u, 34u, 32u, 31u, 29u, 28u, 27u, 27u, 29u, 30u, 32u, 36u, 41u, 46u, 51u, 57u, 64u, 71u, 79u, 87u, 93u, 98u, 101u, 104u, 107u, 109u, 110u, 111u, 111u, 112u, 111u, 110u, 107u, 107u, 110u, 113u, 124u, 129u, 132u, 135u, 131u, 134u, 132u, 125u, 117u, 103u, 90u, 82u, 80u, 81u, 80u, 81u, 86u, 99u, 111u, 119u, 128u, 136u, 148u, 163u, 168u, 174u, 185u, 192u, 194u, 194u, 199u, 200u, 198u, 201u, 207u, 212u, 216u, 216u, 217u, 214u, 211u, 207u, 202u, 196u, 190u, 185u, 178u, 173u, 167u, 161u, 153u, 145u, 137u, 131u, 127u, 124u, 123u, 121u, 122u, 124u, 124u, 122u, 117u, 113u, 112u, 107u, 103u, 94u, 85u, 76u, 70u, 64u, 58u, 58u, 59u, 58u, 56u, 53u, 50u, 45u, 43u, 44u, 47u, 51u, 56u, 60u, 61u, 59u, 55u, 49u, 47u, 44u, 40u, 38u, 37u, 37u, 32u, 23u, 19u, 17u, 14u, 10u, 7u, 6u, 5u, 4u, 3u, 2u, 1u, 0u }, 
-	{ 92u, 107u, 114u, 119u, 121u, 121u, 137u, 148u, 145u, 140u, 137u, 146u, 163u, 170u, 164u, 166u, 153u, 142u, 129u, 136u, 135u, 138u, 140u, 144u, 144u, 143u, 148u, 148u, 149u, 147u, 149u, 143u, 137u, 135u, 137u, 137u, 132u, 129u, 121u, 118u, 111u, 113u, 123u, 128u, 125u, 130u, 137u, 145u, 146u, 145u, 143u, 151u, 160u, 169u, 174u, 182u, 187u, 189u, 190u, 199u, 204u, 205u, 207u, 207u, 209u, 209u, 208u, 206u, 203u, 198u, 194u, 189u, 183u, 177u, 171u, 165u, 158u, 151u, 142u, 131u, 120u, 111u, 101u, 93u, 88u, 83u, 78u, 76u, 74u, 72u, 72u, 72u, 72u, 72u, 73u, 73u, 72u, 72u, 71u, 70u, 68u, 65u, 62u, 60u, 56u, 53u, 50u, 47u, 44u, 41u, 40u, 38u, 36u, 34u, 32u, 31u, 30u, 31u, 32u, 34u, 37u, 41u, 46u, 51u, 58u, 64u, 70u, 76u, 84u, 92u, 97u, 103u, 107u, 110u, 112u, 114u, 115u, 116u, 116u, 117u, 116u, 115u, 114u, 118u, 123u, 127u, 131u, 137u, 142u, 140u, 132u, 135u, 137u, 133u, 125u, 109u, 97u, 95u, 90u, 87u, 88u, 89u, 95u, 105u, 112u, 116u, 128u, 141u, 154u, 165u, 172u, 174u, 187u, 188u, 186u, 185u, 192u, 196u, 193u, 193u, 202u, 206u, 207u, 209u, 211u, 212u, 210u, 205u, 201u, 195u, 189u, 183u, 177u, 172u, 165u, 160u, 154u, 145u, 137u, 131u, 128u, 125u, 123u, 120u, 120u, 121u, 121u, 118u, 112u, 108u, 107u, 104u, 99u, 90u, 78u, 70u, 64u, 60u, 54u, 53u, 56u, 56u, 54u, 51u, 46u, 44u, 43u, 43u, 46u, 52u, 55u, 58u, 59u, 59u, 56u, 51u, 47u, 45u, 42u, 41u, 39u, 37u, 35u, 25u, 19u, 18u, 17u, 13u, 9u, 8u, 7u, 5u, 5u, 3u, 1u, 0u }, 
-	{ 101u, 120u, 129u, 134u, 132u, 135u, 147u, 157u, 164u, 155u, 152u, 166u, 168u, 170u, 164u, 162u, 149u, 132u, 121u, 130u, 126u, 127u, 131u, 135u, 136u, 142u, 141u, 144u, 149u, 151u, 153u, 148u, 141u, 136u, 140u, 137u, 133u, 127u, 117u, 112u, 108u, 111u, 115u, 124u, 123u, 127u, 136u, 143u, 152u, 151u, 151u, 146u, 152u, 162u, 170u, 182u, 185u, 184u, 186u, 188u, 195u, 202u, 203u, 204u, 206u, 207u, 207u, 207u, 204u, 200u, 196u, 191u, 186u, 181u, 176u, 171u, 165u, 157u, 148u, 138u, 128u, 119u, 111u, 104u, 97u, 90u, 86u, 83u, 80u, 78u, 77u, 77u, 77u, 78u, 78u, 78u, 78u, 77u, 76u, 75u, 71u, 69u, 66u, 64u, 60u, 57u, 54u, 51u, 48u, 45u, 44u, 42u, 39u, 37u, 35u, 34u, 33u, 34u, 35u, 37u, 41u, 46u, 51u, 58u, 65u, 72u, 75u, 82u, 89u, 96u, 101u, 108u, 112u, 115u, 118u, 119u, 121u, 121u, 122u, 124u, 122u, 119u, 120u, 124u, 129u, 135u, 138u, 144u, 145u, 144u, 137u, 142u, 142u, 144u, 136u, 122u, 111u, 105u, 98u, 97u, 93u, 96u, 108u, 119u, 118u, 123u, 133u, 147u, 159u, 168u, 173u, 175u, 182u, 185u, 185u, 182u, 189u, 191u, 193u, 192u, 197u, 203u, 201u, 202u, 206u, 208u, 207u, 202u, 197u, 192u, 187u, 181u, 176u, 169u, 163u, 157u, 152u, 145u, 137u, 131u, 127u, 124u, 121u, 119u, 119u, 118u, 118u, 112u, 106u, 103u, 103u, 102u, 94u, 86u, 76u, 66u, 61u, 56u, 53u, 55u, 56u, 56u, 52u, 46u, 43u, 41u, 40u, 40u, 45u, 50u, 52u, 54u, 53u, 54u, 52u, 50u, 48u, 43u, 41u, 39u, 40u, 38u, 35u, 27u, 21u, 19u, 19u, 15u, 12u, 9u, 7u, 6u, 5u, 4u, 2u, 1u }, 
-	{ 116u, 127u, 134u, 142u, 144u, 150u, 161u, 165u, 170u, 174u, 175u, 171u, 164u, 160u, 154u, 155u, 152u, 138u, 125u, 127u, 126u, 119u, 127u, 137u, 139u, 141u, 141u, 144u, 153u, 159u, 156u, 148u, 147u, 145u, 146u, 143u, 139u, 129u, 117u, 109u, 110u, 112u, 110u, 117u, 119u, 121u, 134u, 143u, 152u, 155u, 156u, 150u, 144u, 152u, 164u, 175u, 181u, 180u, 181u, 183u, 188u, 197u, 199u, 201u, 203u, 206u, 206u, 208u, 206u, 203u, 199u, 194u, 190u, 185u, 181u, 176u, 171u, 164u, 155u, 146u, 137u, 129u, 121u, 113u, 105u, 99u, 94u, 90u, 87u, 85u, 84u, 84u, 83u, 84u, 84u, 84u, 83u, 82u, 81u, 80u, 76u, 73u, 71u, 68u, 65u, 61u, 58u, 55u, 52u, 49u, 46u, 44u, 42u, 40u, 38u, 36u, 36u, 37u, 38u, 40u, 44u, 48u, 54u, 63u, 69u, 74u, 78u, 86u, 93u, 99u, 105u, 112u, 117u, 121u, 123u, 125u, 126u, 127u, 128u, 129u, 128u, 126u, 126u, 129u, 131u, 135u, 143u, 148u, 150u, 147u, 144u, 150u, 149u, 152u, 148u, 131u, 120u, 116u, 107u, 107u, 102u, 101u, 114u, 128u, 134u, 135u, 147u, 155u, 161u, 160u, 166u, 171u, 177u, 179u, 185u, 185u, 186u, 186u, 190u, 188u, 192u, 198u, 197u, 199u, 203u, 204u, 202u, 198u, 193u, 189u, 185u, 179u, 173u, 167u, 161u, 153u, 147u, 142u, 135u, 129u, 123u, 119u, 118u, 118u, 117u, 117u, 117u, 112u, 105u, 100u, 101u, 97u, 88u, 84u, 77u, 67u, 61u, 56u, 54u, 54u, 53u, 52u, 50u, 45u, 42u, 39u, 37u, 38u, 42u, 45u, 49u, 50u, 49u, 49u, 50u, 50u, 46u, 42u, 42u, 39u, 38u, 39u, 35u, 27u, 23u, 22u, 20u, 16u, 14u, 11u, 7u, 6u, 5u, 5u, 3u, 2u }, 
-	{ 132u, 142u, 145u, 153u, 155u, 169u, 183u, 182u, 172u, 177u, 177u, 163u, 158u, 160u, 157u, 153u, 160u, 149u, 134u, 125u, 126u, 121u, 127u, 130u, 131u, 132u, 140u, 150u, 160u, 164u, 162u, 156u, 153u, 153u, 145u, 137u, 135u, 128u, 118u, 106u, 105u, 105u, 103u, 113u, 118u, 119u, 128u, 139u, 145u, 152u, 152u, 147u, 147u, 155u, 161u, 166u, 172u, 169u, 175u, 182u, 187u, 191u, 194u, 200u, 202u, 203u, 203u, 206u, 207u, 205u, 202u, 197u, 194u, 190u, 186u, 181u, 176u, 170u, 162u, 154u, 146u, 138u, 129u, 121u, 114u, 107u, 102u, 98u, 94u, 92u, 90u, 90u, 90u, 90u, 91u, 91u, 90u, 88u, 85u, 82u, 80u, 78u, 76u, 73u, 69u, 66u, 62u, 59u, 55u, 52u, 50u, 48u, 45u, 42u, 40u, 39u, 39u, 39u, 40u, 42u, 45u, 50u, 55u, 64u, 71u, 77u, 81u, 87u, 94u, 101u, 108u, 116u, 121u, 126u, 129u, 132u, 132u, 132u, 132u, 135u, 138u, 138u, 137u, 137u, 138u, 139u, 143u, 150u, 158u, 154u, 149u, 149u, 144u, 147u, 146u, 140u, 132u, 130u, 121u, 118u, 108u, 100u, 108u, 119u, 137u, 143u, 155u, 161u, 164u, 157u, 159u, 163u, 170u, 173u, 181u, 181u, 178u, 181u, 185u, 183u, 186u, 191u, 192u, 193u, 196u, 198u, 196u, 193u, 188u, 184u, 180u, 175u, 170u, 164u, 158u, 150u, 143u, 137u, 130u, 124u, 120u, 116u, 115u, 117u, 117u, 117u, 114u, 111u, 110u, 102u, 99u, 96u, 87u, 83u, 76u, 65u, 63u, 59u, 57u, 56u, 52u, 48u, 47u, 41u, 38u, 37u, 35u, 35u, 39u, 42u, 46u, 46u, 48u, 47u, 50u, 48u, 46u, 43u, 41u, 38u, 37u, 36u, 35u, 28u, 25u, 24u, 20u, 17u, 16u, 12u, 9u, 6u, 5u, 5u, 3u, 3u }, 
-	{ 142u, 152u, 157u, 159u, 169u, 179u, 183u, 183u, 179u, 177u, 169u, 160u, 154u, 152u, 147u, 147u, 156u, 156u, 144u, 136u, 129u, 130u, 130u, 132u, 128u, 136u, 145u, 157u, 168u, 170u, 163u, 162u, 159u, 157u, 146u, 135u, 127u, 124u, 116u, 107u, 103u, 102u, 103u, 112u, 115u, 111u, 120u, 128u, 132u, 138u, 144u, 137u, 138u, 144u, 153u, 161u, 165u, 163u, 169u, 174u, 177u, 179u, 184u, 191u, 199u, 201u, 203u, 206u, 209u, 208u, 206u, 200u, 197u, 193u, 190u, 187u, 181u, 175u, 168u, 161u, 153u, 145u, 137u, 129u, 122u, 115u, 110u, 105u, 102u, 99u, 97u, 97u, 96u, 97u, 97u, 97u, 96u, 92u, 89u, 85u, 84u, 83u, 81u, 78u, 74u, 70u, 65u, 62u, 58u, 55u, 52u, 50u, 48u, 45u, 42u, 41u, 40u, 41u, 42u, 44u, 47u, 51u, 57u, 64u, 70u, 76u, 83u, 90u, 97u, 105u, 113u, 120u, 126u, 131u, 135u, 137u, 138u, 138u, 137u, 139u, 145u, 147u, 146u, 142u, 141u, 139u, 143u, 153u, 158u, 156u, 153u, 145u, 143u, 148u, 149u, 144u, 141u, 134u, 127u, 115u, 114u, 105u, 101u, 111u, 128u, 145u, 162u, 176u, 175u, 165u, 158u, 162u, 166u, 173u, 180u, 180u, 181u, 183u, 183u, 181u, 183u, 186u, 189u, 189u, 189u, 191u, 190u, 188u, 184u, 181u, 175u, 169u, 163u, 159u, 154u, 147u, 138u, 131u, 124u, 120u, 117u, 115u, 114u, 115u, 115u, 114u, 112u, 109u, 108u, 103u, 97u, 88u, 86u, 82u, 78u, 71u, 65u, 63u, 61u, 58u, 52u, 48u, 48u, 42u, 36u, 36u, 34u, 35u, 37u, 39u, 42u, 44u, 47u, 47u, 48u, 49u, 47u, 44u, 39u, 37u, 36u, 37u, 36u, 32u, 28u, 27u, 23u, 19u, 17u, 14u, 11u, 8u, 6u, 5u, 4u, 4u }, 
-	{ 143u, 147u, 153u, 159u, 170u, 182u, 185u, 189u, 188u, 185u, 173u, 167u, 156u, 144u, 139u, 150u, 154u, 154u, 155u, 153u, 143u, 145u, 137u, 134u, 140u, 148u, 159u, 171u, 173u, 167u, 161u, 157u, 149u, 144u, 136u, 127u, 121u, 121u, 113u, 110u, 109u, 103u, 105u, 111u, 107u, 103u, 108u, 117u, 125u, 132u, 138u, 133u, 127u, 130u, 139u, 146u, 152u, 154u, 158u, 159u, 159u, 164u, 176u, 182u, 192u, 201u, 206u, 209u, 213u, 211u, 207u, 202u, 199u, 196u, 193u, 190u, 185u, 180u, 173u, 166u, 158u, 151u, 144u, 137u, 129u, 123u, 118u, 113u, 109u, 106u, 104u, 103u, 103u, 103u, 103u, 101u, 101u, 97u, 93u, 88u, 87u, 87u, 85u, 82u, 78u, 74u, 69u, 66u, 61u, 58u, 55u, 52u, 50u, 47u, 44u, 42u, 41u, 42u, 44u, 45u, 47u, 52u, 57u, 63u, 69u, 75u, 83u, 91u, 100u, 109u, 117u, 124u, 130u, 135u, 138u, 141u, 142u, 142u, 143u, 146u, 149u, 148u, 147u, 145u, 144u, 143u, 148u, 151u, 155u, 152u, 152u, 148u, 148u, 149u, 145u, 142u, 140u, 130u, 126u, 117u, 117u, 110u, 103u, 111u, 122u, 142u, 166u, 177u, 174u, 175u, 174u, 179u, 180u, 180u, 177u, 182u, 186u, 183u, 181u, 180u, 182u, 184u, 184u, 185u, 185u, 185u, 184u, 185u, 181u, 175u, 169u, 163u, 156u, 151u, 147u, 142u, 136u, 129u, 123u, 118u, 116u, 115u, 112u, 113u, 112u, 110u, 108u, 106u, 106u, 103u, 92u, 83u, 84u, 83u, 82u, 74u, 69u, 66u, 64u, 59u, 52u, 50u, 48u, 42u, 36u, 33u, 34u, 36u, 36u, 37u, 38u, 40u, 44u, 47u, 48u, 50u, 46u, 41u, 37u, 37u, 37u, 37u, 37u, 34u, 29u, 28u, 25u, 21u, 18u, 15u, 13u, 12u, 9u, 6u, 6u, 6u }, 
-	{ 143u, 144u, 144u, 153u, 167u, 184u, 194u, 196u, 187u, 183u, 182u, 181u, 171u, 151u, 148u, 149u, 152u, 153u, 156u, 157u, 146u, 144u, 140u, 138u, 146u, 149u, 169u, 182u, 175u, 168u, 157u, 147u, 142u, 129u, 123u, 113u, 107u, 107u, 103u, 108u, 106u, 101u, 105u, 104u, 96u, 97u, 101u, 103u, 113u, 116u, 119u, 116u, 113u, 120u, 126u, 128u, 132u, 129u, 137u, 140u, 142u, 153u, 165u, 178u, 186u, 198u, 202u, 205u, 211u, 211u, 207u, 201u, 198u, 195u, 194u, 192u, 189u, 183u, 177u, 170u, 163u, 156u, 149u, 143u, 136u, 131u, 126u, 121u, 116u, 113u, 111u, 109u, 108u, 107u, 106u, 104u, 103u, 100u, 97u, 94u, 91u, 90u, 88u, 85u, 82u, 78u, 73u, 69u, 64u, 60u, 56u, 54u, 52u, 49u, 45u, 43u, 42u, 42u, 44u, 46u, 48u, 52u, 57u, 63u, 69u, 75u, 84u, 92u, 101u, 111u, 119u, 126u, 132u, 137u, 141u, 143u, 145u, 146u, 148u, 154u, 152u, 149u, 145u, 145u, 144u, 143u, 147u, 147u, 154u, 152u, 151u, 145u, 147u, 147u, 142u, 137u, 138u, 131u, 126u, 120u, 122u, 111u, 104u, 111u, 122u, 142u, 165u, 174u, 182u, 187u, 187u, 189u, 186u, 184u, 182u, 183u, 186u, 184u, 179u, 180u, 179u, 181u, 179u, 178u, 177u, 179u, 180u, 182u, 176u, 169u, 164u, 158u, 151u, 145u, 141u, 137u, 132u, 126u, 121u, 116u, 115u, 111u, 108u, 109u, 109u, 109u, 104u, 101u, 101u, 103u, 92u, 81u, 78u, 80u, 86u, 80u, 75u, 73u, 70u, 65u, 56u, 50u, 45u, 40u, 33u, 28u, 31u, 33u, 33u, 35u, 36u, 38u, 43u, 46u, 44u, 47u, 48u, 45u, 42u, 41u, 38u, 36u, 35u, 34u, 31u, 29u, 27u, 24u, 23u, 19u, 16u, 15u, 12u, 9u, 10u, 11u }, 
-	{ 141u, 145u, 145u, 152u, 174u, 194u, 203u, 204u, 194u, 187u, 191u, 189u, 168u, 151u, 152u, 153u, 155u, 147u, 153u, 155u, 153u, 149u, 149u, 144u, 151u, 163u, 185u, 187u, 181u, 171u, 158u, 146u, 139u, 128u, 112u, 102u, 96u, 97u, 104u, 107u, 105u, 108u, 109u, 106u, 102u, 96u, 96u, 99u, 105u, 98u, 96u, 97u, 103u, 107u, 112u, 113u, 113u, 111u, 119u, 127u, 136u, 149u, 161u, 173u, 186u, 192u, 195u, 201u, 206u, 209u, 205u, 200u, 198u, 195u, 194u, 195u, 193u, 188u, 181u, 175u, 167u, 160u, 153u, 148u, 142u, 138u, 134u, 129u, 124u, 120u, 117u, 114u, 112u, 111u, 108u, 106u, 104u, 103u, 100u, 98u, 95u, 93u, 92u, 89u, 85u, 81u, 76u, 72u, 67u, 62u, 58u, 55u, 52u, 49u, 46u, 44u, 44u, 43u, 43u, 45u, 48u, 52u, 56u, 61u, 67u, 75u, 84u, 93u, 102u, 112u, 120u, 128u, 134u, 139u, 142u, 144u, 146u, 151u, 152u, 153u, 154u, 151u, 144u, 143u, 144u, 140u, 142u, 145u, 148u, 147u, 147u, 148u, 150u, 152u, 142u, 141u, 137u, 135u, 132u, 124u, 119u, 110u, 110u, 117u, 130u, 142u, 159u, 174u, 186u, 194u, 200u, 197u, 189u, 186u, 187u, 185u, 184u, 186u, 182u, 180u, 180u, 179u, 176u, 174u, 171u, 172u, 173u, 174u, 170u, 164u, 157u, 151u, 143u, 137u, 135u, 133u, 129u, 122u, 118u, 114u, 111u, 106u, 104u, 103u, 105u, 104u, 98u, 95u, 96u, 96u, 92u, 79u, 77u, 78u, 83u, 83u, 80u, 76u, 72u, 67u, 57u, 54u, 48u, 40u, 34u, 28u, 27u, 30u, 30u, 31u, 33u, 38u, 42u, 46u, 44u, 44u, 47u, 47u, 47u, 42u, 36u, 34u, 35u, 35u, 33u, 29u, 26u, 26u, 26u, 22u, 18u, 17u, 15u, 12u, 13u, 14u }, 
-	{ 141u, 150u, 158u, 168u, 182u, 198u, 205u, 206u, 210u, 209u, 205u, 195u, 168u, 147u, 152u, 160u, 160u, 150u, 157u, 149u, 141u, 138u, 142u, 143u, 152u, 173u, 192u, 192u, 187u, 181u, 171u, 155u, 139u, 130u, 116u, 100u, 91u, 92u, 99u, 104u, 107u, 108u, 107u, 111u, 112u, 105u, 98u, 94u, 90u, 85u, 81u, 84u, 85u, 91u, 103u, 109u, 114u, 114u, 122u, 129u, 134u, 148u, 160u, 169u, 177u, 180u, 188u, 196u, 198u, 202u, 199u, 198u, 199u, 196u, 195u, 196u, 195u, 191u, 185u, 178u, 171u, 163u, 157u, 152u, 147u, 143u, 139u, 135u, 130u, 125u, 122u, 120u, 117u, 114u, 110u, 108u, 107u, 106u, 104u, 103u, 101u, 98u, 95u, 91u, 87u, 83u, 78u, 75u, 70u, 65u, 60u, 56u, 52u, 48u, 47u, 45u, 44u, 43u, 43u, 45u, 47u, 50u, 55u, 60u, 66u, 75u, 84u, 93u, 102u, 111u, 121u, 129u, 136u, 140u, 143u, 145u, 147u, 151u, 153u, 150u, 150u, 146u, 142u, 141u, 139u, 133u, 132u, 136u, 139u, 137u, 137u, 142u, 150u, 153u, 143u, 138u, 133u, 131u, 132u, 128u, 119u, 105u, 107u, 119u, 134u, 146u, 150u, 165u, 181u, 196u, 199u, 193u, 193u, 194u, 189u, 184u, 179u, 178u, 178u, 179u, 175u, 172u, 170u, 170u, 167u, 166u, 168u, 169u, 165u, 157u, 150u, 145u, 139u, 133u, 131u, 130u, 125u, 119u, 116u, 113u, 106u, 100u, 101u, 100u, 100u, 98u, 94u, 91u, 89u, 87u, 85u, 74u, 75u, 81u, 84u, 82u, 76u, 73u, 71u, 66u, 58u, 56u, 51u, 41u, 34u, 29u, 26u, 29u, 30u, 31u, 31u, 37u, 42u, 45u, 44u, 42u, 45u, 45u, 43u, 40u, 34u, 33u, 35u, 34u, 31u, 28u, 26u, 25u, 25u, 24u, 19u, 17u, 15u, 14u, 15u, 14u }, 
-	{ 153u, 160u, 164u, 180u, 199u, 207u, 214u, 218u, 227u, 221u, 212u, 204u, 180u, 166u, 165u, 170u, 165u, 154u, 152u, 144u, 132u, 134u, 130u, 136u, 151u, 184u, 196u, 198u, 189u, 184u, 173u, 160u, 143u, 127u, 117u, 108u, 92u, 90u, 96u, 102u, 102u, 108u, 100u, 104u, 105u, 103u, 95u, 94u, 86u, 82u, 74u, 71u, 71u, 85u, 92u, 107u, 114u, 114u, 115u, 121u, 127u, 140u, 148u, 160u, 163u, 171u, 181u, 186u, 188u, 187u, 190u, 191u, 193u, 192u, 192u, 192u, 193u, 191u, 186u, 181u, 175u, 167u, 161u, 157u, 152u, 147u, 143u, 139u, 134u, 130u, 127u, 125u, 122u, 118u, 113u, 111u, 109u, 107u, 106u, 106u, 104u, 99u, 96u, 91u, 86u, 83u, 78u, 75u, 71u, 67u, 62u, 57u, 52u, 48u, 46u, 45u, 43u, 43u, 43u, 44u, 46u, 49u, 53u, 59u, 65u, 73u, 82u, 92u, 101u, 111u, 120u, 129u, 136u, 141u, 143u, 146u, 149u, 152u, 150u, 145u, 145u, 142u, 144u, 142u, 142u, 142u, 140u, 138u, 136u, 131u, 133u, 140u, 146u, 151u, 141u, 133u, 136u, 132u, 125u, 122u, 110u, 104u, 107u, 115u, 121u, 136u, 145u, 158u, 173u, 186u, 187u, 193u, 193u, 192u, 183u, 176u, 167u, 168u, 170u, 172u, 170u, 168u, 168u, 168u, 167u, 167u, 167u, 165u, 159u, 151u, 148u, 144u, 138u, 133u, 130u, 128u, 123u, 117u, 113u, 109u, 103u, 96u, 93u, 93u, 93u, 90u, 87u, 84u, 82u, 81u, 78u, 73u, 73u, 75u, 81u, 77u, 75u, 72u, 70u, 65u, 60u, 58u, 50u, 42u, 34u, 30u, 28u, 30u, 30u, 31u, 32u, 36u, 40u, 44u, 44u, 40u, 38u, 38u, 38u, 36u, 32u, 31u, 33u, 33u, 29u, 26u, 23u, 24u, 24u, 22u, 18u, 17u, 18u, 19u, 18u, 16u }, 
-	{ 153u, 157u, 155u, 178u, 201u, 209u, 215u, 226u, 225u, 220u, 217u, 214u, 194u, 180u, 172u, 172u, 163u, 149u, 145u, 139u, 132u, 131u, 129u, 128u, 144u, 173u, 194u, 198u, 188u, 175u, 169u, 160u, 144u, 127u, 112u, 105u, 91u, 87u, 90u, 99u, 102u, 104u, 96u, 96u, 102u, 95u, 86u, 82u, 83u, 85u, 80u, 69u, 69u, 79u, 86u, 100u, 112u, 109u, 106u, 116u, 127u, 130u, 139u, 152u, 155u, 161u, 166u, 173u, 176u, 176u, 178u, 182u, 184u, 183u, 185u, 185u, 187u, 186u, 184u, 180u, 176u, 169u, 165u, 161u, 155u, 151u, 146u, 142u, 138u, 133u, 130u, 128u, 124u, 121u, 116u, 114u, 111u, 109u, 108u, 107u, 105u, 99u, 95u, 91u, 86u, 82u, 78u, 74u, 71u, 67u, 64u, 58u, 52u, 48u, 46u, 44u, 43u, 42u, 42u, 43u, 45u, 48u, 52u, 57u, 64u, 72u, 81u, 90u, 100u, 110u, 119u, 128u, 135u, 141u, 145u, 147u, 150u, 153u, 151u, 148u, 145u, 143u, 147u, 147u, 150u, 151u, 148u, 139u, 137u, 134u, 139u, 147u, 147u, 148u, 145u, 137u, 132u, 130u, 125u, 120u, 109u, 107u, 104u, 103u, 103u, 121u, 138u, 148u, 155u, 161u, 174u, 187u, 188u, 182u, 173u, 169u, 161u, 161u, 163u, 165u, 166u, 166u, 166u, 166u, 166u, 167u, 165u, 163u, 155u, 149u, 147u, 144u, 139u, 136u, 129u, 123u, 118u, 114u, 110u, 104u, 97u, 92u, 88u, 86u, 85u, 85u, 80u, 74u, 73u, 72u, 67u, 70u, 70u, 71u, 73u, 75u, 72u, 67u, 62u, 59u, 56u, 57u, 49u, 43u, 34u, 29u, 29u, 29u, 30u, 32u, 35u, 36u, 38u, 41u, 41u, 38u, 36u, 34u, 34u, 31u, 31u, 31u, 32u, 31u, 28u, 25u, 22u, 24u, 24u, 23u, 20u, 19u, 21u, 23u, 23u, 21u }, 
-	{ 150u, 147u, 148u, 173u, 194u, 209u, 218u, 220u, 215u, 214u, 211u, 212u, 194u, 181u, 170u, 171u, 154u, 140u, 146u, 149u, 144u, 139u, 130u, 123u, 145u, 167u, 179u, 181u, 174u, 166u, 167u, 163u, 151u, 133u, 113u, 105u, 91u, 84u, 87u, 96u, 96u, 94u, 88u, 93u, 104u, 100u, 93u, 83u, 82u, 82u, 79u, 68u, 64u, 71u, 81u, 89u, 100u, 99u, 103u, 117u, 125u, 124u, 136u, 140u, 140u, 149u, 157u, 164u, 161u, 160u, 163u, 169u, 177u, 179u, 180u, 181u, 182u, 182u, 180u, 175u, 173u, 169u, 167u, 166u, 160u, 154u, 149u, 145u, 141u, 136u, 133u, 130u, 126u, 122u, 118u, 115u, 112u, 110u, 109u, 108u, 104u, 98u, 94u, 90u, 85u, 82u, 78u, 74u, 70u, 66u, 62u, 58u, 53u, 48u, 45u, 43u, 42u, 41u, 41u, 42u, 43u, 46u, 51u, 56u, 63u, 70u, 79u, 88u, 98u, 109u, 118u, 127u, 135u, 142u, 147u, 149u, 151u, 153u, 152u, 152u, 150u, 149u, 151u, 147u, 149u, 152u, 152u, 144u, 144u, 145u, 149u, 154u, 159u, 155u, 149u, 134u, 125u, 128u, 122u, 123u, 119u, 117u, 110u, 107u, 102u, 115u, 122u, 127u, 133u, 140u, 156u, 163u, 169u, 165u, 157u, 158u, 154u, 151u, 154u, 158u, 159u, 163u, 165u, 165u, 165u, 165u, 161u, 157u, 151u, 146u, 145u, 141u, 137u, 133u, 127u, 121u, 116u, 109u, 103u, 98u, 90u, 85u, 82u, 81u, 78u, 74u, 68u, 62u, 60u, 60u, 60u, 65u, 68u, 70u, 71u, 75u, 69u, 64u, 58u, 53u, 48u, 48u, 44u, 38u, 31u, 25u, 26u, 28u, 28u, 31u, 35u, 36u, 37u, 39u, 38u, 36u, 33u, 31u, 30u, 28u, 30u, 29u, 28u, 28u, 26u, 24u, 23u, 25u, 26u, 25u, 22u, 19u, 20u, 25u, 27u, 24u }, 
-	{ 144u, 147u, 151u, 161u, 184u, 208u, 217u, 215u, 209u, 200u, 196u, 202u, 196u, 189u, 179u, 172u, 147u, 138u, 139u, 156u, 150u, 146u, 130u, 120u, 130u, 152u, 161u, 166u, 171u, 163u, 162u, 157u, 150u, 133u, 112u, 100u, 90u, 83u, 85u, 89u, 92u, 86u, 88u, 91u, 95u, 96u, 95u, 85u, 84u, 83u, 79u, 66u, 58u, 64u, 70u, 79u, 88u, 99u, 107u, 115u, 120u, 118u, 128u, 129u, 126u, 130u, 141u, 148u, 150u, 147u, 152u, 159u, 169u, 172u, 174u, 174u, 176u, 177u, 175u, 174u, 172u, 173u, 172u, 169u, 163u, 157u, 151u, 147u, 143u, 138u, 134u, 131u, 128u, 122u, 117u, 113u, 111u, 109u, 110u, 106u, 100u, 95u, 91u, 88u, 84u, 81u, 77u, 72u, 68u, 63u, 60u, 56u, 52u, 48u, 45u, 43u, 41u, 40u, 40u, 40u, 42u, 45u, 49u, 54u, 61u, 68u, 76u, 85u, 96u, 106u, 116u, 125u, 134u, 142u, 148u, 152u, 153u, 155u, 156u, 158u, 157u, 157u, 154u, 151u, 150u, 155u, 153u, 152u, 154u, 157u, 159u, 163u, 165u, 157u, 146u, 133u, 124u, 124u, 129u, 129u, 127u, 124u, 120u, 114u, 110u, 110u, 108u, 110u, 115u, 126u, 141u, 145u, 153u, 149u, 147u, 151u, 154u, 152u, 153u, 155u, 156u, 161u, 163u, 163u, 162u, 162u, 158u, 154u, 149u, 146u, 142u, 139u, 136u, 129u, 123u, 117u, 113u, 105u, 98u, 91u, 85u, 78u, 76u, 74u, 73u, 68u, 61u, 57u, 55u, 57u, 56u, 62u, 71u, 73u, 75u, 70u, 65u, 60u, 56u, 52u, 46u, 45u, 40u, 33u, 28u, 25u, 26u, 27u, 28u, 30u, 32u, 34u, 34u, 34u, 33u, 32u, 31u, 29u, 28u, 29u, 30u, 29u, 28u, 25u, 24u, 24u, 23u, 24u, 23u, 23u, 23u, 22u, 23u, 24u, 29u, 27u }, 
-	{ 141u, 148u, 156u, 165u, 185u, 205u, 213u, 213u, 208u, 196u, 187u, 189u, 195u, 188u, 181u, 169u, 157u, 146u, 142u, 155u, 154u, 147u, 135u, 121u, 125u, 134u, 145u, 163u, 173u, 168u, 161u, 155u, 145u, 129u, 112u, 98u, 88u, 79u, 75u, 83u, 86u, 81u, 82u, 87u, 88u, 89u, 92u, 89u, 84u, 81u, 78u, 65u, 55u, 60u, 63u, 68u, 83u, 96u, 99u, 100u, 105u, 108u, 116u, 120u, 123u, 122u, 126u, 132u, 137u, 136u, 139u, 153u, 165u, 170u, 170u, 168u, 167u, 167u, 169u, 173u, 172u, 175u, 174u, 169u, 164u, 158u, 152u, 148u, 144u, 139u, 135u, 132u, 128u, 122u, 118u, 113u, 110u, 109u, 107u, 103u, 97u, 93u, 89u, 86u, 83u, 79u, 75u, 70u, 66u, 63u, 58u, 53u, 51u, 48u, 45u, 42u, 40u, 39u, 38u, 38u, 40u, 43u, 47u, 52u, 59u, 66u, 74u, 83u, 93u, 103u, 114u, 123u, 133u, 140u, 148u, 154u, 156u, 157u, 157u, 160u, 160u, 158u, 156u, 155u, 153u, 154u, 150u, 154u, 158u, 161u, 161u, 164u, 161u, 153u, 147u, 141u, 137u, 138u, 138u, 139u, 133u, 129u, 128u, 121u, 117u, 115u, 103u, 102u, 110u, 122u, 134u, 137u, 138u, 136u, 136u, 143u, 150u, 153u, 152u, 152u, 156u, 159u, 160u, 160u, 160u, 160u, 158u, 152u, 147u, 143u, 137u, 132u, 131u, 123u, 118u, 114u, 109u, 101u, 90u, 83u, 79u, 73u, 72u, 71u, 69u, 61u, 56u, 54u, 54u, 54u, 56u, 63u, 70u, 71u, 72u, 68u, 63u, 59u, 53u, 50u, 46u, 42u, 35u, 31u, 28u, 25u, 23u, 24u, 25u, 27u, 28u, 31u, 32u, 30u, 30u, 30u, 30u, 28u, 27u, 28u, 31u, 31u, 29u, 25u, 23u, 22u, 22u, 22u, 21u, 20u, 21u, 23u, 26u, 25u, 28u, 27u }, 
-	{ 138u, 147u, 155u, 165u, 181u, 197u, 204u, 202u, 199u, 188u, 173u, 164u, 178u, 180u, 186u, 182u, 178u, 166u, 157u, 156u, 150u, 151u, 142u, 131u, 135u, 137u, 150u, 160u, 167u, 164u, 154u, 146u, 140u, 129u, 118u, 106u, 92u, 77u, 65u, 75u, 77u, 81u, 81u, 88u, 92u, 88u, 85u, 87u, 83u, 77u, 81u, 73u, 62u, 62u, 57u, 56u, 71u, 87u, 92u, 93u, 97u, 101u, 104u, 109u, 118u, 116u, 119u, 123u, 129u, 132u, 135u, 148u, 161u, 166u, 167u, 165u, 162u, 161u, 164u, 170u, 173u, 175u, 172u, 168u, 163u, 157u, 152u, 147u, 143u, 138u, 135u, 131u, 127u, 122u, 117u, 112u, 109u, 107u, 104u, 99u, 94u, 91u, 87u, 84u, 82u, 77u, 73u, 68u, 63u, 59u, 55u, 51u, 49u, 46u, 43u, 40u, 38u, 36u, 36u, 36u, 38u, 41u, 45u, 50u, 56u, 63u, 71u, 80u, 90u, 100u, 110u, 120u, 130u, 138u, 146u, 152u, 155u, 157u, 161u, 163u, 161u, 159u, 155u, 154u, 153u, 151u, 144u, 145u, 149u, 157u, 159u, 161u, 158u, 153u, 154u, 152u, 148u, 146u, 144u, 144u, 134u, 131u, 136u, 135u, 126u, 119u, 108u, 102u, 108u, 119u, 129u, 125u, 124u, 122u, 125u, 134u, 140u, 143u, 145u, 148u, 152u, 157u, 161u, 159u, 158u, 156u, 155u, 149u, 145u, 139u, 134u, 131u, 129u, 120u, 113u, 109u, 101u, 92u, 79u, 74u, 72u, 68u, 68u, 67u, 64u, 57u, 54u, 51u, 53u, 51u, 54u, 64u, 72u, 74u, 69u, 63u, 56u, 53u, 49u, 43u, 39u, 33u, 29u, 29u, 25u, 23u, 21u, 20u, 20u, 21u, 23u, 25u, 26u, 26u, 26u, 27u, 29u, 29u, 28u, 28u, 31u, 31u, 29u, 26u, 25u, 24u, 24u, 22u, 23u, 21u, 22u, 25u, 25u, 25u, 30u, 30u }, 
-	{ 129u, 141u, 155u, 161u, 174u, 190u, 191u, 192u, 183u, 174u, 162u, 156u, 168u, 177u, 185u, 175u, 173u, 176u, 169u, 159u, 154u, 151u, 129u, 127u, 132u, 131u, 141u, 143u, 148u, 142u, 137u, 129u, 133u, 127u, 123u, 108u, 89u, 82u, 75u, 71u, 80u, 84u, 84u, 87u, 97u, 89u, 85u, 83u, 82u, 79u, 78u, 78u, 74u, 69u, 63u, 56u, 67u, 81u, 88u, 85u, 87u, 92u, 101u, 105u, 111u, 117u, 122u, 124u, 126u, 131u, 136u, 148u, 154u, 160u, 159u, 156u, 157u, 156u, 156u, 163u, 169u, 171u, 170u, 166u, 161u, 156u, 151u, 146u, 141u, 137u, 134u, 130u, 126u, 120u, 115u, 110u, 106u, 104u, 100u, 95u, 91u, 87u, 84u, 81u, 78u, 74u, 70u, 66u, 61u, 56u, 52u, 51u, 47u, 43u, 40u, 38u, 36u, 34u, 34u, 35u, 37u, 39u, 43u, 47u, 53u, 60u, 68u, 76u, 86u, 96u, 106u, 117u, 126u, 135u, 144u, 151u, 154u, 157u, 160u, 163u, 161u, 158u, 155u, 153u, 152u, 149u, 141u, 139u, 142u, 151u, 157u, 156u, 152u, 150u, 154u, 157u, 153u, 154u, 156u, 152u, 138u, 129u, 139u, 143u, 135u, 125u, 107u, 102u, 102u, 108u, 113u, 116u, 115u, 113u, 119u, 128u, 134u, 137u, 140u, 140u, 144u, 153u, 154u, 155u, 154u, 155u, 153u, 152u, 145u, 138u, 133u, 130u, 126u, 118u, 111u, 103u, 93u, 84u, 75u, 70u, 65u, 65u, 65u, 69u, 63u, 55u, 55u, 52u, 50u, 47u, 50u, 57u, 67u, 71u, 67u, 63u, 56u, 47u, 45u, 39u, 34u, 29u, 28u, 25u, 22u, 20u, 19u, 18u, 17u, 19u, 21u, 22u, 22u, 22u, 22u, 23u, 26u, 31u, 30u, 29u, 33u, 33u, 30u, 27u, 27u, 26u, 26u, 26u, 24u, 24u, 24u, 26u, 26u, 27u, 33u, 33u }, 
-	{ 120u, 135u, 150u, 160u, 175u, 185u, 186u, 190u, 179u, 171u, 163u, 163u, 162u, 169u, 172u, 167u, 171u, 183u, 172u, 164u, 163u, 153u, 129u, 117u, 112u, 111u, 115u, 119u, 120u, 115u, 115u, 108u, 114u, 121u, 120u, 106u, 89u, 85u, 89u, 85u, 87u, 84u, 82u, 86u, 102u, 98u, 91u, 89u, 85u, 81u, 76u, 77u, 80u, 76u, 69u, 64u, 71u, 77u, 84u, 78u, 79u, 88u, 100u, 103u, 103u, 107u, 116u, 120u, 123u, 131u, 140u, 146u, 150u, 153u, 149u, 147u, 153u, 153u, 152u, 157u, 164u, 165u, 165u, 163u, 159u, 155u, 150u, 144u, 139u, 135u, 130u, 127u, 122u, 117u, 112u, 107u, 102u, 98u, 94u, 91u, 87u, 83u, 80u, 77u, 74u, 70u, 66u, 62u, 59u, 54u, 51u, 49u, 46u, 42u, 39u, 36u, 35u, 33u, 33u, 34u, 35u, 38u, 41u, 45u, 50u, 57u, 64u, 73u, 83u, 92u, 103u, 115u, 124u, 132u, 141u, 148u, 153u, 157u, 160u, 162u, 161u, 157u, 152u, 150u, 146u, 145u, 142u, 138u, 138u, 143u, 154u, 156u, 153u, 151u, 154u, 159u, 159u, 157u, 159u, 152u, 137u, 127u, 132u, 137u, 132u, 122u, 111u, 106u, 101u, 106u, 109u, 110u, 110u, 108u, 114u, 124u, 133u, 137u, 139u, 137u, 138u, 144u, 146u, 145u, 146u, 149u, 148u, 149u, 145u, 140u, 135u, 130u, 125u, 117u, 106u, 97u, 87u, 78u, 70u, 66u, 61u, 60u, 63u, 67u, 62u, 55u, 55u, 53u, 48u, 45u, 44u, 46u, 54u, 61u, 58u, 55u, 53u, 47u, 44u, 39u, 33u, 28u, 24u, 21u, 19u, 17u, 17u, 17u, 16u, 17u, 19u, 18u, 17u, 18u, 19u, 20u, 23u, 28u, 30u, 32u, 37u, 37u, 32u, 29u, 28u, 26u, 25u, 25u, 25u, 26u, 28u, 33u, 37u, 39u, 41u, 46u }, 
-	{ 109u, 122u, 142u, 158u, 170u, 175u, 178u, 178u, 174u, 168u, 162u, 170u, 165u, 165u, 157u, 160u, 165u, 179u, 171u, 159u, 156u, 151u, 135u, 120u, 110u, 110u, 107u, 105u, 102u, 108u, 113u, 108u, 112u, 120u, 107u, 97u, 94u, 100u, 95u, 94u, 90u, 88u, 92u, 94u, 100u, 101u, 103u, 103u, 89u, 83u, 78u, 79u, 77u, 72u, 71u, 69u, 70u, 75u, 82u, 78u, 77u, 87u, 94u, 97u, 96u, 104u, 112u, 118u, 126u, 133u, 140u, 140u, 147u, 148u, 143u, 142u, 144u, 148u, 150u, 157u, 163u, 163u, 163u, 160u, 156u, 152u, 147u, 141u, 137u, 132u, 127u, 123u, 119u, 114u, 108u, 102u, 97u, 93u, 89u, 86u, 82u, 79u, 75u, 72u, 69u, 66u, 62u, 59u, 56u, 52u, 50u, 48u, 44u, 40u, 38u, 35u, 34u, 32u, 32u, 33u, 34u, 36u, 39u, 42u, 47u, 53u, 60u, 68u, 79u, 89u, 101u, 113u, 122u, 129u, 137u, 143u, 149u, 153u, 157u, 158u, 159u, 157u, 150u, 145u, 140u, 139u, 136u, 133u, 135u, 139u, 149u, 152u, 153u, 154u, 152u, 154u, 160u, 165u, 168u, 158u, 145u, 135u, 126u, 130u, 126u, 115u, 107u, 109u, 108u, 107u, 105u, 102u, 105u, 106u, 113u, 123u, 131u, 134u, 133u, 129u, 128u, 129u, 132u, 133u, 138u, 144u, 142u, 140u, 138u, 134u, 131u, 128u, 124u, 115u, 103u, 94u, 85u, 74u, 63u, 58u, 57u, 57u, 58u, 61u, 60u, 57u, 54u, 49u, 43u, 43u, 42u, 43u, 49u, 51u, 52u, 52u, 48u, 44u, 40u, 37u, 31u, 26u, 21u, 19u, 17u, 16u, 16u, 16u, 14u, 14u, 14u, 14u, 14u, 15u, 18u, 20u, 22u, 26u, 29u, 33u, 37u, 37u, 31u, 29u, 27u, 28u, 28u, 27u, 27u, 27u, 30u, 38u, 46u, 54u, 54u, 56u }, 
-	{ 111u, 117u, 134u, 152u, 165u, 167u, 170u, 170u, 170u, 166u, 158u, 160u, 158u, 159u, 153u, 152u, 160u, 161u, 167u, 162u, 164u, 156u, 148u, 131u, 121u, 121u, 115u, 105u, 98u, 102u, 110u, 116u, 120u, 122u, 111u, 106u, 107u, 115u, 103u, 101u, 99u, 98u, 99u, 106u, 101u, 107u, 112u, 107u, 97u, 88u, 89u, 84u, 78u, 77u, 81u, 77u, 77u, 74u, 71u, 71u, 73u, 79u, 81u, 88u, 93u, 104u, 119u, 123u, 133u, 143u, 139u, 135u, 139u, 147u, 143u, 140u, 139u, 145u, 152u, 158u, 163u, 163u, 162u, 159u, 153u, 148u, 143u, 138u, 133u, 128u, 123u, 118u, 114u, 108u, 102u, 97u, 91u, 87u, 83u, 80u, 77u, 73u, 70u, 67u, 64u, 61u, 58u, 55u, 52u, 49u, 48u, 46u, 42u, 39u, 37u, 34u, 32u, 31u, 31u, 32u, 33u, 34u, 37u, 40u, 45u, 51u, 57u, 65u, 74u, 86u, 97u, 107u, 117u, 123u, 130u, 136u, 143u, 149u, 152u, 153u, 155u, 153u, 146u, 139u, 135u, 131u, 130u, 129u, 131u, 132u, 140u, 141u, 148u, 154u, 151u, 149u, 157u, 163u, 167u, 158u, 150u, 140u, 124u, 127u, 131u, 115u, 109u, 111u, 100u, 95u, 97u, 88u, 92u, 105u, 108u, 118u, 124u, 127u, 122u, 114u, 111u, 112u, 119u, 126u, 132u, 139u, 139u, 135u, 131u, 127u, 123u, 121u, 120u, 113u, 103u, 93u, 83u, 68u, 58u, 54u, 57u, 54u, 54u, 59u, 58u, 57u, 53u, 47u, 43u, 41u, 42u, 44u, 45u, 44u, 47u, 50u, 46u, 39u, 34u, 32u, 28u, 21u, 17u, 15u, 17u, 17u, 16u, 15u, 15u, 14u, 12u, 13u, 13u, 15u, 17u, 20u, 22u, 25u, 29u, 34u, 36u, 38u, 34u, 29u, 29u, 30u, 32u, 30u, 29u, 30u, 36u, 43u, 54u, 63u, 65u, 60u }, 
-	{ 117u, 125u, 137u, 152u, 161u, 163u, 168u, 173u, 168u, 157u, 146u, 146u, 145u, 145u, 145u, 147u, 150u, 146u, 165u, 173u, 179u, 170u, 164u, 151u, 139u, 132u, 126u, 125u, 112u, 96u, 102u, 114u, 123u, 125u, 120u, 116u, 118u, 116u, 105u, 100u, 94u, 104u, 110u, 112u, 103u, 108u, 119u, 118u, 114u, 104u, 99u, 91u, 89u, 91u, 91u, 85u, 79u, 76u, 66u, 61u, 57u, 63u, 71u, 77u, 91u, 107u, 125u, 130u, 137u, 145u, 141u, 136u, 134u, 141u, 144u, 139u, 138u, 143u, 153u, 158u, 157u, 159u, 160u, 156u, 151u, 146u, 139u, 133u, 129u, 124u, 119u, 114u, 109u, 102u, 96u, 91u, 85u, 81u, 77u, 73u, 70u, 67u, 64u, 61u, 59u, 57u, 54u, 52u, 49u, 45u, 44u, 43u, 39u, 37u, 35u, 33u, 31u, 30u, 30u, 31u, 31u, 32u, 35u, 39u, 44u, 51u, 55u, 61u, 70u, 82u, 93u, 101u, 111u, 117u, 124u, 129u, 136u, 143u, 147u, 148u, 151u, 146u, 139u, 133u, 128u, 125u, 122u, 123u, 121u, 118u, 123u, 127u, 138u, 149u, 148u, 144u, 152u, 158u, 156u, 145u, 136u, 135u, 131u, 132u, 139u, 125u, 120u, 113u, 97u, 86u, 86u, 82u, 84u, 100u, 109u, 113u, 116u, 120u, 112u, 103u, 94u, 96u, 105u, 117u, 126u, 135u, 135u, 129u, 124u, 122u, 121u, 119u, 117u, 112u, 101u, 92u, 82u, 66u, 54u, 50u, 53u, 52u, 53u, 57u, 53u, 51u, 48u, 47u, 41u, 37u, 41u, 42u, 41u, 41u, 41u, 41u, 39u, 34u, 29u, 25u, 21u, 16u, 14u, 14u, 15u, 18u, 17u, 16u, 16u, 14u, 13u, 14u, 14u, 14u, 16u, 20u, 21u, 25u, 30u, 36u, 38u, 40u, 37u, 31u, 29u, 32u, 36u, 34u, 33u, 35u, 46u, 54u, 57u, 61u, 59u, 56u }, 
-	{ 123u, 130u, 141u, 152u, 163u, 169u, 176u, 176u, 177u, 166u, 152u, 148u, 136u, 135u, 143u, 145u, 146u, 136u, 152u, 175u, 187u, 188u, 173u, 160u, 150u, 142u, 148u, 138u, 120u, 108u, 112u, 127u, 132u, 132u, 133u, 140u, 140u, 122u, 104u, 92u, 94u, 98u, 108u, 117u, 113u, 121u, 124u, 121u, 119u, 111u, 100u, 99u, 94u, 101u, 100u, 91u, 75u, 67u, 55u, 51u, 49u, 47u, 56u, 69u, 87u, 102u, 117u, 131u, 139u, 143u, 141u, 130u, 128u, 136u, 137u, 130u, 135u, 142u, 151u, 151u, 153u, 158u, 160u, 155u, 150u, 143u, 134u, 128u, 124u, 118u, 114u, 108u, 102u, 96u, 90u, 84u, 78u, 74u, 70u, 67u, 64u, 61u, 59u, 56u, 54u, 52u, 50u, 48u, 45u, 43u, 41u, 40u, 37u, 35u, 33u, 32u, 30u, 30u, 30u, 30u, 30u, 31u, 34u, 38u, 42u, 50u, 55u, 61u, 70u, 78u, 87u, 93u, 102u, 110u, 117u, 124u, 131u, 138u, 141u, 143u, 143u, 140u, 133u, 123u, 117u, 120u, 120u, 120u, 114u, 108u, 104u, 110u, 121u, 136u, 133u, 132u, 141u, 147u, 144u, 139u, 129u, 123u, 128u, 130u, 135u, 129u, 124u, 101u, 90u, 83u, 78u, 77u, 83u, 99u, 106u, 106u, 114u, 111u, 99u, 92u, 84u, 87u, 98u, 111u, 118u, 127u, 130u, 124u, 119u, 113u, 116u, 116u, 110u, 104u, 96u, 88u, 77u, 68u, 56u, 50u, 50u, 50u, 51u, 50u, 50u, 50u, 48u, 45u, 43u, 38u, 42u, 43u, 43u, 40u, 39u, 36u, 33u, 31u, 25u, 19u, 14u, 12u, 12u, 14u, 15u, 16u, 15u, 15u, 14u, 13u, 13u, 13u, 14u, 14u, 16u, 20u, 22u, 26u, 29u, 34u, 36u, 39u, 38u, 32u, 31u, 33u, 38u, 39u, 38u, 47u, 56u, 64u, 61u, 63u, 56u, 53u }, 
-	{ 124u, 134u, 145u, 152u, 161u, 175u, 177u, 181u, 184u, 171u, 158u, 152u, 134u, 130u, 131u, 144u, 148u, 145u, 151u, 169u, 181u, 193u, 186u, 168u, 165u, 164u, 164u, 143u, 129u, 123u, 128u, 137u, 145u, 144u, 142u, 157u, 156u, 144u, 120u, 105u, 96u, 93u, 101u, 109u, 119u, 125u, 122u, 123u, 123u, 110u, 105u, 106u, 103u, 104u, 101u, 91u, 72u, 66u, 57u, 49u, 47u, 41u, 48u, 65u, 78u, 93u, 103u, 120u, 132u, 134u, 133u, 124u, 118u, 123u, 131u, 134u, 138u, 141u, 148u, 148u, 154u, 160u, 161u, 157u, 149u, 139u, 129u, 122u, 118u, 113u, 107u, 101u, 95u, 89u, 83u, 77u, 72u, 67u, 63u, 60u, 58u, 55u, 53u, 51u, 49u, 47u, 46u, 45u, 43u, 41u, 39u, 37u, 35u, 34u, 32u, 30u, 30u, 29u, 29u, 30u, 30u, 31u, 33u, 37u, 41u, 48u, 54u, 59u, 66u, 75u, 83u, 90u, 98u, 104u, 112u, 118u, 125u, 133u, 135u, 134u, 135u, 134u, 126u, 119u, 115u, 114u, 114u, 113u, 112u, 104u, 95u, 98u, 110u, 125u, 123u, 125u, 131u, 132u, 133u, 135u, 130u, 124u, 123u, 127u, 122u, 126u, 124u, 106u, 93u, 84u, 72u, 73u, 81u, 99u, 103u, 105u, 113u, 110u, 95u, 87u, 82u, 84u, 95u, 103u, 110u, 114u, 118u, 112u, 109u, 109u, 110u, 109u, 105u, 96u, 89u, 82u, 73u, 65u, 57u, 52u, 48u, 50u, 51u, 46u, 48u, 48u, 49u, 48u, 46u, 46u, 47u, 50u, 46u, 40u, 38u, 37u, 34u, 27u, 19u, 14u, 10u, 9u, 10u, 11u, 11u, 13u, 13u, 12u, 12u, 12u, 11u, 12u, 13u, 15u, 18u, 23u, 26u, 27u, 31u, 33u, 37u, 38u, 35u, 33u, 33u, 37u, 43u, 45u, 48u, 56u, 64u, 66u, 70u, 66u, 61u, 58u }, 
-	{ 126u, 132u, 147u, 155u, 166u, 177u, 179u, 178u, 175u, 166u, 166u, 165u, 150u, 140u, 134u, 140u, 143u, 142u, 144u, 166u, 181u, 184u, 185u, 176u, 178u, 176u, 172u, 154u, 142u, 134u, 139u, 142u, 146u, 152u, 158u, 161u, 161u, 155u, 140u, 124u, 111u, 98u, 96u, 101u, 112u, 117u, 126u, 125u, 118u, 111u, 110u, 111u, 108u, 104u, 100u, 93u, 77u, 68u, 63u, 56u, 47u, 41u, 49u, 62u, 73u, 87u, 99u, 113u, 119u, 118u, 120u, 115u, 113u, 118u, 120u, 129u, 139u, 148u, 153u, 149u, 152u, 158u, 158u, 154u, 145u, 135u, 124u, 117u, 111u, 106u, 100u, 95u, 88u, 82u, 76u, 70u, 65u, 61u, 57u, 54u, 52u, 49u, 47u, 46u, 44u, 44u, 43u, 42u, 41u, 39u, 38u, 35u, 33u, 31u, 31u, 30u, 29u, 29u, 29u, 30u, 30u, 32u, 34u, 37u, 41u, 46u, 52u, 58u, 64u, 74u, 83u, 91u, 94u, 101u, 110u, 118u, 122u, 127u, 127u, 125u, 127u, 124u, 116u, 113u, 115u, 112u, 108u, 106u, 110u, 108u, 102u, 103u, 103u, 116u, 120u, 126u, 128u, 134u, 128u, 136u, 146u, 139u, 130u, 133u, 126u, 131u, 125u, 110u, 96u, 91u, 78u, 78u, 81u, 97u, 103u, 106u, 111u, 104u, 93u, 86u, 79u, 78u, 87u, 94u, 103u, 108u, 109u, 104u, 102u, 106u, 104u, 100u, 94u, 87u, 83u, 75u, 65u, 61u, 55u, 48u, 45u, 48u, 50u, 46u, 47u, 48u, 52u, 53u, 50u, 52u, 54u, 51u, 44u, 41u, 36u, 34u, 30u, 23u, 16u, 11u, 8u, 7u, 7u, 8u, 9u, 10u, 11u, 10u, 10u, 10u, 11u, 12u, 13u, 15u, 19u, 24u, 29u, 32u, 33u, 35u, 40u, 41u, 37u, 36u, 33u, 38u, 47u, 51u, 55u, 60u, 68u, 69u, 71u, 69u, 69u, 72u }, 
-	{ 129u, 136u, 149u, 159u, 161u, 166u, 175u, 179u, 168u, 170u, 176u, 169u, 158u, 142u, 137u, 135u, 141u, 139u, 146u, 167u, 175u, 184u, 184u, 184u, 184u, 182u, 177u, 165u, 153u, 157u, 159u, 152u, 155u, 155u, 162u, 162u, 168u, 162u, 154u, 134u, 116u, 103u, 96u, 104u, 116u, 120u, 124u, 125u, 115u, 102u, 101u, 106u, 111u, 103u, 97u, 90u, 80u, 74u, 68u, 61u, 53u, 47u, 48u, 55u, 65u, 80u, 91u, 98u, 109u, 109u, 117u, 117u, 114u, 108u, 114u, 126u, 144u, 153u, 154u, 153u, 154u, 157u, 152u, 149u, 140u, 130u, 120u, 112u, 106u, 100u, 94u, 88u, 81u, 75u, 69u, 63u, 58u, 55u, 51u, 49u, 46u, 44u, 43u, 41u, 41u, 40u, 40u, 40u, 39u, 38u, 37u, 35u, 32u, 30u, 28u, 29u, 29u, 29u, 30u, 30u, 31u, 32u, 34u, 36u, 40u, 45u, 51u, 57u, 64u, 74u, 85u, 90u, 97u, 106u, 115u, 120u, 124u, 127u, 125u, 122u, 124u, 118u, 113u, 110u, 108u, 107u, 105u, 105u, 113u, 112u, 113u, 114u, 114u, 117u, 129u, 141u, 137u, 139u, 138u, 146u, 150u, 151u, 140u, 139u, 137u, 137u, 135u, 122u, 111u, 99u, 98u, 92u, 89u, 98u, 97u, 103u, 101u, 98u, 90u, 80u, 75u, 72u, 78u, 89u, 99u, 102u, 101u, 100u, 97u, 99u, 99u, 92u, 80u, 77u, 74u, 62u, 56u, 53u, 49u, 44u, 43u, 44u, 47u, 48u, 50u, 49u, 53u, 56u, 53u, 52u, 50u, 46u, 40u, 37u, 32u, 31u, 26u, 21u, 15u, 10u, 8u, 5u, 4u, 6u, 7u, 7u, 9u, 9u, 8u, 9u, 10u, 11u, 13u, 16u, 20u, 24u, 29u, 33u, 33u, 36u, 43u, 44u, 42u, 41u, 38u, 39u, 44u, 52u, 60u, 68u, 69u, 74u, 73u, 73u, 76u, 84u }, 
-	{ 132u, 142u, 151u, 158u, 154u, 161u, 173u, 178u, 174u, 174u, 177u, 173u, 154u, 135u, 127u, 125u, 131u, 132u, 139u, 158u, 167u, 185u, 190u, 195u, 188u, 186u, 190u, 181u, 178u, 176u, 172u, 167u, 169u, 164u, 170u, 168u, 169u, 162u, 149u, 130u, 118u, 111u, 106u, 111u, 118u, 116u, 114u, 119u, 115u, 97u, 94u, 97u, 105u, 107u, 101u, 94u, 83u, 77u, 72u, 63u, 56u, 50u, 46u, 49u, 59u, 70u, 79u, 94u, 104u, 105u, 112u, 117u, 110u, 102u, 108u, 125u, 139u, 147u, 147u, 143u, 147u, 148u, 143u, 138u, 132u, 123u, 114u, 106u, 100u, 94u, 87u, 81u, 75u, 68u, 62u, 57u, 53u, 49u, 46u, 43u, 41u, 40u, 39u, 38u, 37u, 37u, 37u, 37u, 38u, 37u, 36u, 34u, 32u, 29u, 27u, 27u, 28u, 29u, 30u, 31u, 33u, 34u, 36u, 38u, 42u, 45u, 50u, 56u, 63u, 74u, 84u, 92u, 99u, 108u, 115u, 119u, 125u, 126u, 124u, 121u, 119u, 112u, 108u, 105u, 104u, 101u, 106u, 113u, 118u, 118u, 119u, 125u, 134u, 126u, 134u, 144u, 145u, 144u, 150u, 145u, 149u, 157u, 160u, 155u, 150u, 156u, 154u, 146u, 131u, 117u, 119u, 111u, 98u, 99u, 94u, 98u, 97u, 92u, 78u, 70u, 69u, 69u, 69u, 78u, 90u, 97u, 99u, 98u, 93u, 89u, 87u, 83u, 69u, 64u, 60u, 51u, 46u, 46u, 43u, 41u, 40u, 39u, 41u, 46u, 52u, 52u, 55u, 55u, 52u, 50u, 44u, 39u, 34u, 32u, 28u, 26u, 22u, 18u, 15u, 10u, 7u, 4u, 3u, 5u, 6u, 6u, 7u, 8u, 8u, 9u, 10u, 11u, 13u, 17u, 21u, 24u, 29u, 32u, 33u, 37u, 44u, 42u, 44u, 44u, 42u, 39u, 45u, 57u, 64u, 70u, 72u, 74u, 73u, 76u, 86u, 94u }, 
-	{ 130u, 141u, 151u, 158u, 153u, 153u, 158u, 163u, 170u, 172u, 168u, 168u, 156u, 139u, 131u, 133u, 139u, 138u, 138u, 151u, 160u, 173u, 180u, 187u, 196u, 198u, 197u, 190u, 192u, 183u, 176u, 174u, 181u, 179u, 181u, 171u, 167u, 157u, 150u, 135u, 124u, 115u, 112u, 120u, 116u, 105u, 103u, 108u, 110u, 103u, 99u, 95u, 95u, 102u, 100u, 99u, 89u, 85u, 81u, 73u, 65u, 57u, 51u, 48u, 55u, 63u, 70u, 86u, 97u, 103u, 110u, 108u, 99u, 94u, 105u, 124u, 135u, 133u, 135u, 137u, 135u, 133u, 129u, 125u, 123u, 115u, 109u, 101u, 94u, 88u, 81u, 75u, 69u, 62u, 56u, 51u, 47u, 43u, 40u, 38u, 36u, 36u, 35u, 35u, 34u, 33u, 33u, 34u, 35u, 35u, 34u, 33u, 32u, 29u, 27u, 26u, 28u, 29u, 31u, 33u, 34u, 36u, 37u, 38u, 41u, 45u, 51u, 57u, 63u, 73u, 81u, 89u, 95u, 106u, 111u, 115u, 120u, 123u, 122u, 120u, 116u, 105u, 99u, 95u, 99u, 103u, 117u, 128u, 130u, 125u, 129u, 140u, 146u, 141u, 143u, 145u, 152u, 158u, 162u, 151u, 150u, 154u, 162u, 158u, 156u, 166u, 159u, 157u, 144u, 133u, 136u, 121u, 102u, 94u, 87u, 88u, 84u, 77u, 69u, 68u, 65u, 67u, 69u, 76u, 84u, 88u, 93u, 91u, 86u, 83u, 79u, 66u, 56u, 51u, 45u, 41u, 40u, 41u, 39u, 38u, 40u, 39u, 40u, 42u, 48u, 48u, 51u, 55u, 54u, 51u, 44u, 37u, 30u, 26u, 24u, 23u, 21u, 17u, 14u, 10u, 7u, 5u, 3u, 4u, 4u, 5u, 6u, 6u, 8u, 8u, 9u, 11u, 14u, 17u, 22u, 28u, 35u, 39u, 40u, 40u, 43u, 43u, 43u, 41u, 42u, 44u, 52u, 60u, 64u, 68u, 69u, 73u, 86u, 92u, 107u, 118u }, 
-	{ 126u, 140u, 150u, 153u, 149u, 148u, 147u, 154u, 163u, 165u, 162u, 157u, 152u, 139u, 126u, 134u, 138u, 138u, 139u, 142u, 154u, 158u, 170u, 173u, 179u, 190u, 191u, 189u, 190u, 185u, 179u, 171u, 175u, 183u, 177u, 166u, 166u, 156u, 150u, 140u, 124u, 110u, 107u, 108u, 108u, 100u, 99u, 105u, 107u, 109u, 105u, 101u, 95u, 95u, 95u, 92u, 80u, 78u, 73u, 66u, 63u, 55u, 49u, 47u, 56u, 64u, 73u, 78u, 92u, 102u, 109u, 111u, 101u, 93u, 99u, 112u, 122u, 123u, 125u, 125u, 121u, 120u, 117u, 116u, 114u, 109u, 103u, 97u, 89u, 81u, 76u, 70u, 64u, 58u, 52u, 46u, 42u, 38u, 36u, 34u, 33u, 32u, 31u, 31u, 30u, 30u, 30u, 31u, 31u, 32u, 32u, 31u, 31u, 29u, 28u, 28u, 29u, 31u, 33u, 34u, 36u, 37u, 37u, 38u, 41u, 47u, 52u, 58u, 66u, 70u, 78u, 86u, 93u, 100u, 106u, 108u, 112u, 117u, 116u, 113u, 110u, 106u, 97u, 95u, 100u, 108u, 116u, 124u, 130u, 129u, 129u, 136u, 149u, 162u, 151u, 145u, 151u, 159u, 164u, 164u, 162u, 165u, 161u, 158u, 161u, 164u, 161u, 149u, 143u, 134u, 134u, 120u, 106u, 93u, 85u, 81u, 78u, 69u, 69u, 68u, 64u, 64u, 69u, 75u, 73u, 77u, 80u, 80u, 76u, 75u, 68u, 55u, 48u, 42u, 38u, 37u, 36u, 37u, 36u, 37u, 40u, 39u, 40u, 41u, 47u, 49u, 48u, 51u, 53u, 48u, 41u, 35u, 29u, 25u, 22u, 20u, 19u, 17u, 12u, 9u, 6u, 4u, 4u, 4u, 4u, 4u, 5u, 6u, 6u, 7u, 8u, 10u, 13u, 16u, 20u, 27u, 36u, 45u, 48u, 49u, 47u, 47u, 46u, 44u, 44u, 50u, 55u, 61u, 65u, 70u, 76u, 83u, 92u, 97u, 113u, 126u }, 
-	{ 125u, 136u, 144u, 141u, 141u, 140u, 141u, 151u, 154u, 157u, 157u, 152u, 143u, 132u, 122u, 128u, 123u, 121u, 135u, 149u, 156u, 152u, 159u, 157u, 153u, 170u, 175u, 177u, 183u, 179u, 173u, 165u, 160u, 164u, 165u, 162u, 158u, 149u, 146u, 136u, 117u, 97u, 90u, 93u, 96u, 97u, 92u, 97u, 109u, 116u, 114u, 108u, 95u, 92u, 91u, 80u, 65u, 61u, 59u, 57u, 53u, 46u, 41u, 42u, 50u, 63u, 72u, 79u, 86u, 97u, 109u, 112u, 99u, 92u, 96u, 103u, 115u, 121u, 118u, 111u, 104u, 104u, 104u, 107u, 107u, 102u, 96u, 91u, 84u, 76u, 70u, 65u, 59u, 54u, 48u, 42u, 39u, 35u, 33u, 32u, 30u, 29u, 28u, 27u, 27u, 27u, 28u, 28u, 28u, 29u, 29u, 29u, 30u, 30u, 30u, 31u, 32u, 33u, 35u, 36u, 37u, 37u, 38u, 39u, 44u, 50u, 57u, 63u, 67u, 71u, 77u, 84u, 89u, 91u, 94u, 99u, 107u, 110u, 108u, 106u, 109u, 111u, 102u, 97u, 99u, 102u, 106u, 109u, 121u, 130u, 129u, 129u, 148u, 160u, 153u, 138u, 141u, 149u, 160u, 171u, 174u, 167u, 161u, 164u, 164u, 162u, 164u, 151u, 142u, 134u, 127u, 109u, 105u, 91u, 83u, 77u, 69u, 65u, 68u, 70u, 67u, 64u, 67u, 66u, 64u, 65u, 67u, 67u, 67u, 68u, 62u, 52u, 45u, 38u, 36u, 37u, 36u, 38u, 39u, 38u, 38u, 38u, 37u, 40u, 47u, 51u, 49u, 49u, 50u, 45u, 39u, 35u, 30u, 26u, 23u, 21u, 19u, 16u, 12u, 9u, 5u, 4u, 3u, 3u, 4u, 4u, 4u, 5u, 5u, 6u, 7u, 9u, 11u, 13u, 18u, 26u, 36u, 44u, 48u, 50u, 50u, 52u, 53u, 51u, 48u, 54u, 64u, 69u, 73u, 78u, 85u, 90u, 96u, 101u, 109u, 121u }, 
-	{ 125u, 136u, 142u, 135u, 135u, 138u, 139u, 143u, 144u, 151u, 145u, 137u, 127u, 112u, 105u, 108u, 110u, 114u, 128u, 144u, 149u, 149u, 156u, 151u, 148u, 164u, 170u, 176u, 185u, 182u, 174u, 170u, 160u, 148u, 151u, 150u, 146u, 143u, 135u, 117u, 94u, 83u, 78u, 81u, 84u, 86u, 91u, 91u, 103u, 115u, 115u, 106u, 98u, 95u, 87u, 72u, 56u, 50u, 46u, 46u, 48u, 44u, 41u, 42u, 46u, 56u, 66u, 79u, 84u, 85u, 92u, 92u, 85u, 89u, 88u, 90u, 108u, 114u, 106u, 98u, 92u, 92u, 94u, 97u, 98u, 95u, 90u, 86u, 80u, 73u, 66u, 60u, 54u, 50u, 45u, 40u, 36u, 32u, 30u, 28u, 27u, 25u, 25u, 24u, 24u, 25u, 26u, 26u, 26u, 27u, 27u, 28u, 30u, 31u, 32u, 34u, 35u, 36u, 37u, 38u, 39u, 39u, 39u, 40u, 46u, 53u, 64u, 70u, 67u, 71u, 78u, 85u, 84u, 86u, 91u, 97u, 103u, 101u, 99u, 101u, 107u, 117u, 114u, 111u, 106u, 99u, 96u, 97u, 110u, 118u, 128u, 133u, 142u, 147u, 145u, 135u, 139u, 144u, 153u, 164u, 163u, 156u, 155u, 155u, 164u, 171u, 169u, 153u, 138u, 122u, 112u, 105u, 100u, 81u, 72u, 73u, 66u, 64u, 68u, 68u, 67u, 63u, 63u, 60u, 60u, 56u, 55u, 57u, 59u, 61u, 59u, 51u, 45u, 40u, 35u, 36u, 35u, 37u, 38u, 36u, 33u, 33u, 33u, 38u, 44u, 47u, 47u, 43u, 46u, 45u, 39u, 34u, 29u, 27u, 25u, 23u, 22u, 17u, 11u, 8u, 5u, 3u, 3u, 3u, 3u, 3u, 4u, 4u, 3u, 4u, 6u, 8u, 10u, 12u, 17u, 25u, 34u, 39u, 44u, 49u, 51u, 55u, 58u, 56u, 55u, 58u, 69u, 76u, 80u, 85u, 96u, 102u, 107u, 112u, 112u, 124u }, 
-	{ 118u, 128u, 136u, 132u, 136u, 138u, 137u, 136u, 141u, 144u, 137u, 129u, 118u, 103u, 100u, 101u, 106u, 110u, 124u, 133u, 137u, 143u, 146u, 147u, 151u, 156u, 165u, 180u, 180u, 179u, 178u, 175u, 157u, 129u, 127u, 124u, 119u, 119u, 110u, 91u, 83u, 73u, 72u, 72u, 73u, 74u, 78u, 81u, 90u, 103u, 110u, 101u, 95u, 88u, 79u, 63u, 52u, 44u, 39u, 41u, 43u, 39u, 35u, 37u, 40u, 45u, 55u, 61u, 73u, 83u, 83u, 78u, 75u, 77u, 78u, 83u, 97u, 99u, 97u, 91u, 89u, 88u, 89u, 91u, 92u, 90u, 87u, 81u, 76u, 71u, 65u, 58u, 52u, 46u, 41u, 37u, 33u, 30u, 27u, 25u, 24u, 23u, 22u, 22u, 22u, 23u, 24u, 24u, 25u, 26u, 27u, 28u, 30u, 32u, 34u, 35u, 36u, 38u, 39u, 40u, 40u, 41u, 41u, 43u, 49u, 57u, 68u, 73u, 73u, 73u, 75u, 81u, 78u, 82u, 93u, 98u, 100u, 98u, 102u, 107u, 108u, 117u, 121u, 118u, 104u, 101u, 101u, 105u, 106u, 117u, 133u, 137u, 139u, 147u, 145u, 137u, 145u, 148u, 149u, 146u, 140u, 137u, 144u, 147u, 155u, 160u, 157u, 145u, 127u, 111u, 99u, 97u, 87u, 72u, 64u, 64u, 65u, 64u, 64u, 68u, 65u, 63u, 61u, 62u, 57u, 53u, 53u, 56u, 55u, 55u, 57u, 49u, 43u, 40u, 35u, 35u, 34u, 37u, 36u, 35u, 33u, 30u, 31u, 37u, 40u, 45u, 43u, 46u, 48u, 50u, 43u, 35u, 30u, 26u, 25u, 22u, 19u, 15u, 11u, 6u, 5u, 3u, 2u, 2u, 2u, 2u, 3u, 2u, 2u, 4u, 5u, 8u, 11u, 14u, 18u, 25u, 32u, 37u, 41u, 46u, 50u, 55u, 57u, 57u, 59u, 64u, 75u, 84u, 85u, 90u, 96u, 108u, 109u, 109u, 108u, 121u }, 
-	{ 110u, 120u, 131u, 133u, 137u, 140u, 139u, 131u, 130u, 132u, 132u, 125u, 113u, 98u, 91u, 92u, 104u, 110u, 120u, 125u, 128u, 129u, 128u, 130u, 135u, 142u, 146u, 162u, 168u, 173u, 166u, 161u, 146u, 118u, 105u, 109u, 105u, 93u, 86u, 79u, 76u, 73u, 70u, 69u, 63u, 62u, 65u, 71u, 82u, 97u, 106u, 102u, 89u, 78u, 66u, 55u, 50u, 42u, 38u, 37u, 34u, 34u, 32u, 34u, 38u, 42u, 52u, 57u, 67u, 79u, 78u, 74u, 67u, 68u, 77u, 80u, 86u, 88u, 87u, 87u, 89u, 88u, 87u, 89u, 89u, 86u, 84u, 79u, 74u, 69u, 64u, 58u, 51u, 46u, 40u, 35u, 31u, 28u, 26u, 23u, 22u, 21u, 20u, 21u, 21u, 22u, 23u, 23u, 24u, 25u, 27u, 29u, 31u, 33u, 35u, 36u, 37u, 38u, 39u, 39u, 40u, 41u, 44u, 49u, 54u, 59u, 66u, 72u, 73u, 72u, 73u, 76u, 76u, 72u, 80u, 89u, 97u, 101u, 105u, 111u, 110u, 109u, 118u, 122u, 114u, 111u, 109u, 109u, 115u, 138u, 144u, 137u, 137u, 143u, 143u, 141u, 144u, 141u, 139u, 129u, 126u, 126u, 134u, 149u, 155u, 154u, 152u, 133u, 109u, 91u, 83u, 81u, 67u, 54u, 52u, 61u, 66u, 63u, 60u, 63u, 61u, 58u, 59u, 56u, 52u, 48u, 51u, 56u, 56u, 55u, 55u, 45u, 39u, 35u, 31u, 30u, 32u, 34u, 33u, 32u, 32u, 30u, 31u, 36u, 40u, 42u, 44u, 50u, 53u, 56u, 47u, 39u, 34u, 27u, 23u, 19u, 17u, 13u, 9u, 6u, 5u, 3u, 2u, 2u, 2u, 1u, 1u, 1u, 2u, 3u, 5u, 8u, 12u, 14u, 18u, 25u, 29u, 32u, 38u, 43u, 47u, 52u, 56u, 61u, 65u, 70u, 79u, 88u, 93u, 96u, 99u, 107u, 107u, 105u, 104u, 112u }, 
-	{ 112u, 117u, 127u, 135u, 141u, 139u, 138u, 129u, 121u, 123u, 124u, 116u, 107u, 98u, 87u, 84u, 93u, 97u, 105u, 111u, 117u, 120u, 113u, 111u, 121u, 141u, 143u, 149u, 155u, 158u, 156u, 153u, 132u, 112u, 94u, 98u, 108u, 96u, 85u, 83u, 76u, 71u, 67u, 63u, 57u, 59u, 61u, 66u, 78u, 91u, 98u, 95u, 83u, 75u, 59u, 47u, 44u, 41u, 38u, 33u, 33u, 35u, 31u, 31u, 37u, 44u, 56u, 63u, 76u, 84u, 77u, 70u, 63u, 64u, 67u, 69u, 75u, 78u, 79u, 86u, 88u, 86u, 86u, 88u, 86u, 84u, 82u, 78u, 73u, 69u, 64u, 58u, 52u, 46u, 41u, 35u, 31u, 27u, 24u, 23u, 21u, 20u, 19u, 19u, 21u, 21u, 22u, 23u, 24u, 25u, 27u, 30u, 32u, 33u, 35u, 36u, 37u, 38u, 38u, 38u, 39u, 42u, 45u, 52u, 59u, 63u, 62u, 64u, 66u, 72u, 76u, 74u, 71u, 66u, 71u, 77u, 89u, 97u, 99u, 100u, 99u, 104u, 120u, 128u, 125u, 120u, 121u, 116u, 129u, 145u, 149u, 143u, 138u, 133u, 133u, 137u, 138u, 138u, 135u, 127u, 133u, 140u, 139u, 139u, 148u, 148u, 142u, 123u, 105u, 87u, 81u, 70u, 60u, 54u, 56u, 62u, 64u, 61u, 64u, 70u, 66u, 58u, 56u, 51u, 51u, 47u, 50u, 54u, 55u, 50u, 46u, 42u, 39u, 33u, 30u, 28u, 31u, 32u, 30u, 29u, 29u, 29u, 31u, 34u, 37u, 39u, 42u, 45u, 51u, 54u, 46u, 39u, 36u, 31u, 27u, 20u, 15u, 10u, 8u, 7u, 5u, 3u, 2u, 1u, 1u, 2u, 1u, 1u, 2u, 3u, 4u, 7u, 12u, 16u, 18u, 23u, 29u, 33u, 36u, 39u, 44u, 49u, 51u, 55u, 61u, 67u, 77u, 83u, 94u, 98u, 102u, 106u, 106u, 108u, 108u, 114u }, 
-	{ 108u, 114u, 121u, 130u, 137u, 135u, 129u, 119u, 110u, 111u, 111u, 108u, 99u, 94u, 85u, 78u, 83u, 89u, 92u, 95u, 102u, 107u, 99u, 94u, 108u, 134u, 136u, 134u, 141u, 137u, 140u, 137u, 122u, 102u, 91u, 100u, 111u, 103u, 91u, 86u, 73u, 67u, 65u, 60u, 55u, 53u, 54u, 62u, 71u, 85u, 90u, 85u, 75u, 67u, 55u, 45u, 41u, 42u, 43u, 38u, 35u, 33u, 33u, 36u, 38u, 49u, 61u, 70u, 80u, 81u, 76u, 65u, 58u, 56u, 57u, 64u, 65u, 72u, 79u, 84u, 85u, 85u, 86u, 87u, 85u, 83u, 80u, 78u, 74u, 70u, 66u, 60u, 54u, 48u, 42u, 36u, 32u, 28u, 24u, 23u, 22u, 21u, 20u, 19u, 21u, 22u, 23u, 24u, 25u, 26u, 28u, 30u, 32u, 33u, 35u, 36u, 38u, 37u, 37u, 38u, 41u, 44u, 47u, 54u, 60u, 60u, 58u, 60u, 65u, 69u, 73u, 72u, 71u, 70u, 67u, 69u, 79u, 89u, 95u, 92u, 88u, 101u, 117u, 122u, 115u, 121u, 124u, 123u, 125u, 140u, 144u, 147u, 143u, 129u, 121u, 125u, 141u, 139u, 137u, 141u, 147u, 156u, 146u, 140u, 136u, 133u, 121u, 111u, 94u, 79u, 73u, 62u, 61u, 62u, 63u, 65u, 60u, 55u, 61u, 66u, 58u, 56u, 57u, 55u, 51u, 47u, 49u, 49u, 48u, 43u, 37u, 35u, 34u, 32u, 30u, 31u, 32u, 30u, 29u, 27u, 26u, 29u, 31u, 34u, 38u, 38u, 34u, 39u, 49u, 52u, 49u, 44u, 39u, 34u, 28u, 22u, 15u, 11u, 8u, 8u, 6u, 4u, 2u, 1u, 1u, 2u, 2u, 1u, 2u, 3u, 4u, 7u, 11u, 16u, 21u, 25u, 29u, 36u, 37u, 40u, 42u, 45u, 46u, 49u, 54u, 61u, 72u, 81u, 93u, 96u, 101u, 104u, 111u, 118u, 121u, 127u }, 
-	{ 105u, 112u, 119u, 124u, 125u, 129u, 125u, 113u, 104u, 102u, 101u, 98u, 90u, 85u, 82u, 79u, 76u, 76u, 84u, 87u, 88u, 85u, 85u, 90u, 98u, 119u, 128u, 133u, 134u, 128u, 123u, 120u, 116u, 109u, 105u, 111u, 117u, 105u, 96u, 89u, 76u, 71u, 67u, 57u, 49u, 46u, 52u, 64u, 73u, 82u, 88u, 86u, 71u, 63u, 56u, 51u, 47u, 44u, 44u, 43u, 43u, 40u, 39u, 41u, 45u, 57u, 70u, 77u, 83u, 84u, 80u, 67u, 60u, 59u, 63u, 68u, 68u, 72u, 78u, 79u, 81u, 84u, 87u, 87u, 86u, 83u, 81u, 79u, 76u, 73u, 69u, 63u, 57u, 51u, 45u, 39u, 33u, 29u, 26u, 24u, 23u, 22u, 21u, 20u, 21u, 23u, 25u, 25u, 26u, 27u, 29u, 30u, 32u, 34u, 36u, 38u, 40u, 39u, 38u, 39u, 42u, 45u, 49u, 54u, 57u, 55u, 55u, 58u, 64u, 67u, 67u, 67u, 69u, 69u, 67u, 66u, 71u, 82u, 84u, 84u, 88u, 92u, 105u, 116u, 117u, 125u, 117u, 120u, 123u, 135u, 134u, 143u, 138u, 120u, 108u, 113u, 133u, 142u, 138u, 146u, 156u, 169u, 157u, 141u, 128u, 120u, 108u, 98u, 84u, 78u, 74u, 64u, 58u, 61u, 62u, 62u, 59u, 55u, 52u, 52u, 52u, 49u, 49u, 52u, 51u, 47u, 46u, 45u, 41u, 39u, 33u, 32u, 32u, 30u, 28u, 30u, 30u, 29u, 28u, 26u, 24u, 26u, 26u, 27u, 31u, 32u, 29u, 36u, 43u, 48u, 47u, 43u, 39u, 36u, 29u, 25u, 19u, 15u, 13u, 10u, 7u, 4u, 2u, 2u, 2u, 2u, 2u, 1u, 1u, 2u, 4u, 7u, 11u, 18u, 24u, 28u, 33u, 39u, 39u, 40u, 40u, 41u, 43u, 47u, 49u, 57u, 69u, 80u, 91u, 96u, 102u, 108u, 117u, 123u, 126u, 134u }, 
-	{ 98u, 105u, 114u, 122u, 123u, 125u, 118u, 107u, 98u, 95u, 95u, 90u, 84u, 79u, 79u, 80u, 77u, 71u, 71u, 71u, 67u, 68u, 70u, 77u, 95u, 107u, 118u, 126u, 116u, 114u, 107u, 103u, 104u, 110u, 107u, 105u, 109u, 100u, 95u, 87u, 75u, 73u, 66u, 55u, 45u, 44u, 51u, 65u, 75u, 80u, 85u, 81u, 71u, 66u, 60u, 58u, 52u, 47u, 43u, 45u, 46u, 49u, 44u, 44u, 48u, 60u, 72u, 79u, 88u, 86u, 84u, 74u, 72u, 72u, 75u, 76u, 73u, 75u, 81u, 81u, 83u, 88u, 88u, 88u, 87u, 85u, 84u, 82u, 80u, 78u, 74u, 68u, 61u, 55u, 50u, 43u, 37u, 32u, 28u, 26u, 24u, 23u, 23u, 23u, 23u, 24u, 26u, 27u, 27u, 29u, 30u, 32u, 33u, 34u, 37u, 38u, 40u, 41u, 42u, 46u, 46u, 48u, 54u, 54u, 55u, 56u, 58u, 62u, 63u, 62u, 66u, 68u, 70u, 68u, 72u, 70u, 65u, 69u, 76u, 76u, 84u, 91u, 97u, 106u, 117u, 127u, 120u, 114u, 119u, 123u, 113u, 117u, 116u, 112u, 109u, 118u, 125u, 136u, 142u, 150u, 159u, 167u, 151u, 136u, 124u, 113u, 97u, 90u, 83u, 79u, 76u, 66u, 62u, 65u, 67u, 64u, 65u, 59u, 51u, 53u, 52u, 43u, 46u, 49u, 53u, 50u, 43u, 41u, 37u, 36u, 28u, 28u, 32u, 30u, 28u, 29u, 30u, 32u, 29u, 25u, 25u, 25u, 25u, 24u, 27u, 27u, 25u, 32u, 43u, 46u, 46u, 46u, 43u, 41u, 34u, 31u, 25u, 20u, 17u, 13u, 9u, 7u, 5u, 3u, 2u, 2u, 2u, 2u, 2u, 3u, 6u, 8u, 13u, 19u, 24u, 31u, 38u, 39u, 39u, 38u, 41u, 42u, 45u, 48u, 53u, 61u, 66u, 76u, 87u, 98u, 101u, 109u, 118u, 123u, 127u, 137u }, 
-	{ 92u, 96u, 108u, 119u, 122u, 119u, 110u, 100u, 95u, 92u, 89u, 82u, 80u, 79u, 77u, 78u, 77u, 69u, 62u, 57u, 55u, 57u, 58u, 66u, 85u, 97u, 104u, 105u, 105u, 103u, 97u, 92u, 93u, 93u, 96u, 96u, 93u, 88u, 85u, 74u, 69u, 70u, 62u, 49u, 41u, 41u, 51u, 62u, 71u, 75u, 77u, 72u, 67u, 61u, 57u, 57u, 51u, 48u, 43u, 40u, 42u, 45u, 43u, 43u, 50u, 58u, 68u, 84u, 89u, 85u, 84u, 79u, 78u, 82u, 79u, 74u, 76u, 77u, 80u, 82u, 87u, 90u, 90u, 91u, 90u, 88u, 89u, 88u, 88u, 86u, 80u, 73u, 66u, 61u, 56u, 49u, 41u, 35u, 30u, 27u, 26u, 25u, 25u, 25u, 26u, 27u, 29u, 29u, 29u, 31u, 32u, 33u, 35u, 35u, 37u, 39u, 41u, 43u, 45u, 50u, 54u, 52u, 53u, 53u, 57u, 61u, 63u, 67u, 66u, 63u, 67u, 72u, 72u, 72u, 75u, 76u, 66u, 62u, 69u, 75u, 81u, 87u, 87u, 98u, 110u, 117u, 117u, 107u, 111u, 108u, 98u, 99u, 100u, 105u, 110u, 118u, 127u, 133u, 145u, 150u, 155u, 158u, 142u, 129u, 119u, 102u, 87u, 89u, 85u, 81u, 76u, 73u, 72u, 75u, 76u, 69u, 68u, 62u, 55u, 51u, 50u, 43u, 44u, 48u, 53u, 52u, 50u, 44u, 38u, 36u, 28u, 27u, 34u, 34u, 32u, 32u, 31u, 32u, 29u, 26u, 24u, 23u, 23u, 23u, 26u, 24u, 23u, 29u, 37u, 46u, 47u, 48u, 47u, 45u, 39u, 35u, 30u, 25u, 23u, 17u, 13u, 11u, 9u, 6u, 4u, 4u, 4u, 3u, 3u, 5u, 7u, 10u, 15u, 20u, 28u, 33u, 37u, 39u, 39u, 40u, 42u, 45u, 48u, 54u, 61u, 65u, 67u, 72u, 86u, 95u, 100u, 108u, 115u, 124u, 131u, 138u }, 
-	{ 87u, 90u, 106u, 116u, 116u, 112u, 103u, 93u, 86u, 83u, 84u, 79u, 80u, 80u, 77u, 76u, 71u, 64u, 56u, 48u, 49u, 53u, 53u, 58u, 75u, 89u, 98u, 99u, 100u, 87u, 82u, 83u, 86u, 78u, 78u, 77u, 74u, 70u, 68u, 61u, 62u, 61u, 53u, 44u, 38u, 40u, 48u, 58u, 67u, 67u, 66u, 61u, 60u, 58u, 57u, 54u, 48u, 44u, 41u, 40u, 41u, 42u, 42u, 40u, 45u, 52u, 63u, 82u, 88u, 86u, 88u, 85u, 83u, 84u, 83u, 74u, 75u, 77u, 79u, 84u, 88u, 89u, 93u, 95u, 94u, 94u, 95u, 95u, 95u, 92u, 84u, 78u, 73u, 67u, 61u, 53u, 45u, 39u, 33u, 31u, 30u, 29u, 28u, 28u, 29u, 30u, 32u, 33u, 34u, 34u, 34u, 34u, 34u, 36u, 37u, 38u, 41u, 43u, 45u, 51u, 58u, 58u, 57u, 56u, 59u, 66u, 72u, 69u, 70u, 72u, 71u, 73u, 68u, 70u, 72u, 70u, 67u, 64u, 65u, 77u, 85u, 87u, 84u, 93u, 110u, 112u, 105u, 95u, 96u, 100u, 87u, 83u, 92u, 101u, 104u, 98u, 105u, 117u, 136u, 145u, 148u, 139u, 125u, 121u, 114u, 100u, 84u, 84u, 83u, 87u, 82u, 81u, 81u, 83u, 78u, 71u, 65u, 62u, 56u, 47u, 44u, 43u, 48u, 49u, 50u, 51u, 50u, 42u, 37u, 35u, 29u, 31u, 35u, 36u, 40u, 36u, 32u, 34u, 31u, 27u, 27u, 24u, 23u, 22u, 22u, 24u, 25u, 27u, 32u, 42u, 41u, 46u, 46u, 46u, 41u, 38u, 38u, 33u, 29u, 22u, 17u, 14u, 14u, 11u, 8u, 6u, 6u, 6u, 6u, 6u, 8u, 11u, 15u, 23u, 32u, 35u, 39u, 42u, 42u, 42u, 47u, 53u, 55u, 61u, 65u, 65u, 65u, 70u, 82u, 89u, 98u, 108u, 116u, 126u, 137u, 144u }, 
-	{ 86u, 91u, 101u, 110u, 110u, 110u, 103u, 90u, 81u, 79u, 80u, 77u, 80u, 80u, 78u, 70u, 63u, 62u, 56u, 51u, 56u, 59u, 56u, 54u, 64u, 75u, 89u, 90u, 91u, 84u, 75u, 81u, 76u, 64u, 59u, 63u, 66u, 61u, 55u, 49u, 49u, 47u, 48u, 39u, 33u, 32u, 38u, 49u, 57u, 58u, 60u, 57u, 56u, 54u, 53u, 49u, 47u, 43u, 38u, 36u, 36u, 34u, 36u, 38u, 40u, 50u, 60u, 76u, 83u, 84u, 89u, 89u, 88u, 89u, 85u, 80u, 82u, 82u, 85u, 88u, 91u, 94u, 100u, 105u, 103u, 102u, 100u, 100u, 99u, 95u, 91u, 87u, 81u, 75u, 67u, 59u, 51u, 44u, 39u, 35u, 33u, 31u, 29u, 27u, 31u, 34u, 35u, 37u, 38u, 35u, 35u, 34u, 34u, 37u, 40u, 42u, 45u, 48u, 49u, 52u, 58u, 58u, 57u, 56u, 56u, 60u, 69u, 71u, 77u, 79u, 74u, 72u, 66u, 68u, 70u, 67u, 63u, 58u, 62u, 74u, 77u, 74u, 70u, 81u, 92u, 90u, 91u, 86u, 76u, 78u, 75u, 82u, 97u, 101u, 105u, 96u, 95u, 107u, 125u, 135u, 129u, 121u, 112u, 111u, 101u, 93u, 77u, 70u, 80u, 85u, 84u, 79u, 77u, 80u, 79u, 76u, 67u, 67u, 63u, 51u, 46u, 45u, 49u, 52u, 47u, 48u, 49u, 40u, 35u, 34u, 32u, 33u, 34u, 38u, 40u, 35u, 33u, 36u, 32u, 29u, 26u, 24u, 23u, 22u, 20u, 20u, 22u, 24u, 31u, 34u, 37u, 43u, 47u, 52u, 46u, 46u, 46u, 43u, 36u, 28u, 24u, 19u, 17u, 16u, 12u, 11u, 10u, 10u, 11u, 9u, 11u, 14u, 19u, 25u, 34u, 37u, 41u, 46u, 46u, 45u, 49u, 56u, 56u, 61u, 64u, 65u, 62u, 66u, 74u, 84u, 99u, 107u, 118u, 130u, 147u, 152u }, 
-	{ 86u, 89u, 97u, 105u, 103u, 101u, 99u, 90u, 81u, 77u, 76u, 74u, 78u, 82u, 79u, 68u, 61u, 62u, 58u, 57u, 61u, 62u, 56u, 55u, 61u, 72u, 77u, 70u, 74u, 76u, 72u, 69u, 55u, 46u, 45u, 50u, 52u, 53u, 47u, 40u, 39u, 37u, 40u, 38u, 31u, 29u, 30u, 40u, 51u, 55u, 58u, 56u, 54u, 52u, 49u, 46u, 44u, 40u, 35u, 33u, 33u, 31u, 31u, 33u, 37u, 49u, 61u, 73u, 84u, 86u, 90u, 95u, 95u, 98u, 91u, 87u, 93u, 91u, 91u, 96u, 100u, 104u, 110u, 115u, 113u, 110u, 107u, 106u, 104u, 99u, 98u, 96u, 90u, 84u, 76u, 67u, 59u, 51u, 45u, 41u, 38u, 35u, 31u, 30u, 33u, 36u, 39u, 40u, 41u, 39u, 36u, 34u, 34u, 39u, 45u, 48u, 53u, 57u, 55u, 55u, 55u, 57u, 57u, 54u, 54u, 55u, 60u, 71u, 79u, 84u, 79u, 70u, 62u, 66u, 69u, 70u, 67u, 60u, 62u, 75u, 71u, 59u, 53u, 55u, 69u, 71u, 75u, 71u, 59u, 63u, 75u, 89u, 103u, 112u, 113u, 110u, 99u, 107u, 120u, 118u, 113u, 109u, 102u, 97u, 88u, 83u, 72u, 70u, 84u, 88u, 80u, 77u, 78u, 79u, 79u, 74u, 67u, 66u, 65u, 57u, 50u, 48u, 48u, 52u, 48u, 49u, 49u, 44u, 38u, 34u, 31u, 34u, 38u, 41u, 38u, 35u, 36u, 39u, 34u, 30u, 25u, 24u, 25u, 22u, 19u, 17u, 18u, 19u, 22u, 27u, 31u, 35u, 47u, 56u, 53u, 53u, 52u, 48u, 40u, 31u, 28u, 27u, 24u, 20u, 17u, 16u, 16u, 15u, 16u, 14u, 15u, 18u, 22u, 26u, 31u, 36u, 42u, 46u, 50u, 51u, 53u, 59u, 60u, 62u, 65u, 66u, 64u, 64u, 69u, 83u, 97u, 105u, 119u, 137u, 153u, 162u }, 
-	{ 85u, 87u, 91u, 97u, 93u, 89u, 91u, 85u, 79u, 75u, 74u, 72u, 73u, 76u, 74u, 70u, 62u, 64u, 65u, 65u, 62u, 58u, 56u, 61u, 64u, 69u, 65u, 62u, 65u, 61u, 57u, 54u, 47u, 42u, 43u, 47u, 45u, 43u, 40u, 35u, 34u, 35u, 35u, 33u, 31u, 31u, 32u, 37u, 43u, 46u, 50u, 51u, 50u, 49u, 48u, 44u, 42u, 38u, 33u, 31u, 29u, 29u, 30u, 35u, 39u, 48u, 61u, 70u, 76u, 82u, 88u, 97u, 98u, 99u, 98u, 95u, 99u, 100u, 98u, 104u, 113u, 120u, 127u, 125u, 120u, 119u, 118u, 118u, 116u, 110u, 108u, 106u, 100u, 92u, 83u, 74u, 66u, 58u, 51u, 47u, 44u, 39u, 35u, 33u, 34u, 37u, 42u, 44u, 44u, 42u, 39u, 36u, 37u, 40u, 47u, 52u, 56u, 61u, 60u, 57u, 54u, 56u, 59u, 55u, 52u, 54u, 59u, 68u, 75u, 85u, 85u, 75u, 70u, 71u, 74u, 76u, 83u, 77u, 69u, 74u, 66u, 57u, 50u, 47u, 58u, 65u, 71u, 69u, 57u, 62u, 81u, 94u, 104u, 118u, 122u, 109u, 93u, 102u, 115u, 113u, 113u, 105u, 97u, 95u, 84u, 80u, 76u, 74u, 82u, 91u, 81u, 77u, 81u, 80u, 77u, 75u, 74u, 75u, 65u, 52u, 43u, 44u, 47u, 47u, 44u, 48u, 47u, 45u, 37u, 33u, 29u, 30u, 37u, 39u, 38u, 36u, 33u, 36u, 33u, 31u, 28u, 28u, 24u, 21u, 20u, 18u, 17u, 17u, 18u, 22u, 25u, 34u, 48u, 52u, 51u, 56u, 56u, 51u, 41u, 35u, 31u, 32u, 32u, 25u, 20u, 18u, 17u, 16u, 19u, 19u, 19u, 23u, 26u, 31u, 33u, 38u, 45u, 48u, 51u, 58u, 60u, 62u, 67u, 67u, 67u, 68u, 70u, 71u, 72u, 82u, 95u, 103u, 122u, 143u, 157u, 167u }, 
-	{ 82u, 85u, 89u, 91u, 86u, 80u, 81u, 82u, 78u, 77u, 76u, 71u, 72u, 69u, 69u, 65u, 58u, 62u, 66u, 64u, 61u, 57u, 61u, 62u, 62u, 58u, 58u, 60u, 57u, 51u, 44u, 46u, 42u, 39u, 41u, 45u, 45u, 44u, 40u, 38u, 38u, 35u, 34u, 33u, 34u, 34u, 34u, 35u, 40u, 42u, 45u, 46u, 47u, 46u, 44u, 43u, 39u, 37u, 35u, 30u, 28u, 30u, 31u, 36u, 40u, 44u, 53u, 60u, 67u, 74u, 84u, 97u, 105u, 104u, 104u, 110u, 109u, 104u, 105u, 113u, 126u, 133u, 141u, 137u, 131u, 130u, 130u, 129u, 125u, 121u, 118u, 116u, 110u, 101u, 91u, 81u, 74u, 65u, 58u, 53u, 51u, 43u, 37u, 38u, 37u, 39u, 42u, 43u, 45u, 44u, 42u, 37u, 38u, 40u, 44u, 50u, 56u, 60u, 62u, 56u, 54u, 55u, 58u, 53u, 53u, 55u, 54u, 56u, 63u, 71u, 72u, 73u, 69u, 71u, 81u, 90u, 98u, 95u, 82u, 78u, 70u, 58u, 49u, 45u, 55u, 66u, 71u, 64u, 64u, 72u, 87u, 100u, 104u, 113u, 118u, 105u, 96u, 98u, 102u, 105u, 105u, 103u, 106u, 100u, 89u, 78u, 76u, 78u, 83u, 87u, 85u, 78u, 79u, 78u, 80u, 82u, 83u, 78u, 67u, 52u, 43u, 46u, 46u, 46u, 45u, 47u, 43u, 40u, 34u, 29u, 27u, 29u, 36u, 40u, 41u, 39u, 35u, 34u, 34u, 33u, 32u, 29u, 25u, 22u, 21u, 19u, 18u, 18u, 18u, 20u, 25u, 33u, 45u, 49u, 49u, 54u, 58u, 52u, 43u, 38u, 35u, 37u, 36u, 31u, 23u, 20u, 18u, 17u, 20u, 23u, 25u, 27u, 32u, 35u, 36u, 39u, 45u, 47u, 52u, 60u, 61u, 65u, 69u, 70u, 70u, 71u, 78u, 79u, 79u, 87u, 96u, 108u, 126u, 148u, 161u, 169u }, 
-	{ 77u, 83u, 86u, 86u, 82u, 74u, 73u, 76u, 75u, 76u, 75u, 70u, 71u, 67u, 63u, 60u, 57u, 59u, 63u, 61u, 57u, 55u, 60u, 60u, 55u, 50u, 51u, 56u, 51u, 43u, 36u, 36u, 37u, 42u, 45u, 45u, 46u, 46u, 44u, 45u, 40u, 36u, 32u, 31u, 32u, 35u, 36u, 35u, 35u, 35u, 38u, 41u, 41u, 39u, 39u, 38u, 37u, 35u, 33u, 28u, 26u, 28u, 30u, 30u, 33u, 38u, 45u, 50u, 60u, 66u, 76u, 88u, 104u, 112u, 117u, 123u, 118u, 113u, 115u, 124u, 139u, 151u, 159u, 158u, 154u, 149u, 146u, 141u, 135u, 131u, 127u, 124u, 117u, 108u, 98u, 89u, 81u, 73u, 65u, 59u, 55u, 47u, 41u, 42u, 41u, 39u, 40u, 42u, 46u, 45u, 42u, 39u, 40u, 40u, 41u, 44u, 53u, 54u, 56u, 53u, 51u, 54u, 57u, 53u, 48u, 49u, 47u, 44u, 48u, 54u, 58u, 61u, 64u, 75u, 86u, 98u, 107u, 107u, 94u, 79u, 71u, 71u, 58u, 50u, 52u, 56u, 65u, 63u, 67u, 77u, 87u, 93u, 107u, 116u, 120u, 109u, 96u, 93u, 100u, 103u, 106u, 108u, 114u, 106u, 97u, 89u, 86u, 86u, 83u, 81u, 78u, 73u, 77u, 79u, 83u, 86u, 90u, 83u, 69u, 55u, 49u, 46u, 40u, 42u, 47u, 48u, 42u, 38u, 33u, 28u, 27u, 28u, 35u, 39u, 40u, 41u, 38u, 40u, 39u, 34u, 33u, 30u, 28u, 26u, 24u, 22u, 22u, 21u, 19u, 21u, 28u, 33u, 40u, 41u, 44u, 48u, 47u, 45u, 42u, 38u, 37u, 41u, 36u, 30u, 26u, 19u, 16u, 18u, 21u, 26u, 32u, 35u, 39u, 38u, 36u, 40u, 47u, 50u, 56u, 62u, 64u, 68u, 73u, 75u, 77u, 78u, 84u, 86u, 87u, 92u, 101u, 115u, 130u, 151u, 164u, 174u }, 
-	{ 72u, 78u, 81u, 79u, 76u, 71u, 70u, 71u, 68u, 69u, 70u, 66u, 66u, 64u, 57u, 57u, 54u, 54u, 57u, 56u, 54u, 50u, 56u, 59u, 56u, 52u, 52u, 52u, 48u, 46u, 39u, 34u, 34u, 41u, 41u, 41u, 42u, 45u, 44u, 47u, 44u, 38u, 32u, 28u, 27u, 30u, 31u, 33u, 33u, 34u, 35u, 35u, 36u, 34u, 35u, 32u, 31u, 30u, 27u, 24u, 23u, 24u, 26u, 28u, 31u, 36u, 44u, 47u, 52u, 59u, 69u, 77u, 94u, 108u, 115u, 119u, 120u, 119u, 123u, 134u, 151u, 166u, 170u, 172u, 170u, 163u, 155u, 147u, 144u, 144u, 138u, 130u, 124u, 116u, 107u, 97u, 90u, 81u, 74u, 67u, 59u, 52u, 45u, 44u, 42u, 42u, 42u, 45u, 48u, 46u, 41u, 36u, 34u, 34u, 35u, 40u, 47u, 47u, 51u, 51u, 47u, 48u, 48u, 48u, 46u, 44u, 42u, 40u, 46u, 53u, 54u, 57u, 66u, 75u, 83u, 103u, 106u, 107u, 98u, 80u, 84u, 85u, 67u, 60u, 57u, 53u, 60u, 67u, 75u, 70u, 78u, 88u, 109u, 121u, 129u, 118u, 102u, 100u, 103u, 104u, 108u, 110u, 116u, 108u, 97u, 89u, 91u, 89u, 81u, 73u, 70u, 73u, 74u, 78u, 84u, 87u, 93u, 91u, 81u, 70u, 57u, 46u, 37u, 37u, 45u, 45u, 45u, 42u, 34u, 30u, 32u, 32u, 38u, 41u, 43u, 48u, 45u, 43u, 42u, 41u, 35u, 29u, 29u, 30u, 28u, 25u, 24u, 22u, 20u, 20u, 25u, 32u, 37u, 40u, 43u, 45u, 42u, 38u, 38u, 38u, 36u, 37u, 33u, 28u, 23u, 19u, 15u, 13u, 16u, 22u, 30u, 36u, 40u, 42u, 41u, 45u, 49u, 52u, 60u, 67u, 69u, 71u, 76u, 77u, 82u, 84u, 88u, 92u, 94u, 99u, 109u, 124u, 139u, 157u, 168u, 180u }, 
-	{ 69u, 74u, 77u, 75u, 72u, 67u, 67u, 64u, 62u, 63u, 61u, 60u, 59u, 58u, 56u, 54u, 50u, 49u, 52u, 52u, 50u, 50u, 55u, 62u, 57u, 53u, 52u, 50u, 49u, 49u, 46u, 35u, 34u, 36u, 38u, 39u, 45u, 47u, 47u, 47u, 46u, 40u, 34u, 29u, 25u, 28u, 27u, 29u, 31u, 30u, 30u, 31u, 32u, 31u, 31u, 28u, 28u, 26u, 23u, 19u, 19u, 21u, 23u, 27u, 31u, 36u, 40u, 44u, 47u, 54u, 63u, 70u, 84u, 102u, 111u, 113u, 120u, 126u, 138u, 146u, 158u, 170u, 175u, 178u, 180u, 172u, 160u, 155u, 154u, 151u, 144u, 136u, 131u, 125u, 116u, 107u, 99u, 91u, 83u, 74u, 66u, 58u, 51u, 45u, 43u, 41u, 40u, 43u, 45u, 38u, 34u, 30u, 27u, 29u, 29u, 35u, 41u, 41u, 43u, 43u, 40u, 41u, 42u, 38u, 40u, 44u, 40u, 41u, 45u, 50u, 51u, 57u, 64u, 71u, 83u, 101u, 105u, 105u, 100u, 95u, 90u, 90u, 79u, 73u, 66u, 60u, 58u, 68u, 75u, 77u, 82u, 93u, 110u, 123u, 124u, 119u, 109u, 111u, 112u, 108u, 110u, 108u, 108u, 99u, 94u, 86u, 86u, 81u, 75u, 72u, 74u, 79u, 78u, 81u, 90u, 95u, 104u, 104u, 94u, 86u, 69u, 50u, 41u, 39u, 48u, 48u, 51u, 48u, 38u, 33u, 34u, 37u, 40u, 47u, 52u, 49u, 48u, 43u, 45u, 43u, 40u, 33u, 32u, 35u, 32u, 30u, 29u, 26u, 23u, 21u, 25u, 29u, 35u, 36u, 40u, 43u, 39u, 34u, 32u, 32u, 33u, 32u, 30u, 24u, 22u, 19u, 14u, 11u, 13u, 19u, 25u, 32u, 38u, 44u, 47u, 47u, 49u, 53u, 62u, 68u, 72u, 77u, 80u, 85u, 90u, 90u, 97u, 100u, 102u, 109u, 123u, 131u, 145u, 161u, 174u, 188u }, 
-	{ 68u, 73u, 76u, 75u, 75u, 70u, 66u, 63u, 59u, 56u, 56u, 57u, 57u, 55u, 53u, 50u, 50u, 51u, 50u, 54u, 56u, 57u, 60u, 65u, 66u, 59u, 55u, 55u, 56u, 55u, 54u, 44u, 37u, 36u, 39u, 45u, 50u, 50u, 52u, 52u, 45u, 38u, 34u, 30u, 26u, 27u, 26u, 26u, 27u, 29u, 27u, 27u, 28u, 27u, 28u, 27u, 25u, 23u, 19u, 17u, 17u, 19u, 24u, 29u, 33u, 37u, 38u, 43u, 47u, 50u, 56u, 67u, 80u, 98u, 112u, 116u, 124u, 135u, 147u, 155u, 167u, 175u, 180u, 185u, 186u, 180u, 170u, 165u, 164u, 157u, 147u, 142u, 137u, 131u, 126u, 117u, 107u, 98u, 89u, 80u, 70u, 61u, 55u, 46u, 43u, 44u, 42u, 40u, 41u, 34u, 27u, 25u, 24u, 23u, 25u, 27u, 32u, 35u, 38u, 36u, 35u, 35u, 34u, 32u, 38u, 44u, 42u, 42u, 44u, 48u, 52u, 54u, 57u, 68u, 87u, 99u, 108u, 112u, 103u, 97u, 88u, 92u, 83u, 72u, 63u, 57u, 50u, 61u, 73u, 75u, 89u, 99u, 103u, 107u, 111u, 118u, 119u, 120u, 112u, 106u, 104u, 102u, 100u, 89u, 85u, 78u, 76u, 75u, 78u, 77u, 79u, 88u, 88u, 92u, 99u, 104u, 109u, 103u, 101u, 97u, 85u, 65u, 56u, 49u, 53u, 60u, 59u, 50u, 39u, 36u, 36u, 41u, 44u, 52u, 56u, 52u, 51u, 47u, 48u, 44u, 38u, 32u, 33u, 34u, 32u, 30u, 29u, 26u, 26u, 24u, 24u, 28u, 32u, 32u, 36u, 39u, 34u, 29u, 27u, 26u, 27u, 25u, 24u, 22u, 22u, 18u, 14u, 14u, 15u, 19u, 24u, 30u, 39u, 43u, 48u, 49u, 50u, 56u, 64u, 69u, 77u, 84u, 91u, 99u, 103u, 105u, 110u, 112u, 116u, 122u, 132u, 137u, 150u, 164u, 177u, 190u }, 
-	{ 66u, 72u, 75u, 74u, 75u, 73u, 67u, 63u, 59u, 57u, 54u, 55u, 55u, 52u, 51u, 49u, 49u, 52u, 53u, 56u, 59u, 68u, 74u, 80u, 82u, 70u, 68u, 67u, 66u, 64u, 58u, 52u, 53u, 49u, 48u, 51u, 56u, 55u, 54u, 57u, 49u, 41u, 38u, 32u, 29u, 26u, 25u, 22u, 25u, 26u, 25u, 26u, 28u, 27u, 27u, 28u, 23u, 21u, 18u, 17u, 16u, 18u, 23u, 29u, 32u, 35u, 34u, 39u, 45u, 50u, 58u, 70u, 83u, 100u, 114u, 121u, 129u, 143u, 154u, 165u, 172u, 174u, 181u, 189u, 191u, 190u, 184u, 177u, 172u, 162u, 151u, 146u, 138u, 135u, 130u, 121u, 110u, 102u, 96u, 86u, 75u, 67u, 57u, 50u, 50u, 49u, 44u, 39u, 37u, 32u, 27u, 25u, 23u, 22u, 24u, 23u, 26u, 28u, 28u, 28u, 29u, 30u, 31u, 34u, 37u, 39u, 37u, 40u, 41u, 44u, 43u, 41u, 44u, 55u, 78u, 90u, 103u, 111u, 110u, 104u, 96u, 91u, 84u, 76u, 65u, 59u, 53u, 56u, 68u, 76u, 93u, 104u, 104u, 102u, 110u, 116u, 119u, 116u, 112u, 116u, 111u, 104u, 98u, 87u, 84u, 78u, 70u, 71u, 77u, 83u, 87u, 95u, 97u, 102u, 111u, 109u, 108u, 100u, 105u, 104u, 96u, 82u, 73u, 64u, 61u, 69u, 68u, 55u, 47u, 46u, 41u, 43u, 47u, 59u, 62u, 55u, 54u, 49u, 49u, 42u, 35u, 31u, 28u, 27u, 26u, 27u, 26u, 26u, 26u, 26u, 25u, 28u, 30u, 31u, 33u, 33u, 28u, 24u, 23u, 22u, 23u, 21u, 18u, 19u, 19u, 17u, 14u, 14u, 14u, 17u, 19u, 25u, 34u, 41u, 45u, 46u, 53u, 63u, 75u, 80u, 90u, 95u, 103u, 111u, 118u, 122u, 123u, 125u, 131u, 135u, 140u, 145u, 155u, 168u, 179u, 192u }, 
-	{ 65u, 69u, 70u, 71u, 72u, 71u, 69u, 65u, 63u, 60u, 57u, 56u, 56u, 53u, 50u, 50u, 51u, 53u, 56u, 61u, 66u, 80u, 88u, 96u, 92u, 87u, 84u, 78u, 70u, 72u, 70u, 64u, 66u, 63u, 58u, 59u, 61u, 60u, 56u, 55u, 49u, 43u, 41u, 34u, 29u, 27u, 26u, 24u, 26u, 25u, 22u, 25u, 28u, 26u, 26u, 25u, 20u, 19u, 18u, 16u, 16u, 18u, 24u, 30u, 32u, 35u, 35u, 36u, 42u, 50u, 63u, 74u, 91u, 107u, 118u, 132u, 142u, 153u, 164u, 166u, 170u, 176u, 184u, 192u, 198u, 198u, 197u, 191u, 186u, 174u, 160u, 151u, 147u, 140u, 133u, 125u, 112u, 105u, 101u, 94u, 84u, 73u, 64u, 57u, 57u, 53u, 47u, 39u, 35u, 31u, 27u, 26u, 24u, 21u, 22u, 23u, 25u, 26u, 26u, 25u, 26u, 29u, 31u, 36u, 37u, 35u, 35u, 36u, 38u, 39u, 35u, 36u, 40u, 52u, 69u, 79u, 95u, 108u, 115u, 116u, 101u, 89u, 80u, 76u, 70u, 58u, 52u, 52u, 52u, 66u, 84u, 99u, 97u, 102u, 105u, 103u, 99u, 95u, 103u, 108u, 109u, 104u, 91u, 82u, 77u, 72u, 68u, 73u, 79u, 82u, 91u, 97u, 99u, 101u, 109u, 113u, 109u, 107u, 108u, 112u, 111u, 104u, 96u, 79u, 77u, 78u, 70u, 60u, 55u, 55u, 48u, 47u, 57u, 68u, 75u, 70u, 58u, 48u, 47u, 42u, 35u, 28u, 23u, 21u, 21u, 23u, 23u, 25u, 25u, 25u, 26u, 28u, 28u, 29u, 29u, 24u, 20u, 19u, 19u, 18u, 18u, 17u, 15u, 13u, 14u, 14u, 12u, 12u, 13u, 14u, 16u, 21u, 29u, 38u, 41u, 46u, 55u, 68u, 82u, 91u, 100u, 104u, 112u, 122u, 131u, 134u, 132u, 134u, 140u, 144u, 151u, 158u, 165u, 174u, 182u, 193u }, 
-	{ 62u, 66u, 67u, 69u, 71u, 71u, 71u, 70u, 66u, 62u, 61u, 57u, 56u, 56u, 55u, 55u, 56u, 59u, 62u, 69u, 73u, 85u, 97u, 103u, 97u, 95u, 90u, 84u, 76u, 78u, 83u, 81u, 75u, 71u, 67u, 67u, 64u, 61u, 54u, 49u, 45u, 44u, 41u, 35u, 30u, 27u, 25u, 25u, 26u, 25u, 21u, 22u, 23u, 22u, 23u, 22u, 18u, 18u, 19u, 18u, 19u, 22u, 25u, 30u, 33u, 34u, 38u, 40u, 45u, 51u, 64u, 79u, 93u, 105u, 121u, 136u, 147u, 157u, 167u, 168u, 172u, 181u, 192u, 198u, 204u, 200u, 199u, 195u, 191u, 182u, 171u, 162u, 158u, 144u, 134u, 128u, 118u, 110u, 103u, 92u, 81u, 72u, 68u, 62u, 59u, 54u, 50u, 45u, 43u, 37u, 30u, 28u, 25u, 22u, 21u, 24u, 24u, 25u, 26u, 25u, 26u, 26u, 26u, 29u, 33u, 29u, 29u, 30u, 32u, 32u, 32u, 36u, 41u, 49u, 61u, 81u, 88u, 94u, 105u, 115u, 105u, 98u, 87u, 76u, 70u, 57u, 47u, 45u, 45u, 57u, 74u, 88u, 93u, 93u, 88u, 86u, 83u, 85u, 86u, 90u, 96u, 98u, 89u, 77u, 75u, 76u, 74u, 79u, 79u, 83u, 92u, 93u, 99u, 100u, 98u, 106u, 109u, 111u, 116u, 125u, 122u, 119u, 115u, 100u, 92u, 81u, 77u, 72u, 66u, 59u, 50u, 55u, 66u, 75u, 82u, 82u, 74u, 57u, 48u, 38u, 32u, 26u, 24u, 22u, 23u, 23u, 22u, 25u, 27u, 26u, 25u, 26u, 24u, 22u, 20u, 17u, 15u, 15u, 14u, 15u, 14u, 12u, 11u, 9u, 9u, 10u, 11u, 13u, 14u, 14u, 15u, 19u, 26u, 34u, 41u, 51u, 58u, 70u, 83u, 97u, 107u, 111u, 121u, 132u, 137u, 140u, 141u, 144u, 152u, 161u, 163u, 167u, 173u, 177u, 184u, 195u }, 
-	{ 60u, 63u, 66u, 68u, 70u, 72u, 72u, 72u, 67u, 64u, 62u, 58u, 58u, 58u, 59u, 60u, 60u, 63u, 67u, 77u, 83u, 95u, 113u, 111u, 104u, 102u, 100u, 90u, 87u, 86u, 88u, 93u, 89u, 81u, 75u, 71u, 63u, 58u, 53u, 46u, 48u, 47u, 40u, 34u, 29u, 25u, 23u, 25u, 25u, 23u, 22u, 22u, 20u, 18u, 19u, 20u, 19u, 20u, 21u, 21u, 23u, 31u, 32u, 35u, 38u, 37u, 40u, 44u, 48u, 59u, 68u, 77u, 87u, 101u, 118u, 132u, 151u, 160u, 166u, 171u, 178u, 190u, 194u, 197u, 205u, 205u, 201u, 198u, 194u, 189u, 177u, 170u, 166u, 154u, 138u, 131u, 116u, 107u, 96u, 86u, 74u, 73u, 71u, 67u, 60u, 52u, 48u, 42u, 43u, 37u, 31u, 27u, 25u, 19u, 18u, 19u, 19u, 20u, 22u, 21u, 24u, 24u, 25u, 27u, 28u, 25u, 24u, 26u, 30u, 30u, 33u, 39u, 44u, 48u, 55u, 68u, 74u, 84u, 95u, 107u, 99u, 88u, 80u, 70u, 67u, 57u, 50u, 44u, 49u, 63u, 76u, 83u, 79u, 68u, 70u, 69u, 67u, 77u, 76u, 81u, 83u, 84u, 85u, 78u, 74u, 77u, 77u, 81u, 80u, 87u, 97u, 96u, 99u, 98u, 101u, 112u, 120u, 123u, 124u, 123u, 117u, 118u, 119u, 114u, 104u, 91u, 85u, 79u, 73u, 63u, 57u, 62u, 69u, 75u, 79u, 81u, 78u, 64u, 52u, 42u, 34u, 29u, 25u, 24u, 25u, 25u, 25u, 26u, 28u, 25u, 24u, 23u, 20u, 18u, 17u, 15u, 13u, 12u, 13u, 13u, 13u, 11u, 10u, 8u, 8u, 9u, 11u, 14u, 14u, 13u, 13u, 18u, 26u, 35u, 47u, 56u, 63u, 76u, 86u, 100u, 110u, 116u, 122u, 134u, 142u, 144u, 147u, 155u, 161u, 168u, 173u, 175u, 182u, 188u, 193u, 200u }, 
-	{ 57u, 62u, 65u, 68u, 71u, 73u, 74u, 75u, 72u, 67u, 63u, 61u, 62u, 64u, 64u, 67u, 67u, 69u, 74u, 81u, 92u, 108u, 122u, 123u, 116u, 109u, 110u, 103u, 103u, 100u, 96u, 100u, 98u, 90u, 80u, 72u, 61u, 55u, 52u, 50u, 53u, 52u, 43u, 36u, 31u, 26u, 21u, 21u, 23u, 24u, 21u, 21u, 19u, 16u, 16u, 18u, 19u, 22u, 22u, 23u, 28u, 33u, 36u, 40u, 39u, 40u, 40u, 47u, 57u, 65u, 71u, 74u, 85u, 99u, 119u, 137u, 154u, 161u, 167u, 173u, 182u, 188u, 194u, 194u, 197u, 200u, 200u, 199u, 197u, 194u, 189u, 181u, 173u, 158u, 141u, 126u, 110u, 103u, 89u, 78u, 72u, 70u, 69u, 67u, 60u, 50u, 42u, 38u, 39u, 37u, 34u, 32u, 27u, 21u, 17u, 15u, 15u, 16u, 17u, 20u, 25u, 24u, 24u, 23u, 23u, 20u, 20u, 23u, 28u, 32u, 34u, 40u, 43u, 50u, 53u, 58u, 67u, 74u, 86u, 92u, 90u, 78u, 73u, 65u, 63u, 60u, 58u, 53u, 55u, 65u, 66u, 68u, 68u, 53u, 52u, 58u, 62u, 69u, 71u, 72u, 71u, 77u, 76u, 73u, 69u, 71u, 77u, 76u, 76u, 87u, 94u, 97u, 97u, 100u, 109u, 113u, 126u, 130u, 124u, 121u, 114u, 111u, 109u, 110u, 103u, 92u, 84u, 79u, 74u, 72u, 68u, 67u, 70u, 72u, 74u, 74u, 72u, 64u, 57u, 49u, 37u, 32u, 27u, 26u, 27u, 28u, 27u, 27u, 29u, 26u, 21u, 19u, 17u, 16u, 15u, 14u, 12u, 11u, 13u, 14u, 13u, 11u, 10u, 8u, 9u, 11u, 12u, 13u, 12u, 12u, 13u, 16u, 24u, 37u, 48u, 56u, 66u, 78u, 89u, 99u, 111u, 117u, 123u, 131u, 139u, 143u, 148u, 158u, 167u, 172u, 177u, 180u, 188u, 197u, 203u, 205u }, 
-	{ 56u, 60u, 64u, 68u, 70u, 73u, 74u, 75u, 74u, 70u, 66u, 64u, 67u, 71u, 72u, 73u, 75u, 77u, 83u, 90u, 102u, 112u, 124u, 130u, 128u, 121u, 115u, 109u, 113u, 110u, 102u, 101u, 99u, 90u, 78u, 69u, 58u, 54u, 56u, 55u, 56u, 54u, 44u, 36u, 31u, 28u, 23u, 21u, 22u, 24u, 22u, 20u, 19u, 16u, 16u, 17u, 18u, 19u, 20u, 24u, 30u, 33u, 39u, 43u, 39u, 38u, 43u, 55u, 66u, 73u, 76u, 79u, 90u, 103u, 123u, 139u, 153u, 165u, 170u, 176u, 190u, 195u, 199u, 198u, 195u, 200u, 205u, 211u, 209u, 203u, 197u, 190u, 178u, 157u, 137u, 120u, 112u, 101u, 82u, 70u, 65u, 61u, 63u, 62u, 54u, 44u, 37u, 38u, 38u, 36u, 33u, 30u, 24u, 22u, 20u, 19u, 18u, 18u, 19u, 23u, 27u, 24u, 26u, 24u, 20u, 18u, 17u, 19u, 24u, 32u, 37u, 41u, 44u, 52u, 53u, 60u, 65u, 69u, 84u, 84u, 82u, 76u, 70u, 62u, 61u, 58u, 54u, 55u, 58u, 62u, 56u, 56u, 52u, 42u, 48u, 58u, 64u, 67u, 66u, 65u, 71u, 78u, 73u, 64u, 58u, 60u, 66u, 69u, 75u, 85u, 87u, 87u, 91u, 98u, 107u, 113u, 129u, 137u, 131u, 124u, 110u, 108u, 111u, 109u, 101u, 87u, 78u, 72u, 70u, 73u, 73u, 69u, 64u, 62u, 67u, 63u, 57u, 56u, 56u, 48u, 39u, 37u, 34u, 33u, 33u, 30u, 27u, 26u, 26u, 25u, 22u, 18u, 15u, 15u, 14u, 13u, 12u, 11u, 13u, 13u, 12u, 12u, 10u, 9u, 10u, 12u, 12u, 12u, 11u, 13u, 15u, 16u, 22u, 34u, 43u, 50u, 60u, 72u, 86u, 90u, 99u, 108u, 117u, 125u, 132u, 140u, 149u, 161u, 173u, 182u, 186u, 189u, 195u, 203u, 211u, 215u }, 
-	{ 55u, 59u, 63u, 68u, 71u, 73u, 75u, 77u, 77u, 74u, 71u, 72u, 73u, 77u, 78u, 80u, 82u, 86u, 90u, 97u, 105u, 115u, 128u, 134u, 136u, 132u, 124u, 115u, 115u, 112u, 106u, 100u, 98u, 91u, 80u, 72u, 62u, 59u, 61u, 58u, 56u, 53u, 45u, 37u, 30u, 28u, 24u, 20u, 22u, 22u, 23u, 20u, 17u, 15u, 15u, 15u, 16u, 18u, 21u, 26u, 32u, 38u, 44u, 47u, 48u, 47u, 53u, 61u, 78u, 88u, 87u, 92u, 102u, 117u, 136u, 153u, 164u, 175u, 172u, 178u, 188u, 199u, 200u, 198u, 195u, 201u, 212u, 216u, 217u, 212u, 208u, 200u, 186u, 170u, 149u, 130u, 119u, 108u, 87u, 72u, 58u, 56u, 58u, 55u, 49u, 41u, 35u, 36u, 34u, 34u, 32u, 27u, 23u, 23u, 27u, 24u, 23u, 19u, 22u, 27u, 30u, 29u, 34u, 29u, 25u, 22u, 18u, 18u, 21u, 30u, 38u, 39u, 42u, 47u, 50u, 59u, 62u, 78u, 92u, 94u, 88u, 78u, 61u, 60u, 61u, 54u, 51u, 53u, 56u, 62u, 53u, 49u, 43u, 37u, 43u, 53u, 62u, 65u, 68u, 60u, 63u, 66u, 63u, 55u, 48u, 50u, 57u, 61u, 69u, 74u, 76u, 78u, 81u, 87u, 99u, 114u, 125u, 133u, 135u, 124u, 114u, 105u, 106u, 102u, 93u, 87u, 85u, 77u, 73u, 71u, 71u, 65u, 59u, 57u, 55u, 53u, 48u, 48u, 52u, 49u, 45u, 43u, 40u, 40u, 38u, 35u, 27u, 25u, 24u, 24u, 21u, 17u, 14u, 14u, 14u, 11u, 11u, 11u, 12u, 13u, 12u, 12u, 10u, 9u, 10u, 12u, 12u, 12u, 12u, 15u, 16u, 16u, 21u, 32u, 38u, 45u, 54u, 63u, 74u, 80u, 87u, 97u, 106u, 121u, 132u, 141u, 151u, 163u, 178u, 188u, 193u, 199u, 202u, 207u, 216u, 218u }, 
-	{ 54u, 59u, 64u, 68u, 72u, 75u, 77u, 79u, 80u, 79u, 77u, 79u, 80u, 82u, 84u, 86u, 89u, 92u, 97u, 101u, 110u, 120u, 129u, 137u, 139u, 136u, 131u, 129u, 125u, 116u, 108u, 107u, 101u, 92u, 85u, 76u, 67u, 63u, 62u, 60u, 57u, 51u, 44u, 38u, 30u, 27u, 25u, 21u, 20u, 22u, 21u, 18u, 15u, 14u, 14u, 14u, 15u, 18u, 23u, 29u, 36u, 43u, 48u, 50u, 58u, 62u, 67u, 73u, 84u, 94u, 95u, 104u, 119u, 133u, 145u, 164u, 178u, 181u, 177u, 178u, 184u, 198u, 200u, 196u, 192u, 193u, 206u, 215u, 217u, 219u, 222u, 210u, 199u, 186u, 159u, 138u, 123u, 112u, 92u, 76u, 62u, 54u, 52u, 53u, 46u, 37u, 32u, 31u, 29u, 28u, 27u, 23u, 21u, 28u, 31u, 28u, 25u, 23u, 27u, 32u, 36u, 36u, 37u, 33u, 31u, 25u, 21u, 21u, 24u, 29u, 38u, 40u, 45u, 44u, 44u, 53u, 67u, 78u, 91u, 90u, 84u, 66u, 54u, 49u, 50u, 50u, 52u, 50u, 50u, 56u, 55u, 53u, 48u, 37u, 39u, 55u, 65u, 65u, 67u, 58u, 52u, 54u, 52u, 46u, 42u, 39u, 42u, 49u, 57u, 61u, 69u, 73u, 77u, 84u, 93u, 104u, 115u, 123u, 130u, 126u, 117u, 104u, 100u, 97u, 90u, 86u, 83u, 79u, 77u, 71u, 63u, 60u, 60u, 55u, 46u, 45u, 48u, 47u, 47u, 49u, 50u, 50u, 48u, 47u, 42u, 37u, 29u, 25u, 22u, 21u, 19u, 15u, 13u, 12u, 12u, 11u, 12u, 12u, 11u, 13u, 12u, 12u, 11u, 10u, 12u, 14u, 15u, 14u, 14u, 16u, 16u, 16u, 23u, 32u, 35u, 41u, 48u, 54u, 64u, 73u, 76u, 86u, 100u, 117u, 132u, 141u, 153u, 167u, 180u, 192u, 201u, 207u, 210u, 214u, 220u, 222u }, 
-	{ 54u, 60u, 65u, 69u, 73u, 77u, 81u, 84u, 84u, 83u, 82u, 85u, 87u, 90u, 92u, 93u, 96u, 100u, 103u, 107u, 117u, 125u, 129u, 135u, 139u, 138u, 137u, 135u, 130u, 125u, 115u, 114u, 106u, 92u, 85u, 80u, 71u, 66u, 64u, 62u, 58u, 53u, 47u, 40u, 31u, 27u, 24u, 21u, 18u, 19u, 19u, 17u, 15u, 13u, 13u, 15u, 16u, 18u, 22u, 29u, 37u, 46u, 52u, 56u, 67u, 71u, 72u, 76u, 82u, 94u, 98u, 111u, 124u, 132u, 149u, 168u, 179u, 179u, 177u, 180u, 187u, 201u, 200u, 193u, 187u, 193u, 203u, 212u, 220u, 223u, 224u, 214u, 205u, 186u, 165u, 149u, 132u, 122u, 104u, 78u, 68u, 58u, 51u, 52u, 42u, 37u, 35u, 33u, 31u, 29u, 28u, 26u, 27u, 30u, 31u, 29u, 27u, 27u, 30u, 33u, 38u, 43u, 39u, 34u, 33u, 26u, 21u, 22u, 26u, 31u, 36u, 40u, 50u, 53u, 54u, 62u, 78u, 78u, 83u, 80u, 79u, 57u, 51u, 47u, 46u, 47u, 49u, 49u, 46u, 43u, 43u, 44u, 39u, 34u, 40u, 50u, 54u, 51u, 51u, 46u, 45u, 42u, 39u, 39u, 40u, 35u, 37u, 43u, 50u, 56u, 69u, 80u, 82u, 90u, 97u, 100u, 107u, 110u, 119u, 118u, 114u, 104u, 103u, 97u, 89u, 80u, 75u, 72u, 73u, 76u, 69u, 64u, 64u, 57u, 52u, 49u, 50u, 52u, 48u, 49u, 55u, 58u, 53u, 54u, 48u, 39u, 30u, 25u, 22u, 19u, 17u, 13u, 11u, 10u, 10u, 10u, 11u, 12u, 12u, 12u, 11u, 10u, 11u, 10u, 13u, 16u, 18u, 17u, 16u, 17u, 18u, 19u, 25u, 31u, 31u, 37u, 44u, 48u, 56u, 66u, 67u, 77u, 96u, 114u, 129u, 138u, 154u, 167u, 178u, 189u, 202u, 210u, 216u, 219u, 222u, 226u }, 
-	{ 54u, 60u, 65u, 70u, 75u, 79u, 84u, 88u, 88u, 87u, 87u, 89u, 92u, 95u, 98u, 98u, 99u, 104u, 107u, 113u, 120u, 128u, 131u, 136u, 141u, 142u, 142u, 140u, 134u, 131u, 124u, 118u, 105u, 92u, 87u, 83u, 77u, 72u, 66u, 64u, 59u, 52u, 48u, 40u, 31u, 26u, 23u, 20u, 18u, 18u, 17u, 17u, 16u, 13u, 13u, 14u, 16u, 18u, 24u, 29u, 40u, 50u, 61u, 67u, 77u, 82u, 83u, 83u, 88u, 100u, 108u, 122u, 129u, 141u, 156u, 172u, 176u, 170u, 175u, 187u, 204u, 207u, 206u, 197u, 195u, 197u, 203u, 214u, 218u, 228u, 227u, 218u, 206u, 188u, 173u, 151u, 139u, 122u, 107u, 84u, 75u, 68u, 56u, 52u, 42u, 35u, 38u, 35u, 32u, 28u, 27u, 27u, 32u, 35u, 35u, 32u, 32u, 33u, 34u, 35u, 39u, 43u, 42u, 38u, 34u, 30u, 28u, 30u, 30u, 34u, 41u, 46u, 56u, 60u, 64u, 72u, 81u, 84u, 82u, 77u, 71u, 57u, 51u, 50u, 53u, 55u, 50u, 45u, 38u, 36u, 34u, 35u, 30u, 29u, 32u, 42u, 41u, 39u, 38u, 35u, 35u, 33u, 33u, 34u, 34u, 33u, 32u, 38u, 45u, 55u, 66u, 81u, 88u, 94u, 98u, 102u, 107u, 108u, 113u, 115u, 111u, 107u, 101u, 93u, 81u, 74u, 72u, 68u, 74u, 83u, 76u, 70u, 63u, 59u, 57u, 51u, 51u, 50u, 55u, 56u, 60u, 63u, 64u, 61u, 53u, 39u, 31u, 23u, 20u, 17u, 14u, 10u, 9u, 8u, 8u, 9u, 10u, 11u, 11u, 10u, 10u, 10u, 10u, 10u, 12u, 16u, 21u, 19u, 17u, 17u, 18u, 20u, 24u, 28u, 30u, 34u, 41u, 45u, 51u, 59u, 67u, 74u, 90u, 105u, 121u, 136u, 151u, 166u, 178u, 188u, 199u, 210u, 217u, 221u, 225u, 227u }, 
-	{ 54u, 60u, 66u, 71u, 77u, 82u, 88u, 92u, 92u, 91u, 92u, 95u, 97u, 101u, 103u, 103u, 104u, 109u, 114u, 120u, 126u, 132u, 134u, 135u, 141u, 144u, 143u, 138u, 132u, 128u, 122u, 115u, 102u, 94u, 90u, 86u, 83u, 75u, 63u, 60u, 55u, 49u, 45u, 39u, 31u, 27u, 24u, 23u, 20u, 17u, 16u, 17u, 17u, 15u, 14u, 14u, 16u, 18u, 23u, 30u, 40u, 52u, 63u, 75u, 87u, 89u, 94u, 93u, 92u, 106u, 122u, 130u, 139u, 152u, 156u, 168u, 170u, 175u, 182u, 191u, 205u, 211u, 205u, 204u, 204u, 209u, 213u, 225u, 226u, 232u, 236u, 224u, 204u, 186u, 169u, 151u, 139u, 124u, 112u, 100u, 93u, 79u, 63u, 55u, 44u, 40u, 42u, 37u, 30u, 25u, 27u, 27u, 29u, 35u, 32u, 29u, 32u, 32u, 33u, 37u, 44u, 46u, 49u, 46u, 40u, 40u, 45u, 46u, 42u, 45u, 49u, 55u, 64u, 68u, 72u, 82u, 87u, 89u, 86u, 76u, 66u, 53u, 52u, 53u, 52u, 57u, 53u, 40u, 31u, 28u, 32u, 31u, 24u, 22u, 24u, 32u, 30u, 29u, 29u, 29u, 28u, 26u, 26u, 28u, 31u, 30u, 29u, 33u, 39u, 53u, 63u, 76u, 88u, 95u, 97u, 102u, 106u, 108u, 112u, 111u, 109u, 101u, 92u, 85u, 77u, 70u, 68u, 72u, 80u, 85u, 87u, 83u, 73u, 66u, 61u, 56u, 51u, 55u, 61u, 63u, 62u, 65u, 68u, 65u, 55u, 39u, 29u, 22u, 18u, 16u, 13u, 10u, 9u, 8u, 8u, 9u, 10u, 11u, 11u, 10u, 10u, 10u, 10u, 11u, 14u, 17u, 20u, 18u, 16u, 17u, 20u, 21u, 22u, 26u, 28u, 33u, 39u, 44u, 50u, 58u, 67u, 73u, 85u, 99u, 112u, 129u, 145u, 159u, 174u, 184u, 197u, 207u, 214u, 221u, 226u, 229u }, 
-	{ 55u, 61u, 68u, 73u, 79u, 86u, 92u, 97u, 98u, 97u, 97u, 100u, 102u, 105u, 108u, 109u, 111u, 114u, 120u, 127u, 132u, 136u, 137u, 138u, 140u, 145u, 143u, 137u, 130u, 120u, 117u, 112u, 105u, 100u, 90u, 84u, 81u, 71u, 62u, 57u, 52u, 46u, 44u, 36u, 28u, 27u, 27u, 25u, 21u, 19u, 17u, 19u, 19u, 19u, 16u, 15u, 17u, 18u, 23u, 29u, 38u, 49u, 56u, 72u, 88u, 91u, 98u, 100u, 103u, 112u, 127u, 136u, 144u, 149u, 153u, 164u, 167u, 181u, 191u, 199u, 201u, 212u, 213u, 214u, 210u, 216u, 223u, 238u, 240u, 239u, 237u, 227u, 204u, 187u, 167u, 154u, 136u, 130u, 125u, 115u, 108u, 88u, 72u, 60u, 49u, 41u, 41u, 38u, 31u, 28u, 27u, 26u, 27u, 29u, 27u, 27u, 33u, 34u, 35u, 37u, 44u, 43u, 49u, 46u, 44u, 46u, 53u, 59u, 54u, 52u, 57u, 63u, 75u, 81u, 84u, 94u, 98u, 97u, 90u, 79u, 69u, 65u, 62u, 57u, 56u, 56u, 47u, 32u, 27u, 25u, 30u, 25u, 18u, 16u, 18u, 22u, 19u, 19u, 20u, 23u, 23u, 22u, 22u, 24u, 27u, 25u, 25u, 30u, 37u, 49u, 58u, 70u, 82u, 91u, 93u, 96u, 99u, 101u, 106u, 105u, 108u, 100u, 96u, 88u, 84u, 75u, 70u, 77u, 78u, 81u, 92u, 92u, 81u, 73u, 67u, 66u, 59u, 60u, 59u, 55u, 54u, 61u, 62u, 60u, 52u, 38u, 28u, 22u, 17u, 15u, 12u, 9u, 9u, 8u, 8u, 9u, 10u, 11u, 11u, 9u, 9u, 9u, 10u, 11u, 13u, 16u, 17u, 16u, 17u, 19u, 21u, 23u, 24u, 25u, 26u, 33u, 36u, 40u, 44u, 54u, 64u, 74u, 81u, 94u, 109u, 125u, 137u, 154u, 172u, 184u, 195u, 205u, 212u, 220u, 225u, 230u }, 
-	{ 58u, 64u, 70u, 76u, 82u, 88u, 95u, 99u, 101u, 101u, 102u, 104u, 106u, 109u, 111u, 113u, 115u, 120u, 125u, 130u, 136u, 138u, 139u, 140u, 141u, 145u, 142u, 135u, 128u, 116u, 109u, 107u, 104u, 95u, 90u, 82u, 71u, 67u, 60u, 55u, 49u, 45u, 42u, 35u, 31u, 30u, 29u, 26u, 22u, 20u, 19u, 20u, 21u, 21u, 19u, 18u, 19u, 20u, 24u, 31u, 36u, 41u, 50u, 66u, 80u, 87u, 99u, 107u, 112u, 118u, 133u, 145u, 150u, 153u, 158u, 165u, 173u, 184u, 197u, 200u, 204u, 208u, 212u, 210u, 213u, 225u, 233u, 241u, 241u, 245u, 237u, 225u, 204u, 190u, 178u, 158u, 144u, 142u, 135u, 129u, 117u, 98u, 82u, 68u, 55u, 45u, 44u, 40u, 33u, 32u, 29u, 27u, 24u, 25u, 24u, 29u, 37u, 42u, 41u, 42u, 43u, 44u, 51u, 53u, 47u, 51u, 58u, 61u, 65u, 66u, 71u, 72u, 76u, 80u, 97u, 109u, 111u, 103u, 93u, 83u, 76u, 75u, 70u, 62u, 57u, 50u, 42u, 30u, 26u, 20u, 20u, 22u, 17u, 13u, 13u, 14u, 13u, 12u, 14u, 18u, 20u, 18u, 18u, 19u, 22u, 24u, 24u, 26u, 33u, 44u, 54u, 65u, 79u, 88u, 91u, 91u, 97u, 97u, 95u, 99u, 104u, 104u, 98u, 92u, 85u, 79u, 77u, 77u, 78u, 85u, 94u, 96u, 94u, 83u, 82u, 73u, 69u, 67u, 59u, 50u, 52u, 59u, 61u, 56u, 47u, 35u, 26u, 23u, 18u, 15u, 12u, 10u, 9u, 7u, 7u, 9u, 10u, 10u, 10u, 8u, 9u, 8u, 9u, 11u, 13u, 15u, 15u, 16u, 18u, 21u, 21u, 22u, 26u, 25u, 25u, 30u, 34u, 38u, 44u, 53u, 59u, 68u, 79u, 89u, 102u, 117u, 132u, 151u, 169u, 184u, 194u, 204u, 213u, 219u, 225u, 230u }, 
-	{ 59u, 65u, 71u, 77u, 83u, 89u, 96u, 100u, 103u, 105u, 105u, 107u, 108u, 111u, 114u, 116u, 119u, 124u, 129u, 131u, 135u, 139u, 140u, 139u, 141u, 143u, 139u, 136u, 132u, 121u, 109u, 102u, 100u, 92u, 90u, 83u, 69u, 64u, 60u, 55u, 48u, 46u, 44u, 40u, 35u, 33u, 29u, 26u, 23u, 20u, 20u, 20u, 22u, 22u, 20u, 20u, 21u, 24u, 27u, 33u, 38u, 45u, 56u, 70u, 81u, 89u, 100u, 113u, 120u, 132u, 145u, 155u, 157u, 162u, 171u, 175u, 184u, 195u, 201u, 199u, 203u, 201u, 201u, 203u, 211u, 222u, 235u, 242u, 242u, 247u, 240u, 218u, 204u, 201u, 189u, 175u, 168u, 156u, 144u, 132u, 123u, 106u, 92u, 79u, 67u, 54u, 52u, 48u, 41u, 40u, 38u, 35u, 30u, 25u, 22u, 27u, 38u, 45u, 49u, 47u, 47u, 52u, 54u, 55u, 50u, 52u, 56u, 58u, 64u, 75u, 81u, 79u, 78u, 83u, 106u, 115u, 108u, 102u, 102u, 91u, 84u, 76u, 66u, 58u, 51u, 42u, 35u, 29u, 26u, 24u, 20u, 18u, 18u, 14u, 12u, 11u, 10u, 10u, 11u, 13u, 15u, 15u, 16u, 16u, 17u, 17u, 22u, 23u, 30u, 37u, 48u, 63u, 71u, 77u, 82u, 83u, 88u, 88u, 88u, 93u, 92u, 94u, 91u, 89u, 86u, 87u, 83u, 80u, 82u, 88u, 97u, 101u, 103u, 95u, 95u, 87u, 75u, 64u, 56u, 54u, 60u, 67u, 63u, 55u, 47u, 38u, 31u, 27u, 21u, 16u, 12u, 10u, 9u, 7u, 6u, 7u, 8u, 9u, 8u, 8u, 9u, 8u, 8u, 9u, 10u, 12u, 14u, 16u, 17u, 18u, 18u, 19u, 23u, 26u, 28u, 29u, 32u, 37u, 47u, 52u, 56u, 63u, 73u, 81u, 96u, 113u, 131u, 150u, 169u, 183u, 194u, 204u, 212u, 217u, 222u, 226u }, 
-	{ 61u, 66u, 71u, 78u, 84u, 90u, 97u, 101u, 104u, 105u, 108u, 108u, 110u, 113u, 117u, 119u, 121u, 125u, 130u, 134u, 136u, 139u, 139u, 139u, 141u, 140u, 138u, 134u, 129u, 122u, 110u, 103u, 96u, 92u, 88u, 82u, 71u, 66u, 63u, 60u, 54u, 51u, 49u, 42u, 37u, 37u, 32u, 29u, 25u, 22u, 23u, 25u, 27u, 28u, 25u, 25u, 24u, 26u, 30u, 36u, 41u, 53u, 64u, 73u, 86u, 93u, 104u, 122u, 132u, 146u, 152u, 160u, 155u, 164u, 173u, 175u, 189u, 202u, 209u, 211u, 212u, 205u, 203u, 202u, 208u, 222u, 236u, 240u, 240u, 237u, 228u, 214u, 207u, 202u, 188u, 181u, 175u, 164u, 159u, 144u, 134u, 113u, 102u, 87u, 80u, 66u, 61u, 55u, 44u, 41u, 39u, 35u, 31u, 26u, 22u, 26u, 33u, 38u, 42u, 46u, 51u, 52u, 52u, 56u, 51u, 56u, 62u, 64u, 66u, 82u, 81u, 79u, 82u, 93u, 113u, 120u, 109u, 108u, 102u, 90u, 78u, 68u, 56u, 49u, 43u, 39u, 35u, 36u, 32u, 30u, 23u, 16u, 13u, 12u, 11u, 11u, 12u, 10u, 11u, 10u, 13u, 14u, 13u, 14u, 14u, 14u, 17u, 22u, 29u, 34u, 43u, 55u, 65u, 74u, 78u, 79u, 76u, 79u, 83u, 86u, 85u, 87u, 85u, 83u, 83u, 89u, 92u, 89u, 93u, 94u, 103u, 105u, 105u, 101u, 102u, 102u, 82u, 69u, 58u, 57u, 60u, 63u, 57u, 49u, 47u, 41u, 36u, 31u, 26u, 19u, 15u, 11u, 8u, 5u, 5u, 6u, 7u, 8u, 7u, 7u, 7u, 8u, 8u, 8u, 9u, 11u, 14u, 15u, 14u, 14u, 13u, 15u, 19u, 24u, 31u, 31u, 34u, 40u, 47u, 52u, 58u, 65u, 77u, 84u, 95u, 111u, 132u, 149u, 169u, 184u, 196u, 203u, 210u, 214u, 217u, 220u }, 
-	{ 63u, 67u, 72u, 79u, 85u, 92u, 98u, 102u, 105u, 106u, 108u, 108u, 110u, 114u, 117u, 120u, 124u, 128u, 132u, 135u, 139u, 140u, 140u, 139u, 139u, 139u, 134u, 130u, 124u, 119u, 110u, 99u, 91u, 90u, 85u, 81u, 74u, 68u, 64u, 64u, 59u, 53u, 50u, 45u, 44u, 41u, 38u, 33u, 30u, 26u, 26u, 30u, 33u, 33u, 31u, 31u, 28u, 30u, 35u, 41u, 46u, 56u, 68u, 74u, 84u, 93u, 104u, 121u, 139u, 148u, 158u, 164u, 162u, 167u, 179u, 182u, 191u, 204u, 218u, 222u, 214u, 203u, 203u, 203u, 209u, 225u, 231u, 239u, 238u, 227u, 217u, 209u, 213u, 204u, 187u, 180u, 173u, 171u, 166u, 148u, 128u, 116u, 109u, 93u, 82u, 71u, 59u, 58u, 49u, 41u, 41u, 35u, 31u, 25u, 20u, 21u, 23u, 28u, 34u, 38u, 41u, 47u, 53u, 59u, 58u, 61u, 68u, 67u, 72u, 88u, 86u, 90u, 102u, 110u, 117u, 119u, 111u, 104u, 97u, 88u, 77u, 63u, 55u, 46u, 43u, 43u, 40u, 40u, 37u, 33u, 23u, 14u, 10u, 10u, 11u, 11u, 12u, 10u, 9u, 8u, 10u, 10u, 12u, 12u, 12u, 14u, 15u, 19u, 29u, 35u, 40u, 51u, 63u, 71u, 78u, 74u, 68u, 67u, 72u, 73u, 74u, 74u, 74u, 73u, 77u, 83u, 89u, 91u, 98u, 100u, 104u, 102u, 99u, 106u, 109u, 99u, 87u, 76u, 67u, 61u, 60u, 57u, 54u, 49u, 47u, 43u, 36u, 33u, 27u, 20u, 16u, 12u, 7u, 5u, 4u, 5u, 6u, 6u, 7u, 8u, 7u, 7u, 8u, 8u, 9u, 11u, 12u, 14u, 14u, 13u, 10u, 13u, 17u, 22u, 29u, 31u, 35u, 40u, 47u, 55u, 63u, 69u, 80u, 91u, 99u, 117u, 136u, 151u, 164u, 179u, 193u, 199u, 204u, 208u, 209u, 213u }, 
-	{ 64u, 69u, 73u, 80u, 88u, 95u, 99u, 103u, 105u, 104u, 107u, 108u, 111u, 116u, 120u, 123u, 129u, 133u, 135u, 136u, 138u, 139u, 139u, 137u, 137u, 136u, 132u, 129u, 123u, 117u, 107u, 94u, 93u, 94u, 88u, 79u, 73u, 70u, 64u, 63u, 58u, 53u, 52u, 51u, 51u, 45u, 40u, 35u, 33u, 32u, 32u, 35u, 36u, 35u, 34u, 34u, 32u, 31u, 35u, 41u, 50u, 57u, 67u, 73u, 83u, 91u, 103u, 120u, 135u, 140u, 151u, 163u, 171u, 178u, 186u, 192u, 200u, 209u, 221u, 224u, 218u, 207u, 204u, 204u, 211u, 221u, 221u, 225u, 222u, 207u, 201u, 200u, 205u, 189u, 175u, 170u, 173u, 174u, 165u, 145u, 123u, 116u, 114u, 97u, 86u, 72u, 59u, 58u, 50u, 42u, 39u, 35u, 31u, 27u, 23u, 20u, 22u, 27u, 33u, 37u, 37u, 41u, 48u, 56u, 58u, 63u, 74u, 83u, 93u, 107u, 111u, 117u, 123u, 124u, 122u, 124u, 116u, 102u, 93u, 84u, 70u, 55u, 48u, 39u, 38u, 38u, 35u, 34u, 30u, 26u, 19u, 14u, 12u, 10u, 10u, 10u, 10u, 8u, 6u, 5u, 7u, 8u, 10u, 11u, 11u, 12u, 14u, 18u, 27u, 35u, 40u, 49u, 56u, 61u, 69u, 67u, 62u, 60u, 59u, 59u, 61u, 61u, 63u, 63u, 68u, 78u, 86u, 93u, 99u, 97u, 97u, 98u, 92u, 96u, 103u, 97u, 96u, 85u, 74u, 63u, 59u, 55u, 49u, 44u, 42u, 40u, 35u, 36u, 31u, 23u, 17u, 14u, 8u, 5u, 4u, 4u, 5u, 5u, 6u, 7u, 7u, 8u, 7u, 7u, 9u, 10u, 10u, 11u, 12u, 10u, 11u, 14u, 17u, 20u, 24u, 30u, 34u, 41u, 49u, 58u, 68u, 77u, 83u, 93u, 101u, 116u, 134u, 152u, 161u, 170u, 180u, 186u, 193u, 199u, 203u, 207u }, 
-	{ 67u, 70u, 76u, 83u, 90u, 96u, 100u, 103u, 104u, 104u, 107u, 108u, 111u, 115u, 119u, 123u, 131u, 136u, 139u, 138u, 138u, 138u, 138u, 137u, 136u, 132u, 130u, 127u, 124u, 119u, 109u, 99u, 93u, 92u, 87u, 81u, 75u, 73u, 68u, 61u, 61u, 60u, 56u, 56u, 55u, 48u, 44u, 41u, 40u, 38u, 39u, 42u, 42u, 38u, 38u, 38u, 37u, 34u, 38u, 42u, 50u, 55u, 65u, 69u, 78u, 83u, 94u, 107u, 122u, 130u, 147u, 164u, 173u, 178u, 188u, 198u, 203u, 208u, 213u, 221u, 220u, 214u, 212u, 210u, 216u, 215u, 214u, 211u, 211u, 196u, 193u, 190u, 192u, 182u, 175u, 165u, 167u, 171u, 168u, 155u, 135u, 127u, 116u, 99u, 81u, 68u, 60u, 54u, 45u, 37u, 35u, 36u, 30u, 27u, 26u, 21u, 22u, 26u, 32u, 36u, 35u, 40u, 46u, 54u, 61u, 70u, 84u, 92u, 107u, 118u, 125u, 124u, 133u, 133u, 125u, 121u, 113u, 97u, 82u, 77u, 59u, 48u, 45u, 38u, 33u, 32u, 27u, 27u, 26u, 25u, 22u, 15u, 11u, 11u, 11u, 11u, 9u, 6u, 4u, 4u, 5u, 7u, 9u, 11u, 11u, 11u, 13u, 20u, 28u, 34u, 39u, 43u, 45u, 52u, 58u, 62u, 61u, 55u, 48u, 48u, 48u, 48u, 51u, 57u, 64u, 73u, 79u, 91u, 95u, 94u, 96u, 91u, 90u, 87u, 92u, 96u, 97u, 89u, 78u, 69u, 58u, 54u, 47u, 41u, 40u, 40u, 39u, 39u, 32u, 24u, 17u, 12u, 7u, 4u, 2u, 3u, 3u, 3u, 5u, 6u, 6u, 7u, 7u, 7u, 8u, 9u, 10u, 11u, 11u, 11u, 13u, 16u, 20u, 21u, 21u, 27u, 32u, 43u, 51u, 60u, 73u, 76u, 82u, 94u, 103u, 113u, 132u, 146u, 155u, 162u, 171u, 174u, 180u, 187u, 194u, 202u }, 
-	{ 69u, 73u, 77u, 85u, 90u, 94u, 100u, 102u, 103u, 106u, 108u, 108u, 111u, 114u, 118u, 122u, 131u, 138u, 144u, 142u, 139u, 137u, 138u, 137u, 134u, 131u, 128u, 127u, 123u, 118u, 109u, 98u, 95u, 92u, 86u, 80u, 77u, 71u, 66u, 58u, 62u, 65u, 60u, 57u, 56u, 53u, 48u, 48u, 46u, 45u, 49u, 49u, 47u, 44u, 45u, 44u, 44u, 40u, 40u, 45u, 51u, 57u, 65u, 72u, 75u, 80u, 91u, 100u, 113u, 129u, 144u, 163u, 175u, 174u, 177u, 194u, 204u, 208u, 211u, 211u, 211u, 216u, 216u, 215u, 217u, 211u, 206u, 205u, 202u, 195u, 191u, 186u, 179u, 179u, 168u, 166u, 163u, 163u, 161u, 158u, 141u, 126u, 106u, 92u, 79u, 67u, 53u, 48u, 39u, 32u, 31u, 33u, 30u, 28u, 28u, 22u, 22u, 26u, 30u, 35u, 39u, 43u, 52u, 58u, 67u, 78u, 90u, 101u, 116u, 125u, 130u, 133u, 126u, 128u, 120u, 107u, 99u, 93u, 78u, 67u, 54u, 47u, 45u, 39u, 33u, 27u, 23u, 21u, 23u, 23u, 21u, 15u, 12u, 10u, 10u, 9u, 7u, 4u, 4u, 3u, 4u, 5u, 8u, 13u, 14u, 13u, 15u, 20u, 28u, 34u, 35u, 35u, 40u, 44u, 49u, 56u, 58u, 52u, 45u, 44u, 44u, 44u, 46u, 54u, 59u, 70u, 73u, 80u, 87u, 90u, 93u, 87u, 84u, 79u, 83u, 93u, 95u, 80u, 75u, 72u, 61u, 51u, 47u, 41u, 39u, 42u, 46u, 40u, 30u, 22u, 16u, 10u, 6u, 4u, 2u, 2u, 2u, 3u, 4u, 5u, 5u, 6u, 7u, 7u, 8u, 9u, 12u, 13u, 14u, 15u, 19u, 21u, 22u, 23u, 23u, 25u, 31u, 41u, 51u, 61u, 69u, 73u, 83u, 95u, 106u, 112u, 126u, 138u, 148u, 156u, 163u, 167u, 174u, 179u, 185u, 194u }, 
-	{ 69u, 71u, 77u, 85u, 88u, 91u, 98u, 102u, 104u, 109u, 109u, 109u, 113u, 116u, 120u, 124u, 131u, 139u, 146u, 144u, 139u, 137u, 137u, 135u, 134u, 131u, 129u, 129u, 126u, 121u, 111u, 99u, 93u, 91u, 86u, 77u, 78u, 75u, 68u, 59u, 62u, 70u, 69u, 69u, 66u, 60u, 52u, 54u, 52u, 50u, 56u, 56u, 52u, 50u, 53u, 55u, 55u, 46u, 42u, 47u, 55u, 61u, 68u, 75u, 78u, 86u, 92u, 96u, 109u, 127u, 139u, 156u, 167u, 164u, 169u, 185u, 196u, 206u, 209u, 200u, 197u, 206u, 204u, 209u, 215u, 210u, 202u, 194u, 184u, 180u, 180u, 185u, 172u, 161u, 158u, 162u, 157u, 155u, 153u, 149u, 130u, 108u, 94u, 85u, 75u, 64u, 46u, 37u, 35u, 32u, 31u, 33u, 32u, 32u, 30u, 23u, 24u, 29u, 34u, 39u, 44u, 49u, 59u, 67u, 78u, 96u, 110u, 121u, 132u, 138u, 134u, 136u, 129u, 125u, 114u, 102u, 86u, 79u, 64u, 53u, 45u, 41u, 42u, 39u, 32u, 25u, 22u, 18u, 19u, 18u, 17u, 14u, 10u, 7u, 7u, 7u, 5u, 2u, 2u, 2u, 3u, 4u, 8u, 11u, 16u, 17u, 18u, 20u, 28u, 33u, 34u, 34u, 39u, 42u, 44u, 49u, 52u, 49u, 45u, 44u, 43u, 45u, 49u, 56u, 60u, 64u, 68u, 74u, 80u, 84u, 89u, 88u, 87u, 83u, 86u, 92u, 87u, 77u, 77u, 73u, 70u, 60u, 51u, 43u, 38u, 40u, 46u, 38u, 30u, 21u, 16u, 8u, 5u, 3u, 3u, 2u, 2u, 2u, 2u, 3u, 5u, 6u, 7u, 8u, 9u, 11u, 14u, 18u, 20u, 22u, 22u, 22u, 22u, 24u, 24u, 24u, 28u, 36u, 46u, 58u, 66u, 72u, 84u, 93u, 102u, 108u, 121u, 132u, 141u, 149u, 158u, 163u, 167u, 173u, 177u, 183u }, 
-	{ 65u, 70u, 77u, 84u, 87u, 88u, 95u, 101u, 104u, 109u, 110u, 111u, 112u, 115u, 119u, 126u, 134u, 139u, 145u, 141u, 139u, 135u, 135u, 133u, 132u, 131u, 130u, 128u, 129u, 122u, 113u, 102u, 96u, 92u, 88u, 81u, 79u, 78u, 75u, 72u, 68u, 74u, 77u, 79u, 77u, 69u, 61u, 57u, 55u, 58u, 61u, 63u, 61u, 61u, 65u, 66u, 65u, 58u, 54u, 53u, 57u, 66u, 73u, 81u, 82u, 87u, 95u, 96u, 107u, 122u, 133u, 146u, 154u, 158u, 162u, 169u, 183u, 191u, 196u, 190u, 190u, 198u, 197u, 205u, 204u, 202u, 202u, 190u, 176u, 169u, 172u, 174u, 167u, 157u, 157u, 148u, 142u, 138u, 137u, 132u, 114u, 99u, 82u, 75u, 66u, 52u, 38u, 28u, 27u, 26u, 28u, 29u, 32u, 35u, 33u, 31u, 30u, 32u, 38u, 44u, 48u, 56u, 63u, 76u, 89u, 105u, 114u, 126u, 131u, 136u, 135u, 128u, 124u, 120u, 108u, 95u, 80u, 72u, 57u, 44u, 43u, 42u, 40u, 38u, 29u, 25u, 19u, 14u, 14u, 13u, 13u, 13u, 12u, 9u, 7u, 5u, 4u, 2u, 1u, 2u, 2u, 3u, 5u, 9u, 15u, 20u, 23u, 25u, 28u, 33u, 34u, 35u, 38u, 43u, 45u, 45u, 51u, 49u, 46u, 41u, 40u, 45u, 52u, 59u, 67u, 68u, 68u, 73u, 80u, 82u, 85u, 87u, 86u, 88u, 92u, 92u, 88u, 80u, 78u, 79u, 76u, 66u, 55u, 46u, 44u, 45u, 48u, 40u, 31u, 20u, 14u, 8u, 5u, 4u, 4u, 3u, 3u, 3u, 3u, 4u, 5u, 6u, 7u, 9u, 10u, 12u, 17u, 23u, 24u, 28u, 27u, 26u, 25u, 27u, 25u, 25u, 28u, 35u, 44u, 53u, 63u, 71u, 79u, 92u, 102u, 108u, 115u, 124u, 131u, 142u, 151u, 154u, 160u, 164u, 168u, 173u }, 
-	{ 63u, 68u, 75u, 79u, 80u, 82u, 88u, 94u, 99u, 107u, 109u, 110u, 109u, 109u, 118u, 129u, 138u, 139u, 142u, 139u, 138u, 133u, 133u, 132u, 132u, 132u, 130u, 127u, 125u, 121u, 114u, 105u, 98u, 94u, 93u, 82u, 78u, 77u, 76u, 76u, 77u, 81u, 87u, 86u, 83u, 79u, 72u, 64u, 61u, 66u, 68u, 70u, 70u, 72u, 79u, 77u, 74u, 73u, 70u, 68u, 68u, 74u, 80u, 86u, 88u, 95u, 96u, 97u, 104u, 118u, 128u, 136u, 147u, 153u, 154u, 161u, 170u, 176u, 180u, 177u, 181u, 191u, 192u, 207u, 205u, 194u, 196u, 193u, 182u, 163u, 152u, 155u, 154u, 151u, 152u, 142u, 136u, 131u, 129u, 119u, 109u, 93u, 72u, 63u, 49u, 37u, 29u, 23u, 22u, 22u, 22u, 24u, 30u, 35u, 38u, 38u, 35u, 37u, 40u, 45u, 52u, 61u, 67u, 78u, 92u, 109u, 117u, 129u, 128u, 125u, 125u, 122u, 117u, 108u, 98u, 87u, 76u, 65u, 55u, 44u, 41u, 41u, 41u, 40u, 29u, 23u, 17u, 12u, 10u, 11u, 10u, 11u, 13u, 12u, 9u, 6u, 3u, 2u, 1u, 1u, 1u, 2u, 4u, 9u, 13u, 17u, 23u, 25u, 28u, 30u, 31u, 33u, 36u, 41u, 43u, 43u, 46u, 46u, 42u, 39u, 41u, 46u, 53u, 59u, 67u, 69u, 72u, 78u, 80u, 82u, 84u, 87u, 84u, 84u, 90u, 91u, 91u, 82u, 74u, 77u, 76u, 67u, 57u, 54u, 50u, 50u, 49u, 40u, 30u, 19u, 11u, 8u, 5u, 3u, 3u, 3u, 3u, 4u, 4u, 4u, 5u, 6u, 6u, 9u, 12u, 16u, 22u, 29u, 31u, 35u, 32u, 28u, 27u, 28u, 25u, 27u, 29u, 33u, 40u, 49u, 59u, 65u, 77u, 90u, 100u, 104u, 113u, 118u, 125u, 137u, 143u, 145u, 149u, 154u, 161u, 168u }, 
-	{ 62u, 67u, 71u, 71u, 72u, 75u, 81u, 89u, 95u, 103u, 107u, 109u, 108u, 110u, 120u, 130u, 140u, 141u, 141u, 137u, 135u, 131u, 131u, 130u, 129u, 128u, 124u, 121u, 118u, 114u, 109u, 104u, 101u, 96u, 94u, 88u, 84u, 82u, 79u, 80u, 82u, 84u, 92u, 93u, 89u, 84u, 73u, 69u, 67u, 72u, 71u, 72u, 74u, 80u, 85u, 88u, 85u, 83u, 80u, 79u, 78u, 79u, 85u, 101u, 106u, 104u, 104u, 107u, 111u, 117u, 125u, 136u, 145u, 148u, 153u, 158u, 161u, 167u, 170u, 171u, 172u, 185u, 198u, 211u, 206u, 197u, 194u, 189u, 184u, 164u, 149u, 139u, 136u, 133u, 139u, 140u, 135u, 125u, 124u, 114u, 107u, 92u, 68u, 55u, 40u, 31u, 27u, 21u, 19u, 20u, 22u, 25u, 31u, 35u, 37u, 37u, 37u, 41u, 43u, 45u, 53u, 63u, 71u, 81u, 94u, 114u, 125u, 128u, 125u, 125u, 127u, 126u, 112u, 96u, 89u, 78u, 70u, 59u, 50u, 42u, 38u, 41u, 40u, 38u, 30u, 24u, 18u, 13u, 9u, 8u, 8u, 8u, 9u, 10u, 9u, 6u, 4u, 2u, 2u, 1u, 1u, 2u, 4u, 6u, 9u, 14u, 21u, 24u, 26u, 27u, 29u, 32u, 36u, 39u, 38u, 39u, 40u, 41u, 37u, 38u, 40u, 46u, 56u, 63u, 69u, 72u, 71u, 75u, 81u, 79u, 77u, 79u, 79u, 84u, 85u, 87u, 86u, 85u, 75u, 72u, 69u, 62u, 58u, 60u, 53u, 53u, 46u, 35u, 24u, 17u, 11u, 7u, 5u, 4u, 3u, 2u, 2u, 4u, 3u, 4u, 6u, 7u, 7u, 10u, 13u, 18u, 24u, 32u, 34u, 38u, 37u, 31u, 33u, 32u, 28u, 27u, 30u, 32u, 36u, 40u, 50u, 63u, 80u, 91u, 103u, 104u, 112u, 115u, 118u, 128u, 135u, 142u, 147u, 151u, 157u, 165u }, 
-	{ 62u, 63u, 63u, 63u, 66u, 69u, 74u, 82u, 90u, 96u, 100u, 105u, 107u, 110u, 120u, 128u, 135u, 139u, 138u, 136u, 129u, 128u, 128u, 129u, 126u, 125u, 120u, 117u, 113u, 110u, 108u, 103u, 101u, 95u, 92u, 89u, 85u, 85u, 81u, 82u, 80u, 81u, 84u, 90u, 92u, 87u, 82u, 76u, 76u, 80u, 80u, 79u, 82u, 89u, 94u, 94u, 92u, 91u, 85u, 89u, 93u, 93u, 96u, 110u, 122u, 112u, 110u, 112u, 114u, 116u, 123u, 132u, 143u, 146u, 152u, 149u, 154u, 163u, 165u, 169u, 177u, 190u, 207u, 214u, 212u, 202u, 191u, 180u, 176u, 166u, 141u, 127u, 128u, 124u, 125u, 135u, 134u, 124u, 119u, 107u, 92u, 83u, 62u, 48u, 35u, 31u, 26u, 24u, 21u, 20u, 24u, 30u, 32u, 36u, 38u, 39u, 40u, 43u, 45u, 47u, 55u, 63u, 71u, 83u, 94u, 114u, 124u, 131u, 125u, 126u, 130u, 123u, 107u, 88u, 86u, 79u, 63u, 56u, 47u, 38u, 36u, 39u, 41u, 35u, 29u, 23u, 18u, 14u, 9u, 6u, 6u, 7u, 7u, 7u, 7u, 7u, 4u, 3u, 2u, 1u, 2u, 3u, 3u, 5u, 7u, 12u, 18u, 25u, 25u, 25u, 31u, 36u, 40u, 39u, 37u, 37u, 36u, 37u, 40u, 42u, 43u, 48u, 57u, 66u, 69u, 73u, 74u, 76u, 80u, 79u, 72u, 73u, 73u, 77u, 80u, 81u, 80u, 80u, 68u, 66u, 61u, 57u, 53u, 53u, 51u, 49u, 41u, 31u, 23u, 16u, 11u, 8u, 6u, 4u, 2u, 2u, 2u, 3u, 4u, 4u, 6u, 7u, 9u, 12u, 14u, 19u, 28u, 33u, 38u, 39u, 41u, 39u, 38u, 33u, 33u, 32u, 34u, 36u, 37u, 37u, 45u, 58u, 75u, 93u, 105u, 112u, 114u, 118u, 116u, 122u, 128u, 137u, 145u, 153u, 154u, 164u }, 
-	{ 58u, 54u, 54u, 56u, 60u, 64u, 69u, 74u, 83u, 89u, 93u, 99u, 102u, 103u, 110u, 120u, 126u, 130u, 130u, 131u, 123u, 122u, 126u, 125u, 120u, 118u, 114u, 112u, 110u, 110u, 108u, 102u, 99u, 94u, 89u, 86u, 85u, 83u, 77u, 76u, 77u, 77u, 79u, 90u, 90u, 86u, 87u, 86u, 88u, 88u, 92u, 93u, 93u, 98u, 103u, 102u, 99u, 96u, 92u, 96u, 103u, 108u, 113u, 120u, 125u, 115u, 107u, 109u, 116u, 119u, 122u, 130u, 140u, 145u, 151u, 148u, 149u, 156u, 164u, 171u, 177u, 190u, 206u, 209u, 206u, 202u, 191u, 178u, 167u, 157u, 135u, 129u, 130u, 123u, 114u, 120u, 119u, 114u, 112u, 98u, 83u, 71u, 51u, 40u, 37u, 33u, 28u, 26u, 24u, 22u, 25u, 30u, 32u, 37u, 39u, 41u, 41u, 44u, 48u, 51u, 59u, 65u, 71u, 82u, 93u, 108u, 122u, 126u, 124u, 125u, 125u, 115u, 100u, 87u, 86u, 77u, 63u, 54u, 45u, 38u, 36u, 39u, 39u, 32u, 30u, 25u, 20u, 13u, 8u, 5u, 6u, 7u, 6u, 6u, 7u, 6u, 4u, 3u, 2u, 2u, 2u, 3u, 3u, 4u, 7u, 13u, 19u, 26u, 27u, 27u, 31u, 37u, 37u, 35u, 35u, 36u, 34u, 35u, 41u, 46u, 47u, 51u, 61u, 68u, 70u, 73u, 78u, 80u, 84u, 81u, 74u, 70u, 73u, 79u, 76u, 75u, 73u, 68u, 56u, 51u, 51u, 52u, 52u, 48u, 45u, 42u, 34u, 27u, 22u, 16u, 14u, 10u, 7u, 3u, 1u, 1u, 2u, 3u, 4u, 5u, 6u, 9u, 12u, 16u, 16u, 22u, 32u, 36u, 38u, 39u, 41u, 41u, 37u, 35u, 38u, 39u, 35u, 37u, 40u, 42u, 45u, 52u, 67u, 89u, 103u, 109u, 115u, 115u, 112u, 121u, 123u, 131u, 141u, 150u, 154u, 164u }, 
-	{ 53u, 50u, 49u, 51u, 54u, 58u, 62u, 68u, 77u, 81u, 84u, 90u, 94u, 99u, 101u, 110u, 117u, 124u, 126u, 128u, 121u, 120u, 126u, 121u, 113u, 110u, 107u, 107u, 105u, 105u, 104u, 98u, 95u, 91u, 87u, 84u, 82u, 76u, 73u, 73u, 79u, 82u, 85u, 90u, 93u, 93u, 91u, 92u, 93u, 95u, 98u, 98u, 104u, 105u, 111u, 112u, 108u, 104u, 102u, 100u, 109u, 117u, 124u, 127u, 126u, 118u, 112u, 116u, 121u, 129u, 129u, 133u, 139u, 145u, 152u, 154u, 153u, 154u, 167u, 171u, 180u, 193u, 205u, 212u, 208u, 201u, 190u, 175u, 162u, 150u, 136u, 128u, 120u, 108u, 104u, 115u, 116u, 110u, 106u, 93u, 80u, 61u, 48u, 38u, 38u, 37u, 35u, 32u, 28u, 25u, 28u, 31u, 35u, 38u, 40u, 43u, 44u, 46u, 47u, 51u, 58u, 65u, 69u, 78u, 90u, 100u, 111u, 119u, 121u, 119u, 116u, 105u, 94u, 79u, 75u, 71u, 62u, 52u, 46u, 42u, 36u, 34u, 34u, 32u, 29u, 25u, 20u, 14u, 10u, 6u, 4u, 4u, 4u, 4u, 6u, 6u, 4u, 3u, 3u, 3u, 3u, 3u, 3u, 5u, 8u, 13u, 19u, 26u, 27u, 28u, 28u, 31u, 31u, 30u, 29u, 32u, 34u, 39u, 44u, 48u, 51u, 55u, 63u, 68u, 74u, 78u, 83u, 83u, 83u, 77u, 73u, 72u, 76u, 75u, 74u, 70u, 64u, 56u, 46u, 44u, 42u, 44u, 48u, 44u, 41u, 37u, 30u, 27u, 24u, 18u, 14u, 11u, 7u, 4u, 2u, 2u, 3u, 4u, 5u, 6u, 7u, 11u, 15u, 20u, 22u, 25u, 31u, 35u, 34u, 38u, 40u, 44u, 38u, 35u, 37u, 37u, 33u, 35u, 38u, 46u, 46u, 50u, 61u, 77u, 88u, 93u, 103u, 111u, 107u, 114u, 119u, 126u, 134u, 144u, 154u, 163u }, 
-	{ 51u, 48u, 47u, 49u, 50u, 54u, 56u, 62u, 66u, 69u, 72u, 79u, 84u, 92u, 95u, 100u, 108u, 113u, 117u, 119u, 116u, 117u, 121u, 119u, 109u, 103u, 99u, 96u, 97u, 95u, 93u, 91u, 88u, 86u, 84u, 83u, 78u, 72u, 69u, 71u, 77u, 81u, 86u, 91u, 94u, 94u, 94u, 93u, 94u, 96u, 94u, 96u, 105u, 110u, 114u, 119u, 115u, 111u, 110u, 113u, 116u, 123u, 128u, 127u, 132u, 127u, 124u, 124u, 129u, 133u, 134u, 138u, 144u, 146u, 150u, 156u, 153u, 156u, 170u, 178u, 184u, 200u, 210u, 216u, 215u, 205u, 198u, 186u, 170u, 154u, 141u, 130u, 126u, 108u, 106u, 113u, 117u, 111u, 100u, 89u, 81u, 65u, 55u, 41u, 40u, 43u, 40u, 40u, 38u, 33u, 31u, 33u, 37u, 40u, 42u, 46u, 48u, 49u, 48u, 51u, 57u, 62u, 68u, 76u, 85u, 95u, 104u, 111u, 115u, 117u, 110u, 101u, 91u, 73u, 68u, 64u, 55u, 49u, 43u, 40u, 36u, 32u, 30u, 30u, 28u, 23u, 20u, 14u, 8u, 5u, 3u, 3u, 4u, 6u, 7u, 6u, 4u, 4u, 4u, 4u, 3u, 2u, 4u, 6u, 9u, 13u, 17u, 21u, 25u, 28u, 27u, 27u, 27u, 26u, 25u, 28u, 32u, 40u, 45u, 45u, 49u, 56u, 64u, 71u, 74u, 77u, 83u, 86u, 84u, 75u, 72u, 69u, 74u, 74u, 71u, 65u, 63u, 55u, 45u, 41u, 37u, 38u, 42u, 41u, 36u, 31u, 27u, 25u, 22u, 19u, 14u, 9u, 6u, 4u, 3u, 2u, 3u, 4u, 5u, 7u, 9u, 13u, 19u, 22u, 26u, 28u, 33u, 37u, 42u, 39u, 41u, 43u, 36u, 30u, 34u, 34u, 32u, 32u, 36u, 43u, 49u, 50u, 54u, 63u, 72u, 83u, 91u, 99u, 103u, 108u, 112u, 122u, 131u, 146u, 159u, 163u }, 
-	{ 50u, 47u, 46u, 47u, 48u, 52u, 51u, 53u, 55u, 59u, 61u, 69u, 77u, 86u, 89u, 90u, 96u, 97u, 100u, 101u, 99u, 102u, 108u, 110u, 101u, 92u, 88u, 85u, 86u, 85u, 80u, 79u, 81u, 81u, 80u, 76u, 72u, 70u, 69u, 70u, 72u, 78u, 84u, 89u, 92u, 92u, 91u, 90u, 90u, 91u, 90u, 94u, 99u, 106u, 114u, 123u, 122u, 119u, 121u, 126u, 128u, 127u, 124u, 130u, 136u, 131u, 133u, 132u, 132u, 138u, 144u, 153u, 157u, 153u, 149u, 157u, 159u, 158u, 169u, 182u, 193u, 208u, 221u, 221u, 216u, 209u, 201u, 190u, 182u, 167u, 155u, 145u, 141u, 125u, 121u, 119u, 110u, 105u, 94u, 89u, 82u, 71u, 65u, 50u, 48u, 48u, 43u, 47u, 45u, 41u, 39u, 36u, 36u, 39u, 43u, 48u, 52u, 52u, 51u, 50u, 54u, 61u, 66u, 71u, 80u, 89u, 96u, 102u, 107u, 108u, 107u, 98u, 84u, 71u, 66u, 59u, 48u, 41u, 38u, 37u, 36u, 30u, 29u, 29u, 28u, 23u, 17u, 12u, 7u, 4u, 2u, 3u, 4u, 5u, 6u, 5u, 4u, 4u, 4u, 3u, 2u, 2u, 4u, 8u, 10u, 14u, 17u, 21u, 26u, 31u, 31u, 27u, 25u, 23u, 22u, 25u, 30u, 35u, 40u, 43u, 50u, 58u, 64u, 69u, 72u, 77u, 81u, 86u, 85u, 75u, 70u, 71u, 74u, 70u, 68u, 63u, 63u, 55u, 44u, 43u, 38u, 35u, 34u, 33u, 32u, 34u, 28u, 22u, 16u, 15u, 12u, 8u, 5u, 3u, 3u, 2u, 2u, 4u, 6u, 8u, 9u, 13u, 20u, 23u, 25u, 25u, 29u, 35u, 44u, 44u, 49u, 46u, 34u, 26u, 29u, 28u, 32u, 34u, 36u, 39u, 44u, 43u, 44u, 53u, 64u, 76u, 83u, 87u, 91u, 96u, 103u, 116u, 132u, 145u, 157u, 165u }, 
-	{ 51u, 47u, 43u, 43u, 44u, 46u, 45u, 45u, 47u, 49u, 54u, 59u, 65u, 73u, 79u, 81u, 82u, 83u, 84u, 86u, 86u, 90u, 96u, 98u, 90u, 80u, 77u, 78u, 76u, 73u, 70u, 70u, 72u, 75u, 74u, 69u, 66u, 65u, 67u, 69u, 72u, 79u, 82u, 85u, 87u, 85u, 85u, 85u, 87u, 88u, 89u, 91u, 96u, 105u, 112u, 123u, 124u, 125u, 125u, 132u, 131u, 130u, 128u, 132u, 138u, 143u, 147u, 143u, 142u, 143u, 152u, 157u, 160u, 165u, 162u, 165u, 165u, 161u, 165u, 177u, 192u, 205u, 218u, 216u, 210u, 200u, 197u, 195u, 187u, 170u, 161u, 152u, 139u, 134u, 132u, 131u, 120u, 113u, 105u, 99u, 87u, 80u, 66u, 55u, 51u, 55u, 52u, 54u, 52u, 53u, 46u, 40u, 38u, 42u, 46u, 49u, 53u, 52u, 50u, 51u, 52u, 56u, 62u, 68u, 74u, 81u, 87u, 91u, 98u, 99u, 96u, 85u, 77u, 67u, 62u, 54u, 45u, 35u, 32u, 29u, 30u, 27u, 26u, 25u, 25u, 22u, 16u, 11u, 6u, 3u, 3u, 3u, 5u, 6u, 7u, 6u, 5u, 5u, 4u, 3u, 2u, 2u, 4u, 6u, 10u, 14u, 16u, 20u, 27u, 31u, 30u, 26u, 22u, 22u, 23u, 25u, 27u, 31u, 37u, 41u, 49u, 56u, 62u, 65u, 70u, 72u, 76u, 83u, 79u, 73u, 69u, 70u, 73u, 71u, 69u, 65u, 65u, 60u, 45u, 38u, 35u, 33u, 32u, 29u, 32u, 30u, 24u, 18u, 14u, 13u, 11u, 8u, 4u, 3u, 3u, 2u, 3u, 5u, 8u, 10u, 10u, 15u, 23u, 28u, 29u, 26u, 26u, 31u, 38u, 46u, 48u, 42u, 32u, 27u, 27u, 25u, 27u, 31u, 33u, 34u, 37u, 37u, 37u, 44u, 53u, 62u, 68u, 71u, 77u, 84u, 96u, 109u, 126u, 142u, 154u, 159u }, 
-	{ 49u, 45u, 40u, 40u, 42u, 41u, 40u, 39u, 41u, 42u, 46u, 50u, 54u, 60u, 68u, 71u, 76u, 76u, 75u, 77u, 78u, 78u, 82u, 85u, 79u, 72u, 66u, 65u, 63u, 60u, 62u, 62u, 64u, 67u, 69u, 66u, 63u, 62u, 65u, 66u, 69u, 74u, 78u, 77u, 80u, 84u, 85u, 82u, 82u, 85u, 88u, 88u, 95u, 102u, 111u, 124u, 131u, 132u, 133u, 135u, 137u, 140u, 139u, 142u, 147u, 157u, 160u, 158u, 150u, 150u, 154u, 158u, 165u, 172u, 174u, 175u, 176u, 175u, 173u, 180u, 190u, 203u, 212u, 214u, 204u, 199u, 196u, 195u, 183u, 170u, 165u, 153u, 141u, 139u, 142u, 143u, 133u, 120u, 115u, 108u, 99u, 86u, 64u, 60u, 59u, 65u, 67u, 66u, 60u, 56u, 52u, 47u, 45u, 47u, 48u, 48u, 51u, 49u, 47u, 49u, 49u, 50u, 55u, 62u, 67u, 72u, 77u, 81u, 85u, 89u, 84u, 76u, 67u, 60u, 53u, 46u, 38u, 29u, 26u, 24u, 24u, 22u, 20u, 20u, 21u, 20u, 15u, 10u, 7u, 5u, 4u, 5u, 5u, 5u, 7u, 6u, 6u, 5u, 5u, 3u, 3u, 3u, 4u, 6u, 10u, 12u, 15u, 20u, 24u, 27u, 26u, 23u, 21u, 24u, 26u, 26u, 25u, 29u, 32u, 37u, 44u, 51u, 57u, 62u, 66u, 69u, 73u, 79u, 76u, 70u, 71u, 70u, 71u, 72u, 70u, 69u, 64u, 59u, 49u, 39u, 38u, 33u, 29u, 29u, 29u, 27u, 24u, 20u, 15u, 10u, 8u, 7u, 5u, 4u, 3u, 3u, 5u, 9u, 10u, 11u, 15u, 22u, 30u, 32u, 34u, 29u, 30u, 29u, 34u, 43u, 47u, 41u, 32u, 28u, 23u, 20u, 23u, 27u, 32u, 32u, 33u, 31u, 30u, 37u, 44u, 52u, 61u, 66u, 69u, 74u, 87u, 104u, 116u, 132u, 147u, 155u }, 
-	{ 47u, 42u, 39u, 38u, 39u, 38u, 36u, 35u, 34u, 33u, 38u, 42u, 47u, 55u, 60u, 61u, 68u, 69u, 70u, 69u, 68u, 65u, 66u, 71u, 72u, 68u, 59u, 56u, 53u, 51u, 53u, 53u, 54u, 58u, 62u, 62u, 60u, 60u, 65u, 65u, 65u, 67u, 72u, 74u, 76u, 81u, 83u, 80u, 81u, 81u, 84u, 88u, 97u, 107u, 119u, 127u, 133u, 136u, 139u, 143u, 148u, 154u, 154u, 159u, 162u, 167u, 169u, 168u, 160u, 158u, 158u, 166u, 180u, 185u, 178u, 176u, 180u, 178u, 174u, 180u, 188u, 203u, 211u, 210u, 200u, 197u, 190u, 186u, 178u, 169u, 164u, 158u, 148u, 137u, 138u, 141u, 136u, 124u, 117u, 105u, 98u, 89u, 76u, 74u, 73u, 78u, 83u, 82u, 70u, 59u, 52u, 52u, 53u, 55u, 52u, 50u, 49u, 47u, 46u, 47u, 46u, 47u, 50u, 56u, 60u, 66u, 71u, 75u, 79u, 79u, 76u, 71u, 63u, 58u, 49u, 40u, 32u, 25u, 23u, 22u, 21u, 19u, 16u, 17u, 17u, 16u, 14u, 11u, 9u, 7u, 7u, 8u, 7u, 6u, 7u, 8u, 8u, 6u, 6u, 5u, 4u, 5u, 5u, 7u, 11u, 13u, 15u, 21u, 25u, 28u, 27u, 24u, 22u, 24u, 25u, 25u, 25u, 26u, 30u, 36u, 42u, 49u, 55u, 61u, 64u, 68u, 72u, 77u, 75u, 72u, 73u, 73u, 74u, 76u, 78u, 78u, 67u, 60u, 54u, 44u, 41u, 33u, 29u, 30u, 33u, 32u, 30u, 22u, 17u, 10u, 8u, 7u, 6u, 5u, 3u, 4u, 6u, 10u, 11u, 14u, 19u, 26u, 34u, 34u, 33u, 29u, 32u, 33u, 33u, 36u, 41u, 37u, 30u, 25u, 22u, 21u, 23u, 25u, 27u, 28u, 27u, 25u, 24u, 30u, 37u, 45u, 54u, 61u, 66u, 74u, 79u, 92u, 102u, 116u, 136u, 152u }, 
-	{ 49u, 43u, 39u, 35u, 35u, 36u, 33u, 32u, 31u, 30u, 31u, 38u, 45u, 54u, 54u, 54u, 59u, 62u, 66u, 64u, 63u, 57u, 55u, 57u, 58u, 59u, 53u, 47u, 44u, 41u, 44u, 49u, 49u, 53u, 57u, 59u, 60u, 61u, 64u, 64u, 62u, 62u, 68u, 72u, 75u, 81u, 83u, 80u, 83u, 85u, 84u, 90u, 100u, 112u, 121u, 129u, 139u, 141u, 143u, 147u, 154u, 159u, 160u, 166u, 168u, 172u, 178u, 176u, 171u, 170u, 169u, 179u, 188u, 192u, 189u, 179u, 177u, 178u, 177u, 179u, 186u, 203u, 208u, 201u, 202u, 198u, 190u, 181u, 175u, 171u, 162u, 156u, 148u, 143u, 131u, 132u, 131u, 126u, 117u, 106u, 96u, 94u, 84u, 79u, 74u, 79u, 87u, 83u, 70u, 58u, 54u, 54u, 59u, 58u, 53u, 53u, 53u, 48u, 46u, 46u, 46u, 46u, 49u, 55u, 60u, 65u, 67u, 70u, 74u, 73u, 68u, 65u, 57u, 51u, 42u, 34u, 26u, 23u, 21u, 21u, 18u, 15u, 14u, 13u, 13u, 11u, 10u, 11u, 9u, 8u, 8u, 8u, 8u, 8u, 9u, 9u, 11u, 11u, 10u, 7u, 6u, 7u, 8u, 10u, 14u, 16u, 18u, 21u, 26u, 28u, 26u, 24u, 23u, 25u, 25u, 25u, 26u, 28u, 34u, 38u, 44u, 49u, 55u, 63u, 68u, 74u, 79u, 76u, 76u, 75u, 75u, 77u, 79u, 80u, 82u, 82u, 74u, 68u, 65u, 53u, 46u, 36u, 31u, 29u, 33u, 34u, 36u, 25u, 17u, 11u, 10u, 9u, 9u, 6u, 5u, 7u, 8u, 10u, 14u, 17u, 22u, 30u, 37u, 35u, 34u, 31u, 32u, 31u, 33u, 35u, 35u, 32u, 27u, 24u, 22u, 20u, 19u, 25u, 25u, 23u, 21u, 21u, 22u, 26u, 33u, 42u, 46u, 53u, 63u, 72u, 79u, 86u, 96u, 109u, 134u, 154u }, 
-	{ 52u, 43u, 38u, 34u, 33u, 32u, 29u, 28u, 27u, 27u, 27u, 36u, 45u, 48u, 46u, 47u, 49u, 54u, 60u, 59u, 58u, 54u, 53u, 50u, 50u, 51u, 46u, 38u, 37u, 37u, 41u, 46u, 50u, 51u, 55u, 58u, 61u, 62u, 63u, 63u, 61u, 63u, 67u, 73u, 77u, 80u, 84u, 82u, 85u, 89u, 89u, 97u, 106u, 115u, 123u, 132u, 139u, 139u, 144u, 151u, 154u, 160u, 166u, 171u, 169u, 175u, 184u, 187u, 181u, 181u, 184u, 184u, 191u, 194u, 191u, 177u, 172u, 170u, 172u, 178u, 188u, 201u, 208u, 203u, 201u, 193u, 186u, 178u, 170u, 160u, 156u, 153u, 148u, 149u, 130u, 117u, 126u, 124u, 120u, 113u, 98u, 93u, 81u, 77u, 76u, 81u, 80u, 75u, 67u, 60u, 57u, 57u, 58u, 59u, 58u, 57u, 57u, 54u, 50u, 49u, 49u, 48u, 50u, 56u, 63u, 63u, 64u, 66u, 70u, 67u, 62u, 59u, 54u, 46u, 39u, 30u, 26u, 22u, 19u, 18u, 18u, 14u, 11u, 9u, 8u, 7u, 7u, 8u, 8u, 8u, 8u, 8u, 7u, 8u, 10u, 12u, 14u, 15u, 15u, 12u, 11u, 10u, 10u, 12u, 15u, 17u, 18u, 21u, 27u, 28u, 24u, 22u, 23u, 23u, 24u, 26u, 30u, 32u, 36u, 41u, 48u, 51u, 58u, 65u, 72u, 80u, 80u, 76u, 77u, 75u, 75u, 80u, 81u, 83u, 84u, 82u, 80u, 78u, 72u, 63u, 53u, 42u, 36u, 35u, 35u, 32u, 36u, 28u, 19u, 14u, 16u, 15u, 13u, 10u, 8u, 11u, 11u, 12u, 15u, 20u, 27u, 35u, 37u, 36u, 33u, 30u, 27u, 28u, 33u, 33u, 32u, 31u, 27u, 24u, 19u, 18u, 19u, 22u, 21u, 20u, 19u, 20u, 23u, 26u, 31u, 36u, 37u, 44u, 58u, 69u, 75u, 85u, 95u, 111u, 132u, 154u }, 
-	{ 57u, 46u, 40u, 35u, 33u, 30u, 27u, 26u, 24u, 23u, 25u, 33u, 38u, 41u, 40u, 39u, 40u, 45u, 50u, 52u, 52u, 52u, 51u, 46u, 44u, 43u, 38u, 35u, 35u, 36u, 41u, 47u, 51u, 53u, 57u, 58u, 61u, 61u, 60u, 61u, 63u, 66u, 68u, 71u, 76u, 80u, 83u, 85u, 88u, 90u, 93u, 101u, 112u, 119u, 125u, 130u, 135u, 139u, 142u, 148u, 156u, 163u, 167u, 171u, 169u, 178u, 186u, 191u, 190u, 189u, 191u, 191u, 190u, 187u, 185u, 175u, 172u, 172u, 176u, 179u, 189u, 196u, 201u, 199u, 193u, 193u, 189u, 179u, 173u, 162u, 162u, 156u, 148u, 141u, 130u, 114u, 113u, 114u, 118u, 114u, 96u, 82u, 78u, 78u, 79u, 77u, 71u, 72u, 66u, 59u, 56u, 58u, 56u, 60u, 63u, 61u, 57u, 56u, 53u, 53u, 54u, 54u, 55u, 60u, 62u, 61u, 64u, 64u, 66u, 64u, 61u, 57u, 51u, 44u, 37u, 30u, 25u, 20u, 17u, 16u, 16u, 14u, 10u, 7u, 5u, 5u, 5u, 5u, 6u, 7u, 7u, 6u, 6u, 8u, 12u, 14u, 17u, 17u, 19u, 17u, 15u, 12u, 11u, 12u, 12u, 13u, 15u, 18u, 23u, 26u, 22u, 21u, 21u, 22u, 24u, 26u, 30u, 34u, 38u, 45u, 48u, 52u, 59u, 68u, 77u, 80u, 80u, 78u, 75u, 75u, 77u, 82u, 81u, 83u, 87u, 85u, 85u, 83u, 73u, 64u, 57u, 47u, 42u, 38u, 32u, 28u, 28u, 22u, 17u, 16u, 21u, 21u, 20u, 15u, 13u, 15u, 13u, 15u, 19u, 22u, 28u, 35u, 36u, 37u, 33u, 32u, 29u, 31u, 36u, 37u, 36u, 33u, 26u, 24u, 18u, 17u, 17u, 18u, 19u, 19u, 19u, 21u, 22u, 24u, 31u, 35u, 34u, 37u, 49u, 56u, 63u, 79u, 95u, 109u, 124u, 146u }, 
-	{ 60u, 49u, 40u, 34u, 31u, 27u, 26u, 25u, 24u, 22u, 23u, 28u, 33u, 35u, 36u, 38u, 40u, 42u, 45u, 50u, 53u, 52u, 49u, 46u, 45u, 42u, 38u, 39u, 37u, 40u, 45u, 50u, 53u, 56u, 56u, 58u, 59u, 61u, 58u, 58u, 61u, 65u, 70u, 73u, 74u, 79u, 84u, 86u, 89u, 90u, 95u, 103u, 112u, 117u, 122u, 127u, 133u, 138u, 142u, 149u, 155u, 163u, 166u, 170u, 171u, 180u, 189u, 192u, 197u, 198u, 193u, 192u, 186u, 184u, 182u, 181u, 175u, 174u, 179u, 182u, 180u, 184u, 186u, 188u, 180u, 181u, 189u, 180u, 172u, 165u, 157u, 153u, 150u, 139u, 129u, 117u, 117u, 110u, 105u, 106u, 100u, 83u, 77u, 76u, 72u, 67u, 67u, 72u, 71u, 59u, 56u, 57u, 58u, 62u, 62u, 61u, 57u, 58u, 58u, 59u, 57u, 59u, 61u, 63u, 63u, 63u, 64u, 65u, 64u, 62u, 60u, 55u, 50u, 43u, 37u, 30u, 25u, 21u, 17u, 15u, 14u, 12u, 10u, 7u, 5u, 5u, 4u, 4u, 6u, 6u, 7u, 7u, 7u, 8u, 9u, 12u, 17u, 17u, 18u, 19u, 17u, 15u, 13u, 14u, 13u, 12u, 13u, 17u, 22u, 26u, 24u, 21u, 20u, 22u, 25u, 28u, 31u, 36u, 41u, 46u, 50u, 57u, 62u, 70u, 77u, 82u, 81u, 81u, 76u, 73u, 75u, 77u, 79u, 79u, 84u, 88u, 89u, 83u, 73u, 66u, 59u, 53u, 47u, 39u, 33u, 25u, 23u, 19u, 16u, 18u, 21u, 18u, 18u, 18u, 18u, 17u, 15u, 14u, 19u, 22u, 28u, 32u, 37u, 41u, 37u, 33u, 32u, 33u, 35u, 38u, 38u, 27u, 23u, 22u, 18u, 17u, 17u, 14u, 14u, 14u, 17u, 19u, 19u, 20u, 25u, 31u, 30u, 32u, 40u, 48u, 60u, 74u, 92u, 104u, 121u, 143u }, 
-	{ 60u, 50u, 41u, 35u, 31u, 25u, 23u, 23u, 22u, 21u, 21u, 26u, 31u, 34u, 35u, 38u, 39u, 39u, 42u, 47u, 52u, 51u, 50u, 48u, 46u, 44u, 41u, 41u, 39u, 42u, 51u, 55u, 55u, 59u, 61u, 63u, 62u, 61u, 59u, 59u, 61u, 65u, 71u, 74u, 72u, 77u, 84u, 88u, 88u, 90u, 93u, 101u, 110u, 115u, 119u, 125u, 131u, 137u, 143u, 150u, 153u, 159u, 167u, 169u, 171u, 179u, 187u, 191u, 194u, 194u, 189u, 189u, 181u, 176u, 178u, 179u, 174u, 177u, 179u, 178u, 175u, 170u, 171u, 175u, 172u, 175u, 182u, 176u, 170u, 164u, 151u, 146u, 147u, 144u, 134u, 127u, 121u, 110u, 95u, 94u, 98u, 91u, 83u, 77u, 69u, 65u, 71u, 75u, 73u, 63u, 60u, 60u, 62u, 61u, 63u, 62u, 61u, 63u, 64u, 64u, 62u, 64u, 62u, 62u, 63u, 61u, 62u, 65u, 64u, 60u, 56u, 51u, 46u, 41u, 37u, 30u, 27u, 23u, 18u, 14u, 13u, 11u, 10u, 7u, 5u, 4u, 4u, 4u, 4u, 5u, 6u, 8u, 9u, 7u, 7u, 9u, 14u, 15u, 17u, 18u, 16u, 14u, 14u, 12u, 13u, 12u, 13u, 17u, 21u, 23u, 22u, 21u, 21u, 23u, 25u, 30u, 33u, 38u, 42u, 46u, 51u, 59u, 67u, 71u, 77u, 81u, 81u, 79u, 79u, 75u, 74u, 76u, 74u, 75u, 80u, 86u, 87u, 80u, 72u, 67u, 61u, 57u, 52u, 45u, 38u, 29u, 26u, 22u, 19u, 19u, 20u, 16u, 13u, 14u, 14u, 15u, 16u, 15u, 18u, 24u, 30u, 36u, 39u, 43u, 38u, 35u, 35u, 39u, 36u, 35u, 32u, 24u, 19u, 17u, 15u, 13u, 13u, 12u, 11u, 12u, 14u, 16u, 17u, 19u, 22u, 26u, 26u, 27u, 32u, 44u, 56u, 71u, 85u, 101u, 117u, 137u }, 
-	{ 61u, 50u, 42u, 36u, 30u, 25u, 22u, 21u, 21u, 21u, 23u, 26u, 28u, 30u, 32u, 35u, 37u, 38u, 40u, 44u, 47u, 46u, 49u, 49u, 48u, 47u, 42u, 42u, 41u, 46u, 56u, 59u, 62u, 63u, 64u, 66u, 64u, 62u, 60u, 62u, 64u, 66u, 71u, 72u, 69u, 75u, 79u, 85u, 87u, 89u, 91u, 98u, 105u, 111u, 116u, 122u, 128u, 136u, 143u, 147u, 153u, 155u, 161u, 166u, 171u, 178u, 184u, 191u, 198u, 196u, 190u, 184u, 178u, 174u, 173u, 175u, 176u, 177u, 176u, 177u, 176u, 168u, 166u, 171u, 173u, 173u, 175u, 172u, 163u, 156u, 145u, 142u, 144u, 147u, 143u, 141u, 125u, 108u, 87u, 86u, 92u, 87u, 81u, 73u, 67u, 67u, 77u, 78u, 74u, 67u, 62u, 60u, 60u, 61u, 66u, 66u, 68u, 70u, 71u, 70u, 67u, 65u, 64u, 63u, 62u, 60u, 60u, 61u, 62u, 60u, 56u, 51u, 47u, 40u, 37u, 33u, 29u, 25u, 20u, 16u, 14u, 12u, 10u, 8u, 6u, 4u, 4u, 4u, 4u, 5u, 6u, 8u, 8u, 6u, 7u, 9u, 12u, 13u, 13u, 13u, 13u, 14u, 15u, 14u, 15u, 13u, 13u, 16u, 17u, 19u, 20u, 21u, 23u, 24u, 27u, 31u, 35u, 41u, 45u, 49u, 54u, 60u, 67u, 71u, 77u, 80u, 83u, 78u, 75u, 74u, 76u, 76u, 72u, 74u, 79u, 86u, 84u, 76u, 71u, 69u, 63u, 61u, 54u, 49u, 41u, 36u, 31u, 23u, 18u, 16u, 19u, 18u, 12u, 12u, 14u, 17u, 17u, 17u, 17u, 19u, 23u, 30u, 32u, 38u, 40u, 42u, 39u, 37u, 39u, 36u, 29u, 22u, 15u, 13u, 13u, 11u, 10u, 10u, 10u, 11u, 12u, 13u, 15u, 18u, 22u, 23u, 23u, 24u, 25u, 33u, 46u, 66u, 84u, 98u, 111u, 128u }, 
-	{ 64u, 52u, 42u, 36u, 30u, 25u, 21u, 20u, 18u, 19u, 22u, 25u, 27u, 26u, 30u, 31u, 32u, 32u, 34u, 38u, 38u, 40u, 41u, 48u, 48u, 45u, 46u, 45u, 45u, 49u, 57u, 64u, 68u, 69u, 68u, 70u, 68u, 66u, 66u, 66u, 67u, 69u, 70u, 70u, 67u, 69u, 73u, 79u, 82u, 84u, 91u, 100u, 104u, 109u, 114u, 119u, 125u, 133u, 138u, 142u, 147u, 151u, 156u, 161u, 170u, 177u, 181u, 191u, 194u, 191u, 186u, 178u, 169u, 165u, 165u, 164u, 171u, 176u, 172u, 172u, 171u, 168u, 163u, 169u, 174u, 175u, 178u, 172u, 165u, 151u, 148u, 149u, 142u, 147u, 153u, 145u, 129u, 103u, 89u, 86u, 92u, 88u, 80u, 69u, 71u, 75u, 78u, 75u, 74u, 66u, 64u, 63u, 61u, 63u, 68u, 72u, 73u, 77u, 74u, 70u, 68u, 66u, 66u, 64u, 63u, 61u, 59u, 59u, 60u, 59u, 54u, 50u, 47u, 43u, 38u, 35u, 31u, 27u, 23u, 18u, 15u, 13u, 11u, 8u, 6u, 4u, 4u, 4u, 4u, 4u, 5u, 6u, 5u, 5u, 5u, 6u, 9u, 12u, 10u, 11u, 12u, 14u, 15u, 14u, 13u, 13u, 13u, 14u, 15u, 16u, 17u, 20u, 22u, 25u, 27u, 32u, 38u, 44u, 48u, 51u, 55u, 62u, 68u, 72u, 76u, 79u, 80u, 74u, 71u, 72u, 74u, 74u, 72u, 71u, 76u, 79u, 79u, 74u, 68u, 66u, 65u, 58u, 54u, 50u, 45u, 40u, 35u, 24u, 16u, 14u, 13u, 14u, 12u, 14u, 15u, 19u, 22u, 21u, 20u, 17u, 21u, 26u, 26u, 30u, 35u, 38u, 38u, 34u, 35u, 32u, 27u, 21u, 17u, 15u, 14u, 11u, 9u, 10u, 9u, 9u, 12u, 13u, 15u, 18u, 19u, 20u, 18u, 18u, 19u, 22u, 33u, 51u, 72u, 90u, 101u, 113u }, 
-	{ 68u, 56u, 44u, 36u, 29u, 25u, 19u, 15u, 14u, 16u, 21u, 26u, 27u, 27u, 28u, 28u, 26u, 27u, 26u, 28u, 29u, 30u, 34u, 43u, 46u, 46u, 46u, 45u, 45u, 48u, 55u, 64u, 73u, 77u, 77u, 79u, 77u, 73u, 71u, 68u, 67u, 68u, 69u, 67u, 66u, 67u, 70u, 75u, 77u, 83u, 90u, 97u, 101u, 105u, 110u, 116u, 122u, 129u, 134u, 138u, 144u, 149u, 154u, 155u, 163u, 170u, 174u, 182u, 184u, 179u, 174u, 169u, 160u, 155u, 150u, 148u, 155u, 162u, 164u, 166u, 165u, 163u, 158u, 163u, 173u, 180u, 182u, 176u, 167u, 153u, 151u, 156u, 149u, 143u, 149u, 148u, 136u, 112u, 96u, 96u, 99u, 99u, 94u, 78u, 73u, 73u, 69u, 69u, 68u, 65u, 64u, 67u, 65u, 66u, 71u, 74u, 77u, 80u, 77u, 72u, 70u, 68u, 69u, 66u, 65u, 62u, 61u, 60u, 61u, 58u, 54u, 50u, 47u, 44u, 39u, 36u, 32u, 29u, 24u, 20u, 16u, 14u, 11u, 8u, 6u, 5u, 4u, 4u, 4u, 4u, 4u, 5u, 4u, 4u, 4u, 5u, 8u, 10u, 9u, 9u, 10u, 11u, 10u, 11u, 12u, 12u, 13u, 14u, 15u, 15u, 17u, 20u, 22u, 25u, 29u, 34u, 40u, 48u, 52u, 56u, 59u, 64u, 69u, 71u, 73u, 75u, 74u, 70u, 68u, 68u, 69u, 68u, 68u, 71u, 74u, 75u, 76u, 71u, 67u, 67u, 65u, 59u, 54u, 53u, 52u, 46u, 39u, 26u, 16u, 11u, 8u, 11u, 11u, 14u, 19u, 23u, 22u, 23u, 21u, 18u, 20u, 21u, 19u, 20u, 22u, 28u, 33u, 33u, 34u, 31u, 26u, 21u, 18u, 18u, 17u, 12u, 8u, 8u, 9u, 9u, 13u, 15u, 16u, 17u, 16u, 15u, 13u, 12u, 13u, 18u, 26u, 42u, 57u, 74u, 86u, 99u }, 
-	{ 65u, 55u, 42u, 33u, 27u, 23u, 17u, 13u, 13u, 15u, 20u, 25u, 28u, 28u, 26u, 23u, 21u, 24u, 24u, 24u, 24u, 26u, 30u, 37u, 41u, 45u, 46u, 44u, 46u, 50u, 56u, 65u, 73u, 79u, 80u, 80u, 83u, 76u, 71u, 68u, 68u, 66u, 67u, 67u, 67u, 65u, 67u, 70u, 71u, 77u, 87u, 94u, 98u, 102u, 108u, 114u, 119u, 126u, 133u, 136u, 139u, 143u, 148u, 150u, 157u, 162u, 166u, 172u, 173u, 173u, 170u, 165u, 154u, 147u, 141u, 139u, 140u, 142u, 155u, 161u, 160u, 161u, 155u, 156u, 169u, 173u, 176u, 176u, 169u, 157u, 156u, 156u, 157u, 153u, 149u, 149u, 139u, 128u, 115u, 107u, 101u, 107u, 105u, 90u, 85u, 77u, 67u, 67u, 66u, 66u, 63u, 68u, 69u, 70u, 78u, 82u, 83u, 83u, 78u, 74u, 73u, 73u, 73u, 68u, 66u, 63u, 63u, 62u, 61u, 58u, 55u, 51u, 47u, 44u, 40u, 36u, 33u, 30u, 26u, 22u, 19u, 16u, 13u, 10u, 7u, 6u, 5u, 4u, 4u, 4u, 4u, 4u, 4u, 4u, 4u, 4u, 7u, 7u, 8u, 7u, 8u, 9u, 9u, 10u, 11u, 11u, 13u, 14u, 15u, 16u, 18u, 20u, 23u, 27u, 31u, 36u, 43u, 50u, 55u, 60u, 64u, 67u, 69u, 71u, 72u, 73u, 71u, 69u, 67u, 65u, 66u, 66u, 66u, 71u, 71u, 69u, 69u, 69u, 69u, 68u, 66u, 64u, 63u, 59u, 59u, 54u, 44u, 31u, 20u, 13u, 9u, 12u, 12u, 15u, 20u, 25u, 25u, 26u, 20u, 17u, 19u, 20u, 16u, 16u, 19u, 23u, 28u, 28u, 28u, 26u, 21u, 18u, 16u, 16u, 16u, 12u, 9u, 8u, 9u, 9u, 12u, 15u, 15u, 15u, 14u, 13u, 10u, 9u, 10u, 14u, 20u, 35u, 50u, 62u, 76u, 91u }, 
-	{ 60u, 52u, 42u, 33u, 27u, 23u, 17u, 13u, 13u, 15u, 19u, 22u, 26u, 28u, 25u, 23u, 23u, 23u, 23u, 23u, 23u, 24u, 30u, 34u, 37u, 39u, 42u, 43u, 45u, 52u, 60u, 67u, 74u, 77u, 81u, 82u, 84u, 76u, 69u, 67u, 67u, 66u, 66u, 66u, 67u, 65u, 65u, 67u, 67u, 72u, 82u, 88u, 93u, 98u, 105u, 112u, 117u, 123u, 129u, 131u, 132u, 137u, 142u, 146u, 150u, 155u, 159u, 161u, 162u, 165u, 164u, 159u, 148u, 139u, 133u, 132u, 130u, 131u, 138u, 149u, 152u, 150u, 149u, 154u, 165u, 165u, 166u, 171u, 165u, 159u, 152u, 149u, 155u, 155u, 150u, 146u, 135u, 133u, 131u, 118u, 112u, 113u, 110u, 104u, 93u, 79u, 70u, 70u, 71u, 67u, 65u, 70u, 75u, 76u, 82u, 86u, 87u, 85u, 82u, 79u, 76u, 76u, 75u, 70u, 67u, 65u, 65u, 65u, 62u, 60u, 58u, 52u, 48u, 45u, 41u, 36u, 33u, 30u, 27u, 24u, 21u, 18u, 14u, 11u, 9u, 8u, 6u, 5u, 5u, 5u, 5u, 5u, 4u, 4u, 4u, 4u, 6u, 6u, 6u, 6u, 6u, 7u, 8u, 9u, 9u, 9u, 12u, 13u, 14u, 16u, 18u, 20u, 25u, 29u, 33u, 38u, 45u, 51u, 56u, 62u, 66u, 68u, 71u, 73u, 73u, 74u, 73u, 70u, 67u, 64u, 62u, 64u, 69u, 70u, 67u, 65u, 64u, 67u, 69u, 69u, 70u, 71u, 72u, 66u, 61u, 53u, 44u, 32u, 22u, 16u, 11u, 13u, 15u, 15u, 17u, 23u, 24u, 24u, 23u, 19u, 17u, 18u, 15u, 15u, 21u, 23u, 21u, 22u, 23u, 21u, 16u, 15u, 13u, 12u, 13u, 12u, 10u, 8u, 9u, 9u, 11u, 14u, 12u, 11u, 11u, 10u, 9u, 8u, 9u, 14u, 21u, 29u, 41u, 56u, 69u, 90u }, 
-	{ 60u, 51u, 41u, 33u, 27u, 23u, 19u, 19u, 18u, 18u, 20u, 21u, 23u, 26u, 26u, 24u, 24u, 23u, 24u, 23u, 22u, 25u, 29u, 32u, 35u, 36u, 39u, 41u, 44u, 52u, 61u, 69u, 75u, 78u, 82u, 83u, 82u, 74u, 69u, 68u, 68u, 66u, 66u, 67u, 67u, 66u, 67u, 65u, 62u, 70u, 79u, 84u, 90u, 96u, 104u, 106u, 109u, 113u, 121u, 125u, 127u, 129u, 132u, 138u, 141u, 146u, 148u, 147u, 151u, 158u, 156u, 147u, 137u, 130u, 126u, 122u, 119u, 123u, 127u, 132u, 136u, 139u, 149u, 156u, 163u, 164u, 163u, 165u, 158u, 156u, 150u, 147u, 150u, 152u, 145u, 143u, 146u, 140u, 138u, 135u, 126u, 117u, 112u, 107u, 90u, 82u, 76u, 76u, 74u, 69u, 68u, 72u, 80u, 82u, 84u, 85u, 88u, 88u, 84u, 83u, 80u, 79u, 78u, 74u, 71u, 68u, 66u, 65u, 62u, 61u, 59u, 54u, 50u, 47u, 42u, 37u, 33u, 30u, 27u, 25u, 21u, 18u, 15u, 12u, 10u, 9u, 8u, 6u, 6u, 5u, 5u, 4u, 4u, 4u, 4u, 4u, 5u, 5u, 4u, 5u, 5u, 6u, 6u, 7u, 7u, 9u, 10u, 11u, 13u, 15u, 18u, 21u, 26u, 30u, 35u, 40u, 46u, 53u, 58u, 63u, 67u, 70u, 73u, 75u, 76u, 77u, 76u, 73u, 69u, 65u, 61u, 62u, 69u, 71u, 67u, 65u, 66u, 67u, 68u, 70u, 70u, 71u, 73u, 67u, 57u, 48u, 40u, 31u, 25u, 20u, 13u, 12u, 14u, 15u, 15u, 17u, 16u, 19u, 25u, 25u, 19u, 15u, 17u, 18u, 20u, 23u, 23u, 22u, 19u, 16u, 12u, 13u, 11u, 9u, 10u, 10u, 9u, 8u, 10u, 11u, 11u, 12u, 10u, 10u, 10u, 9u, 9u, 9u, 10u, 14u, 19u, 26u, 38u, 48u, 59u, 82u }, 
-	{ 65u, 54u, 44u, 36u, 28u, 24u, 24u, 25u, 22u, 21u, 21u, 20u, 23u, 25u, 25u, 26u, 25u, 24u, 23u, 22u, 22u, 23u, 26u, 29u, 30u, 32u, 33u, 37u, 42u, 49u, 59u, 72u, 78u, 80u, 82u, 85u, 82u, 76u, 71u, 68u, 68u, 69u, 67u, 67u, 67u, 69u, 68u, 67u, 65u, 71u, 78u, 85u, 90u, 95u, 98u, 99u, 103u, 106u, 110u, 116u, 118u, 121u, 125u, 130u, 133u, 139u, 143u, 139u, 144u, 148u, 140u, 132u, 128u, 128u, 127u, 120u, 115u, 114u, 118u, 120u, 128u, 138u, 145u, 152u, 160u, 163u, 163u, 160u, 156u, 151u, 149u, 146u, 143u, 148u, 148u, 151u, 152u, 148u, 151u, 148u, 140u, 126u, 121u, 118u, 100u, 91u, 81u, 76u, 76u, 72u, 70u, 74u, 83u, 88u, 87u, 86u, 87u, 88u, 87u, 86u, 83u, 82u, 80u, 77u, 75u, 69u, 67u, 65u, 64u, 62u, 58u, 54u, 50u, 47u, 43u, 38u, 34u, 30u, 27u, 24u, 21u, 18u, 15u, 12u, 11u, 10u, 8u, 6u, 6u, 5u, 5u, 4u, 4u, 3u, 3u, 3u, 3u, 3u, 3u, 4u, 4u, 4u, 5u, 5u, 5u, 7u, 9u, 11u, 12u, 14u, 17u, 21u, 26u, 31u, 37u, 42u, 48u, 54u, 60u, 65u, 70u, 74u, 76u, 78u, 79u, 80u, 79u, 76u, 74u, 69u, 64u, 65u, 69u, 73u, 71u, 68u, 70u, 73u, 73u, 72u, 72u, 72u, 73u, 67u, 55u, 45u, 36u, 31u, 29u, 27u, 19u, 14u, 14u, 13u, 14u, 16u, 15u, 17u, 24u, 27u, 23u, 19u, 19u, 18u, 20u, 21u, 25u, 24u, 20u, 15u, 12u, 10u, 9u, 8u, 10u, 12u, 11u, 10u, 10u, 12u, 10u, 10u, 10u, 10u, 9u, 8u, 9u, 8u, 10u, 13u, 18u, 28u, 36u, 45u, 53u, 71u }, 
-	{ 68u, 60u, 51u, 42u, 32u, 29u, 28u, 29u, 27u, 24u, 22u, 21u, 22u, 24u, 26u, 28u, 27u, 25u, 23u, 21u, 20u, 20u, 23u, 26u, 27u, 29u, 31u, 35u, 41u, 47u, 55u, 67u, 75u, 81u, 83u, 84u, 84u, 78u, 72u, 70u, 69u, 69u, 68u, 68u, 68u, 69u, 68u, 68u, 72u, 78u, 82u, 84u, 87u, 89u, 91u, 93u, 95u, 96u, 98u, 102u, 105u, 111u, 117u, 124u, 128u, 133u, 139u, 137u, 139u, 136u, 126u, 117u, 119u, 120u, 121u, 115u, 111u, 112u, 113u, 117u, 129u, 135u, 138u, 147u, 154u, 161u, 162u, 157u, 149u, 148u, 149u, 145u, 145u, 150u, 153u, 149u, 151u, 157u, 158u, 152u, 144u, 129u, 123u, 120u, 105u, 92u, 85u, 80u, 76u, 77u, 77u, 79u, 83u, 90u, 89u, 88u, 87u, 88u, 88u, 89u, 87u, 86u, 81u, 79u, 75u, 70u, 67u, 66u, 65u, 63u, 57u, 54u, 50u, 48u, 44u, 39u, 34u, 30u, 27u, 24u, 21u, 18u, 15u, 13u, 11u, 9u, 8u, 7u, 5u, 5u, 4u, 4u, 3u, 3u, 2u, 2u, 3u, 3u, 2u, 3u, 3u, 3u, 4u, 4u, 5u, 6u, 8u, 9u, 11u, 13u, 16u, 21u, 26u, 31u, 37u, 42u, 49u, 56u, 62u, 67u, 72u, 76u, 78u, 80u, 82u, 82u, 81u, 80u, 78u, 75u, 72u, 72u, 75u, 78u, 79u, 77u, 78u, 79u, 76u, 78u, 79u, 78u, 73u, 62u, 47u, 37u, 32u, 31u, 32u, 30u, 26u, 18u, 14u, 11u, 12u, 13u, 14u, 15u, 22u, 26u, 24u, 22u, 22u, 24u, 23u, 22u, 24u, 23u, 21u, 14u, 10u, 8u, 6u, 6u, 9u, 13u, 13u, 11u, 10u, 10u, 9u, 8u, 9u, 10u, 9u, 8u, 9u, 10u, 12u, 16u, 21u, 30u, 37u, 44u, 57u, 69u }, 
-	{ 70u, 62u, 52u, 44u, 38u, 33u, 29u, 30u, 32u, 29u, 24u, 22u, 22u, 24u, 26u, 27u, 26u, 24u, 22u, 20u, 19u, 19u, 21u, 24u, 26u, 28u, 30u, 33u, 37u, 43u, 50u, 58u, 68u, 77u, 81u, 80u, 80u, 74u, 69u, 68u, 68u, 66u, 66u, 66u, 67u, 69u, 70u, 69u, 73u, 78u, 81u, 82u, 83u, 84u, 85u, 86u, 87u, 87u, 89u, 92u, 96u, 105u, 109u, 115u, 120u, 125u, 127u, 128u, 127u, 122u, 113u, 110u, 106u, 103u, 103u, 103u, 104u, 107u, 110u, 118u, 126u, 130u, 140u, 145u, 147u, 154u, 153u, 149u, 149u, 146u, 141u, 136u, 138u, 145u, 153u, 150u, 150u, 154u, 155u, 152u, 140u, 120u, 111u, 109u, 102u, 93u, 88u, 79u, 77u, 82u, 84u, 89u, 90u, 90u, 90u, 94u, 92u, 90u, 91u, 93u, 90u, 87u, 81u, 80u, 76u, 72u, 71u, 71u, 69u, 62u, 57u, 54u, 49u, 47u, 44u, 39u, 34u, 30u, 27u, 24u, 21u, 18u, 15u, 13u, 11u, 9u, 7u, 6u, 5u, 4u, 4u, 3u, 3u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 3u, 3u, 4u, 5u, 7u, 9u, 11u, 13u, 16u, 20u, 25u, 30u, 36u, 42u, 50u, 57u, 63u, 67u, 72u, 78u, 80u, 82u, 84u, 84u, 82u, 81u, 81u, 80u, 79u, 79u, 79u, 79u, 81u, 81u, 82u, 83u, 79u, 79u, 81u, 82u, 71u, 56u, 43u, 32u, 31u, 34u, 35u, 32u, 26u, 20u, 16u, 13u, 13u, 13u, 14u, 15u, 19u, 25u, 25u, 26u, 23u, 24u, 24u, 23u, 22u, 19u, 17u, 13u, 9u, 6u, 5u, 7u, 8u, 10u, 10u, 9u, 10u, 10u, 9u, 9u, 8u, 10u, 10u, 9u, 11u, 15u, 19u, 22u, 25u, 31u, 38u, 45u, 61u, 75u }, 
-	{ 68u, 60u, 50u, 44u, 38u, 33u, 31u, 31u, 32u, 29u, 26u, 25u, 24u, 25u, 25u, 26u, 24u, 22u, 21u, 20u, 20u, 20u, 22u, 24u, 26u, 28u, 30u, 33u, 36u, 42u, 49u, 54u, 61u, 71u, 75u, 75u, 75u, 72u, 67u, 67u, 65u, 63u, 62u, 65u, 65u, 67u, 67u, 67u, 68u, 73u, 76u, 77u, 77u, 81u, 82u, 83u, 81u, 81u, 84u, 86u, 90u, 99u, 103u, 109u, 111u, 112u, 113u, 115u, 117u, 114u, 109u, 102u, 92u, 92u, 94u, 98u, 101u, 108u, 114u, 123u, 127u, 130u, 136u, 138u, 140u, 142u, 139u, 137u, 138u, 137u, 134u, 132u, 127u, 131u, 137u, 141u, 142u, 140u, 147u, 144u, 132u, 122u, 113u, 107u, 102u, 93u, 87u, 80u, 80u, 83u, 89u, 93u, 91u, 91u, 91u, 96u, 99u, 98u, 101u, 101u, 98u, 93u, 87u, 85u, 79u, 76u, 74u, 72u, 68u, 61u, 56u, 51u, 48u, 46u, 43u, 38u, 33u, 29u, 25u, 23u, 20u, 17u, 15u, 12u, 10u, 8u, 7u, 6u, 5u, 4u, 3u, 3u, 2u, 2u, 2u, 2u, 2u, 2u, 1u, 2u, 2u, 2u, 2u, 3u, 3u, 5u, 6u, 8u, 10u, 12u, 15u, 19u, 24u, 30u, 35u, 41u, 49u, 56u, 62u, 67u, 72u, 78u, 81u, 83u, 85u, 85u, 84u, 83u, 84u, 85u, 84u, 84u, 83u, 81u, 83u, 89u, 86u, 81u, 82u, 81u, 87u, 87u, 74u, 58u, 47u, 40u, 35u, 34u, 31u, 30u, 23u, 17u, 16u, 16u, 15u, 15u, 17u, 19u, 21u, 22u, 24u, 23u, 21u, 21u, 23u, 24u, 21u, 17u, 14u, 12u, 10u, 6u, 5u, 6u, 7u, 7u, 7u, 8u, 8u, 7u, 8u, 7u, 7u, 9u, 10u, 10u, 12u, 17u, 25u, 28u, 34u, 38u, 43u, 50u, 65u, 72u }, 
-	{ 65u, 57u, 49u, 43u, 39u, 33u, 33u, 33u, 32u, 31u, 29u, 28u, 27u, 26u, 26u, 24u, 22u, 21u, 21u, 21u, 21u, 21u, 22u, 24u, 26u, 28u, 30u, 33u, 36u, 42u, 50u, 55u, 60u, 66u, 69u, 68u, 70u, 71u, 68u, 65u, 62u, 60u, 59u, 62u, 64u, 63u, 66u, 63u, 63u, 66u, 68u, 70u, 73u, 76u, 76u, 76u, 75u, 77u, 82u, 84u, 88u, 94u, 101u, 106u, 107u, 105u, 105u, 107u, 108u, 110u, 105u, 97u, 88u, 85u, 91u, 98u, 101u, 106u, 112u, 120u, 124u, 127u, 132u, 132u, 134u, 133u, 129u, 126u, 122u, 122u, 121u, 121u, 120u, 121u, 123u, 131u, 132u, 130u, 130u, 127u, 127u, 125u, 118u, 112u, 109u, 97u, 86u, 80u, 80u, 85u, 88u, 90u, 92u, 94u, 96u, 99u, 104u, 109u, 111u, 110u, 109u, 102u, 97u, 92u, 85u, 79u, 77u, 72u, 65u, 60u, 55u, 50u, 47u, 43u, 40u, 35u, 31u, 27u, 24u, 21u, 18u, 16u, 14u, 11u, 9u, 7u, 6u, 5u, 4u, 4u, 3u, 3u, 2u, 2u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 2u, 2u, 3u, 4u, 5u, 7u, 9u, 12u, 15u, 18u, 23u, 29u, 35u, 41u, 48u, 56u, 62u, 67u, 73u, 78u, 83u, 85u, 86u, 87u, 87u, 87u, 87u, 88u, 87u, 87u, 87u, 84u, 87u, 91u, 87u, 85u, 87u, 85u, 89u, 85u, 74u, 64u, 53u, 48u, 42u, 35u, 31u, 29u, 22u, 18u, 18u, 18u, 15u, 14u, 16u, 18u, 20u, 21u, 21u, 20u, 20u, 19u, 18u, 20u, 19u, 15u, 12u, 10u, 9u, 6u, 5u, 4u, 5u, 6u, 7u, 7u, 6u, 6u, 7u, 6u, 8u, 11u, 11u, 11u, 12u, 19u, 30u, 36u, 47u, 48u, 52u, 60u, 65u, 64u }, 
-	{ 60u, 54u, 49u, 42u, 37u, 32u, 33u, 34u, 32u, 31u, 29u, 28u, 28u, 27u, 26u, 23u, 21u, 21u, 21u, 21u, 22u, 22u, 23u, 24u, 26u, 29u, 30u, 33u, 37u, 42u, 49u, 54u, 59u, 64u, 67u, 69u, 69u, 68u, 66u, 63u, 61u, 61u, 60u, 61u, 64u, 62u, 63u, 63u, 64u, 66u, 68u, 68u, 70u, 71u, 72u, 70u, 70u, 71u, 75u, 76u, 81u, 87u, 97u, 99u, 100u, 102u, 100u, 100u, 103u, 105u, 98u, 90u, 86u, 80u, 82u, 93u, 102u, 107u, 109u, 111u, 117u, 121u, 126u, 131u, 134u, 132u, 128u, 124u, 119u, 116u, 113u, 114u, 116u, 113u, 112u, 119u, 119u, 119u, 117u, 117u, 123u, 122u, 117u, 110u, 104u, 96u, 89u, 86u, 83u, 87u, 92u, 92u, 97u, 101u, 108u, 110u, 114u, 119u, 117u, 115u, 117u, 112u, 105u, 94u, 86u, 80u, 77u, 71u, 63u, 57u, 52u, 46u, 43u, 41u, 38u, 33u, 29u, 25u, 22u, 19u, 17u, 15u, 12u, 10u, 8u, 7u, 6u, 5u, 4u, 3u, 3u, 2u, 2u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 2u, 3u, 3u, 5u, 6u, 8u, 11u, 14u, 18u, 22u, 28u, 34u, 41u, 48u, 55u, 61u, 69u, 75u, 81u, 85u, 88u, 90u, 89u, 90u, 91u, 92u, 92u, 87u, 85u, 89u, 91u, 96u, 99u, 100u, 96u, 93u, 95u, 93u, 85u, 74u, 68u, 55u, 49u, 47u, 42u, 38u, 35u, 29u, 23u, 22u, 21u, 18u, 17u, 17u, 19u, 19u, 16u, 16u, 18u, 18u, 15u, 13u, 13u, 15u, 16u, 12u, 10u, 8u, 6u, 4u, 3u, 5u, 6u, 8u, 7u, 7u, 7u, 7u, 7u, 8u, 12u, 15u, 14u, 14u, 23u, 39u, 51u, 59u, 52u, 56u, 68u, 65u, 69u }, 
-	{ 56u, 52u, 48u, 41u, 36u, 32u, 32u, 33u, 32u, 32u, 30u, 28u, 30u, 28u, 25u, 22u, 22u, 22u, 22u, 23u, 24u, 24u, 25u, 26u, 27u, 29u, 31u, 34u, 38u, 42u, 48u, 53u, 58u, 62u, 67u, 70u, 69u, 68u, 66u, 64u, 62u, 61u, 59u, 60u, 60u, 61u, 62u, 65u, 66u, 68u, 69u, 69u, 67u, 69u, 67u, 64u, 63u, 65u, 66u, 66u, 70u, 79u, 87u, 91u, 92u, 98u, 100u, 100u, 99u, 98u, 97u, 92u, 87u, 80u, 78u, 87u, 98u, 101u, 104u, 106u, 113u, 119u, 126u, 133u, 131u, 127u, 127u, 124u, 116u, 109u, 110u, 115u, 115u, 116u, 114u, 112u, 109u, 112u, 112u, 114u, 117u, 116u, 112u, 107u, 103u, 92u, 89u, 87u, 88u, 92u, 98u, 99u, 104u, 111u, 119u, 119u, 123u, 123u, 122u, 121u, 120u, 116u, 107u, 96u, 87u, 79u, 75u, 69u, 63u, 55u, 49u, 44u, 40u, 37u, 34u, 31u, 27u, 24u, 21u, 18u, 16u, 13u, 11u, 9u, 8u, 6u, 5u, 4u, 4u, 3u, 2u, 2u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 2u, 3u, 4u, 6u, 8u, 10u, 13u, 17u, 22u, 27u, 34u, 41u, 47u, 54u, 61u, 69u, 78u, 84u, 89u, 92u, 93u, 93u, 93u, 93u, 93u, 90u, 85u, 84u, 84u, 93u, 99u, 101u, 106u, 104u, 100u, 95u, 93u, 81u, 78u, 68u, 60u, 54u, 46u, 42u, 39u, 37u, 31u, 28u, 28u, 26u, 23u, 25u, 25u, 22u, 22u, 19u, 17u, 18u, 18u, 15u, 12u, 11u, 14u, 15u, 13u, 10u, 8u, 6u, 5u, 4u, 6u, 7u, 8u, 6u, 6u, 7u, 6u, 8u, 10u, 13u, 15u, 15u, 19u, 34u, 51u, 63u, 64u, 59u, 64u, 74u, 80u, 81u }, 
-	{ 54u, 49u, 45u, 40u, 36u, 33u, 31u, 32u, 33u, 33u, 31u, 30u, 31u, 29u, 26u, 24u, 24u, 24u, 25u, 25u, 26u, 26u, 27u, 27u, 28u, 29u, 33u, 36u, 39u, 43u, 47u, 53u, 57u, 62u, 67u, 70u, 71u, 70u, 66u, 65u, 62u, 60u, 58u, 58u, 59u, 59u, 59u, 61u, 62u, 65u, 67u, 66u, 67u, 65u, 62u, 59u, 60u, 61u, 58u, 56u, 63u, 71u, 77u, 81u, 84u, 91u, 100u, 101u, 99u, 96u, 95u, 92u, 91u, 90u, 83u, 86u, 94u, 98u, 101u, 107u, 118u, 121u, 125u, 126u, 125u, 123u, 124u, 119u, 115u, 108u, 110u, 116u, 115u, 112u, 106u, 102u, 103u, 108u, 108u, 108u, 107u, 107u, 109u, 103u, 95u, 90u, 89u, 89u, 95u, 100u, 105u, 106u, 111u, 118u, 123u, 124u, 127u, 128u, 129u, 127u, 126u, 120u, 109u, 96u, 87u, 78u, 73u, 69u, 62u, 53u, 47u, 42u, 38u, 35u, 31u, 29u, 25u, 22u, 20u, 17u, 14u, 12u, 10u, 9u, 7u, 6u, 5u, 4u, 3u, 3u, 2u, 2u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 2u, 3u, 5u, 7u, 10u, 13u, 16u, 21u, 27u, 33u, 40u, 46u, 54u, 62u, 71u, 79u, 87u, 94u, 97u, 97u, 97u, 97u, 96u, 93u, 88u, 82u, 84u, 86u, 95u, 102u, 106u, 105u, 106u, 104u, 95u, 89u, 87u, 86u, 76u, 69u, 54u, 44u, 40u, 38u, 37u, 34u, 34u, 33u, 29u, 27u, 29u, 31u, 31u, 29u, 23u, 19u, 19u, 19u, 16u, 14u, 12u, 12u, 11u, 11u, 9u, 8u, 8u, 6u, 5u, 7u, 8u, 8u, 7u, 8u, 7u, 6u, 6u, 9u, 13u, 13u, 17u, 26u, 43u, 60u, 67u, 63u, 63u, 75u, 80u, 82u, 85u }, 
-	{ 50u, 47u, 43u, 40u, 38u, 35u, 33u, 34u, 35u, 33u, 31u, 30u, 31u, 30u, 27u, 26u, 26u, 27u, 27u, 27u, 28u, 29u, 30u, 30u, 31u, 32u, 34u, 38u, 40u, 44u, 48u, 53u, 57u, 63u, 68u, 71u, 74u, 69u, 67u, 68u, 65u, 60u, 57u, 57u, 60u, 58u, 57u, 57u, 60u, 61u, 63u, 63u, 64u, 58u, 56u, 55u, 57u, 54u, 54u, 55u, 62u, 70u, 76u, 82u, 86u, 90u, 95u, 92u, 89u, 88u, 88u, 86u, 89u, 94u, 91u, 89u, 93u, 101u, 103u, 106u, 116u, 117u, 119u, 116u, 119u, 121u, 122u, 116u, 114u, 109u, 112u, 113u, 111u, 109u, 101u, 95u, 98u, 105u, 106u, 104u, 100u, 102u, 99u, 94u, 91u, 88u, 87u, 89u, 96u, 99u, 103u, 108u, 115u, 122u, 125u, 124u, 124u, 125u, 129u, 131u, 131u, 122u, 113u, 100u, 90u, 80u, 76u, 70u, 62u, 53u, 46u, 42u, 38u, 34u, 30u, 27u, 24u, 21u, 18u, 16u, 13u, 11u, 9u, 8u, 7u, 6u, 5u, 4u, 3u, 3u, 2u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 2u, 3u, 4u, 6u, 9u, 12u, 16u, 21u, 27u, 33u, 40u, 48u, 56u, 66u, 73u, 83u, 92u, 99u, 102u, 102u, 101u, 101u, 99u, 97u, 92u, 87u, 85u, 88u, 96u, 107u, 116u, 118u, 116u, 115u, 109u, 95u, 98u, 92u, 77u, 67u, 54u, 44u, 39u, 41u, 41u, 39u, 36u, 31u, 32u, 32u, 34u, 32u, 34u, 29u, 21u, 20u, 20u, 20u, 20u, 18u, 14u, 10u, 9u, 9u, 8u, 8u, 8u, 5u, 4u, 5u, 6u, 7u, 8u, 9u, 7u, 7u, 8u, 9u, 10u, 12u, 20u, 29u, 43u, 58u, 66u, 64u, 69u, 81u, 84u, 84u, 92u }, 
-	{ 46u, 44u, 42u, 38u, 37u, 35u, 33u, 34u, 34u, 32u, 30u, 28u, 30u, 29u, 28u, 27u, 28u, 29u, 30u, 29u, 30u, 32u, 33u, 33u, 34u, 35u, 36u, 38u, 41u, 45u, 49u, 54u, 59u, 66u, 70u, 74u, 74u, 71u, 70u, 69u, 65u, 59u, 57u, 57u, 57u, 58u, 55u, 55u, 56u, 56u, 57u, 55u, 56u, 54u, 54u, 53u, 52u, 52u, 51u, 57u, 64u, 69u, 77u, 83u, 84u, 89u, 90u, 91u, 86u, 80u, 81u, 82u, 85u, 96u, 96u, 91u, 94u, 101u, 101u, 105u, 113u, 115u, 114u, 108u, 113u, 117u, 113u, 113u, 116u, 114u, 113u, 109u, 107u, 105u, 96u, 88u, 88u, 97u, 100u, 99u, 93u, 91u, 90u, 91u, 90u, 88u, 85u, 85u, 89u, 97u, 101u, 104u, 113u, 120u, 126u, 124u, 122u, 123u, 128u, 135u, 139u, 130u, 119u, 107u, 96u, 86u, 80u, 72u, 62u, 54u, 47u, 41u, 37u, 33u, 28u, 25u, 22u, 19u, 17u, 15u, 12u, 10u, 8u, 7u, 6u, 5u, 4u, 3u, 3u, 2u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 2u, 4u, 6u, 8u, 12u, 16u, 22u, 27u, 34u, 42u, 50u, 59u, 70u, 78u, 88u, 97u, 104u, 107u, 106u, 106u, 105u, 104u, 101u, 98u, 89u, 85u, 88u, 96u, 107u, 114u, 120u, 119u, 123u, 117u, 107u, 102u, 93u, 74u, 61u, 50u, 45u, 42u, 46u, 47u, 42u, 36u, 37u, 36u, 37u, 37u, 33u, 33u, 28u, 21u, 22u, 25u, 25u, 24u, 22u, 15u, 12u, 10u, 9u, 9u, 8u, 6u, 4u, 3u, 4u, 5u, 6u, 7u, 8u, 6u, 7u, 9u, 11u, 11u, 13u, 18u, 24u, 35u, 50u, 66u, 72u, 73u, 83u, 81u, 84u, 94u }, 
-	{ 44u, 42u, 39u, 36u, 34u, 34u, 34u, 34u, 34u, 32u, 31u, 28u, 28u, 28u, 29u, 29u, 31u, 32u, 33u, 32u, 32u, 33u, 35u, 36u, 37u, 37u, 38u, 41u, 46u, 50u, 52u, 56u, 63u, 68u, 69u, 71u, 71u, 68u, 68u, 68u, 65u, 59u, 57u, 55u, 54u, 55u, 52u, 51u, 50u, 51u, 51u, 50u, 50u, 50u, 49u, 50u, 50u, 51u, 52u, 59u, 65u, 67u, 74u, 77u, 82u, 87u, 87u, 88u, 79u, 74u, 79u, 82u, 84u, 96u, 96u, 91u, 94u, 102u, 108u, 115u, 119u, 117u, 111u, 108u, 113u, 113u, 108u, 108u, 109u, 111u, 112u, 110u, 107u, 103u, 92u, 84u, 83u, 90u, 89u, 84u, 84u, 87u, 83u, 86u, 85u, 85u, 83u, 87u, 89u, 96u, 101u, 105u, 113u, 119u, 124u, 125u, 124u, 124u, 129u, 137u, 141u, 134u, 121u, 107u, 96u, 85u, 77u, 71u, 63u, 54u, 47u, 41u, 36u, 31u, 27u, 24u, 20u, 18u, 15u, 13u, 11u, 9u, 8u, 6u, 5u, 4u, 3u, 3u, 2u, 2u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 2u, 4u, 6u, 9u, 12u, 17u, 22u, 29u, 35u, 43u, 52u, 62u, 72u, 82u, 92u, 102u, 108u, 112u, 112u, 111u, 110u, 109u, 104u, 99u, 94u, 89u, 92u, 98u, 104u, 114u, 124u, 120u, 122u, 118u, 115u, 108u, 90u, 70u, 57u, 45u, 47u, 49u, 45u, 44u, 48u, 47u, 46u, 42u, 40u, 39u, 37u, 34u, 29u, 24u, 25u, 28u, 30u, 27u, 21u, 16u, 13u, 10u, 8u, 8u, 7u, 5u, 4u, 3u, 3u, 3u, 5u, 6u, 6u, 5u, 6u, 8u, 9u, 10u, 10u, 15u, 22u, 29u, 37u, 51u, 65u, 73u, 75u, 78u, 82u, 83u }, 
-	{ 40u, 38u, 36u, 35u, 33u, 32u, 32u, 31u, 31u, 30u, 29u, 27u, 26u, 28u, 29u, 30u, 32u, 34u, 35u, 35u, 35u, 37u, 39u, 39u, 41u, 41u, 42u, 45u, 49u, 51u, 54u, 57u, 61u, 65u, 66u, 66u, 67u, 64u, 64u, 67u, 63u, 58u, 57u, 54u, 52u, 50u, 47u, 46u, 46u, 48u, 49u, 48u, 47u, 46u, 44u, 45u, 48u, 53u, 54u, 57u, 60u, 64u, 68u, 71u, 78u, 82u, 80u, 80u, 75u, 69u, 75u, 76u, 77u, 88u, 89u, 83u, 83u, 92u, 106u, 114u, 114u, 113u, 108u, 110u, 113u, 112u, 105u, 99u, 103u, 107u, 109u, 105u, 99u, 94u, 83u, 79u, 80u, 82u, 79u, 78u, 79u, 82u, 82u, 86u, 86u, 87u, 85u, 87u, 92u, 101u, 106u, 109u, 115u, 119u, 126u, 129u, 130u, 128u, 131u, 134u, 133u, 129u, 119u, 106u, 95u, 84u, 74u, 66u, 60u, 53u, 45u, 41u, 35u, 30u, 26u, 22u, 19u, 16u, 14u, 12u, 10u, 8u, 7u, 6u, 4u, 3u, 3u, 3u, 2u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 2u, 4u, 6u, 9u, 13u, 17u, 23u, 30u, 37u, 45u, 55u, 65u, 75u, 86u, 96u, 106u, 111u, 114u, 117u, 115u, 113u, 111u, 107u, 99u, 98u, 92u, 91u, 94u, 101u, 114u, 118u, 117u, 122u, 124u, 125u, 117u, 96u, 73u, 58u, 55u, 56u, 52u, 48u, 46u, 51u, 58u, 53u, 50u, 44u, 40u, 36u, 30u, 26u, 24u, 24u, 27u, 30u, 26u, 20u, 16u, 12u, 10u, 8u, 7u, 6u, 5u, 5u, 5u, 3u, 4u, 5u, 4u, 5u, 6u, 7u, 8u, 8u, 8u, 10u, 14u, 20u, 26u, 28u, 35u, 43u, 59u, 63u, 69u, 69u, 73u }, 
-	{ 35u, 33u, 32u, 32u, 31u, 29u, 29u, 29u, 28u, 28u, 27u, 25u, 26u, 27u, 28u, 30u, 33u, 35u, 37u, 39u, 41u, 44u, 45u, 45u, 48u, 48u, 48u, 49u, 50u, 50u, 53u, 56u, 59u, 61u, 62u, 63u, 60u, 61u, 64u, 64u, 61u, 57u, 57u, 53u, 51u, 46u, 43u, 42u, 44u, 45u, 47u, 47u, 45u, 42u, 41u, 41u, 46u, 52u, 55u, 55u, 59u, 66u, 68u, 74u, 78u, 79u, 77u, 70u, 67u, 66u, 67u, 69u, 76u, 82u, 86u, 80u, 80u, 85u, 96u, 103u, 106u, 104u, 104u, 107u, 113u, 110u, 102u, 99u, 103u, 105u, 109u, 103u, 98u, 90u, 82u, 77u, 76u, 77u, 75u, 77u, 78u, 80u, 85u, 90u, 91u, 93u, 90u, 92u, 101u, 109u, 113u, 115u, 118u, 120u, 126u, 132u, 132u, 127u, 126u, 127u, 125u, 122u, 114u, 105u, 95u, 85u, 71u, 63u, 57u, 50u, 43u, 38u, 33u, 29u, 24u, 20u, 16u, 15u, 13u, 11u, 9u, 7u, 6u, 5u, 4u, 3u, 2u, 2u, 2u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 2u, 3u, 4u, 6u, 9u, 13u, 18u, 24u, 31u, 39u, 48u, 58u, 69u, 79u, 89u, 100u, 108u, 113u, 117u, 119u, 117u, 114u, 113u, 108u, 101u, 96u, 92u, 87u, 88u, 98u, 104u, 111u, 117u, 123u, 129u, 129u, 114u, 95u, 76u, 67u, 73u, 71u, 63u, 58u, 62u, 64u, 70u, 66u, 58u, 48u, 38u, 33u, 25u, 23u, 24u, 27u, 28u, 32u, 28u, 21u, 17u, 14u, 12u, 9u, 7u, 7u, 7u, 7u, 6u, 5u, 5u, 5u, 4u, 5u, 8u, 8u, 7u, 7u, 7u, 9u, 13u, 17u, 18u, 21u, 24u, 30u, 45u, 52u, 58u, 65u, 71u }, 
-	{ 31u, 30u, 29u, 28u, 27u, 27u, 27u, 27u, 26u, 25u, 24u, 25u, 26u, 28u, 29u, 31u, 34u, 36u, 40u, 43u, 47u, 51u, 52u, 54u, 55u, 56u, 58u, 57u, 54u, 53u, 54u, 57u, 62u, 62u, 60u, 61u, 59u, 61u, 65u, 62u, 59u, 58u, 56u, 50u, 47u, 42u, 39u, 38u, 39u, 42u, 43u, 43u, 42u, 41u, 41u, 42u, 46u, 52u, 55u, 57u, 61u, 66u, 71u, 75u, 79u, 81u, 79u, 68u, 63u, 65u, 66u, 71u, 76u, 74u, 77u, 80u, 86u, 85u, 88u, 96u, 98u, 96u, 101u, 102u, 105u, 106u, 102u, 105u, 104u, 102u, 104u, 103u, 99u, 91u, 84u, 82u, 81u, 78u, 77u, 77u, 78u, 81u, 89u, 96u, 99u, 98u, 98u, 105u, 112u, 115u, 119u, 120u, 124u, 128u, 128u, 130u, 132u, 124u, 121u, 118u, 116u, 115u, 107u, 99u, 93u, 84u, 71u, 61u, 55u, 49u, 43u, 37u, 31u, 25u, 20u, 17u, 15u, 14u, 12u, 10u, 9u, 7u, 6u, 5u, 4u, 3u, 2u, 2u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 2u, 3u, 5u, 7u, 10u, 14u, 20u, 26u, 33u, 41u, 50u, 61u, 72u, 83u, 92u, 102u, 111u, 117u, 121u, 122u, 122u, 117u, 115u, 110u, 103u, 97u, 92u, 88u, 91u, 89u, 87u, 94u, 115u, 130u, 134u, 126u, 111u, 95u, 85u, 85u, 90u, 84u, 76u, 75u, 79u, 72u, 74u, 73u, 61u, 50u, 39u, 30u, 25u, 25u, 26u, 30u, 32u, 33u, 27u, 20u, 16u, 15u, 13u, 11u, 10u, 8u, 7u, 9u, 9u, 6u, 5u, 5u, 5u, 6u, 7u, 7u, 6u, 6u, 6u, 6u, 10u, 12u, 12u, 15u, 19u, 27u, 42u, 49u, 52u, 58u, 72u }, 
-	{ 26u, 26u, 25u, 25u, 25u, 24u, 25u, 25u, 24u, 24u, 23u, 25u, 26u, 27u, 28u, 30u, 34u, 37u, 41u, 46u, 51u, 56u, 58u, 60u, 62u, 61u, 64u, 64u, 61u, 60u, 59u, 64u, 67u, 64u, 60u, 61u, 61u, 60u, 62u, 60u, 57u, 57u, 53u, 48u, 44u, 40u, 37u, 38u, 37u, 39u, 39u, 39u, 36u, 37u, 38u, 41u, 45u, 51u, 54u, 61u, 65u, 67u, 70u, 76u, 80u, 77u, 75u, 65u, 60u, 58u, 60u, 63u, 69u, 71u, 74u, 86u, 89u, 91u, 87u, 93u, 97u, 95u, 99u, 101u, 105u, 109u, 107u, 108u, 107u, 106u, 103u, 99u, 94u, 84u, 78u, 79u, 81u, 79u, 79u, 81u, 84u, 86u, 95u, 103u, 103u, 104u, 106u, 112u, 120u, 123u, 125u, 127u, 132u, 133u, 130u, 132u, 131u, 124u, 117u, 114u, 109u, 107u, 103u, 97u, 91u, 81u, 70u, 62u, 54u, 47u, 41u, 35u, 28u, 22u, 19u, 15u, 14u, 12u, 11u, 10u, 8u, 7u, 5u, 4u, 3u, 3u, 2u, 2u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 2u, 2u, 4u, 5u, 8u, 11u, 15u, 21u, 27u, 35u, 44u, 53u, 63u, 75u, 86u, 95u, 104u, 114u, 119u, 124u, 124u, 123u, 118u, 116u, 115u, 112u, 105u, 95u, 87u, 85u, 82u, 82u, 86u, 104u, 121u, 129u, 122u, 120u, 110u, 98u, 95u, 101u, 98u, 100u, 100u, 91u, 81u, 78u, 77u, 63u, 50u, 40u, 31u, 27u, 27u, 29u, 31u, 31u, 29u, 25u, 18u, 15u, 15u, 14u, 11u, 11u, 11u, 9u, 11u, 12u, 10u, 8u, 8u, 9u, 8u, 7u, 6u, 5u, 5u, 5u, 6u, 9u, 11u, 12u, 16u, 21u, 33u, 41u, 48u, 49u, 56u, 62u }, 
-	{ 23u, 23u, 22u, 23u, 23u, 22u, 22u, 22u, 22u, 22u, 24u, 26u, 26u, 26u, 26u, 29u, 34u, 38u, 41u, 47u, 52u, 60u, 64u, 68u, 69u, 68u, 67u, 69u, 66u, 68u, 69u, 71u, 69u, 66u, 58u, 60u, 63u, 63u, 60u, 57u, 53u, 49u, 45u, 45u, 41u, 39u, 37u, 38u, 38u, 37u, 36u, 34u, 31u, 31u, 35u, 39u, 44u, 51u, 57u, 62u, 66u, 70u, 73u, 80u, 81u, 76u, 73u, 64u, 57u, 54u, 54u, 58u, 64u, 72u, 81u, 86u, 89u, 94u, 90u, 89u, 93u, 96u, 103u, 108u, 111u, 109u, 107u, 109u, 108u, 106u, 99u, 93u, 87u, 80u, 75u, 76u, 79u, 81u, 83u, 85u, 90u, 95u, 98u, 106u, 110u, 111u, 113u, 118u, 126u, 128u, 129u, 133u, 139u, 136u, 136u, 135u, 131u, 127u, 121u, 115u, 105u, 100u, 95u, 90u, 86u, 80u, 70u, 61u, 51u, 44u, 39u, 33u, 27u, 21u, 19u, 15u, 13u, 12u, 10u, 9u, 7u, 6u, 5u, 4u, 3u, 3u, 2u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 0u, 0u, 0u, 0u, 1u, 1u, 1u, 1u, 2u, 2u, 3u, 4u, 6u, 9u, 12u, 17u, 23u, 29u, 37u, 46u, 55u, 66u, 78u, 89u, 98u, 107u, 116u, 121u, 126u, 127u, 123u, 118u, 118u, 119u, 122u, 116u, 104u, 93u, 83u, 84u, 84u, 88u, 93u, 103u, 115u, 116u, 123u, 121u, 112u, 107u, 109u, 111u, 120u, 110u, 97u, 86u, 79u, 68u, 57u, 44u, 35u, 29u, 27u, 27u, 27u, 26u, 27u, 23u, 20u, 15u, 13u, 12u, 13u, 13u, 12u, 12u, 11u, 11u, 15u, 14u, 13u, 12u, 12u, 11u, 8u, 7u, 6u, 6u, 6u, 7u, 9u, 12u, 13u, 17u, 20u, 31u, 42u, 51u, 56u, 58u, 60u }, 
-	{ 21u, 20u, 19u, 20u, 20u, 21u, 21u, 21u, 22u, 23u, 24u, 25u, 24u, 24u, 26u, 29u, 32u, 37u, 41u, 50u, 56u, 60u, 62u, 69u, 72u, 72u, 69u, 70u, 66u, 69u, 74u, 75u, 70u, 66u, 57u, 59u, 64u, 62u, 56u, 52u, 48u, 44u, 39u, 38u, 35u, 34u, 35u, 36u, 35u, 32u, 31u, 29u, 28u, 28u, 34u, 39u, 44u, 50u, 55u, 57u, 62u, 68u, 73u, 80u, 81u, 78u, 70u, 63u, 60u, 59u, 59u, 60u, 62u, 70u, 79u, 85u, 89u, 91u, 90u, 90u, 94u, 101u, 109u, 109u, 109u, 108u, 107u, 110u, 109u, 107u, 101u, 99u, 91u, 82u, 79u, 79u, 84u, 85u, 85u, 90u, 95u, 98u, 103u, 110u, 115u, 116u, 120u, 125u, 130u, 131u, 134u, 136u, 138u, 137u, 139u, 135u, 134u, 130u, 123u, 114u, 99u, 89u, 83u, 78u, 77u, 74u, 66u, 59u, 50u, 44u, 38u, 31u, 24u, 20u, 19u, 16u, 13u, 12u, 10u, 9u, 7u, 6u, 5u, 4u, 3u, 3u, 2u, 2u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 0u, 1u, 1u, 1u, 1u, 2u, 2u, 3u, 3u, 4u, 6u, 8u, 11u, 14u, 19u, 25u, 32u, 40u, 50u, 59u, 70u, 81u, 92u, 101u, 111u, 119u, 122u, 125u, 128u, 128u, 124u, 125u, 126u, 131u, 128u, 116u, 102u, 85u, 84u, 84u, 85u, 86u, 90u, 100u, 109u, 116u, 112u, 113u, 114u, 117u, 121u, 130u, 120u, 104u, 93u, 78u, 57u, 46u, 38u, 31u, 28u, 26u, 24u, 23u, 23u, 27u, 25u, 20u, 15u, 12u, 11u, 13u, 14u, 11u, 10u, 11u, 12u, 15u, 16u, 15u, 14u, 13u, 12u, 11u, 9u, 8u, 7u, 8u, 9u, 11u, 13u, 13u, 18u, 23u, 30u, 40u, 54u, 60u, 58u, 59u }, 
-	{ 18u, 18u, 18u, 19u, 19u, 20u, 19u, 20u, 21u, 23u, 24u, 23u, 22u, 22u, 24u, 28u, 31u, 35u, 42u, 51u, 56u, 57u, 58u, 65u, 68u, 68u, 67u, 70u, 69u, 71u, 74u, 75u, 67u, 62u, 55u, 58u, 61u, 58u, 52u, 47u, 45u, 39u, 36u, 34u, 32u, 32u, 33u, 34u, 34u, 31u, 27u, 26u, 25u, 27u, 33u, 36u, 39u, 46u, 50u, 52u, 57u, 62u, 68u, 73u, 74u, 70u, 66u, 66u, 61u, 58u, 61u, 59u, 57u, 61u, 71u, 83u, 82u, 84u, 90u, 90u, 98u, 107u, 111u, 108u, 110u, 112u, 111u, 112u, 110u, 108u, 103u, 103u, 95u, 90u, 87u, 89u, 91u, 92u, 90u, 94u, 100u, 101u, 106u, 111u, 116u, 118u, 126u, 131u, 134u, 135u, 135u, 137u, 137u, 137u, 137u, 135u, 133u, 128u, 123u, 110u, 96u, 84u, 75u, 73u, 70u, 68u, 61u, 57u, 52u, 45u, 40u, 31u, 24u, 19u, 18u, 16u, 14u, 12u, 11u, 9u, 7u, 6u, 5u, 4u, 3u, 3u, 2u, 2u, 1u, 2u, 2u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 1u, 2u, 2u, 2u, 3u, 4u, 4u, 6u, 7u, 9u, 12u, 17u, 22u, 28u, 35u, 44u, 53u, 63u, 73u, 84u, 94u, 104u, 114u, 122u, 126u, 127u, 130u, 130u, 129u, 131u, 132u, 139u, 140u, 131u, 112u, 96u, 90u, 85u, 84u, 79u, 84u, 93u, 104u, 103u, 103u, 114u, 116u, 123u, 128u, 133u, 122u, 106u, 94u, 72u, 55u, 42u, 35u, 30u, 27u, 23u, 20u, 20u, 22u, 26u, 26u, 21u, 16u, 12u, 10u, 11u, 10u, 9u, 9u, 13u, 13u, 15u, 18u, 18u, 17u, 17u, 16u, 13u, 10u, 8u, 8u, 7u, 10u, 13u, 16u, 17u, 23u, 27u, 34u, 45u, 59u, 65u, 66u, 62u }, 
-	{ 16u, 16u, 17u, 17u, 17u, 18u, 18u, 19u, 21u, 22u, 22u, 22u, 22u, 21u, 23u, 25u, 28u, 32u, 41u, 49u, 53u, 53u, 58u, 65u, 63u, 59u, 60u, 66u, 68u, 72u, 69u, 68u, 62u, 57u, 52u, 53u, 55u, 56u, 46u, 42u, 41u, 39u, 36u, 33u, 32u, 31u, 33u, 33u, 33u, 31u, 29u, 26u, 25u, 28u, 33u, 35u, 38u, 45u, 48u, 48u, 52u, 55u, 60u, 62u, 64u, 61u, 60u, 62u, 58u, 56u, 56u, 55u, 52u, 56u, 65u, 77u, 82u, 84u, 88u, 89u, 97u, 105u, 107u, 109u, 112u, 106u, 103u, 106u, 109u, 111u, 109u, 103u, 96u, 92u, 89u, 91u, 97u, 101u, 99u, 100u, 102u, 100u, 105u, 115u, 120u, 123u, 130u, 131u, 135u, 138u, 135u, 135u, 136u, 136u, 137u, 133u, 130u, 128u, 122u, 106u, 93u, 81u, 74u, 70u, 67u, 64u, 57u, 54u, 53u, 48u, 40u, 32u, 26u, 20u, 17u, 16u, 14u, 13u, 11u, 9u, 8u, 6u, 5u, 4u, 3u, 3u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 2u, 3u, 3u, 4u, 5u, 6u, 7u, 9u, 11u, 15u, 19u, 25u, 31u, 39u, 47u, 57u, 66u, 77u, 87u, 96u, 105u, 116u, 123u, 128u, 129u, 130u, 131u, 132u, 135u, 137u, 142u, 146u, 141u, 123u, 105u, 94u, 86u, 83u, 82u, 87u, 86u, 94u, 94u, 93u, 102u, 111u, 119u, 125u, 132u, 119u, 101u, 84u, 64u, 51u, 41u, 37u, 31u, 24u, 20u, 20u, 20u, 23u, 25u, 26u, 20u, 16u, 12u, 9u, 8u, 9u, 10u, 10u, 13u, 14u, 16u, 20u, 22u, 21u, 18u, 18u, 15u, 13u, 9u, 8u, 8u, 10u, 16u, 19u, 19u, 24u, 30u, 40u, 50u, 65u, 76u, 82u, 75u }, 
-	{ 14u, 15u, 16u, 16u, 16u, 17u, 17u, 18u, 20u, 20u, 21u, 22u, 21u, 21u, 23u, 25u, 28u, 31u, 37u, 44u, 48u, 52u, 58u, 63u, 66u, 61u, 61u, 66u, 69u, 68u, 64u, 63u, 59u, 53u, 50u, 51u, 50u, 51u, 48u, 44u, 40u, 37u, 34u, 33u, 33u, 32u, 31u, 32u, 31u, 29u, 29u, 26u, 25u, 29u, 33u, 35u, 41u, 48u, 51u, 49u, 50u, 49u, 52u, 54u, 57u, 54u, 51u, 51u, 53u, 54u, 55u, 58u, 54u, 56u, 66u, 77u, 85u, 90u, 91u, 91u, 102u, 111u, 109u, 108u, 107u, 105u, 95u, 94u, 99u, 101u, 99u, 97u, 94u, 93u, 88u, 89u, 95u, 102u, 101u, 102u, 105u, 103u, 108u, 115u, 116u, 120u, 128u, 130u, 131u, 137u, 137u, 136u, 137u, 139u, 138u, 130u, 122u, 123u, 116u, 103u, 93u, 84u, 74u, 67u, 66u, 64u, 59u, 54u, 53u, 48u, 42u, 35u, 29u, 23u, 18u, 16u, 14u, 13u, 11u, 9u, 8u, 7u, 6u, 5u, 4u, 3u, 3u, 2u, 2u, 2u, 2u, 2u, 2u, 3u, 3u, 3u, 3u, 3u, 3u, 4u, 4u, 5u, 5u, 6u, 7u, 9u, 11u, 14u, 18u, 23u, 28u, 35u, 43u, 51u, 61u, 71u, 81u, 90u, 99u, 108u, 116u, 124u, 130u, 134u, 135u, 135u, 136u, 140u, 143u, 147u, 153u, 147u, 129u, 115u, 101u, 92u, 86u, 85u, 88u, 86u, 82u, 80u, 87u, 95u, 103u, 103u, 107u, 113u, 110u, 95u, 77u, 59u, 50u, 42u, 40u, 32u, 24u, 20u, 23u, 25u, 28u, 30u, 30u, 21u, 16u, 12u, 9u, 8u, 9u, 9u, 10u, 14u, 19u, 22u, 27u, 27u, 25u, 19u, 19u, 17u, 15u, 15u, 15u, 13u, 15u, 22u, 24u, 23u, 26u, 32u, 43u, 50u, 67u, 77u, 88u, 83u }, 
-	{ 14u, 14u, 14u, 14u, 14u, 14u, 15u, 16u, 17u, 18u, 19u, 18u, 19u, 20u, 23u, 25u, 27u, 28u, 33u, 40u, 44u, 49u, 54u, 63u, 67u, 62u, 63u, 70u, 67u, 64u, 61u, 57u, 55u, 47u, 47u, 48u, 48u, 49u, 47u, 41u, 37u, 33u, 33u, 34u, 36u, 34u, 32u, 32u, 30u, 30u, 27u, 26u, 26u, 30u, 35u, 37u, 42u, 49u, 54u, 49u, 48u, 49u, 47u, 47u, 48u, 47u, 43u, 43u, 46u, 51u, 56u, 59u, 54u, 58u, 69u, 79u, 93u, 100u, 95u, 95u, 101u, 111u, 107u, 101u, 105u, 98u, 86u, 87u, 88u, 86u, 86u, 81u, 85u, 88u, 89u, 89u, 93u, 99u, 102u, 105u, 106u, 108u, 111u, 109u, 111u, 117u, 129u, 133u, 135u, 141u, 141u, 140u, 139u, 140u, 136u, 130u, 121u, 114u, 107u, 98u, 91u, 83u, 76u, 70u, 68u, 65u, 62u, 59u, 54u, 51u, 47u, 40u, 33u, 27u, 22u, 18u, 16u, 13u, 11u, 10u, 9u, 8u, 7u, 5u, 4u, 4u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 4u, 4u, 4u, 5u, 5u, 5u, 6u, 6u, 7u, 8u, 10u, 12u, 14u, 17u, 22u, 27u, 32u, 39u, 47u, 56u, 65u, 75u, 85u, 94u, 101u, 110u, 117u, 123u, 130u, 135u, 138u, 140u, 141u, 146u, 146u, 150u, 151u, 143u, 130u, 118u, 107u, 94u, 88u, 86u, 80u, 79u, 75u, 74u, 83u, 88u, 98u, 98u, 100u, 102u, 101u, 88u, 78u, 62u, 53u, 48u, 46u, 39u, 29u, 24u, 26u, 31u, 33u, 33u, 29u, 19u, 15u, 13u, 11u, 10u, 9u, 10u, 12u, 18u, 26u, 30u, 32u, 31u, 26u, 23u, 23u, 23u, 20u, 21u, 19u, 20u, 22u, 24u, 32u, 34u, 32u, 38u, 44u, 55u, 68u, 80u, 84u, 85u }, 
-	{ 13u, 13u, 12u, 12u, 12u, 12u, 13u, 13u, 14u, 15u, 15u, 15u, 16u, 18u, 20u, 22u, 22u, 22u, 24u, 29u, 36u, 43u, 46u, 54u, 59u, 56u, 60u, 70u, 71u, 67u, 66u, 63u, 57u, 46u, 43u, 39u, 40u, 41u, 41u, 42u, 38u, 29u, 28u, 32u, 36u, 35u, 32u, 30u, 31u, 32u, 30u, 27u, 29u, 33u, 36u, 40u, 45u, 49u, 53u, 52u, 47u, 45u, 43u, 41u, 41u, 43u, 41u, 41u, 43u, 46u, 49u, 57u, 56u, 59u, 66u, 79u, 93u, 99u, 96u, 99u, 99u, 104u, 106u, 100u, 96u, 90u, 83u, 84u, 85u, 81u, 74u, 75u, 77u, 78u, 84u, 86u, 88u, 93u, 101u, 109u, 112u, 113u, 113u, 111u, 113u, 118u, 131u, 140u, 146u, 150u, 150u, 146u, 142u, 139u, 136u, 132u, 123u, 112u, 104u, 96u, 90u, 80u, 76u, 72u, 68u, 65u, 66u, 63u, 57u, 52u, 46u, 43u, 37u, 32u, 27u, 21u, 18u, 16u, 13u, 12u, 11u, 9u, 8u, 7u, 6u, 5u, 4u, 4u, 4u, 4u, 4u, 4u, 4u, 4u, 5u, 5u, 6u, 6u, 7u, 7u, 8u, 9u, 10u, 11u, 12u, 14u, 17u, 21u, 25u, 31u, 36u, 43u, 52u, 60u, 70u, 80u, 88u, 97u, 105u, 112u, 118u, 124u, 130u, 136u, 139u, 142u, 144u, 148u, 150u, 150u, 145u, 136u, 124u, 112u, 103u, 94u, 87u, 83u, 77u, 70u, 69u, 71u, 77u, 82u, 96u, 101u, 99u, 100u, 104u, 95u, 85u, 74u, 68u, 58u, 57u, 50u, 36u, 27u, 30u, 37u, 36u, 32u, 25u, 17u, 16u, 14u, 13u, 12u, 11u, 13u, 15u, 21u, 29u, 32u, 32u, 32u, 30u, 28u, 26u, 27u, 27u, 27u, 27u, 31u, 29u, 29u, 36u, 41u, 36u, 40u, 48u, 59u, 76u, 88u, 83u, 83u }, 
-	{ 12u, 11u, 11u, 10u, 10u, 11u, 10u, 11u, 11u, 12u, 13u, 13u, 13u, 15u, 16u, 18u, 17u, 18u, 18u, 21u, 26u, 31u, 32u, 39u, 47u, 49u, 54u, 62u, 72u, 73u, 70u, 63u, 51u, 38u, 35u, 34u, 33u, 32u, 34u, 38u, 32u, 26u, 25u, 29u, 36u, 38u, 36u, 32u, 32u, 33u, 33u, 30u, 31u, 34u, 40u, 46u, 52u, 55u, 53u, 53u, 45u, 38u, 37u, 33u, 32u, 35u, 38u, 41u, 43u, 48u, 52u, 60u, 59u, 56u, 60u, 75u, 87u, 95u, 93u, 92u, 100u, 101u, 99u, 93u, 87u, 87u, 90u, 86u, 81u, 83u, 78u, 73u, 72u, 74u, 82u, 85u, 85u, 91u, 101u, 107u, 113u, 115u, 114u, 116u, 121u, 124u, 136u, 145u, 151u, 151u, 149u, 143u, 140u, 136u, 132u, 130u, 125u, 115u, 104u, 94u, 89u, 80u, 75u, 71u, 67u, 65u, 68u, 65u, 60u, 54u, 48u, 46u, 40u, 35u, 29u, 24u, 22u, 19u, 16u, 15u, 13u, 11u, 10u, 8u, 7u, 7u, 6u, 6u, 5u, 5u, 5u, 5u, 5u, 6u, 6u, 6u, 7u, 8u, 8u, 9u, 10u, 11u, 12u, 14u, 15u, 18u, 21u, 25u, 29u, 35u, 41u, 48u, 57u, 65u, 75u, 85u, 93u, 100u, 109u, 115u, 121u, 128u, 132u, 137u, 142u, 145u, 146u, 150u, 152u, 150u, 143u, 134u, 119u, 107u, 91u, 85u, 80u, 72u, 68u, 63u, 57u, 62u, 72u, 80u, 97u, 104u, 99u, 102u, 107u, 105u, 97u, 82u, 85u, 80u, 65u, 54u, 38u, 27u, 34u, 37u, 29u, 26u, 22u, 17u, 15u, 12u, 11u, 11u, 11u, 13u, 15u, 21u, 29u, 34u, 31u, 32u, 35u, 32u, 30u, 28u, 29u, 29u, 32u, 36u, 38u, 38u, 42u, 43u, 35u, 40u, 47u, 53u, 66u, 78u, 72u, 80u }, 
-	{ 10u, 10u, 10u, 10u, 9u, 8u, 8u, 9u, 10u, 10u, 10u, 10u, 11u, 12u, 13u, 15u, 16u, 16u, 15u, 15u, 18u, 21u, 22u, 29u, 37u, 45u, 50u, 54u, 65u, 71u, 72u, 63u, 47u, 37u, 30u, 29u, 26u, 27u, 29u, 33u, 30u, 27u, 23u, 27u, 33u, 35u, 35u, 35u, 33u, 32u, 31u, 31u, 34u, 35u, 39u, 48u, 52u, 57u, 56u, 53u, 43u, 37u, 35u, 31u, 29u, 33u, 37u, 39u, 44u, 49u, 58u, 61u, 60u, 62u, 60u, 67u, 75u, 82u, 89u, 89u, 95u, 98u, 91u, 88u, 82u, 88u, 93u, 92u, 84u, 83u, 85u, 79u, 68u, 72u, 78u, 87u, 85u, 87u, 98u, 105u, 115u, 120u, 120u, 122u, 128u, 135u, 142u, 149u, 148u, 150u, 148u, 143u, 139u, 136u, 132u, 128u, 126u, 118u, 106u, 92u, 86u, 78u, 72u, 72u, 69u, 67u, 70u, 68u, 63u, 57u, 52u, 48u, 44u, 36u, 31u, 27u, 25u, 23u, 20u, 17u, 16u, 14u, 12u, 11u, 10u, 9u, 8u, 7u, 7u, 7u, 7u, 7u, 7u, 7u, 8u, 8u, 9u, 9u, 10u, 11u, 12u, 14u, 15u, 17u, 19u, 21u, 25u, 28u, 33u, 39u, 45u, 53u, 62u, 71u, 80u, 90u, 97u, 104u, 112u, 119u, 126u, 130u, 133u, 138u, 142u, 146u, 149u, 154u, 154u, 150u, 142u, 129u, 117u, 103u, 88u, 80u, 76u, 69u, 67u, 59u, 50u, 58u, 73u, 86u, 103u, 109u, 109u, 112u, 112u, 104u, 103u, 100u, 102u, 96u, 76u, 59u, 42u, 35u, 37u, 40u, 32u, 25u, 22u, 21u, 18u, 15u, 14u, 13u, 14u, 16u, 18u, 23u, 28u, 31u, 29u, 32u, 37u, 35u, 32u, 30u, 27u, 27u, 32u, 38u, 41u, 42u, 45u, 44u, 42u, 41u, 41u, 48u, 57u, 64u, 67u, 81u }, 
-	{ 9u, 9u, 8u, 8u, 8u, 7u, 7u, 7u, 8u, 7u, 8u, 8u, 9u, 10u, 12u, 14u, 14u, 14u, 14u, 13u, 15u, 19u, 23u, 27u, 34u, 47u, 56u, 53u, 59u, 66u, 65u, 59u, 50u, 39u, 33u, 29u, 25u, 25u, 22u, 25u, 25u, 26u, 25u, 27u, 29u, 30u, 32u, 34u, 31u, 31u, 31u, 33u, 36u, 37u, 42u, 50u, 51u, 48u, 50u, 49u, 41u, 35u, 32u, 30u, 28u, 29u, 35u, 39u, 41u, 48u, 59u, 63u, 64u, 68u, 71u, 72u, 73u, 74u, 84u, 90u, 88u, 92u, 89u, 95u, 87u, 85u, 95u, 97u, 100u, 98u, 93u, 84u, 68u, 70u, 79u, 88u, 88u, 89u, 101u, 111u, 121u, 126u, 124u, 123u, 132u, 145u, 151u, 151u, 148u, 150u, 144u, 138u, 134u, 133u, 130u, 125u, 125u, 114u, 101u, 91u, 86u, 81u, 76u, 77u, 75u, 73u, 75u, 72u, 65u, 59u, 55u, 49u, 46u, 40u, 33u, 28u, 27u, 25u, 22u, 20u, 18u, 17u, 15u, 14u, 13u, 12u, 11u, 10u, 10u, 9u, 9u, 9u, 9u, 9u, 10u, 10u, 11u, 11u, 12u, 13u, 14u, 16u, 18u, 20u, 22u, 25u, 28u, 32u, 37u, 43u, 50u, 58u, 67u, 76u, 85u, 94u, 103u, 109u, 115u, 123u, 129u, 133u, 136u, 139u, 144u, 148u, 153u, 158u, 157u, 148u, 138u, 132u, 121u, 104u, 94u, 86u, 80u, 69u, 65u, 58u, 52u, 54u, 65u, 84u, 100u, 109u, 111u, 111u, 107u, 97u, 108u, 115u, 113u, 94u, 80u, 68u, 60u, 48u, 44u, 44u, 35u, 28u, 23u, 23u, 22u, 18u, 16u, 15u, 17u, 19u, 24u, 27u, 30u, 32u, 33u, 37u, 36u, 34u, 37u, 32u, 28u, 28u, 33u, 39u, 44u, 42u, 42u, 41u, 41u, 41u, 46u, 52u, 58u, 62u, 65u, 72u }, 
-	{ 8u, 8u, 7u, 6u, 6u, 5u, 6u, 6u, 6u, 6u, 7u, 8u, 8u, 9u, 11u, 12u, 12u, 13u, 13u, 14u, 15u, 18u, 24u, 25u, 29u, 42u, 48u, 46u, 50u, 52u, 56u, 54u, 48u, 36u, 34u, 29u, 26u, 20u, 18u, 20u, 22u, 22u, 26u, 28u, 29u, 29u, 31u, 33u, 30u, 29u, 31u, 33u, 36u, 39u, 44u, 45u, 45u, 42u, 42u, 41u, 37u, 32u, 27u, 24u, 25u, 29u, 38u, 48u, 48u, 50u, 57u, 62u, 69u, 73u, 77u, 71u, 72u, 75u, 80u, 89u, 85u, 92u, 94u, 99u, 92u, 92u, 106u, 109u, 107u, 107u, 97u, 84u, 70u, 77u, 91u, 93u, 94u, 95u, 104u, 114u, 122u, 123u, 123u, 123u, 133u, 146u, 150u, 151u, 146u, 147u, 144u, 137u, 134u, 131u, 129u, 126u, 121u, 109u, 101u, 95u, 86u, 81u, 80u, 83u, 80u, 78u, 76u, 74u, 66u, 61u, 57u, 50u, 48u, 45u, 35u, 31u, 30u, 28u, 25u, 22u, 21u, 20u, 18u, 17u, 17u, 16u, 14u, 13u, 12u, 12u, 12u, 12u, 12u, 12u, 13u, 13u, 13u, 14u, 15u, 16u, 17u, 19u, 21u, 23u, 25u, 28u, 31u, 34u, 40u, 46u, 54u, 62u, 70u, 79u, 88u, 97u, 106u, 112u, 120u, 127u, 133u, 137u, 140u, 144u, 152u, 154u, 159u, 158u, 155u, 146u, 137u, 130u, 123u, 108u, 100u, 91u, 83u, 73u, 69u, 66u, 67u, 59u, 66u, 90u, 98u, 102u, 104u, 100u, 97u, 90u, 97u, 109u, 110u, 105u, 101u, 88u, 78u, 61u, 56u, 55u, 42u, 35u, 28u, 28u, 26u, 24u, 19u, 19u, 19u, 21u, 25u, 26u, 30u, 34u, 38u, 39u, 36u, 35u, 32u, 28u, 29u, 29u, 34u, 40u, 46u, 43u, 43u, 40u, 39u, 42u, 48u, 49u, 55u, 53u, 57u, 60u }, 
-	{ 7u, 6u, 5u, 4u, 4u, 5u, 5u, 5u, 6u, 6u, 6u, 7u, 8u, 9u, 10u, 11u, 11u, 12u, 13u, 12u, 13u, 17u, 22u, 22u, 25u, 31u, 35u, 36u, 41u, 43u, 48u, 46u, 40u, 34u, 31u, 27u, 21u, 16u, 15u, 16u, 17u, 20u, 23u, 27u, 29u, 32u, 36u, 37u, 35u, 35u, 37u, 37u, 37u, 39u, 44u, 42u, 39u, 35u, 34u, 36u, 35u, 32u, 26u, 21u, 25u, 32u, 42u, 50u, 51u, 50u, 57u, 61u, 66u, 79u, 82u, 73u, 65u, 72u, 81u, 95u, 97u, 97u, 96u, 94u, 92u, 98u, 103u, 109u, 109u, 103u, 93u, 79u, 73u, 83u, 93u, 97u, 95u, 96u, 103u, 110u, 121u, 123u, 122u, 124u, 131u, 142u, 146u, 146u, 144u, 142u, 143u, 138u, 136u, 130u, 125u, 120u, 113u, 107u, 101u, 97u, 86u, 83u, 85u, 84u, 83u, 81u, 77u, 75u, 70u, 65u, 60u, 56u, 51u, 49u, 43u, 38u, 33u, 30u, 29u, 26u, 24u, 23u, 22u, 21u, 21u, 20u, 18u, 17u, 16u, 15u, 15u, 15u, 15u, 16u, 16u, 16u, 16u, 17u, 18u, 19u, 21u, 22u, 24u, 27u, 29u, 30u, 33u, 36u, 41u, 49u, 56u, 64u, 72u, 82u, 91u, 100u, 108u, 115u, 124u, 132u, 137u, 140u, 144u, 149u, 154u, 158u, 160u, 162u, 160u, 152u, 139u, 129u, 125u, 115u, 104u, 98u, 86u, 81u, 73u, 68u, 71u, 70u, 74u, 87u, 98u, 100u, 91u, 87u, 89u, 94u, 91u, 99u, 117u, 113u, 110u, 101u, 87u, 77u, 70u, 59u, 50u, 41u, 35u, 33u, 27u, 24u, 23u, 24u, 22u, 19u, 24u, 26u, 29u, 33u, 37u, 38u, 36u, 31u, 28u, 29u, 30u, 34u, 38u, 41u, 45u, 48u, 45u, 40u, 40u, 41u, 41u, 45u, 49u, 48u, 51u, 53u }, 
-	{ 5u, 5u, 4u, 4u, 4u, 4u, 4u, 4u, 5u, 5u, 5u, 6u, 7u, 8u, 9u, 10u, 10u, 11u, 12u, 11u, 11u, 13u, 16u, 17u, 21u, 25u, 27u, 29u, 36u, 42u, 43u, 36u, 32u, 27u, 21u, 18u, 14u, 11u, 11u, 11u, 13u, 19u, 24u, 25u, 28u, 32u, 36u, 39u, 39u, 39u, 39u, 39u, 41u, 41u, 37u, 35u, 33u, 28u, 27u, 30u, 38u, 37u, 27u, 22u, 27u, 33u, 44u, 47u, 46u, 51u, 61u, 64u, 62u, 73u, 78u, 73u, 69u, 74u, 87u, 105u, 104u, 100u, 102u, 99u, 92u, 89u, 89u, 94u, 95u, 94u, 95u, 87u, 83u, 90u, 96u, 95u, 90u, 89u, 96u, 109u, 119u, 122u, 125u, 127u, 133u, 137u, 141u, 144u, 144u, 140u, 139u, 136u, 133u, 128u, 118u, 111u, 109u, 105u, 100u, 96u, 88u, 84u, 86u, 85u, 85u, 83u, 77u, 76u, 73u, 70u, 66u, 62u, 56u, 54u, 51u, 45u, 39u, 35u, 32u, 29u, 28u, 27u, 25u, 25u, 23u, 22u, 21u, 20u, 20u, 19u, 19u, 19u, 19u, 19u, 19u, 19u, 20u, 20u, 21u, 22u, 24u, 25u, 27u, 29u, 31u, 32u, 34u, 38u, 43u, 50u, 57u, 65u, 73u, 84u, 96u, 106u, 113u, 118u, 125u, 132u, 138u, 141u, 146u, 149u, 153u, 159u, 162u, 164u, 162u, 154u, 139u, 133u, 127u, 116u, 106u, 103u, 95u, 86u, 73u, 66u, 68u, 69u, 69u, 88u, 109u, 105u, 90u, 87u, 88u, 98u, 92u, 97u, 114u, 112u, 106u, 95u, 87u, 83u, 79u, 73u, 62u, 49u, 45u, 43u, 35u, 28u, 25u, 22u, 22u, 19u, 18u, 19u, 21u, 25u, 31u, 33u, 30u, 25u, 24u, 28u, 31u, 34u, 39u, 40u, 43u, 45u, 42u, 37u, 36u, 36u, 34u, 38u, 38u, 36u, 38u, 41u }, 
-	{ 4u, 4u, 3u, 3u, 3u, 3u, 3u, 4u, 4u, 4u, 5u, 5u, 7u, 7u, 9u, 9u, 10u, 11u, 12u, 11u, 11u, 11u, 11u, 13u, 15u, 21u, 21u, 22u, 29u, 35u, 35u, 29u, 23u, 20u, 13u, 10u, 8u, 6u, 5u, 6u, 8u, 14u, 21u, 25u, 28u, 31u, 34u, 42u, 43u, 40u, 39u, 38u, 39u, 40u, 36u, 31u, 30u, 27u, 29u, 30u, 34u, 37u, 32u, 33u, 36u, 42u, 48u, 46u, 45u, 45u, 51u, 54u, 60u, 78u, 84u, 81u, 73u, 77u, 98u, 102u, 97u, 95u, 100u, 104u, 89u, 84u, 82u, 81u, 82u, 86u, 92u, 96u, 90u, 94u, 99u, 92u, 85u, 80u, 94u, 108u, 112u, 121u, 127u, 128u, 134u, 139u, 143u, 144u, 143u, 140u, 141u, 143u, 136u, 127u, 115u, 108u, 106u, 100u, 96u, 92u, 93u, 88u, 86u, 85u, 86u, 86u, 84u, 83u, 80u, 77u, 74u, 70u, 66u, 62u, 59u, 53u, 44u, 40u, 36u, 32u, 31u, 30u, 28u, 27u, 27u, 25u, 24u, 24u, 24u, 24u, 23u, 23u, 22u, 23u, 23u, 23u, 23u, 24u, 25u, 26u, 27u, 29u, 31u, 33u, 34u, 36u, 38u, 41u, 46u, 51u, 58u, 64u, 74u, 86u, 98u, 108u, 115u, 118u, 123u, 129u, 135u, 139u, 145u, 148u, 155u, 159u, 165u, 166u, 165u, 160u, 145u, 139u, 133u, 124u, 113u, 110u, 102u, 92u, 83u, 72u, 69u, 72u, 74u, 89u, 109u, 111u, 94u, 88u, 87u, 99u, 100u, 104u, 106u, 104u, 107u, 95u, 93u, 95u, 93u, 89u, 70u, 56u, 50u, 45u, 37u, 31u, 22u, 19u, 16u, 13u, 13u, 15u, 17u, 21u, 28u, 30u, 28u, 28u, 26u, 30u, 34u, 39u, 45u, 44u, 40u, 41u, 40u, 39u, 37u, 34u, 31u, 33u, 32u, 31u, 30u, 33u }, 
-	{ 3u, 3u, 3u, 2u, 3u, 3u, 3u, 3u, 4u, 4u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 11u, 11u, 10u, 10u, 10u, 9u, 10u, 13u, 18u, 16u, 18u, 24u, 28u, 27u, 21u, 19u, 16u, 10u, 7u, 5u, 4u, 4u, 4u, 5u, 9u, 15u, 23u, 28u, 30u, 35u, 41u, 40u, 37u, 37u, 39u, 36u, 37u, 33u, 28u, 25u, 27u, 28u, 29u, 29u, 34u, 37u, 44u, 50u, 51u, 53u, 48u, 46u, 45u, 40u, 40u, 57u, 77u, 78u, 72u, 76u, 84u, 95u, 97u, 92u, 89u, 94u, 98u, 90u, 84u, 81u, 73u, 74u, 76u, 85u, 93u, 96u, 93u, 98u, 95u, 85u, 82u, 90u, 103u, 109u, 117u, 126u, 132u, 135u, 140u, 145u, 142u, 144u, 145u, 144u, 148u, 140u, 128u, 119u, 114u, 109u, 103u, 98u, 94u, 95u, 95u, 93u, 90u, 92u, 93u, 91u, 88u, 88u, 86u, 83u, 81u, 78u, 72u, 64u, 57u, 49u, 44u, 42u, 37u, 35u, 34u, 32u, 32u, 31u, 29u, 28u, 28u, 29u, 29u, 28u, 27u, 27u, 27u, 27u, 27u, 26u, 28u, 29u, 29u, 31u, 33u, 35u, 36u, 37u, 40u, 43u, 46u, 50u, 55u, 60u, 65u, 73u, 86u, 95u, 104u, 113u, 117u, 121u, 126u, 131u, 138u, 144u, 148u, 149u, 155u, 162u, 167u, 167u, 162u, 152u, 150u, 143u, 134u, 127u, 125u, 115u, 101u, 90u, 82u, 76u, 80u, 83u, 91u, 107u, 110u, 95u, 81u, 82u, 83u, 98u, 101u, 103u, 105u, 107u, 101u, 107u, 106u, 98u, 95u, 85u, 64u, 53u, 45u, 39u, 37u, 27u, 21u, 15u, 13u, 14u, 15u, 16u, 18u, 23u, 25u, 26u, 27u, 24u, 27u, 29u, 35u, 39u, 42u, 41u, 40u, 40u, 37u, 35u, 32u, 29u, 29u, 26u, 27u, 28u, 30u }, 
-	{ 3u, 2u, 3u, 2u, 2u, 3u, 3u, 3u, 3u, 3u, 4u, 5u, 6u, 7u, 9u, 9u, 9u, 9u, 10u, 9u, 9u, 9u, 9u, 10u, 12u, 17u, 16u, 15u, 19u, 21u, 21u, 17u, 16u, 13u, 9u, 7u, 4u, 4u, 4u, 5u, 6u, 9u, 14u, 18u, 26u, 31u, 34u, 37u, 33u, 29u, 31u, 36u, 37u, 37u, 33u, 28u, 24u, 26u, 25u, 25u, 24u, 32u, 39u, 46u, 53u, 50u, 49u, 44u, 46u, 54u, 48u, 45u, 58u, 69u, 77u, 64u, 65u, 78u, 81u, 85u, 86u, 84u, 91u, 99u, 97u, 84u, 81u, 76u, 82u, 77u, 72u, 75u, 88u, 92u, 96u, 94u, 90u, 86u, 85u, 93u, 105u, 119u, 128u, 134u, 135u, 136u, 142u, 143u, 141u, 140u, 142u, 144u, 138u, 133u, 126u, 120u, 115u, 108u, 102u, 102u, 105u, 104u, 105u, 102u, 99u, 99u, 98u, 98u, 98u, 96u, 91u, 90u, 87u, 79u, 69u, 63u, 57u, 51u, 46u, 42u, 41u, 39u, 38u, 36u, 35u, 33u, 33u, 33u, 32u, 31u, 31u, 31u, 31u, 31u, 30u, 30u, 30u, 31u, 33u, 34u, 34u, 36u, 37u, 38u, 40u, 42u, 46u, 51u, 56u, 61u, 65u, 66u, 71u, 83u, 93u, 100u, 108u, 117u, 121u, 125u, 128u, 135u, 140u, 142u, 140u, 148u, 155u, 161u, 159u, 157u, 156u, 154u, 148u, 139u, 130u, 126u, 121u, 104u, 96u, 97u, 97u, 99u, 92u, 85u, 86u, 90u, 85u, 86u, 85u, 74u, 85u, 94u, 104u, 121u, 126u, 126u, 122u, 123u, 117u, 114u, 102u, 76u, 54u, 42u, 38u, 39u, 32u, 25u, 19u, 18u, 15u, 13u, 14u, 18u, 24u, 24u, 23u, 23u, 22u, 24u, 27u, 32u, 33u, 37u, 40u, 39u, 36u, 32u, 31u, 27u, 26u, 27u, 24u, 24u, 25u, 31u }, 
-	{ 2u, 2u, 2u, 2u, 2u, 3u, 3u, 3u, 3u, 3u, 3u, 4u, 5u, 7u, 7u, 8u, 9u, 9u, 9u, 9u, 10u, 11u, 11u, 10u, 12u, 13u, 14u, 13u, 15u, 18u, 17u, 16u, 15u, 13u, 9u, 7u, 6u, 5u, 5u, 6u, 8u, 11u, 12u, 17u, 24u, 30u, 34u, 31u, 27u, 25u, 26u, 32u, 35u, 32u, 29u, 26u, 23u, 25u, 23u, 20u, 22u, 29u, 39u, 47u, 51u, 46u, 44u, 43u, 44u, 55u, 59u, 57u, 58u, 72u, 70u, 65u, 58u, 65u, 67u, 69u, 73u, 71u, 80u, 87u, 95u, 80u, 64u, 67u, 67u, 64u, 63u, 71u, 83u, 87u, 91u, 90u, 89u, 87u, 84u, 90u, 100u, 115u, 125u, 131u, 130u, 134u, 139u, 141u, 136u, 136u, 136u, 138u, 136u, 137u, 132u, 130u, 121u, 114u, 110u, 111u, 113u, 113u, 112u, 110u, 106u, 107u, 106u, 106u, 106u, 104u, 101u, 98u, 98u, 89u, 82u, 74u, 68u, 61u, 54u, 49u, 48u, 47u, 44u, 41u, 39u, 38u, 37u, 36u, 34u, 34u, 35u, 35u, 34u, 34u, 34u, 34u, 33u, 35u, 37u, 36u, 36u, 38u, 38u, 40u, 42u, 46u, 51u, 56u, 63u, 69u, 70u, 72u, 74u, 80u, 90u, 98u, 104u, 115u, 119u, 124u, 127u, 132u, 134u, 136u, 138u, 144u, 153u, 159u, 158u, 157u, 159u, 158u, 154u, 146u, 135u, 125u, 123u, 107u, 103u, 100u, 99u, 101u, 94u, 83u, 77u, 79u, 74u, 79u, 90u, 90u, 94u, 103u, 111u, 129u, 135u, 147u, 139u, 131u, 125u, 123u, 100u, 75u, 53u, 42u, 36u, 36u, 35u, 29u, 26u, 25u, 21u, 17u, 17u, 20u, 25u, 27u, 27u, 25u, 23u, 19u, 24u, 30u, 32u, 33u, 36u, 36u, 32u, 27u, 26u, 24u, 24u, 23u, 22u, 23u, 27u, 34u }, 
-	{ 2u, 2u, 2u, 2u, 2u, 2u, 2u, 3u, 3u, 3u, 3u, 4u, 5u, 6u, 7u, 7u, 8u, 8u, 8u, 9u, 11u, 10u, 10u, 10u, 11u, 13u, 13u, 13u, 15u, 16u, 16u, 16u, 14u, 11u, 7u, 5u, 5u, 6u, 6u, 7u, 9u, 12u, 15u, 20u, 24u, 29u, 29u, 27u, 26u, 25u, 26u, 29u, 29u, 30u, 26u, 22u, 22u, 24u, 21u, 21u, 24u, 27u, 31u, 38u, 46u, 47u, 39u, 40u, 45u, 58u, 69u, 73u, 71u, 73u, 66u, 57u, 52u, 61u, 58u, 48u, 52u, 58u, 67u, 72u, 81u, 70u, 51u, 51u, 51u, 46u, 53u, 68u, 78u, 79u, 87u, 95u, 89u, 88u, 83u, 88u, 92u, 100u, 111u, 120u, 126u, 133u, 135u, 135u, 133u, 134u, 133u, 134u, 135u, 140u, 139u, 134u, 125u, 122u, 125u, 123u, 120u, 120u, 119u, 116u, 112u, 112u, 111u, 113u, 116u, 115u, 111u, 107u, 105u, 98u, 90u, 84u, 81u, 76u, 66u, 60u, 56u, 54u, 51u, 44u, 42u, 43u, 41u, 37u, 35u, 36u, 38u, 38u, 38u, 37u, 37u, 38u, 38u, 38u, 38u, 37u, 37u, 39u, 40u, 44u, 46u, 50u, 56u, 61u, 66u, 72u, 73u, 74u, 77u, 85u, 93u, 102u, 107u, 114u, 115u, 119u, 126u, 128u, 126u, 127u, 134u, 140u, 147u, 157u, 161u, 161u, 162u, 157u, 151u, 144u, 134u, 120u, 110u, 103u, 97u, 95u, 94u, 97u, 94u, 82u, 80u, 87u, 76u, 80u, 100u, 116u, 121u, 125u, 136u, 157u, 155u, 157u, 146u, 130u, 128u, 116u, 86u, 69u, 60u, 44u, 35u, 41u, 39u, 31u, 29u, 30u, 29u, 24u, 21u, 22u, 27u, 30u, 32u, 28u, 25u, 22u, 26u, 32u, 34u, 34u, 33u, 31u, 29u, 27u, 24u, 22u, 20u, 19u, 17u, 20u, 26u, 36u }, 
-	{ 2u, 2u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 4u, 5u, 6u, 7u, 7u, 7u, 8u, 9u, 10u, 10u, 9u, 9u, 11u, 12u, 13u, 13u, 15u, 14u, 13u, 12u, 13u, 10u, 7u, 6u, 5u, 6u, 9u, 11u, 15u, 17u, 22u, 24u, 24u, 26u, 25u, 24u, 25u, 27u, 29u, 32u, 32u, 35u, 28u, 22u, 22u, 23u, 21u, 24u, 25u, 24u, 30u, 39u, 44u, 39u, 41u, 45u, 49u, 63u, 75u, 75u, 77u, 70u, 58u, 47u, 47u, 48u, 46u, 44u, 44u, 47u, 42u, 45u, 57u, 53u, 38u, 41u, 44u, 39u, 46u, 62u, 78u, 95u, 98u, 108u, 105u, 98u, 84u, 85u, 88u, 92u, 102u, 112u, 120u, 129u, 129u, 127u, 127u, 129u, 130u, 131u, 131u, 137u, 140u, 137u, 136u, 133u, 134u, 134u, 129u, 127u, 126u, 123u, 120u, 119u, 119u, 120u, 124u, 121u, 118u, 113u, 109u, 101u, 92u, 85u, 82u, 81u, 77u, 70u, 61u, 57u, 54u, 49u, 45u, 45u, 42u, 39u, 38u, 39u, 40u, 42u, 43u, 42u, 42u, 42u, 42u, 42u, 41u, 41u, 41u, 42u, 43u, 47u, 50u, 54u, 60u, 65u, 69u, 72u, 72u, 75u, 80u, 91u, 99u, 106u, 107u, 111u, 111u, 114u, 122u, 124u, 123u, 122u, 130u, 135u, 145u, 158u, 161u, 166u, 167u, 163u, 155u, 144u, 125u, 111u, 107u, 98u, 91u, 103u, 105u, 106u, 98u, 85u, 83u, 89u, 82u, 100u, 121u, 138u, 144u, 148u, 159u, 171u, 170u, 161u, 151u, 126u, 114u, 100u, 74u, 64u, 56u, 39u, 37u, 40u, 35u, 33u, 33u, 36u, 36u, 30u, 24u, 24u, 29u, 31u, 31u, 28u, 30u, 32u, 32u, 33u, 32u, 34u, 32u, 30u, 31u, 29u, 23u, 19u, 17u, 16u, 15u, 19u, 23u, 28u }, 
-	{ 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 4u, 5u, 6u, 7u, 7u, 8u, 8u, 9u, 9u, 9u, 9u, 9u, 10u, 10u, 13u, 14u, 14u, 13u, 11u, 13u, 13u, 9u, 8u, 8u, 6u, 7u, 11u, 17u, 22u, 26u, 29u, 30u, 29u, 23u, 24u, 26u, 30u, 34u, 33u, 36u, 38u, 39u, 29u, 26u, 21u, 20u, 20u, 24u, 23u, 21u, 29u, 40u, 39u, 37u, 39u, 49u, 52u, 69u, 80u, 73u, 73u, 65u, 56u, 43u, 42u, 42u, 39u, 36u, 32u, 31u, 28u, 33u, 45u, 48u, 38u, 39u, 41u, 45u, 51u, 70u, 87u, 108u, 119u, 121u, 114u, 104u, 91u, 90u, 92u, 94u, 100u, 109u, 121u, 123u, 121u, 119u, 123u, 126u, 125u, 126u, 129u, 135u, 137u, 143u, 145u, 141u, 140u, 139u, 135u, 133u, 131u, 128u, 128u, 126u, 129u, 133u, 133u, 127u, 120u, 117u, 110u, 102u, 96u, 88u, 83u, 86u, 82u, 76u, 67u, 61u, 58u, 54u, 48u, 46u, 43u, 41u, 39u, 41u, 42u, 45u, 47u, 47u, 48u, 48u, 47u, 47u, 45u, 44u, 45u, 48u, 49u, 52u, 54u, 57u, 64u, 68u, 71u, 73u, 73u, 75u, 82u, 91u, 99u, 104u, 107u, 108u, 111u, 112u, 118u, 123u, 120u, 121u, 128u, 137u, 145u, 155u, 160u, 169u, 176u, 169u, 155u, 140u, 120u, 105u, 106u, 102u, 96u, 107u, 110u, 109u, 103u, 103u, 94u, 90u, 97u, 118u, 145u, 155u, 163u, 161u, 168u, 177u, 173u, 161u, 147u, 126u, 104u, 83u, 70u, 54u, 38u, 37u, 36u, 31u, 33u, 36u, 35u, 38u, 39u, 33u, 30u, 27u, 28u, 30u, 33u, 32u, 34u, 33u, 32u, 33u, 33u, 38u, 35u, 30u, 32u, 30u, 22u, 19u, 16u, 15u, 15u, 18u, 24u, 26u }, 
-	{ 4u, 4u, 4u, 4u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 4u, 6u, 7u, 7u, 8u, 9u, 9u, 8u, 8u, 8u, 9u, 10u, 10u, 11u, 12u, 12u, 13u, 11u, 13u, 13u, 9u, 8u, 7u, 7u, 8u, 12u, 21u, 28u, 33u, 34u, 36u, 32u, 25u, 28u, 30u, 31u, 35u, 37u, 44u, 41u, 37u, 31u, 27u, 25u, 25u, 23u, 25u, 23u, 21u, 27u, 34u, 32u, 32u, 38u, 49u, 54u, 66u, 67u, 66u, 65u, 60u, 54u, 48u, 44u, 38u, 29u, 19u, 18u, 18u, 15u, 26u, 39u, 45u, 43u, 46u, 47u, 51u, 55u, 78u, 95u, 110u, 133u, 130u, 116u, 105u, 100u, 101u, 101u, 99u, 103u, 110u, 118u, 120u, 118u, 119u, 122u, 121u, 122u, 126u, 131u, 136u, 139u, 146u, 148u, 144u, 144u, 142u, 140u, 137u, 137u, 136u, 136u, 135u, 136u, 141u, 143u, 138u, 130u, 127u, 122u, 113u, 106u, 97u, 90u, 90u, 86u, 80u, 72u, 68u, 65u, 58u, 51u, 46u, 45u, 43u, 42u, 42u, 44u, 45u, 47u, 50u, 52u, 52u, 51u, 50u, 49u, 48u, 50u, 52u, 52u, 53u, 55u, 59u, 68u, 74u, 74u, 75u, 75u, 76u, 81u, 85u, 91u, 96u, 101u, 108u, 113u, 112u, 115u, 118u, 118u, 124u, 132u, 135u, 141u, 150u, 165u, 174u, 179u, 176u, 161u, 146u, 131u, 117u, 114u, 112u, 100u, 95u, 95u, 97u, 104u, 106u, 106u, 105u, 110u, 128u, 158u, 169u, 171u, 174u, 168u, 163u, 163u, 158u, 138u, 123u, 108u, 73u, 51u, 34u, 28u, 30u, 29u, 27u, 31u, 35u, 37u, 41u, 39u, 39u, 38u, 34u, 33u, 37u, 39u, 40u, 38u, 36u, 34u, 33u, 37u, 41u, 40u, 34u, 30u, 29u, 23u, 19u, 18u, 17u, 18u, 19u, 25u, 29u }, 
-	{ 5u, 5u, 5u, 5u, 4u, 4u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 4u, 5u, 6u, 7u, 8u, 9u, 10u, 9u, 8u, 8u, 8u, 9u, 10u, 11u, 11u, 12u, 13u, 12u, 11u, 12u, 11u, 10u, 9u, 10u, 9u, 13u, 24u, 34u, 44u, 43u, 43u, 41u, 32u, 32u, 35u, 32u, 37u, 39u, 44u, 43u, 33u, 27u, 25u, 29u, 28u, 27u, 23u, 20u, 20u, 24u, 30u, 35u, 36u, 42u, 50u, 53u, 64u, 61u, 59u, 53u, 51u, 51u, 52u, 38u, 29u, 19u, 13u, 9u, 8u, 10u, 18u, 22u, 27u, 35u, 41u, 48u, 61u, 74u, 92u, 109u, 119u, 137u, 127u, 117u, 106u, 109u, 104u, 105u, 107u, 106u, 110u, 112u, 116u, 114u, 115u, 115u, 114u, 117u, 124u, 131u, 137u, 142u, 148u, 149u, 145u, 143u, 143u, 143u, 142u, 142u, 143u, 142u, 143u, 142u, 144u, 146u, 144u, 141u, 137u, 129u, 122u, 116u, 105u, 99u, 94u, 89u, 85u, 81u, 76u, 71u, 63u, 56u, 48u, 46u, 45u, 42u, 42u, 45u, 45u, 47u, 51u, 52u, 52u, 52u, 53u, 52u, 52u, 54u, 55u, 54u, 55u, 56u, 57u, 64u, 76u, 77u, 79u, 80u, 82u, 83u, 83u, 90u, 96u, 101u, 106u, 113u, 113u, 115u, 117u, 119u, 122u, 131u, 136u, 144u, 151u, 161u, 176u, 188u, 181u, 167u, 151u, 130u, 120u, 118u, 119u, 109u, 100u, 94u, 97u, 98u, 98u, 117u, 120u, 128u, 148u, 168u, 181u, 184u, 190u, 172u, 161u, 148u, 149u, 136u, 112u, 104u, 79u, 47u, 32u, 28u, 28u, 34u, 31u, 31u, 35u, 39u, 41u, 39u, 43u, 38u, 38u, 37u, 38u, 39u, 45u, 42u, 36u, 33u, 32u, 38u, 37u, 35u, 33u, 28u, 25u, 23u, 20u, 21u, 19u, 19u, 22u, 28u, 30u }, 
-	{ 7u, 6u, 6u, 6u, 5u, 5u, 4u, 3u, 3u, 3u, 3u, 3u, 3u, 3u, 5u, 6u, 7u, 7u, 8u, 9u, 9u, 8u, 9u, 9u, 9u, 11u, 12u, 11u, 12u, 14u, 14u, 13u, 13u, 12u, 13u, 13u, 12u, 14u, 19u, 27u, 41u, 49u, 49u, 50u, 49u, 47u, 41u, 39u, 38u, 40u, 39u, 40u, 35u, 30u, 29u, 26u, 29u, 27u, 24u, 20u, 17u, 17u, 20u, 28u, 36u, 40u, 47u, 55u, 57u, 58u, 62u, 62u, 52u, 48u, 52u, 46u, 35u, 32u, 22u, 15u, 9u, 7u, 7u, 11u, 11u, 19u, 31u, 45u, 53u, 61u, 85u, 101u, 111u, 126u, 135u, 133u, 124u, 116u, 113u, 103u, 102u, 109u, 111u, 114u, 113u, 115u, 111u, 108u, 108u, 111u, 118u, 122u, 129u, 136u, 140u, 145u, 146u, 146u, 146u, 145u, 142u, 144u, 145u, 146u, 144u, 145u, 149u, 152u, 154u, 154u, 153u, 146u, 133u, 124u, 120u, 107u, 102u, 95u, 88u, 86u, 87u, 80u, 68u, 61u, 57u, 52u, 48u, 46u, 46u, 45u, 46u, 46u, 51u, 52u, 53u, 52u, 54u, 56u, 54u, 56u, 58u, 58u, 58u, 59u, 62u, 61u, 66u, 75u, 78u, 79u, 83u, 85u, 84u, 86u, 93u, 99u, 103u, 105u, 109u, 116u, 117u, 120u, 124u, 125u, 127u, 131u, 138u, 145u, 155u, 172u, 183u, 179u, 170u, 155u, 133u, 119u, 115u, 125u, 115u, 102u, 99u, 92u, 99u, 115u, 131u, 138u, 157u, 168u, 183u, 191u, 191u, 193u, 185u, 159u, 139u, 127u, 111u, 98u, 81u, 70u, 53u, 32u, 28u, 31u, 35u, 36u, 32u, 37u, 39u, 43u, 39u, 42u, 41u, 40u, 41u, 39u, 42u, 45u, 43u, 37u, 33u, 32u, 34u, 34u, 29u, 27u, 23u, 21u, 20u, 20u, 22u, 22u, 22u, 24u, 26u, 28u }, 
-	{ 9u, 8u, 7u, 7u, 6u, 5u, 4u, 4u, 3u, 3u, 4u, 3u, 3u, 4u, 5u, 6u, 6u, 6u, 6u, 8u, 9u, 8u, 10u, 9u, 8u, 11u, 12u, 12u, 13u, 15u, 14u, 11u, 10u, 9u, 12u, 12u, 12u, 16u, 24u, 31u, 41u, 49u, 52u, 55u, 54u, 52u, 48u, 41u, 37u, 38u, 33u, 29u, 31u, 30u, 29u, 26u, 25u, 27u, 20u, 14u, 13u, 15u, 17u, 23u, 31u, 37u, 45u, 58u, 61u, 49u, 51u, 57u, 58u, 56u, 50u, 47u, 49u, 43u, 29u, 20u, 12u, 9u, 8u, 8u, 8u, 17u, 31u, 48u, 58u, 62u, 79u, 104u, 113u, 123u, 131u, 133u, 127u, 122u, 121u, 112u, 105u, 108u, 109u, 119u, 122u, 119u, 112u, 109u, 109u, 115u, 126u, 128u, 131u, 136u, 139u, 146u, 149u, 152u, 150u, 148u, 143u, 142u, 140u, 142u, 146u, 148u, 151u, 155u, 161u, 161u, 157u, 149u, 139u, 129u, 120u, 105u, 99u, 94u, 94u, 90u, 88u, 83u, 69u, 61u, 53u, 49u, 46u, 46u, 49u, 48u, 48u, 48u, 50u, 53u, 56u, 55u, 56u, 57u, 57u, 59u, 60u, 59u, 61u, 65u, 70u, 67u, 68u, 72u, 73u, 75u, 81u, 85u, 90u, 95u, 98u, 98u, 99u, 105u, 110u, 117u, 122u, 124u, 124u, 127u, 126u, 126u, 132u, 137u, 147u, 166u, 179u, 176u, 169u, 157u, 146u, 131u, 123u, 128u, 118u, 110u, 104u, 93u, 98u, 120u, 137u, 150u, 167u, 179u, 184u, 186u, 188u, 192u, 188u, 150u, 128u, 109u, 89u, 79u, 68u, 57u, 47u, 34u, 27u, 30u, 37u, 45u, 42u, 39u, 41u, 42u, 41u, 42u, 43u, 47u, 49u, 47u, 45u, 44u, 42u, 37u, 32u, 31u, 33u, 31u, 27u, 25u, 24u, 23u, 21u, 19u, 21u, 20u, 20u, 22u, 25u, 27u }, 
-	{ 11u, 10u, 8u, 7u, 6u, 6u, 5u, 5u, 5u, 5u, 4u, 4u, 4u, 4u, 5u, 6u, 5u, 6u, 6u, 8u, 8u, 9u, 11u, 9u, 8u, 9u, 9u, 9u, 11u, 12u, 11u, 12u, 11u, 9u, 12u, 14u, 14u, 21u, 28u, 40u, 43u, 47u, 51u, 56u, 60u, 57u, 54u, 46u, 39u, 34u, 33u, 30u, 34u, 35u, 38u, 35u, 32u, 26u, 20u, 12u, 13u, 20u, 21u, 25u, 36u, 37u, 42u, 61u, 60u, 46u, 47u, 55u, 66u, 55u, 53u, 56u, 57u, 54u, 39u, 26u, 16u, 13u, 9u, 9u, 13u, 21u, 32u, 46u, 54u, 68u, 87u, 102u, 107u, 125u, 135u, 136u, 124u, 113u, 116u, 113u, 104u, 102u, 108u, 123u, 125u, 121u, 116u, 115u, 119u, 123u, 125u, 132u, 132u, 136u, 138u, 144u, 151u, 158u, 153u, 148u, 142u, 141u, 139u, 143u, 146u, 149u, 147u, 152u, 163u, 167u, 165u, 155u, 141u, 128u, 112u, 98u, 90u, 91u, 94u, 89u, 87u, 81u, 68u, 60u, 51u, 49u, 47u, 47u, 49u, 50u, 47u, 48u, 49u, 53u, 55u, 56u, 59u, 61u, 61u, 63u, 64u, 63u, 65u, 69u, 77u, 76u, 74u, 79u, 77u, 77u, 82u, 89u, 93u, 103u, 106u, 104u, 101u, 103u, 110u, 119u, 123u, 129u, 130u, 129u, 124u, 126u, 136u, 139u, 151u, 166u, 176u, 174u, 172u, 165u, 150u, 131u, 125u, 136u, 135u, 127u, 116u, 111u, 118u, 135u, 151u, 163u, 166u, 178u, 178u, 174u, 175u, 176u, 173u, 147u, 127u, 106u, 84u, 74u, 70u, 61u, 44u, 36u, 32u, 35u, 36u, 43u, 45u, 48u, 48u, 46u, 40u, 36u, 43u, 52u, 55u, 56u, 55u, 51u, 49u, 43u, 35u, 35u, 38u, 30u, 25u, 23u, 26u, 26u, 22u, 19u, 20u, 19u, 20u, 21u, 22u, 22u }, 
-	{ 13u, 11u, 10u, 9u, 7u, 7u, 6u, 6u, 6u, 6u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 6u, 6u, 7u, 8u, 8u, 8u, 8u, 8u, 7u, 8u, 9u, 9u, 10u, 10u, 11u, 12u, 17u, 21u, 19u, 21u, 29u, 43u, 47u, 53u, 55u, 63u, 65u, 63u, 67u, 56u, 42u, 35u, 34u, 34u, 41u, 44u, 44u, 41u, 34u, 29u, 20u, 14u, 14u, 21u, 22u, 28u, 33u, 34u, 44u, 58u, 67u, 58u, 47u, 51u, 56u, 49u, 51u, 57u, 63u, 51u, 37u, 27u, 18u, 13u, 10u, 11u, 19u, 26u, 39u, 56u, 74u, 85u, 103u, 112u, 106u, 117u, 133u, 132u, 120u, 106u, 111u, 113u, 108u, 102u, 111u, 122u, 129u, 125u, 124u, 129u, 133u, 131u, 129u, 130u, 134u, 137u, 143u, 147u, 154u, 156u, 149u, 142u, 138u, 134u, 135u, 141u, 141u, 143u, 141u, 142u, 154u, 159u, 163u, 155u, 144u, 130u, 116u, 101u, 88u, 89u, 89u, 87u, 82u, 78u, 70u, 58u, 49u, 45u, 47u, 46u, 48u, 48u, 48u, 48u, 49u, 52u, 53u, 55u, 61u, 64u, 67u, 68u, 68u, 68u, 70u, 74u, 83u, 82u, 82u, 85u, 86u, 82u, 86u, 96u, 99u, 103u, 108u, 107u, 101u, 100u, 109u, 117u, 124u, 133u, 137u, 134u, 135u, 137u, 146u, 154u, 166u, 171u, 171u, 168u, 171u, 166u, 146u, 135u, 125u, 138u, 152u, 146u, 140u, 141u, 140u, 143u, 152u, 161u, 164u, 162u, 163u, 151u, 161u, 158u, 156u, 136u, 127u, 117u, 98u, 86u, 76u, 64u, 53u, 48u, 43u, 38u, 37u, 40u, 44u, 53u, 48u, 45u, 38u, 34u, 39u, 50u, 56u, 61u, 63u, 59u, 56u, 48u, 37u, 36u, 32u, 25u, 22u, 25u, 26u, 24u, 20u, 18u, 19u, 21u, 21u, 20u, 20u, 19u }, 
-	{ 15u, 13u, 12u, 11u, 10u, 9u, 8u, 9u, 8u, 8u, 7u, 7u, 7u, 6u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 6u, 6u, 6u, 6u, 6u, 6u, 7u, 8u, 9u, 10u, 12u, 12u, 15u, 22u, 25u, 22u, 23u, 25u, 41u, 52u, 57u, 55u, 61u, 68u, 74u, 72u, 67u, 56u, 46u, 40u, 39u, 44u, 45u, 45u, 42u, 33u, 26u, 18u, 15u, 15u, 18u, 19u, 26u, 31u, 37u, 40u, 48u, 59u, 61u, 51u, 60u, 62u, 57u, 55u, 58u, 64u, 54u, 37u, 24u, 21u, 16u, 14u, 16u, 26u, 35u, 57u, 85u, 104u, 108u, 114u, 109u, 102u, 112u, 129u, 131u, 128u, 112u, 111u, 106u, 103u, 101u, 113u, 124u, 134u, 135u, 136u, 136u, 143u, 141u, 137u, 134u, 136u, 145u, 152u, 155u, 161u, 158u, 148u, 133u, 126u, 122u, 121u, 128u, 134u, 132u, 129u, 133u, 145u, 152u, 149u, 141u, 136u, 125u, 113u, 96u, 86u, 88u, 90u, 90u, 84u, 74u, 66u, 55u, 48u, 43u, 43u, 44u, 49u, 50u, 49u, 49u, 51u, 52u, 53u, 56u, 63u, 65u, 68u, 68u, 68u, 71u, 77u, 84u, 91u, 88u, 83u, 84u, 88u, 93u, 98u, 101u, 102u, 102u, 106u, 103u, 97u, 99u, 109u, 115u, 125u, 134u, 142u, 143u, 146u, 145u, 158u, 167u, 174u, 180u, 177u, 165u, 163u, 161u, 153u, 149u, 138u, 136u, 153u, 159u, 155u, 154u, 159u, 153u, 153u, 143u, 148u, 158u, 156u, 144u, 149u, 148u, 140u, 122u, 122u, 120u, 113u, 98u, 79u, 67u, 58u, 51u, 43u, 35u, 35u, 41u, 46u, 45u, 41u, 38u, 33u, 32u, 37u, 45u, 52u, 62u, 63u, 59u, 54u, 45u, 36u, 33u, 27u, 24u, 25u, 30u, 29u, 26u, 23u, 24u, 23u, 23u, 20u, 18u, 18u, 17u }, 
-	{ 17u, 17u, 16u, 14u, 14u, 13u, 12u, 12u, 11u, 10u, 9u, 9u, 8u, 7u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 5u, 6u, 5u, 6u, 9u, 10u, 11u, 14u, 17u, 24u, 28u, 29u, 25u, 25u, 30u, 42u, 50u, 56u, 56u, 60u, 69u, 76u, 77u, 74u, 69u, 60u, 46u, 45u, 45u, 40u, 46u, 45u, 37u, 31u, 21u, 19u, 16u, 15u, 22u, 32u, 36u, 37u, 39u, 47u, 60u, 64u, 55u, 59u, 61u, 68u, 62u, 62u, 63u, 53u, 39u, 35u, 26u, 15u, 18u, 28u, 36u, 50u, 77u, 101u, 123u, 128u, 123u, 120u, 115u, 119u, 123u, 124u, 123u, 115u, 112u, 106u, 97u, 101u, 111u, 122u, 131u, 137u, 143u, 145u, 149u, 147u, 147u, 145u, 144u, 149u, 150u, 157u, 162u, 161u, 150u, 134u, 124u, 114u, 114u, 123u, 126u, 125u, 126u, 133u, 135u, 140u, 141u, 138u, 132u, 116u, 103u, 91u, 86u, 87u, 91u, 88u, 91u, 80u, 68u, 58u, 48u, 45u, 43u, 42u, 46u, 48u, 49u, 49u, 52u, 51u, 54u, 58u, 64u, 66u, 69u, 71u, 72u, 77u, 84u, 89u, 94u, 96u, 90u, 88u, 92u, 101u, 103u, 104u, 101u, 96u, 99u, 100u, 98u, 103u, 110u, 118u, 133u, 138u, 147u, 149u, 152u, 155u, 171u, 174u, 181u, 186u, 175u, 161u, 154u, 162u, 154u, 152u, 143u, 141u, 155u, 165u, 167u, 160u, 155u, 147u, 145u, 131u, 125u, 133u, 140u, 146u, 136u, 123u, 103u, 105u, 117u, 106u, 108u, 113u, 96u, 79u, 70u, 55u, 43u, 38u, 36u, 38u, 44u, 46u, 47u, 39u, 35u, 39u, 42u, 47u, 57u, 66u, 70u, 71u, 60u, 46u, 42u, 38u, 30u, 30u, 32u, 32u, 28u, 28u, 25u, 25u, 25u, 26u, 22u, 21u, 18u, 17u }, 
-	{ 21u, 22u, 20u, 18u, 19u, 18u, 16u, 15u, 15u, 13u, 10u, 10u, 10u, 8u, 6u, 6u, 6u, 5u, 6u, 6u, 5u, 5u, 5u, 5u, 5u, 6u, 7u, 9u, 12u, 12u, 15u, 17u, 21u, 27u, 32u, 30u, 27u, 29u, 37u, 42u, 44u, 48u, 56u, 58u, 61u, 69u, 76u, 74u, 65u, 60u, 47u, 42u, 38u, 39u, 47u, 51u, 48u, 38u, 30u, 27u, 23u, 21u, 26u, 41u, 44u, 44u, 48u, 54u, 65u, 67u, 61u, 58u, 65u, 77u, 71u, 70u, 59u, 52u, 49u, 44u, 33u, 22u, 20u, 29u, 49u, 63u, 93u, 116u, 127u, 130u, 137u, 135u, 133u, 124u, 116u, 116u, 114u, 112u, 110u, 109u, 102u, 103u, 116u, 128u, 137u, 142u, 144u, 149u, 154u, 155u, 152u, 153u, 153u, 154u, 156u, 160u, 159u, 158u, 151u, 143u, 130u, 114u, 112u, 120u, 123u, 124u, 130u, 137u, 135u, 134u, 139u, 141u, 129u, 112u, 100u, 92u, 87u, 89u, 98u, 97u, 100u, 89u, 74u, 61u, 47u, 43u, 42u, 43u, 44u, 45u, 46u, 50u, 52u, 53u, 57u, 61u, 67u, 68u, 70u, 76u, 81u, 85u, 89u, 96u, 98u, 100u, 99u, 94u, 98u, 103u, 104u, 105u, 105u, 101u, 98u, 105u, 107u, 112u, 116u, 126u, 137u, 147u, 150u, 157u, 157u, 157u, 166u, 170u, 172u, 183u, 178u, 165u, 160u, 162u, 152u, 147u, 148u, 149u, 157u, 167u, 166u, 159u, 156u, 142u, 127u, 114u, 96u, 102u, 123u, 126u, 101u, 84u, 81u, 98u, 100u, 97u, 106u, 111u, 94u, 84u, 72u, 53u, 44u, 38u, 39u, 40u, 43u, 47u, 49u, 45u, 40u, 44u, 51u, 52u, 53u, 63u, 73u, 72u, 67u, 56u, 51u, 46u, 38u, 37u, 36u, 33u, 30u, 27u, 24u, 25u, 27u, 25u, 22u, 23u, 19u, 16u }, 
-	{ 25u, 24u, 22u, 21u, 22u, 21u, 19u, 18u, 18u, 16u, 13u, 11u, 10u, 9u, 7u, 6u, 7u, 6u, 6u, 7u, 6u, 5u, 5u, 5u, 7u, 9u, 10u, 13u, 16u, 18u, 20u, 20u, 23u, 28u, 30u, 28u, 29u, 33u, 42u, 39u, 37u, 41u, 54u, 53u, 61u, 75u, 76u, 77u, 67u, 55u, 43u, 42u, 40u, 43u, 47u, 49u, 50u, 41u, 34u, 31u, 29u, 31u, 36u, 46u, 56u, 63u, 63u, 61u, 66u, 64u, 61u, 54u, 57u, 68u, 69u, 77u, 69u, 58u, 59u, 51u, 35u, 27u, 25u, 31u, 56u, 84u, 109u, 117u, 126u, 135u, 145u, 147u, 148u, 133u, 118u, 117u, 113u, 116u, 117u, 122u, 124u, 126u, 132u, 140u, 150u, 158u, 152u, 149u, 153u, 159u, 164u, 164u, 158u, 157u, 162u, 162u, 161u, 161u, 156u, 147u, 134u, 120u, 112u, 116u, 121u, 120u, 124u, 129u, 127u, 125u, 128u, 135u, 135u, 120u, 108u, 94u, 90u, 94u, 98u, 101u, 101u, 85u, 72u, 58u, 47u, 43u, 44u, 46u, 44u, 45u, 45u, 49u, 54u, 59u, 64u, 68u, 70u, 69u, 72u, 77u, 83u, 91u, 97u, 105u, 107u, 110u, 106u, 100u, 105u, 103u, 100u, 98u, 100u, 98u, 99u, 104u, 106u, 114u, 119u, 128u, 138u, 150u, 154u, 158u, 153u, 151u, 154u, 164u, 171u, 171u, 164u, 159u, 162u, 162u, 154u, 143u, 142u, 146u, 152u, 162u, 163u, 157u, 150u, 139u, 122u, 113u, 97u, 100u, 103u, 98u, 74u, 60u, 65u, 78u, 84u, 95u, 101u, 106u, 94u, 81u, 74u, 58u, 50u, 44u, 43u, 40u, 40u, 43u, 45u, 46u, 51u, 54u, 57u, 54u, 46u, 52u, 65u, 67u, 68u, 60u, 53u, 46u, 46u, 49u, 47u, 36u, 27u, 27u, 26u, 26u, 28u, 24u, 21u, 20u, 16u, 16u }, 
-	{ 29u, 27u, 23u, 24u, 25u, 24u, 23u, 22u, 19u, 19u, 16u, 14u, 14u, 11u, 7u, 6u, 7u, 6u, 6u, 7u, 7u, 7u, 6u, 8u, 11u, 11u, 13u, 17u, 19u, 21u, 20u, 20u, 24u, 28u, 30u, 27u, 29u, 32u, 36u, 33u, 37u, 48u, 59u, 60u, 68u, 73u, 75u, 65u, 62u, 51u, 41u, 41u, 42u, 42u, 46u, 50u, 46u, 39u, 34u, 37u, 37u, 39u, 45u, 53u, 67u, 74u, 67u, 65u, 65u, 62u, 63u, 59u, 63u, 69u, 69u, 76u, 69u, 58u, 57u, 46u, 34u, 31u, 31u, 43u, 64u, 86u, 106u, 114u, 117u, 140u, 145u, 147u, 140u, 136u, 125u, 124u, 115u, 116u, 116u, 126u, 130u, 138u, 141u, 140u, 155u, 167u, 162u, 158u, 157u, 164u, 169u, 169u, 159u, 153u, 159u, 156u, 154u, 156u, 158u, 151u, 136u, 123u, 114u, 116u, 117u, 113u, 114u, 119u, 115u, 115u, 119u, 130u, 132u, 127u, 112u, 99u, 89u, 93u, 95u, 105u, 98u, 83u, 70u, 61u, 51u, 43u, 46u, 48u, 47u, 46u, 47u, 51u, 56u, 62u, 68u, 71u, 69u, 74u, 78u, 79u, 84u, 88u, 97u, 107u, 118u, 116u, 112u, 105u, 107u, 104u, 101u, 101u, 99u, 97u, 96u, 98u, 104u, 111u, 123u, 129u, 140u, 149u, 155u, 159u, 150u, 148u, 150u, 163u, 168u, 156u, 155u, 153u, 158u, 156u, 148u, 137u, 133u, 136u, 151u, 156u, 157u, 154u, 140u, 123u, 106u, 101u, 89u, 86u, 85u, 87u, 64u, 50u, 56u, 70u, 84u, 89u, 97u, 101u, 99u, 92u, 77u, 71u, 63u, 63u, 59u, 51u, 45u, 47u, 51u, 49u, 54u, 62u, 63u, 60u, 52u, 48u, 52u, 60u, 62u, 58u, 43u, 39u, 41u, 50u, 46u, 34u, 28u, 29u, 31u, 30u, 27u, 26u, 22u, 19u, 15u, 15u }, 
-	{ 29u, 26u, 25u, 27u, 28u, 27u, 25u, 23u, 20u, 20u, 18u, 16u, 16u, 13u, 9u, 7u, 6u, 6u, 6u, 7u, 8u, 8u, 10u, 13u, 15u, 15u, 16u, 18u, 20u, 21u, 19u, 19u, 21u, 23u, 25u, 26u, 28u, 32u, 34u, 37u, 45u, 57u, 65u, 72u, 80u, 77u, 66u, 56u, 51u, 42u, 35u, 36u, 43u, 46u, 46u, 44u, 35u, 30u, 34u, 39u, 46u, 51u, 50u, 55u, 62u, 75u, 73u, 73u, 67u, 64u, 67u, 65u, 75u, 79u, 72u, 74u, 62u, 54u, 55u, 47u, 44u, 43u, 39u, 48u, 65u, 82u, 105u, 106u, 104u, 125u, 135u, 129u, 124u, 122u, 117u, 115u, 118u, 114u, 115u, 125u, 126u, 132u, 135u, 137u, 150u, 165u, 165u, 162u, 156u, 159u, 167u, 167u, 157u, 147u, 149u, 151u, 147u, 148u, 148u, 148u, 137u, 128u, 119u, 114u, 114u, 110u, 108u, 112u, 113u, 112u, 119u, 127u, 123u, 124u, 117u, 115u, 105u, 97u, 98u, 104u, 96u, 83u, 70u, 63u, 57u, 48u, 47u, 49u, 50u, 50u, 52u, 53u, 58u, 62u, 67u, 72u, 73u, 78u, 82u, 85u, 89u, 91u, 96u, 107u, 119u, 118u, 114u, 107u, 104u, 101u, 102u, 104u, 99u, 91u, 86u, 89u, 95u, 99u, 113u, 124u, 136u, 149u, 158u, 163u, 156u, 146u, 146u, 150u, 154u, 151u, 145u, 149u, 158u, 159u, 156u, 143u, 128u, 128u, 136u, 142u, 141u, 136u, 123u, 111u, 93u, 71u, 59u, 62u, 66u, 73u, 66u, 52u, 57u, 75u, 83u, 89u, 101u, 106u, 105u, 104u, 93u, 96u, 93u, 90u, 73u, 64u, 57u, 57u, 61u, 61u, 57u, 65u, 69u, 66u, 57u, 45u, 38u, 43u, 49u, 45u, 35u, 37u, 38u, 43u, 40u, 33u, 30u, 31u, 34u, 33u, 31u, 31u, 26u, 21u, 16u, 17u }, 
-	{ 27u, 27u, 28u, 30u, 29u, 29u, 28u, 26u, 24u, 24u, 21u, 17u, 16u, 14u, 11u, 9u, 8u, 9u, 9u, 9u, 9u, 10u, 13u, 15u, 18u, 19u, 19u, 18u, 18u, 22u, 21u, 21u, 19u, 19u, 24u, 27u, 24u, 27u, 33u, 44u, 56u, 70u, 71u, 76u, 79u, 73u, 66u, 52u, 42u, 36u, 31u, 33u, 39u, 41u, 44u, 41u, 33u, 33u, 40u, 40u, 45u, 56u, 58u, 58u, 56u, 67u, 66u, 65u, 62u, 67u, 70u, 74u, 91u, 85u, 73u, 74u, 67u, 61u, 68u, 65u, 55u, 50u, 44u, 51u, 64u, 89u, 114u, 104u, 100u, 111u, 114u, 119u, 123u, 115u, 111u, 101u, 104u, 101u, 109u, 117u, 123u, 133u, 133u, 138u, 149u, 163u, 164u, 160u, 159u, 162u, 162u, 157u, 153u, 148u, 139u, 140u, 134u, 132u, 132u, 137u, 131u, 126u, 123u, 115u, 110u, 107u, 108u, 108u, 113u, 112u, 118u, 124u, 126u, 126u, 122u, 118u, 115u, 104u, 103u, 103u, 94u, 80u, 66u, 62u, 59u, 53u, 51u, 53u, 55u, 54u, 56u, 57u, 61u, 64u, 69u, 72u, 74u, 75u, 79u, 86u, 88u, 92u, 94u, 103u, 113u, 112u, 111u, 108u, 104u, 94u, 98u, 96u, 94u, 81u, 78u, 78u, 85u, 89u, 103u, 116u, 134u, 149u, 159u, 164u, 162u, 156u, 151u, 139u, 146u, 154u, 145u, 142u, 148u, 145u, 149u, 145u, 139u, 138u, 133u, 133u, 140u, 138u, 115u, 94u, 72u, 60u, 45u, 47u, 54u, 59u, 59u, 56u, 59u, 69u, 68u, 77u, 82u, 96u, 114u, 120u, 109u, 112u, 108u, 105u, 86u, 66u, 56u, 54u, 58u, 61u, 57u, 58u, 56u, 59u, 56u, 45u, 36u, 35u, 35u, 37u, 35u, 32u, 30u, 31u, 32u, 30u, 30u, 33u, 37u, 37u, 36u, 36u, 32u, 26u, 20u, 19u }, 
-	{ 29u, 29u, 32u, 32u, 31u, 30u, 30u, 29u, 27u, 28u, 25u, 20u, 17u, 14u, 11u, 11u, 12u, 11u, 11u, 9u, 9u, 11u, 14u, 17u, 20u, 22u, 22u, 21u, 19u, 23u, 24u, 23u, 21u, 20u, 24u, 25u, 23u, 27u, 38u, 53u, 63u, 71u, 71u, 72u, 72u, 69u, 62u, 53u, 41u, 36u, 30u, 29u, 31u, 33u, 38u, 38u, 37u, 37u, 42u, 39u, 42u, 49u, 51u, 53u, 58u, 67u, 66u, 61u, 63u, 75u, 79u, 84u, 96u, 97u, 90u, 79u, 83u, 83u, 92u, 89u, 70u, 56u, 58u, 64u, 72u, 94u, 113u, 105u, 103u, 103u, 105u, 118u, 125u, 119u, 105u, 101u, 105u, 99u, 104u, 112u, 126u, 132u, 132u, 136u, 142u, 154u, 155u, 149u, 153u, 159u, 152u, 146u, 141u, 139u, 129u, 131u, 125u, 115u, 115u, 122u, 122u, 122u, 124u, 119u, 112u, 112u, 116u, 113u, 116u, 115u, 115u, 121u, 119u, 118u, 124u, 122u, 120u, 104u, 98u, 97u, 90u, 75u, 62u, 60u, 61u, 61u, 59u, 61u, 59u, 57u, 58u, 61u, 65u, 65u, 71u, 75u, 75u, 75u, 79u, 83u, 81u, 85u, 88u, 94u, 102u, 103u, 105u, 103u, 97u, 86u, 84u, 83u, 82u, 66u, 62u, 67u, 75u, 82u, 94u, 112u, 125u, 136u, 150u, 157u, 159u, 161u, 154u, 144u, 144u, 145u, 147u, 151u, 147u, 136u, 138u, 146u, 145u, 138u, 132u, 125u, 134u, 135u, 116u, 83u, 64u, 48u, 40u, 36u, 43u, 57u, 51u, 49u, 49u, 54u, 55u, 69u, 70u, 86u, 103u, 124u, 123u, 120u, 117u, 109u, 86u, 67u, 56u, 48u, 48u, 50u, 51u, 45u, 46u, 43u, 44u, 39u, 31u, 25u, 26u, 27u, 34u, 30u, 22u, 21u, 20u, 24u, 26u, 30u, 36u, 34u, 33u, 36u, 32u, 25u, 21u, 21u }, 
-	{ 31u, 32u, 33u, 33u, 33u, 32u, 32u, 32u, 30u, 31u, 28u, 24u, 20u, 17u, 14u, 14u, 13u, 13u, 12u, 9u, 9u, 12u, 16u, 18u, 19u, 19u, 21u, 21u, 21u, 24u, 26u, 27u, 26u, 22u, 22u, 22u, 22u, 27u, 36u, 47u, 57u, 65u, 66u, 67u, 65u, 61u, 58u, 52u, 45u, 36u, 28u, 25u, 25u, 30u, 38u, 39u, 40u, 39u, 41u, 39u, 44u, 47u, 46u, 46u, 53u, 61u, 64u, 66u, 65u, 71u, 81u, 88u, 97u, 101u, 100u, 96u, 109u, 109u, 117u, 113u, 86u, 67u, 62u, 68u, 72u, 87u, 106u, 105u, 104u, 105u, 111u, 119u, 122u, 119u, 115u, 114u, 104u, 101u, 109u, 118u, 124u, 127u, 128u, 135u, 145u, 151u, 148u, 141u, 143u, 148u, 145u, 140u, 132u, 123u, 112u, 111u, 112u, 103u, 103u, 108u, 112u, 114u, 117u, 115u, 112u, 117u, 121u, 118u, 119u, 122u, 117u, 120u, 117u, 117u, 122u, 128u, 125u, 108u, 93u, 87u, 85u, 79u, 67u, 63u, 63u, 64u, 66u, 68u, 62u, 56u, 56u, 60u, 64u, 65u, 69u, 72u, 74u, 77u, 77u, 75u, 74u, 75u, 73u, 77u, 85u, 91u, 96u, 96u, 90u, 77u, 70u, 69u, 66u, 56u, 58u, 64u, 70u, 75u, 87u, 104u, 117u, 128u, 143u, 153u, 160u, 163u, 154u, 145u, 149u, 149u, 149u, 151u, 145u, 139u, 141u, 142u, 133u, 130u, 123u, 119u, 121u, 122u, 102u, 75u, 54u, 39u, 37u, 34u, 32u, 42u, 38u, 36u, 37u, 37u, 43u, 61u, 70u, 86u, 106u, 117u, 129u, 141u, 134u, 118u, 96u, 75u, 59u, 46u, 37u, 34u, 38u, 37u, 35u, 35u, 36u, 28u, 24u, 20u, 18u, 20u, 24u, 24u, 16u, 13u, 12u, 17u, 22u, 27u, 33u, 32u, 33u, 36u, 32u, 26u, 22u, 22u }, 
-	{ 32u, 30u, 31u, 30u, 31u, 30u, 32u, 34u, 33u, 32u, 31u, 28u, 23u, 20u, 16u, 15u, 15u, 14u, 12u, 10u, 11u, 12u, 16u, 19u, 19u, 19u, 18u, 20u, 22u, 25u, 27u, 27u, 27u, 24u, 22u, 24u, 29u, 33u, 41u, 48u, 59u, 68u, 68u, 67u, 70u, 68u, 61u, 49u, 46u, 36u, 27u, 24u, 21u, 24u, 31u, 35u, 40u, 39u, 39u, 40u, 44u, 43u, 43u, 47u, 54u, 53u, 54u, 69u, 72u, 76u, 94u, 104u, 107u, 111u, 115u, 110u, 115u, 124u, 130u, 124u, 101u, 84u, 77u, 77u, 79u, 95u, 103u, 100u, 102u, 110u, 118u, 120u, 120u, 126u, 122u, 121u, 109u, 102u, 107u, 113u, 117u, 131u, 135u, 141u, 148u, 153u, 150u, 141u, 135u, 137u, 133u, 129u, 116u, 110u, 101u, 97u, 90u, 82u, 83u, 86u, 96u, 105u, 109u, 114u, 120u, 126u, 129u, 128u, 122u, 121u, 118u, 120u, 118u, 122u, 121u, 125u, 116u, 105u, 93u, 82u, 84u, 84u, 74u, 70u, 69u, 67u, 68u, 66u, 60u, 57u, 56u, 57u, 61u, 67u, 68u, 69u, 73u, 74u, 74u, 68u, 68u, 72u, 70u, 70u, 73u, 80u, 82u, 83u, 78u, 70u, 64u, 58u, 54u, 54u, 59u, 64u, 69u, 77u, 88u, 99u, 113u, 123u, 133u, 142u, 154u, 158u, 151u, 142u, 142u, 150u, 150u, 144u, 135u, 134u, 140u, 134u, 131u, 128u, 115u, 113u, 106u, 106u, 94u, 73u, 52u, 42u, 45u, 38u, 33u, 40u, 36u, 32u, 38u, 36u, 42u, 59u, 71u, 83u, 100u, 113u, 122u, 131u, 132u, 115u, 100u, 81u, 58u, 46u, 34u, 32u, 31u, 35u, 28u, 26u, 32u, 28u, 21u, 17u, 16u, 18u, 17u, 14u, 12u, 10u, 9u, 15u, 20u, 24u, 29u, 29u, 28u, 28u, 27u, 25u, 21u, 21u }, 
-	{ 38u, 32u, 28u, 26u, 26u, 29u, 32u, 33u, 34u, 35u, 35u, 32u, 25u, 21u, 19u, 17u, 16u, 14u, 12u, 12u, 13u, 13u, 16u, 17u, 18u, 19u, 16u, 19u, 21u, 23u, 24u, 25u, 25u, 23u, 23u, 28u, 30u, 36u, 41u, 50u, 63u, 69u, 73u, 70u, 72u, 67u, 60u, 54u, 48u, 36u, 32u, 29u, 23u, 20u, 24u, 28u, 32u, 34u, 36u, 36u, 40u, 43u, 39u, 45u, 46u, 46u, 54u, 68u, 77u, 90u, 103u, 116u, 107u, 114u, 119u, 128u, 120u, 126u, 138u, 132u, 116u, 99u, 94u, 93u, 90u, 100u, 95u, 95u, 107u, 119u, 130u, 125u, 123u, 122u, 125u, 120u, 110u, 104u, 100u, 104u, 111u, 125u, 130u, 133u, 149u, 153u, 151u, 142u, 134u, 128u, 123u, 110u, 99u, 92u, 89u, 80u, 69u, 65u, 64u, 71u, 88u, 101u, 108u, 116u, 125u, 127u, 127u, 128u, 125u, 120u, 118u, 118u, 121u, 122u, 124u, 123u, 117u, 100u, 91u, 85u, 82u, 87u, 80u, 77u, 77u, 72u, 66u, 60u, 58u, 60u, 58u, 56u, 59u, 61u, 64u, 65u, 66u, 69u, 69u, 67u, 66u, 71u, 68u, 65u, 66u, 70u, 69u, 70u, 67u, 64u, 63u, 57u, 51u, 54u, 59u, 64u, 67u, 78u, 86u, 96u, 111u, 124u, 127u, 133u, 147u, 151u, 148u, 138u, 133u, 143u, 143u, 138u, 128u, 129u, 126u, 130u, 136u, 137u, 128u, 118u, 105u, 90u, 82u, 68u, 60u, 56u, 53u, 51u, 43u, 43u, 50u, 44u, 44u, 37u, 40u, 52u, 67u, 86u, 98u, 104u, 112u, 114u, 113u, 110u, 100u, 91u, 74u, 57u, 43u, 37u, 32u, 27u, 23u, 22u, 29u, 32u, 27u, 23u, 17u, 16u, 12u, 9u, 10u, 9u, 9u, 16u, 18u, 21u, 24u, 25u, 22u, 25u, 26u, 23u, 21u, 18u }, 
-	{ 41u, 37u, 31u, 28u, 26u, 27u, 30u, 33u, 33u, 34u, 34u, 32u, 27u, 23u, 21u, 16u, 14u, 12u, 13u, 13u, 14u, 14u, 16u, 16u, 16u, 19u, 19u, 19u, 20u, 21u, 22u, 22u, 23u, 23u, 23u, 28u, 32u, 37u, 38u, 46u, 56u, 67u, 77u, 74u, 69u, 61u, 54u, 49u, 44u, 43u, 40u, 34u, 27u, 20u, 19u, 22u, 27u, 31u, 36u, 34u, 35u, 41u, 40u, 43u, 44u, 47u, 54u, 67u, 91u, 104u, 110u, 112u, 96u, 101u, 115u, 135u, 132u, 123u, 130u, 132u, 123u, 106u, 97u, 98u, 98u, 104u, 99u, 100u, 106u, 118u, 132u, 131u, 128u, 126u, 126u, 119u, 119u, 117u, 110u, 108u, 111u, 113u, 123u, 131u, 148u, 150u, 146u, 133u, 126u, 118u, 116u, 101u, 92u, 82u, 73u, 61u, 55u, 53u, 53u, 58u, 78u, 92u, 101u, 108u, 112u, 117u, 121u, 119u, 115u, 108u, 112u, 114u, 117u, 123u, 128u, 127u, 124u, 106u, 100u, 93u, 82u, 85u, 82u, 82u, 75u, 67u, 63u, 57u, 55u, 56u, 60u, 61u, 61u, 59u, 60u, 63u, 64u, 68u, 67u, 65u, 62u, 64u, 63u, 63u, 62u, 63u, 63u, 62u, 59u, 59u, 58u, 52u, 50u, 52u, 56u, 62u, 67u, 75u, 86u, 99u, 107u, 119u, 122u, 128u, 140u, 144u, 138u, 127u, 120u, 127u, 130u, 135u, 126u, 119u, 119u, 128u, 140u, 141u, 131u, 119u, 105u, 89u, 83u, 74u, 70u, 67u, 55u, 49u, 51u, 53u, 60u, 56u, 55u, 52u, 53u, 60u, 78u, 93u, 98u, 96u, 103u, 102u, 100u, 99u, 96u, 96u, 89u, 71u, 49u, 36u, 29u, 27u, 31u, 33u, 36u, 38u, 31u, 23u, 14u, 13u, 12u, 11u, 11u, 9u, 10u, 15u, 16u, 13u, 16u, 19u, 21u, 25u, 28u, 27u, 22u, 17u }, 
-	{ 43u, 39u, 35u, 32u, 27u, 25u, 29u, 31u, 32u, 34u, 33u, 31u, 27u, 23u, 20u, 16u, 15u, 13u, 14u, 14u, 14u, 14u, 14u, 13u, 15u, 19u, 21u, 20u, 20u, 21u, 22u, 20u, 20u, 21u, 20u, 21u, 30u, 33u, 33u, 39u, 47u, 55u, 65u, 61u, 56u, 59u, 53u, 46u, 45u, 47u, 45u, 39u, 30u, 24u, 22u, 22u, 25u, 34u, 41u, 36u, 37u, 39u, 39u, 40u, 47u, 49u, 59u, 73u, 93u, 104u, 111u, 105u, 91u, 88u, 98u, 118u, 129u, 127u, 127u, 129u, 126u, 112u, 103u, 99u, 110u, 110u, 105u, 101u, 109u, 120u, 134u, 135u, 128u, 121u, 117u, 113u, 121u, 124u, 117u, 115u, 121u, 120u, 127u, 141u, 151u, 144u, 134u, 127u, 121u, 116u, 107u, 94u, 86u, 77u, 67u, 62u, 56u, 54u, 48u, 52u, 74u, 88u, 95u, 96u, 100u, 108u, 114u, 111u, 105u, 96u, 97u, 103u, 115u, 119u, 120u, 122u, 126u, 116u, 106u, 98u, 89u, 87u, 84u, 78u, 70u, 61u, 60u, 59u, 57u, 58u, 63u, 62u, 60u, 59u, 58u, 61u, 62u, 65u, 68u, 65u, 64u, 61u, 64u, 66u, 63u, 64u, 63u, 57u, 56u, 57u, 54u, 51u, 51u, 48u, 50u, 57u, 62u, 70u, 79u, 92u, 101u, 107u, 111u, 120u, 125u, 131u, 127u, 121u, 117u, 117u, 123u, 117u, 118u, 113u, 111u, 119u, 131u, 135u, 135u, 126u, 107u, 95u, 83u, 79u, 78u, 64u, 58u, 53u, 52u, 53u, 61u, 57u, 57u, 54u, 62u, 72u, 98u, 109u, 114u, 113u, 113u, 107u, 104u, 99u, 102u, 105u, 100u, 87u, 69u, 44u, 34u, 35u, 41u, 48u, 44u, 45u, 38u, 24u, 15u, 12u, 14u, 14u, 11u, 10u, 11u, 11u, 11u, 11u, 15u, 18u, 21u, 22u, 25u, 28u, 23u, 18u }, 
-	{ 44u, 41u, 38u, 34u, 28u, 27u, 30u, 32u, 31u, 34u, 32u, 28u, 24u, 22u, 19u, 17u, 16u, 15u, 16u, 15u, 14u, 14u, 14u, 13u, 16u, 21u, 24u, 22u, 22u, 22u, 22u, 19u, 19u, 20u, 18u, 18u, 24u, 28u, 28u, 30u, 34u, 42u, 46u, 48u, 45u, 49u, 48u, 45u, 45u, 45u, 45u, 41u, 34u, 30u, 29u, 28u, 30u, 40u, 45u, 43u, 43u, 42u, 44u, 43u, 44u, 50u, 64u, 87u, 98u, 104u, 108u, 103u, 97u, 94u, 93u, 108u, 119u, 126u, 129u, 129u, 131u, 118u, 111u, 105u, 112u, 113u, 108u, 110u, 119u, 129u, 131u, 130u, 125u, 113u, 112u, 117u, 121u, 124u, 120u, 116u, 125u, 134u, 144u, 155u, 150u, 143u, 136u, 130u, 127u, 117u, 108u, 90u, 81u, 73u, 66u, 64u, 56u, 51u, 49u, 55u, 73u, 80u, 84u, 87u, 89u, 94u, 103u, 100u, 95u, 86u, 87u, 94u, 105u, 105u, 108u, 110u, 117u, 121u, 108u, 101u, 100u, 94u, 89u, 78u, 70u, 60u, 59u, 59u, 62u, 64u, 65u, 66u, 63u, 60u, 59u, 61u, 63u, 66u, 67u, 65u, 66u, 63u, 65u, 66u, 65u, 63u, 63u, 56u, 56u, 60u, 58u, 55u, 50u, 46u, 48u, 53u, 61u, 68u, 72u, 81u, 92u, 99u, 101u, 104u, 112u, 120u, 120u, 116u, 113u, 121u, 120u, 111u, 104u, 106u, 106u, 105u, 114u, 123u, 127u, 129u, 126u, 100u, 83u, 83u, 83u, 74u, 70u, 66u, 54u, 45u, 48u, 52u, 52u, 46u, 57u, 87u, 114u, 126u, 131u, 130u, 114u, 102u, 100u, 104u, 105u, 106u, 103u, 99u, 84u, 59u, 42u, 41u, 50u, 58u, 58u, 50u, 46u, 30u, 20u, 17u, 16u, 18u, 11u, 9u, 8u, 7u, 9u, 12u, 14u, 15u, 16u, 20u, 24u, 26u, 24u, 19u }, 
-	{ 43u, 43u, 38u, 34u, 32u, 31u, 31u, 31u, 29u, 32u, 31u, 27u, 24u, 23u, 21u, 19u, 17u, 16u, 16u, 16u, 15u, 17u, 17u, 18u, 21u, 25u, 27u, 27u, 27u, 26u, 27u, 24u, 21u, 20u, 17u, 19u, 23u, 25u, 25u, 25u, 28u, 33u, 35u, 37u, 37u, 40u, 39u, 40u, 39u, 40u, 42u, 39u, 37u, 36u, 34u, 36u, 39u, 46u, 50u, 55u, 53u, 46u, 48u, 53u, 52u, 60u, 72u, 98u, 107u, 106u, 108u, 106u, 101u, 100u, 96u, 106u, 115u, 114u, 114u, 114u, 123u, 121u, 120u, 112u, 116u, 115u, 113u, 118u, 125u, 130u, 129u, 125u, 121u, 115u, 115u, 120u, 126u, 128u, 128u, 127u, 132u, 144u, 150u, 158u, 150u, 140u, 135u, 131u, 122u, 109u, 107u, 94u, 84u, 77u, 67u, 61u, 61u, 56u, 52u, 56u, 68u, 74u, 72u, 76u, 82u, 83u, 89u, 90u, 87u, 80u, 77u, 79u, 89u, 97u, 104u, 102u, 102u, 111u, 113u, 104u, 101u, 102u, 94u, 83u, 75u, 66u, 61u, 58u, 65u, 71u, 68u, 70u, 68u, 65u, 62u, 64u, 65u, 66u, 70u, 69u, 65u, 62u, 64u, 68u, 70u, 67u, 64u, 59u, 60u, 63u, 62u, 58u, 53u, 50u, 48u, 51u, 59u, 63u, 68u, 78u, 86u, 91u, 93u, 94u, 100u, 101u, 102u, 103u, 108u, 116u, 110u, 99u, 87u, 92u, 96u, 91u, 95u, 104u, 110u, 121u, 129u, 107u, 85u, 78u, 74u, 73u, 72u, 62u, 60u, 50u, 47u, 45u, 44u, 49u, 59u, 88u, 108u, 122u, 133u, 129u, 115u, 106u, 95u, 97u, 97u, 103u, 105u, 98u, 89u, 69u, 52u, 48u, 55u, 63u, 72u, 65u, 50u, 31u, 21u, 19u, 17u, 18u, 13u, 10u, 8u, 6u, 8u, 12u, 14u, 16u, 17u, 20u, 21u, 22u, 20u, 17u }, 
-	{ 43u, 44u, 42u, 36u, 35u, 32u, 31u, 29u, 28u, 28u, 28u, 25u, 24u, 23u, 21u, 21u, 21u, 18u, 18u, 18u, 16u, 17u, 18u, 22u, 25u, 26u, 27u, 30u, 29u, 29u, 28u, 25u, 21u, 18u, 15u, 17u, 21u, 23u, 23u, 23u, 26u, 27u, 30u, 34u, 34u, 35u, 35u, 38u, 38u, 39u, 42u, 43u, 44u, 45u, 43u, 44u, 50u, 52u, 53u, 62u, 61u, 52u, 56u, 59u, 60u, 66u, 77u, 96u, 111u, 115u, 127u, 121u, 112u, 115u, 112u, 117u, 114u, 114u, 109u, 110u, 118u, 125u, 124u, 116u, 119u, 124u, 127u, 130u, 136u, 135u, 130u, 131u, 125u, 125u, 131u, 128u, 130u, 137u, 133u, 132u, 132u, 140u, 149u, 155u, 152u, 143u, 137u, 128u, 117u, 109u, 110u, 106u, 94u, 83u, 73u, 68u, 65u, 57u, 56u, 61u, 68u, 67u, 65u, 72u, 77u, 74u, 75u, 70u, 65u, 69u, 71u, 74u, 79u, 91u, 91u, 91u, 93u, 105u, 108u, 99u, 95u, 91u, 78u, 74u, 69u, 70u, 64u, 59u, 68u, 73u, 70u, 74u, 76u, 71u, 68u, 69u, 68u, 69u, 73u, 72u, 68u, 66u, 66u, 70u, 72u, 68u, 65u, 65u, 66u, 69u, 66u, 62u, 57u, 57u, 52u, 52u, 56u, 63u, 72u, 78u, 84u, 86u, 88u, 84u, 90u, 89u, 90u, 96u, 98u, 99u, 104u, 95u, 87u, 86u, 85u, 88u, 91u, 100u, 111u, 109u, 116u, 110u, 91u, 81u, 69u, 76u, 80u, 71u, 65u, 60u, 51u, 57u, 56u, 63u, 73u, 92u, 97u, 105u, 119u, 120u, 119u, 105u, 97u, 85u, 83u, 91u, 94u, 91u, 87u, 66u, 55u, 60u, 70u, 74u, 74u, 73u, 59u, 38u, 26u, 22u, 20u, 20u, 13u, 10u, 8u, 8u, 10u, 13u, 17u, 21u, 23u, 18u, 19u, 19u, 18u, 15u }, 
-	{ 43u, 43u, 40u, 37u, 35u, 32u, 30u, 27u, 23u, 22u, 25u, 26u, 23u, 22u, 20u, 21u, 22u, 22u, 21u, 20u, 18u, 19u, 21u, 25u, 25u, 25u, 28u, 32u, 30u, 30u, 26u, 23u, 20u, 18u, 17u, 19u, 23u, 25u, 25u, 25u, 28u, 28u, 29u, 29u, 31u, 33u, 34u, 37u, 40u, 39u, 42u, 45u, 50u, 55u, 55u, 56u, 60u, 60u, 62u, 72u, 68u, 61u, 63u, 65u, 64u, 71u, 82u, 100u, 116u, 126u, 134u, 137u, 136u, 134u, 134u, 133u, 132u, 128u, 123u, 120u, 118u, 127u, 130u, 126u, 130u, 134u, 136u, 144u, 148u, 145u, 139u, 139u, 138u, 143u, 145u, 140u, 139u, 144u, 141u, 134u, 130u, 137u, 143u, 148u, 152u, 150u, 141u, 131u, 120u, 115u, 114u, 107u, 99u, 86u, 82u, 75u, 66u, 58u, 59u, 62u, 66u, 67u, 67u, 69u, 73u, 69u, 62u, 54u, 50u, 54u, 65u, 71u, 74u, 82u, 83u, 86u, 87u, 91u, 92u, 89u, 82u, 76u, 69u, 69u, 67u, 65u, 60u, 60u, 67u, 73u, 73u, 78u, 79u, 75u, 72u, 71u, 71u, 72u, 75u, 75u, 72u, 69u, 69u, 71u, 71u, 70u, 68u, 69u, 71u, 72u, 71u, 69u, 65u, 62u, 58u, 57u, 59u, 64u, 74u, 81u, 82u, 84u, 86u, 83u, 84u, 89u, 93u, 92u, 90u, 94u, 99u, 98u, 88u, 79u, 82u, 86u, 96u, 109u, 113u, 100u, 102u, 102u, 94u, 84u, 75u, 91u, 97u, 90u, 82u, 76u, 61u, 64u, 69u, 78u, 91u, 101u, 93u, 87u, 94u, 103u, 111u, 97u, 96u, 88u, 77u, 73u, 76u, 78u, 79u, 62u, 58u, 74u, 83u, 75u, 73u, 71u, 61u, 45u, 36u, 28u, 24u, 19u, 11u, 8u, 10u, 11u, 13u, 16u, 20u, 25u, 28u, 21u, 16u, 16u, 16u, 17u }, 
-	{ 42u, 40u, 36u, 36u, 37u, 35u, 30u, 25u, 22u, 21u, 21u, 23u, 23u, 21u, 20u, 21u, 21u, 25u, 23u, 22u, 22u, 22u, 25u, 26u, 26u, 25u, 29u, 30u, 27u, 26u, 24u, 23u, 20u, 19u, 21u, 21u, 23u, 26u, 27u, 27u, 29u, 27u, 28u, 32u, 34u, 34u, 32u, 34u, 38u, 40u, 42u, 46u, 50u, 59u, 63u, 66u, 69u, 68u, 69u, 77u, 77u, 67u, 65u, 72u, 72u, 83u, 91u, 104u, 114u, 127u, 131u, 135u, 145u, 143u, 147u, 142u, 142u, 137u, 133u, 129u, 131u, 138u, 138u, 141u, 149u, 152u, 152u, 159u, 165u, 162u, 155u, 150u, 150u, 157u, 159u, 156u, 152u, 153u, 151u, 147u, 139u, 145u, 150u, 149u, 154u, 157u, 148u, 137u, 125u, 120u, 119u, 110u, 102u, 95u, 90u, 73u, 60u, 58u, 62u, 67u, 69u, 70u, 69u, 61u, 61u, 65u, 59u, 50u, 46u, 48u, 57u, 64u, 73u, 79u, 80u, 78u, 78u, 78u, 77u, 82u, 74u, 71u, 67u, 64u, 61u, 55u, 54u, 58u, 63u, 70u, 75u, 80u, 79u, 77u, 75u, 74u, 75u, 75u, 75u, 75u, 73u, 70u, 68u, 70u, 71u, 72u, 71u, 73u, 74u, 71u, 72u, 71u, 73u, 66u, 63u, 60u, 61u, 66u, 73u, 77u, 85u, 87u, 86u, 88u, 87u, 89u, 90u, 85u, 87u, 90u, 87u, 85u, 78u, 78u, 82u, 87u, 100u, 110u, 114u, 112u, 109u, 110u, 102u, 97u, 95u, 94u, 100u, 100u, 91u, 92u, 86u, 80u, 84u, 89u, 92u, 91u, 89u, 80u, 82u, 89u, 105u, 100u, 96u, 89u, 82u, 73u, 73u, 74u, 74u, 58u, 53u, 68u, 73u, 72u, 70u, 63u, 60u, 49u, 38u, 27u, 24u, 21u, 15u, 12u, 12u, 11u, 13u, 21u, 28u, 35u, 34u, 27u, 22u, 19u, 18u, 18u }, 
-	{ 43u, 41u, 39u, 37u, 37u, 35u, 28u, 24u, 23u, 21u, 20u, 20u, 20u, 19u, 21u, 22u, 23u, 25u, 23u, 23u, 24u, 24u, 27u, 26u, 26u, 26u, 28u, 27u, 24u, 22u, 21u, 19u, 18u, 19u, 23u, 23u, 25u, 28u, 28u, 29u, 29u, 29u, 28u, 33u, 38u, 35u, 34u, 34u, 37u, 40u, 42u, 47u, 51u, 60u, 66u, 71u, 72u, 72u, 75u, 81u, 82u, 74u, 73u, 79u, 79u, 84u, 89u, 103u, 113u, 126u, 141u, 146u, 154u, 156u, 153u, 153u, 149u, 144u, 137u, 140u, 148u, 150u, 152u, 155u, 165u, 167u, 169u, 168u, 174u, 173u, 170u, 162u, 164u, 166u, 166u, 165u, 161u, 164u, 162u, 155u, 154u, 153u, 154u, 156u, 157u, 161u, 160u, 149u, 133u, 123u, 120u, 116u, 109u, 101u, 89u, 74u, 61u, 60u, 66u, 71u, 71u, 75u, 70u, 62u, 58u, 61u, 58u, 53u, 49u, 47u, 51u, 61u, 68u, 71u, 75u, 71u, 74u, 73u, 79u, 79u, 72u, 66u, 60u, 59u, 54u, 52u, 50u, 54u, 63u, 69u, 76u, 80u, 79u, 78u, 79u, 78u, 77u, 77u, 75u, 73u, 72u, 71u, 69u, 70u, 71u, 72u, 72u, 75u, 75u, 72u, 73u, 74u, 77u, 71u, 68u, 63u, 63u, 67u, 72u, 75u, 82u, 89u, 87u, 88u, 87u, 88u, 84u, 84u, 86u, 90u, 84u, 77u, 68u, 69u, 76u, 80u, 98u, 108u, 114u, 119u, 118u, 120u, 118u, 101u, 98u, 88u, 100u, 100u, 97u, 91u, 90u, 80u, 84u, 87u, 87u, 79u, 83u, 84u, 83u, 86u, 90u, 95u, 88u, 84u, 81u, 84u, 79u, 77u, 72u, 57u, 49u, 58u, 70u, 75u, 67u, 64u, 60u, 59u, 49u, 39u, 32u, 29u, 23u, 18u, 16u, 17u, 18u, 29u, 40u, 41u, 38u, 36u, 30u, 24u, 21u, 19u }, 
-	{ 45u, 40u, 40u, 41u, 39u, 35u, 28u, 23u, 22u, 21u, 18u, 17u, 20u, 21u, 24u, 24u, 24u, 24u, 24u, 24u, 25u, 27u, 29u, 26u, 26u, 27u, 28u, 25u, 20u, 17u, 15u, 15u, 18u, 21u, 25u, 23u, 25u, 27u, 28u, 29u, 30u, 30u, 30u, 35u, 41u, 39u, 35u, 34u, 37u, 41u, 46u, 51u, 58u, 64u, 69u, 75u, 75u, 78u, 83u, 85u, 84u, 84u, 84u, 82u, 82u, 88u, 92u, 100u, 111u, 124u, 144u, 158u, 167u, 167u, 164u, 162u, 155u, 151u, 150u, 151u, 152u, 153u, 163u, 169u, 175u, 174u, 179u, 180u, 182u, 182u, 179u, 176u, 177u, 174u, 168u, 165u, 166u, 163u, 160u, 159u, 158u, 156u, 158u, 162u, 164u, 166u, 164u, 155u, 143u, 131u, 121u, 119u, 112u, 106u, 93u, 76u, 63u, 63u, 72u, 74u, 76u, 80u, 74u, 62u, 56u, 59u, 61u, 52u, 48u, 47u, 52u, 60u, 65u, 67u, 70u, 69u, 70u, 70u, 77u, 78u, 68u, 61u, 56u, 52u, 51u, 50u, 51u, 53u, 59u, 68u, 74u, 79u, 78u, 81u, 83u, 80u, 78u, 76u, 74u, 72u, 69u, 70u, 71u, 72u, 72u, 72u, 74u, 77u, 75u, 73u, 75u, 78u, 78u, 76u, 73u, 69u, 66u, 68u, 73u, 75u, 82u, 88u, 86u, 88u, 84u, 80u, 79u, 79u, 77u, 80u, 79u, 80u, 68u, 63u, 69u, 73u, 84u, 105u, 119u, 123u, 117u, 118u, 116u, 99u, 86u, 84u, 93u, 96u, 95u, 94u, 95u, 93u, 97u, 95u, 89u, 78u, 79u, 86u, 84u, 87u, 87u, 91u, 92u, 85u, 79u, 91u, 89u, 80u, 72u, 59u, 51u, 59u, 69u, 76u, 75u, 81u, 81u, 78u, 68u, 58u, 47u, 42u, 34u, 28u, 23u, 24u, 27u, 38u, 47u, 50u, 48u, 44u, 39u, 31u, 24u, 21u }, 
-	{ 45u, 42u, 38u, 41u, 38u, 33u, 26u, 23u, 22u, 21u, 19u, 18u, 21u, 23u, 24u, 22u, 22u, 21u, 22u, 23u, 23u, 25u, 24u, 21u, 22u, 24u, 25u, 24u, 20u, 17u, 15u, 15u, 17u, 20u, 22u, 24u, 25u, 27u, 26u, 26u, 26u, 27u, 28u, 34u, 37u, 38u, 35u, 33u, 38u, 45u, 54u, 59u, 67u, 69u, 75u, 83u, 82u, 86u, 91u, 86u, 87u, 90u, 88u, 88u, 89u, 90u, 95u, 98u, 113u, 125u, 144u, 159u, 171u, 174u, 177u, 170u, 158u, 153u, 161u, 162u, 158u, 159u, 168u, 179u, 183u, 184u, 190u, 190u, 191u, 194u, 191u, 190u, 192u, 184u, 176u, 170u, 166u, 162u, 162u, 157u, 158u, 159u, 156u, 158u, 156u, 160u, 160u, 160u, 149u, 139u, 130u, 127u, 118u, 110u, 99u, 85u, 72u, 69u, 71u, 74u, 79u, 79u, 76u, 63u, 57u, 59u, 60u, 53u, 47u, 43u, 48u, 54u, 61u, 66u, 65u, 67u, 70u, 68u, 71u, 75u, 63u, 57u, 55u, 53u, 49u, 45u, 47u, 49u, 54u, 64u, 73u, 79u, 81u, 84u, 84u, 80u, 78u, 75u, 72u, 71u, 69u, 69u, 70u, 70u, 71u, 72u, 76u, 79u, 78u, 78u, 77u, 75u, 74u, 74u, 73u, 74u, 71u, 71u, 75u, 78u, 83u, 88u, 89u, 88u, 84u, 82u, 77u, 74u, 74u, 74u, 75u, 77u, 69u, 68u, 68u, 73u, 85u, 101u, 115u, 122u, 109u, 107u, 103u, 90u, 75u, 74u, 74u, 73u, 78u, 88u, 91u, 97u, 103u, 103u, 97u, 88u, 85u, 96u, 94u, 90u, 91u, 97u, 95u, 86u, 90u, 92u, 86u, 90u, 80u, 67u, 62u, 67u, 75u, 90u, 95u, 96u, 98u, 92u, 82u, 71u, 55u, 44u, 39u, 38u, 35u, 38u, 45u, 50u, 51u, 54u, 57u, 49u, 45u, 41u, 31u, 27u }, 
-	{ 48u, 45u, 41u, 37u, 35u, 31u, 23u, 22u, 22u, 21u, 20u, 22u, 24u, 24u, 22u, 20u, 19u, 19u, 20u, 21u, 21u, 20u, 17u, 16u, 16u, 19u, 20u, 21u, 19u, 17u, 15u, 16u, 17u, 19u, 21u, 24u, 25u, 28u, 27u, 26u, 25u, 26u, 27u, 32u, 33u, 36u, 36u, 37u, 43u, 51u, 62u, 66u, 72u, 77u, 80u, 83u, 89u, 90u, 93u, 88u, 89u, 94u, 91u, 93u, 93u, 93u, 91u, 96u, 110u, 126u, 139u, 156u, 174u, 176u, 180u, 177u, 166u, 166u, 168u, 169u, 168u, 164u, 172u, 185u, 188u, 191u, 193u, 199u, 204u, 204u, 201u, 202u, 200u, 190u, 181u, 172u, 169u, 167u, 165u, 160u, 154u, 153u, 150u, 151u, 151u, 154u, 157u, 159u, 153u, 148u, 139u, 133u, 129u, 119u, 111u, 99u, 89u, 76u, 75u, 74u, 69u, 70u, 65u, 60u, 57u, 59u, 57u, 54u, 43u, 40u, 42u, 45u, 52u, 58u, 57u, 64u, 70u, 67u, 67u, 63u, 54u, 50u, 49u, 49u, 46u, 44u, 47u, 50u, 54u, 66u, 75u, 80u, 81u, 82u, 83u, 79u, 76u, 74u, 70u, 70u, 69u, 68u, 68u, 67u, 68u, 70u, 74u, 79u, 80u, 78u, 78u, 74u, 75u, 72u, 73u, 75u, 75u, 73u, 77u, 80u, 86u, 93u, 94u, 91u, 89u, 86u, 79u, 80u, 77u, 74u, 72u, 74u, 71u, 70u, 69u, 75u, 80u, 90u, 104u, 113u, 105u, 88u, 75u, 70u, 59u, 60u, 66u, 67u, 72u, 80u, 88u, 102u, 106u, 113u, 105u, 100u, 98u, 105u, 110u, 106u, 96u, 99u, 90u, 87u, 86u, 86u, 89u, 93u, 86u, 80u, 76u, 76u, 84u, 100u, 114u, 117u, 115u, 115u, 98u, 83u, 67u, 51u, 48u, 48u, 51u, 52u, 59u, 61u, 57u, 54u, 57u, 53u, 52u, 51u, 39u, 34u }, 
-	{ 54u, 46u, 42u, 36u, 32u, 29u, 25u, 21u, 21u, 22u, 23u, 25u, 24u, 24u, 22u, 19u, 15u, 14u, 15u, 17u, 20u, 17u, 14u, 14u, 14u, 15u, 16u, 17u, 16u, 17u, 15u, 13u, 16u, 22u, 26u, 26u, 26u, 28u, 28u, 26u, 27u, 28u, 30u, 32u, 35u, 40u, 43u, 48u, 54u, 62u, 73u, 78u, 79u, 83u, 87u, 90u, 95u, 97u, 96u, 92u, 98u, 102u, 99u, 96u, 96u, 95u, 91u, 91u, 97u, 120u, 136u, 151u, 169u, 178u, 180u, 179u, 175u, 174u, 173u, 177u, 177u, 174u, 179u, 191u, 195u, 197u, 201u, 208u, 210u, 212u, 210u, 205u, 199u, 195u, 186u, 176u, 170u, 166u, 163u, 163u, 157u, 154u, 154u, 153u, 151u, 154u, 156u, 157u, 157u, 153u, 141u, 133u, 129u, 125u, 117u, 106u, 97u, 86u, 79u, 76u, 69u, 66u, 64u, 62u, 58u, 57u, 52u, 49u, 39u, 34u, 36u, 40u, 47u, 51u, 53u, 62u, 68u, 66u, 64u, 58u, 53u, 44u, 42u, 43u, 42u, 43u, 49u, 54u, 59u, 67u, 73u, 78u, 81u, 82u, 80u, 77u, 74u, 72u, 69u, 68u, 68u, 67u, 66u, 66u, 67u, 69u, 74u, 79u, 80u, 78u, 78u, 76u, 74u, 71u, 74u, 76u, 77u, 77u, 79u, 83u, 89u, 96u, 99u, 98u, 92u, 84u, 83u, 87u, 83u, 79u, 76u, 71u, 67u, 65u, 64u, 70u, 77u, 82u, 90u, 99u, 96u, 73u, 62u, 60u, 59u, 62u, 62u, 60u, 61u, 64u, 74u, 100u, 113u, 115u, 109u, 106u, 110u, 117u, 123u, 118u, 111u, 112u, 98u, 84u, 70u, 71u, 79u, 94u, 90u, 80u, 70u, 76u, 92u, 108u, 121u, 127u, 131u, 132u, 114u, 92u, 75u, 68u, 63u, 59u, 62u, 62u, 64u, 64u, 61u, 57u, 63u, 66u, 70u, 65u, 51u, 45u }, 
-	{ 58u, 51u, 46u, 39u, 33u, 27u, 24u, 20u, 21u, 23u, 25u, 26u, 24u, 23u, 23u, 17u, 14u, 14u, 13u, 12u, 16u, 15u, 14u, 14u, 14u, 13u, 15u, 16u, 15u, 15u, 14u, 13u, 17u, 26u, 28u, 28u, 30u, 31u, 33u, 30u, 30u, 33u, 33u, 34u, 34u, 38u, 46u, 54u, 62u, 71u, 77u, 83u, 84u, 86u, 92u, 98u, 98u, 99u, 99u, 102u, 106u, 106u, 101u, 99u, 101u, 99u, 100u, 98u, 100u, 111u, 124u, 140u, 156u, 172u, 180u, 183u, 184u, 182u, 179u, 176u, 182u, 184u, 191u, 200u, 205u, 206u, 211u, 211u, 214u, 216u, 212u, 207u, 197u, 191u, 185u, 178u, 177u, 173u, 169u, 166u, 162u, 158u, 158u, 157u, 159u, 162u, 166u, 168u, 165u, 156u, 140u, 134u, 129u, 123u, 120u, 116u, 109u, 102u, 84u, 77u, 73u, 67u, 65u, 61u, 60u, 56u, 45u, 40u, 33u, 30u, 32u, 38u, 43u, 48u, 53u, 57u, 60u, 58u, 62u, 57u, 54u, 48u, 43u, 40u, 38u, 42u, 48u, 55u, 60u, 67u, 72u, 76u, 81u, 82u, 80u, 77u, 74u, 71u, 68u, 65u, 64u, 65u, 64u, 65u, 66u, 70u, 74u, 77u, 80u, 80u, 81u, 80u, 78u, 74u, 75u, 74u, 74u, 75u, 78u, 88u, 92u, 96u, 100u, 99u, 90u, 87u, 92u, 91u, 86u, 81u, 78u, 76u, 72u, 71u, 68u, 69u, 75u, 73u, 76u, 84u, 92u, 75u, 61u, 54u, 57u, 58u, 49u, 52u, 54u, 58u, 71u, 90u, 108u, 106u, 109u, 112u, 118u, 128u, 134u, 125u, 124u, 112u, 98u, 84u, 71u, 74u, 78u, 90u, 86u, 73u, 73u, 83u, 96u, 113u, 121u, 127u, 134u, 132u, 124u, 104u, 89u, 82u, 77u, 65u, 60u, 62u, 67u, 70u, 69u, 67u, 73u, 79u, 78u, 75u, 70u, 63u }, 
-	{ 66u, 55u, 48u, 41u, 34u, 26u, 23u, 19u, 21u, 24u, 24u, 25u, 24u, 23u, 21u, 15u, 13u, 11u, 10u, 11u, 12u, 11u, 12u, 14u, 13u, 12u, 14u, 13u, 13u, 13u, 14u, 15u, 19u, 26u, 27u, 28u, 31u, 35u, 36u, 37u, 35u, 35u, 36u, 35u, 35u, 37u, 43u, 52u, 60u, 71u, 78u, 83u, 84u, 84u, 90u, 93u, 96u, 97u, 101u, 107u, 108u, 105u, 103u, 98u, 96u, 92u, 99u, 106u, 105u, 110u, 119u, 133u, 140u, 156u, 171u, 174u, 175u, 179u, 178u, 176u, 188u, 195u, 198u, 202u, 210u, 214u, 217u, 220u, 220u, 218u, 213u, 207u, 200u, 193u, 187u, 182u, 182u, 180u, 173u, 167u, 162u, 160u, 162u, 158u, 160u, 166u, 168u, 169u, 168u, 158u, 143u, 132u, 127u, 125u, 124u, 125u, 123u, 109u, 93u, 83u, 81u, 76u, 75u, 66u, 59u, 55u, 47u, 38u, 31u, 29u, 30u, 34u, 40u, 46u, 53u, 53u, 50u, 56u, 63u, 64u, 61u, 54u, 46u, 39u, 37u, 38u, 43u, 51u, 60u, 67u, 71u, 75u, 78u, 80u, 78u, 76u, 73u, 69u, 66u, 62u, 61u, 63u, 63u, 65u, 67u, 70u, 72u, 76u, 79u, 80u, 82u, 82u, 81u, 78u, 75u, 73u, 71u, 72u, 78u, 87u, 91u, 91u, 97u, 96u, 95u, 99u, 102u, 103u, 96u, 88u, 80u, 82u, 82u, 76u, 69u, 73u, 76u, 73u, 77u, 81u, 87u, 71u, 60u, 58u, 51u, 53u, 45u, 44u, 48u, 56u, 70u, 85u, 93u, 98u, 118u, 132u, 142u, 153u, 147u, 137u, 125u, 108u, 93u, 90u, 78u, 70u, 79u, 88u, 85u, 77u, 81u, 97u, 103u, 114u, 125u, 131u, 144u, 142u, 134u, 112u, 97u, 90u, 88u, 79u, 66u, 67u, 72u, 77u, 82u, 85u, 85u, 85u, 81u, 81u, 85u, 81u }, 
-	{ 72u, 64u, 54u, 46u, 38u, 29u, 24u, 22u, 24u, 24u, 25u, 25u, 24u, 21u, 17u, 14u, 12u, 10u, 10u, 10u, 8u, 8u, 8u, 9u, 12u, 10u, 9u, 11u, 12u, 13u, 16u, 20u, 24u, 31u, 32u, 32u, 33u, 36u, 38u, 41u, 40u, 37u, 38u, 36u, 39u, 41u, 46u, 51u, 59u, 69u, 75u, 83u, 88u, 87u, 86u, 89u, 92u, 93u, 100u, 105u, 106u, 100u, 99u, 92u, 89u, 88u, 89u, 101u, 109u, 114u, 121u, 125u, 131u, 150u, 160u, 167u, 173u, 172u, 175u, 182u, 191u, 199u, 202u, 204u, 212u, 218u, 222u, 226u, 223u, 219u, 213u, 206u, 201u, 197u, 190u, 183u, 182u, 181u, 174u, 168u, 162u, 160u, 160u, 158u, 161u, 163u, 163u, 162u, 157u, 149u, 140u, 125u, 121u, 119u, 117u, 117u, 122u, 113u, 100u, 92u, 91u, 86u, 85u, 73u, 69u, 58u, 44u, 37u, 32u, 31u, 35u, 37u, 41u, 44u, 49u, 47u, 44u, 53u, 64u, 73u, 74u, 64u, 53u, 45u, 42u, 40u, 43u, 49u, 58u, 64u, 68u, 71u, 73u, 76u, 75u, 73u, 71u, 68u, 66u, 62u, 61u, 61u, 62u, 66u, 69u, 72u, 73u, 74u, 75u, 80u, 83u, 83u, 80u, 77u, 75u, 74u, 72u, 73u, 78u, 86u, 91u, 91u, 93u, 98u, 104u, 108u, 109u, 108u, 98u, 90u, 83u, 86u, 85u, 78u, 68u, 70u, 70u, 71u, 77u, 82u, 77u, 60u, 55u, 55u, 49u, 53u, 45u, 39u, 43u, 55u, 70u, 85u, 97u, 116u, 135u, 146u, 156u, 170u, 165u, 147u, 128u, 105u, 92u, 91u, 75u, 68u, 78u, 76u, 75u, 79u, 92u, 105u, 110u, 116u, 128u, 139u, 149u, 142u, 126u, 116u, 109u, 100u, 89u, 77u, 81u, 85u, 86u, 95u, 107u, 107u, 105u, 104u, 98u, 96u, 99u, 88u }
+#embed "heightmap.bin"
 };
+#endif
+#endif
+
+#ifndef HEIGHTMAP_EMBED
+__asm__(
+    ".section .rodata\n"
+    ".balign 64\n"
+    ".global heightmap_pixels\n"
+    ".type heightmap_pixels, @object\n"
+    "heightmap_pixels:\n"
+    ".incbin \"include/heightmap.bin\"\n"
+    ".size heightmap_pixels, .-heightmap_pixels\n"
+    ".previous\n"
+);
+extern const uint8_t heightmap_pixels[256][256];
+#endif
 
 #endif /* _HEIGHTMAP_H_ */
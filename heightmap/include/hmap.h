@@ -0,0 +1,161 @@
+#ifndef _HMAP_H_
+#define _HMAP_H_
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*      .hmap heightmap container
+ * ---------------------------------
+ * little endian, written by tools/image2header.py -f hmap
+ *
+ *  offset | size | field
+ *  -------+------+----------------------------------------
+ *       0 |    4 | magic "HMAP"
+ *       4 |    2 | version
+ *       6 |    2 | sample type (hmap_type_t)
+ *       8 |    4 | width in samples
+ *      12 |    4 | height in samples
+ *      16 |    4 | row stride in bytes
+ *      20 |    4 | offset of the first row from start of file
+ *
+ * Rows are stored top to bottom (north to south) so the samples can be handed
+ * straight to glTexImage2D. The row stride is the row size rounded up to the
+ * unpack alignment, as GLES 2 has no GL_UNPACK_ROW_LENGTH. 16 bit samples are
+ * little endian, so uploaded as two byte channels they land as (low, high).
+ */
+#define HMAP_MAGIC   "HMAP"
+#define HMAP_VERSION 1u
+
+typedef enum {
+    HMAP_U8  = 1,
+    HMAP_U16 = 2,
+} hmap_type_t;
+
+typedef struct {
+    char     magic[4];
+    uint16_t version;
+    uint16_t type;
+    uint32_t width;
+    uint32_t height;
+    uint32_t stride;
+    uint32_t offset;
+} hmap_header_t;
+
+typedef struct {
+    uint32_t width, height;
+    uint32_t stride;           /* bytes between the start of two rows */
+    hmap_type_t type;
+    const uint8_t* data;       /* first sample of the top row */
+    /* mapping of the whole file */
+    void* map;
+    size_t map_size;
+} hmap_t;
+
+uint32_t hmap_sample_size(hmap_type_t type) {
+    switch (type) {
+    case HMAP_U8:  return 1;
+    case HMAP_U16: return 2;
+    default:       return 0;
+    }
+}
+
+/* largest unpack alignment (8, 4, 2 or 1) the row stride satisfies */
+uint32_t hmap_unpack_alignment(const hmap_t* hmap) {
+    uint32_t align = 8;
+    while (hmap->stride % align != 0)
+        align /= 2;
+    return align;
+}
+
+const uint8_t* hmap_row(const hmap_t* hmap, uint32_t h) {
+    return hmap->data + (size_t) h * hmap->stride;
+}
+
+/* sample w of a row in 8 bit altitude units (0-255) - 16 bit samples keep their extra precision as a fraction */
+float hmap_altitude(const hmap_t* hmap, const uint8_t* row, uint32_t w) {
+    if (hmap->type == HMAP_U16) {
+        const uint8_t* sample = row + 2 * w;
+        return (sample[0] | sample[1] << 8) / 257.f;
+    }
+    return row[w];
+}
+
+/* maps a .hmap file read only - samples are used in place, never copied */
+int hmap_open(hmap_t* hmap, const char* path) {
+    struct stat st;
+    hmap_header_t header;
+    uint32_t row_size, align;
+    int fd;
+
+    memset(hmap, 0, sizeof(*hmap));
+
+    fd = open(path, O_RDONLY);
+    if (fd == -1) {
+        printf("ERROR could not open heightmap \"%s\"\n", path);
+        return -1;
+    }
+    if (fstat(fd, &st) == -1 || (size_t) st.st_size < sizeof(header)) {
+        printf("ERROR heightmap \"%s\" is too small\n", path);
+        close(fd);
+        return -1;
+    }
+
+    hmap->map_size = st.st_size;
+    hmap->map = mmap(NULL, hmap->map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); /* mapping holds its own reference */
+    if (hmap->map == MAP_FAILED) {
+        printf("ERROR could not map heightmap \"%s\"\n", path);
+        hmap->map = NULL;
+        return -1;
+    }
+
+    /* validate header */
+    memcpy(&header, hmap->map, sizeof(header));
+    if (memcmp(header.magic, HMAP_MAGIC, 4) != 0 || header.version != HMAP_VERSION) {
+        printf("ERROR \"%s\" is not a version %u heightmap\n", path, HMAP_VERSION);
+        goto fail;
+    }
+    if (hmap_sample_size(header.type) == 0) {
+        printf("ERROR heightmap \"%s\" has unknown sample type %u\n", path, header.type);
+        goto fail;
+    }
+    row_size = header.width * hmap_sample_size(header.type);
+    hmap->stride = header.stride;
+    align = hmap_unpack_alignment(hmap);
+    if (header.width == 0 || header.height == 0
+        || header.stride != (row_size + align - 1) / align * align
+        || header.offset + (size_t) header.stride * header.height > hmap->map_size) {
+        printf("ERROR heightmap \"%s\" has an invalid layout\n", path);
+        goto fail;
+    }
+
+    hmap->width = header.width;
+    hmap->height = header.height;
+    hmap->type = header.type;
+    hmap->data = (const uint8_t*) hmap->map + header.offset;
+
+    /* terrain generation walks the rows in order */
+    madvise(hmap->map, hmap->map_size, MADV_SEQUENTIAL);
+
+    printf("Mapped heightmap \"%s\": %ux%u, %u bit, stride %u\n", path, hmap->width, hmap->height,
+           8 * hmap_sample_size(hmap->type), hmap->stride);
+    return 0;
+
+fail:
+    munmap(hmap->map, hmap->map_size);
+    memset(hmap, 0, sizeof(*hmap));
+    return -1;
+}
+
+void hmap_close(hmap_t* hmap) {
+    if (hmap->map != NULL)
+        munmap(hmap->map, hmap->map_size);
+    memset(hmap, 0, sizeof(*hmap));
+}
+
+#endif /* _HMAP_H_ */
@@ -0,0 +1,340 @@
+#ifndef _RTIN_H_
+#define _RTIN_H_
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "buffers.h"
+#include "glversion.h"
+#include "hmap.h"
+
+/*      right-triangulated irregular network
+ * ---------------------------------
+ * A square map of 2^n + 1 samples is split into two right triangles, and
+ * every triangle recursively into two at the midpoint of its hypotenuse.
+ * rtin_init walks every triangle of that tree once, finest first, and keeps
+ * for each sample the largest error of any triangle that would be split at
+ * it - the error of skipping the sample and all its descendants. A mesh for
+ * a threshold is then a single walk down the tree that stops wherever the
+ * error is within it, so flat regions end up as a few large triangles.
+ *
+ * The mesh is an indexed triangle list. Vertices are numbered on first use,
+ * and a new batch is started whenever a triangle would take a batch past
+ * 16 bit indices, so every batch is drawn with the vertex arrays offset to it.
+ */
+#define RTIN_MAX_BATCHES 16
+#define RTIN_BATCH_VERTICES (UINT16_MAX + 1)
+
+typedef struct {
+    uint32_t first_vertex;
+    uint32_t first_index, num_indices;
+} rtin_batch_t;
+
+typedef struct {
+    uint32_t size;                  /* samples along each side, 2^n + 1 */
+    float spacing;                  /* world units between samples */
+    uint32_t num_tree_triangles;    /* every triangle of the tree but the two roots */
+    uint16_t* coords;               /* (ax, ay, bx, by) hypotenuse of each tree triangle */
+    float* altitudes;               /* samples in 8 bit altitude units, see hmap_altitude */
+    float* errors;                  /* per sample, same units */
+    /* mesh of the last rtin_extract */
+    float max_error;
+    uint32_t* vertex_ids;           /* per sample - batch + 1 in the high half, index in the batch in the low */
+    uint32_t num_vertices, vertex_capacity;
+#ifdef USE_GL1
+    float scale;                    /* world units per altitude step */
+    vec3* vertices;
+    vec3* colors;
+#endif
+#ifdef USE_GL2
+    vec2* vertices;                 /* placed like the terrain grid, see gl_grid_tex */
+    /* where the mesh was last written to the streams, and their generations then - see buffers.h */
+    uint32_t stream_vertices, stream_indices;
+    uint32_t vertex_generation, index_generation;
+    bool streamed;
+#endif
+    uint16_t* indices;
+    uint32_t num_indices;
+    rtin_batch_t batches[RTIN_MAX_BATCHES];
+    uint32_t num_batches;
+} rtin_t;
+
+/* true if a map can be triangulated - square and 2^n + 1 samples wide */
+bool rtin_supports(const hmap_t* hmap) {
+    uint32_t tile = hmap->width - 1;
+    return hmap->width == hmap->height && tile >= 2 && (tile & (tile - 1)) == 0;
+}
+
+/* builds the tree and its errors - the mesh is left empty until rtin_extract */
+int rtin_init(rtin_t* rtin, const hmap_t* hmap, float spacing, float scale) {
+    uint32_t size = hmap->width, tile = size - 1, i, h, w;
+    uint32_t num_parents;
+
+    memset(rtin, 0, sizeof(*rtin));
+    if (!rtin_supports(hmap)) {
+        printf("ERROR RTIN needs a square map of 2^n + 1 samples, not %ux%u\n", hmap->width, hmap->height);
+        return -1;
+    }
+    rtin->size = size;
+    rtin->spacing = spacing;
+#ifdef USE_GL1
+    rtin->scale = scale;
+#endif
+    rtin->num_tree_triangles = tile * tile * 2 - 2;
+    num_parents = rtin->num_tree_triangles - tile * tile;
+
+    rtin->coords = malloc(rtin->num_tree_triangles * 4 * sizeof(uint16_t));
+    rtin->altitudes = malloc(size * size * sizeof(float));
+    rtin->errors = calloc(size * size, sizeof(float));
+    rtin->vertex_ids = malloc(size * size * sizeof(uint32_t));
+    rtin->indices = malloc(tile * tile * 2 * 3 * sizeof(uint16_t));
+    if (rtin->coords == NULL || rtin->altitudes == NULL || rtin->errors == NULL || rtin->vertex_ids == NULL
+        || rtin->indices == NULL) {
+        printf("ERROR could not allocate RTIN of %ux%u\n", size, size);
+        return -1;
+    }
+
+    for (h = 0; h < size; ++h) {
+        const uint8_t* row = hmap_row(hmap, h);
+        for (w = 0; w < size; ++w)
+            rtin->altitudes[h * size + w] = hmap_altitude(hmap, row, w);
+    }
+
+    /* triangle i is node i + 2 of the implicit binary tree - its bits after the leading one pick the
+     * child at each split, 0 for the one on the b side and 1 for the one on the a side
+     */
+    for (i = 0; i < rtin->num_tree_triangles; ++i) {
+        uint32_t id = i + 2, ax = 0, ay = 0, bx = 0, by = 0, cx = 0, cy = 0;
+
+        if (id & 1) {
+            bx = by = cx = tile;    /* bottom left root */
+        } else {
+            ax = ay = cy = tile;    /* top right root */
+        }
+        while ((id >>= 1) > 1) {
+            uint32_t mx = (ax + bx) / 2, my = (ay + by) / 2;
+            if (id & 1) {
+                bx = ax;
+                by = ay;
+                ax = cx;
+                ay = cy;
+            } else {
+                ax = bx;
+                ay = by;
+                bx = cx;
+                by = cy;
+            }
+            cx = mx;
+            cy = my;
+        }
+
+        rtin->coords[4 * i] = ax;
+        rtin->coords[4 * i + 1] = ay;
+        rtin->coords[4 * i + 2] = bx;
+        rtin->coords[4 * i + 3] = by;
+    }
+
+    /* finest triangles first, so the children of a split are done before it */
+    for (i = rtin->num_tree_triangles; i-- > 0;) {
+        uint32_t ax = rtin->coords[4 * i], ay = rtin->coords[4 * i + 1];
+        uint32_t bx = rtin->coords[4 * i + 2], by = rtin->coords[4 * i + 3];
+        uint32_t mx = (ax + bx) / 2, my = (ay + by) / 2;
+        uint32_t cx = mx + my - ay, cy = my + ax - mx;
+        uint32_t middle = my * size + mx;
+        float interpolated = (rtin->altitudes[ay * size + ax] + rtin->altitudes[by * size + bx]) / 2.f;
+        float error = fabsf(interpolated - rtin->altitudes[middle]);
+
+        if (error > rtin->errors[middle])
+            rtin->errors[middle] = error;
+
+        /* a split also has to cover the splits of both its children */
+        if (i < num_parents) {
+            float left = rtin->errors[((ay + cy) / 2) * size + (ax + cx) / 2];
+            float right = rtin->errors[((by + cy) / 2) * size + (bx + cx) / 2];
+            if (left > rtin->errors[middle])
+                rtin->errors[middle] = left;
+            if (right > rtin->errors[middle])
+                rtin->errors[middle] = right;
+        }
+    }
+
+    printf("RTIN over %ux%u: %u tree triangles\n", size, size, rtin->num_tree_triangles);
+    return 0;
+}
+
+void rtin_free(rtin_t* rtin) {
+    free(rtin->coords);
+    free(rtin->altitudes);
+    free(rtin->errors);
+    free(rtin->vertex_ids);
+    free(rtin->vertices);
+#ifdef USE_GL1
+    free(rtin->colors);
+#endif
+    free(rtin->indices);
+    memset(rtin, 0, sizeof(*rtin));
+}
+
+/* grows the vertex arrays - batches repeat the vertices they share, so the count is not known up front */
+int rtin_reserve(rtin_t* rtin, uint32_t num_vertices) {
+    uint32_t capacity = rtin->vertex_capacity ? rtin->vertex_capacity : rtin->size * rtin->size;
+    void* vertices;
+
+    if (num_vertices <= rtin->vertex_capacity)
+        return 0;
+    while (capacity < num_vertices)
+        capacity *= 2;
+
+    vertices = realloc(rtin->vertices, capacity * sizeof(*rtin->vertices));
+    if (vertices == NULL)
+        goto fail;
+    rtin->vertices = vertices;
+#ifdef USE_GL1
+    vertices = realloc(rtin->colors, capacity * sizeof(*rtin->colors));
+    if (vertices == NULL)
+        goto fail;
+    rtin->colors = vertices;
+#endif
+    rtin->vertex_capacity = capacity;
+    return 0;
+
+fail:
+    printf("ERROR could not allocate %u RTIN vertices\n", num_vertices);
+    return -1;
+}
+
+/* index of sample (x, y) in the current batch, adding it on first use - see gen_vertices for the mapping */
+uint16_t rtin_vertex(rtin_t* rtin, uint32_t x, uint32_t y) {
+    rtin_batch_t* batch = &rtin->batches[rtin->num_batches - 1];
+    uint32_t sample = y * rtin->size + x, index;
+    float half = (rtin->size - 1) * rtin->spacing / 2.f;
+
+    if (rtin->vertex_ids[sample] >> 16 == rtin->num_batches)
+        return rtin->vertex_ids[sample] & 0xffff;
+
+    index = rtin->num_vertices++ - batch->first_vertex;
+    rtin->vertex_ids[sample] = rtin->num_batches << 16 | index;
+
+    rtin->vertices[rtin->num_vertices - 1][0] = rtin->spacing * x - half;
+    rtin->vertices[rtin->num_vertices - 1][1] = half - rtin->spacing * y;
+#ifdef USE_GL1
+    rtin->vertices[rtin->num_vertices - 1][2] = rtin->altitudes[sample] * rtin->scale;
+    rtin->colors[rtin->num_vertices - 1][0] = rtin->altitudes[sample] / 255.f;
+    rtin->colors[rtin->num_vertices - 1][1] = rtin->altitudes[sample] / 255.f;
+    rtin->colors[rtin->num_vertices - 1][2] = rtin->altitudes[sample] / 255.f;
+#endif
+    return index;
+}
+
+/* emits triangle (a, b, c), starting a new batch if its vertices might not fit the current one */
+int rtin_emit(rtin_t* rtin, uint32_t ax, uint32_t ay, uint32_t bx, uint32_t by, uint32_t cx, uint32_t cy) {
+    rtin_batch_t* batch = &rtin->batches[rtin->num_batches - 1];
+
+    if (rtin->num_vertices - batch->first_vertex + 3 > RTIN_BATCH_VERTICES) {
+        if (rtin->num_batches == RTIN_MAX_BATCHES) {
+            printf("ERROR RTIN mesh needs more than %d batches\n", RTIN_MAX_BATCHES);
+            return -1;
+        }
+        batch = &rtin->batches[rtin->num_batches++];
+        batch->first_vertex = rtin->num_vertices;
+        batch->first_index = rtin->num_indices;
+        batch->num_indices = 0;
+    }
+    if (rtin_reserve(rtin, rtin->num_vertices + 3) == -1)
+        return -1;
+
+    rtin->indices[rtin->num_indices++] = rtin_vertex(rtin, ax, ay);
+    rtin->indices[rtin->num_indices++] = rtin_vertex(rtin, bx, by);
+    rtin->indices[rtin->num_indices++] = rtin_vertex(rtin, cx, cy);
+    batch->num_indices += 3;
+    return 0;
+}
+
+/* splits triangle (a, b, c) with its right angle at c while the sample on its hypotenuse is out of tolerance */
+int rtin_walk(rtin_t* rtin, uint32_t ax, uint32_t ay, uint32_t bx, uint32_t by, uint32_t cx, uint32_t cy) {
+    uint32_t mx = (ax + bx) / 2, my = (ay + by) / 2;
+    uint32_t legs = (ax > cx ? ax - cx : cx - ax) + (ay > cy ? ay - cy : cy - ay);
+
+    if (legs > 1 && rtin->errors[my * rtin->size + mx] > rtin->max_error) {
+        if (rtin_walk(rtin, cx, cy, ax, ay, mx, my) == -1)
+            return -1;
+        return rtin_walk(rtin, bx, by, cx, cy, mx, my);
+    }
+    return rtin_emit(rtin, ax, ay, bx, by, cx, cy);
+}
+
+/* rebuilds the mesh for an error tolerance in 8 bit altitude units, returns its triangle count or -1 */
+int rtin_extract(rtin_t* rtin, float max_error) {
+    uint32_t tile = rtin->size - 1;
+
+    rtin->max_error = max_error;
+    rtin->num_vertices = 0;
+    rtin->num_indices = 0;
+    rtin->num_batches = 1;
+    memset(&rtin->batches[0], 0, sizeof(rtin->batches[0]));
+#ifdef USE_GL2
+    rtin->streamed = false;
+#endif
+    memset(rtin->vertex_ids, 0, rtin->size * rtin->size * sizeof(uint32_t));
+
+    if (rtin_walk(rtin, 0, 0, tile, tile, tile, 0) == -1 || rtin_walk(rtin, tile, tile, 0, 0, 0, tile) == -1)
+        return -1;
+    return rtin->num_indices / 3;
+}
+
+#ifdef USE_GL2
+/* writes the mesh to the streams unless it is still there from an earlier frame */
+void rtin_stream(rtin_t* rtin) {
+    if (rtin->streamed && rtin->vertex_generation == stream_vertices.generation
+        && rtin->index_generation == stream_indices.generation)
+        return;
+
+    buffer_stream_write(&stream_vertices, rtin->vertices, rtin->num_vertices * sizeof(vec2), &rtin->stream_vertices);
+    buffer_stream_write(&stream_indices, rtin->indices, rtin->num_indices * sizeof(uint16_t), &rtin->stream_indices);
+    rtin->vertex_generation = stream_vertices.generation;
+    rtin->index_generation = stream_indices.generation;
+    rtin->streamed = true;
+}
+#endif
+
+/* draws the last extracted mesh, a batch at a time */
+void rtin_draw(rtin_t* rtin) {
+    uint32_t b;
+
+#ifdef USE_GL2
+    GLuint vbo = 0, ibo = 0;
+
+    /* the error bound holds for full resolution heights */
+    gl_grid_tex(rtin->size, rtin->size, rtin->spacing, 0.f);
+    if (buffers_enabled && stream_vertices.buffer != 0 && stream_indices.buffer != 0) {
+        rtin_stream(rtin);
+        vbo = stream_vertices.buffer;
+        ibo = stream_indices.buffer;
+    }
+    buffer_bind(GL_ARRAY_BUFFER, vbo);
+    buffer_bind(GL_ELEMENT_ARRAY_BUFFER, ibo);
+#endif
+    for (b = 0; b < rtin->num_batches; ++b) {
+        const rtin_batch_t* batch = &rtin->batches[b];
+#ifdef USE_GL1
+        glVertexPointer(3, GL_FLOAT, 0, &rtin->vertices[batch->first_vertex][0]);
+        glColorPointer(3, GL_FLOAT, 0, &rtin->colors[batch->first_vertex][0]);
+#endif
+#ifdef USE_GL2
+        if (vbo != 0) {
+            gl_set_positions(a_pos, BUFFER_OFFSET(rtin->stream_vertices + batch->first_vertex * sizeof(vec2)));
+            glDrawElements(GL_TRIANGLES, batch->num_indices, GL_UNSIGNED_SHORT,
+                           BUFFER_OFFSET(rtin->stream_indices + batch->first_index * sizeof(uint16_t)));
+            continue;
+        }
+        gl_set_positions(a_pos, &rtin->vertices[batch->first_vertex][0]);
+#endif
+        glDrawElements(GL_TRIANGLES, batch->num_indices, GL_UNSIGNED_SHORT, rtin->indices + batch->first_index);
+    }
+}
+
+#endif /* _RTIN_H_ */
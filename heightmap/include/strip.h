@@ -0,0 +1,174 @@
+#ifndef _STRIP_H_
+#define _STRIP_H_
+
+#include <stdint.h>
+#include <string.h>
+
+/*      serpentine triangle strip
+ * ---------------------------------
+ * Rows of quads are walked left to right, then right to left, without
+ * restarting the strip. The first row emits a (top, bottom) pair per
+ * column, every further row turns down at the edge it ended on and then
+ * emits a pair per remaining column:
+ *
+ *   row 0      0,w  1,w+1  ...  w-1,2w-1
+ *   row 1      2w+(w-1)  w+(w-2),2w+(w-2)  ...  w,2w
+ *   row 2      3w  2w+1,3w+1  ...
+ */
+
+/* vertices written per vector store, as (top, bottom) pairs */
+#define STRIP_LANES 8
+typedef uint16_t strip_vec_t __attribute__((vector_size(STRIP_LANES * sizeof(uint16_t))));
+
+/* smaller strips are cheaper to fill on one thread */
+#define STRIP_PARALLEL_MIN 16384u
+
+/* two per column for the first row, then 2 * width - 1 for every further row */
+uint32_t strip_num_indices(uint32_t height, uint32_t width) {
+    return height * width + (height - 2) * (width - 1);
+}
+
+/* original state machine - kept as the reference gen_strip must match */
+void gen_strip_reference(uint16_t* indices, uint32_t num_indices, uint32_t width) {
+    uint32_t i, h = 0, w = 0;
+    int firststep = 1, step = 0, direction = 1;
+
+    for (i = 0; i < num_indices; ++i) {
+        indices[i] = h * width + w;
+
+        if (step == 0) { /* downward motion of triangulation */
+            ++h;
+            step = 1;
+        } else if (step == 1) { /* upward and sideways motion of triangulation */
+            --h;
+            w += direction; /* moves in the current direction */
+            step = 0;
+        }
+
+        /* if at the endges of the grid */
+        if (w == 0 || w == width - 1) {
+            /* if downward motion was just taken - row was just completed */
+            if (!firststep && step == 1) {
+                step = 0; /* move down again */
+                direction *= -1; /* swap direction */
+                firststep = 1;
+            } else {
+                firststep = 0;
+            }
+        }
+    }
+}
+
+/* writes count (top + k * step, bottom + k * step) pairs */
+static inline void strip_pairs(uint16_t* out, uint16_t top, uint16_t bottom, int step, uint32_t count) {
+    strip_vec_t pairs = { 0 }, advance = { 0 };
+    uint32_t k, lane;
+
+    for (lane = 0; lane < STRIP_LANES; lane += 2) {
+        pairs[lane] = top + (int) (lane / 2) * step;
+        pairs[lane + 1] = bottom + (int) (lane / 2) * step;
+        advance[lane] = advance[lane + 1] = (uint16_t) (STRIP_LANES / 2 * step);
+    }
+
+    /* unaligned vector stores - rows start at odd offsets */
+    for (k = 0; k + STRIP_LANES / 2 <= count; k += STRIP_LANES / 2) {
+        memcpy(out + 2 * k, &pairs, sizeof(pairs));
+        pairs += advance;
+    }
+    for (; k < count; ++k) {
+        out[2 * k] = top + (int) k * step;
+        out[2 * k + 1] = bottom + (int) k * step;
+    }
+}
+
+/* quad row r > 0 - turns down at the edge row r - 1 ended on, then runs back across */
+static inline void gen_strip_row(uint16_t* indices, int32_t r, uint32_t width) {
+    uint16_t* out = indices + 2 * width + (r - 1) * (2 * width - 1);
+    uint32_t top = r * width, bottom = (r + 1) * width;
+
+    if (r % 2) { /* odd rows run left from the last column */
+        out[0] = bottom + width - 1;
+        strip_pairs(out + 1, top + width - 2, bottom + width - 2, -1, width - 1);
+    } else {
+        out[0] = bottom;
+        strip_pairs(out + 1, top + 1, bottom + 1, 1, width - 1);
+    }
+}
+
+/* closed form strip over rows x width vertices - every quad row is written independently */
+void gen_strip(uint16_t* indices, uint32_t rows, uint32_t width) {
+    int32_t r, quad_rows = rows - 1;
+
+    /* row 0 runs right */
+    strip_pairs(indices, 0, width, 1, width);
+
+    if ((uint64_t) quad_rows * width < STRIP_PARALLEL_MIN) {
+        for (r = 1; r < quad_rows; ++r)
+            gen_strip_row(indices, r, width);
+        return;
+    }
+
+#pragma omp parallel for schedule(static)
+    for (r = 1; r < quad_rows; ++r)
+        gen_strip_row(indices, r, width);
+}
+
+/* quad columns in block b of a blocked strip */
+uint32_t strip_block_width(uint32_t width, uint32_t block, uint32_t b) {
+    uint32_t first = b * block;
+    return (first + block < width - 1 ? block : width - 1 - first) + 1;
+}
+
+uint32_t strip_num_blocks(uint32_t width, uint32_t block) {
+    return (width - 2) / block + 1;
+}
+
+/* blocks joined by a repeat of the last and first index, padded so every block starts on an even index */
+uint32_t strip_blocked_num_indices(uint32_t rows, uint32_t width, uint32_t block) {
+    uint32_t b, n = 0;
+
+    for (b = 0; b < strip_num_blocks(width, block); ++b) {
+        if (b > 0)
+            n += 2 + n % 2;
+        n += strip_num_indices(rows, strip_block_width(width, block, b));
+    }
+    return n;
+}
+
+/* serpentine strips over vertical blocks of block quad columns, left to right - a row of a
+ * block is revisited after block + 1 new vertices rather than a whole grid row later, so it
+ * is still in a post-transform cache of a few more entries than that
+ * a block of width - 1 or more columns is the plain serpentine
+ */
+void gen_strip_blocked(uint16_t* indices, uint32_t rows, uint32_t width, uint32_t block) {
+    uint32_t b, i, n = 0;
+
+    for (b = 0; b < strip_num_blocks(width, block); ++b) {
+        uint32_t block_width = strip_block_width(width, block, b);
+        uint32_t num_indices = strip_num_indices(rows, block_width);
+        uint16_t first = b * block;
+        uint16_t* out;
+
+        /* degenerate join - last of the previous block, first of this one */
+        if (b > 0) {
+            uint16_t last = indices[n - 1];
+            uint32_t pad = n % 2;
+
+            indices[n++] = last;
+            if (pad)
+                indices[n++] = last;
+            indices[n++] = first;
+        }
+
+        /* strip over the block, then moved from block to grid columns */
+        out = indices + n;
+        gen_strip(out, rows, block_width);
+        if (block_width != width) {
+            for (i = 0; i < num_indices; ++i)
+                out[i] = out[i] / block_width * width + first + out[i] % block_width;
+        }
+        n += num_indices;
+    }
+}
+
+#endif /* _STRIP_H_ */
@@ -0,0 +1,528 @@
+#ifndef _TERRAIN_H_
+#define _TERRAIN_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#include "buffers.h"
+#include "cache.h"
+#include "glversion.h"
+#include "hmap.h"
+#include "strip.h"
+#include "vcache.h"
+#include "vertex.h"
+
+/* sub-buffers of the arena start on a cache line */
+#define TERRAIN_ARENA_ALIGN 64u
+
+/* bump whenever the arena layout or anything generated into it changes */
+#define TERRAIN_LAYOUT_VERSION 7u
+
+/* quads along a patch edge - a patch of (size + 1)^2 vertices is addressed with 16 bit indices */
+#define TERRAIN_PATCH_SIZE 128u
+
+/* quad columns per block of the index strips - two block rows must stay in the FIFO vertex cache */
+#define TERRAIN_STRIP_BLOCK (VCACHE_SIZE / 2 - 2)
+
+/* patch resolutions, each half the quads of the one before - the coarsest keeps at least TERRAIN_LOD_MIN_QUADS */
+#define TERRAIN_MAX_LODS 5
+#define TERRAIN_LOD_MIN_QUADS 8u
+/* full resolution out to this many patch sizes from the camera - the range doubles per level */
+#define TERRAIN_LOD_RANGE 2.f
+
+/* edges of a patch as bits of a stitch variant - set where the neighbour is one level coarser */
+#define TERRAIN_EDGE_TOP    1u
+#define TERRAIN_EDGE_RIGHT  2u
+#define TERRAIN_EDGE_BOTTOM 4u
+#define TERRAIN_EDGE_LEFT   8u
+#define TERRAIN_STITCHES    16u
+
+/* bounds of a patch - z is the altitude range of its samples in [0, 1] */
+typedef struct {
+    vec3 aabb[2];
+} terrain_patch_t;
+
+/* terrain grid sized to the loaded heightmap - every buffer lives in one arena allocation
+ * the grid is split into square patches, each with its own (size + 1)^2 vertices so that
+ * every patch draws the same 16 bit strip with the vertex arrays offset to it - patches
+ * past the edge of the map repeat its last row and column
+ * lower levels of detail draw every 2^l-th vertex of a patch - each level has a strip per
+ * combination of coarser neighbours, with the odd vertices of those edges folded onto their
+ * even neighbours so the edges match and no T-junction cracks open
+ */
+typedef struct {
+    uint32_t width, height;     /* samples along each side */
+    float spacing;              /* world units between samples */
+    uint32_t patch_size;        /* quads along a patch edge */
+    uint32_t patch_vertices;    /* (patch_size + 1)^2 */
+    uint32_t patches_x, patches_y, num_patches;
+    terrain_patch_t* patches;
+    uint16_t* indices;          /* strips over one patch, TERRAIN_STITCHES per level of detail */
+    uint32_t num_indices;       /* all of them */
+    uint32_t num_lods;
+    uint32_t lod_first[TERRAIN_MAX_LODS];   /* first index of a level's unstitched strip */
+    uint32_t lod_indices[TERRAIN_MAX_LODS]; /* indices per strip of a level */
+#ifdef USE_GL1
+    float scale;                /* world units per altitude step */
+    vertex_packed_t* vertices;  /* in samples, see vertex.h */
+#endif
+#ifdef USE_GL2
+    vec2* vertices;             /* texture coordinates follow from them, see gl_grid_tex */
+    GLuint vbo, ibo;            /* the arena's vertices and indices, see terrain_upload */
+#endif
+    void* arena;
+    size_t arena_size;
+    /* set when the arena is a read only mapping of the derived data cache */
+    void* cache_map;
+    size_t cache_map_size;
+    /* patches to draw this frame and the level of every patch - rebuilt by terrain_cull, kept out of the read only arena */
+    uint32_t* draw_list;
+    uint32_t num_draws;
+    terrain_patch_t* boxes;     /* world space bounds of every patch */
+    uint8_t* lods;
+    uint32_t num_triangles;
+} terrain_t;
+
+size_t arena_align(size_t size) {
+    return (size + TERRAIN_ARENA_ALIGN - 1) / TERRAIN_ARENA_ALIGN * TERRAIN_ARENA_ALIGN;
+}
+
+/* hands out the next size bytes of the arena */
+void* arena_take(uint8_t** cursor, size_t size) {
+    void* ptr = *cursor;
+    *cursor += arena_align(size);
+    return ptr;
+}
+
+/* sample under vertex (r, c) of patch p, clamped to the map */
+void terrain_patch_sample(const terrain_t* terrain, uint32_t p, uint32_t r, uint32_t c, uint32_t* h, uint32_t* w) {
+    *h = (p / terrain->patches_x) * terrain->patch_size + r;
+    *w = (p % terrain->patches_x) * terrain->patch_size + c;
+    if (*h > terrain->height - 1)
+        *h = terrain->height - 1;
+    if (*w > terrain->width - 1)
+        *w = terrain->width - 1;
+}
+
+/* levels of detail a patch size can be halved into */
+uint32_t terrain_num_lods(uint32_t patch_size) {
+    uint32_t lods = 1;
+    while (lods < TERRAIN_MAX_LODS && patch_size % (2u << (lods - 1)) == 0 && (patch_size >> lods) >= TERRAIN_LOD_MIN_QUADS)
+        ++lods;
+    return lods;
+}
+
+/* strips ordered for the post-transform vertex cache, see vcache.h - level 0 unstitched is the full resolution strip,
+ * and every other strip is it over every 2^l-th vertex with the odd vertices of the stitched edges folded back
+ */
+void gen_indices(terrain_t* terrain) {
+    uint32_t size = terrain->patch_size, l, v, i;
+
+    for (l = 0; l < terrain->num_lods; ++l) {
+        uint32_t step = 1u << l, quads = size >> l, count = terrain->lod_indices[l];
+        uint16_t* base = terrain->indices + terrain->lod_first[l];
+
+        /* strip over the level's own grid, moved onto the patch vertices */
+        gen_strip_blocked(base, quads + 1, quads + 1, TERRAIN_STRIP_BLOCK);
+        for (i = 0; i < count; ++i)
+            base[i] = base[i] / (quads + 1) * step * (size + 1) + base[i] % (quads + 1) * step;
+
+        for (v = 1; v < TERRAIN_STITCHES; ++v) {
+            uint16_t* out = base + v * count;
+            for (i = 0; i < count; ++i) {
+                uint32_t r = base[i] / (size + 1), c = base[i] % (size + 1);
+                bool odd_r = (r / step) % 2, odd_c = (c / step) % 2;
+
+                if (((v & TERRAIN_EDGE_TOP) && r == 0 && odd_c) || ((v & TERRAIN_EDGE_BOTTOM) && r == size && odd_c))
+                    c -= step;
+                if (((v & TERRAIN_EDGE_LEFT) && c == 0 && odd_r) || ((v & TERRAIN_EDGE_RIGHT) && c == size && odd_r))
+                    r -= step;
+                out[i] = r * (size + 1) + c;
+            }
+        }
+    }
+}
+
+void gen_patches(terrain_t* terrain, const hmap_t* hmap) {
+    uint32_t size = terrain->patch_size, p, r, c, h, w;
+    float spacing = terrain->spacing;
+    float h_offset = (terrain->height - 1) * spacing / 2.0f;
+    float w_offset = (terrain->width - 1) * spacing / 2.0f;
+
+    for (p = 0; p < terrain->num_patches; ++p) {
+        terrain_patch_t* patch = &terrain->patches[p];
+        float low = 255.f, high = 0.f;
+
+        for (r = 0; r <= size; ++r) {
+            terrain_patch_sample(terrain, p, r, 0, &h, &w);
+            const uint8_t* row = hmap_row(hmap, h);
+            for (c = 0; c <= size; ++c) {
+                terrain_patch_sample(terrain, p, r, c, &h, &w);
+                float alt = hmap_altitude(hmap, row, w);
+                if (alt < low)
+                    low = alt;
+                if (alt > high)
+                    high = alt;
+            }
+        }
+
+        /* corners - +y is north, so the first row is the top */
+        terrain_patch_sample(terrain, p, size, 0, &h, &w);
+        patch->aabb[0][0] = spacing * w - w_offset;
+        patch->aabb[0][1] = h_offset - spacing * h;
+        patch->aabb[0][2] = low / 255.f;
+        terrain_patch_sample(terrain, p, 0, size, &h, &w);
+        patch->aabb[1][0] = spacing * w - w_offset;
+        patch->aabb[1][1] = h_offset - spacing * h;
+        patch->aabb[1][2] = high / 255.f;
+    }
+}
+
+#ifdef USE_GL1
+void gen_vertices(terrain_t* terrain, const hmap_t* hmap) {
+    uint32_t size = terrain->patch_size;
+    uint32_t p, r, c, h, w;
+
+    for (p = 0; p < terrain->num_patches; ++p) {
+        for (r = 0; r <= size; ++r) {
+            vertex_packed_t* vertices = &terrain->vertices[p * terrain->patch_vertices + r * (size + 1)];
+            terrain_patch_sample(terrain, p, r, 0, &h, &w);
+            const uint8_t* row = hmap_row(hmap, h);
+            for (c = 0; c <= size; ++c) {
+                terrain_patch_sample(terrain, p, r, c, &h, &w);
+                /* 16 bit samples are converted here - GL1 has no shaders to unpack them */
+                vertex_pack(&vertices[c], w, h, hmap_altitude(hmap, row, w));
+            }
+        }
+    }
+}
+#endif
+#ifdef USE_GL2
+void gen_vertices(terrain_t* terrain, const hmap_t* hmap) {
+    uint32_t height = terrain->height, width = terrain->width, size = terrain->patch_size;
+    float spacing = terrain->spacing;
+    uint32_t p, r, c, h, w;
+    float h_offset = (height - 1) * spacing / 2.0f;
+    float w_offset = (width - 1) * spacing / 2.0f;
+
+    for (p = 0; p < terrain->num_patches; ++p) {
+        for (r = 0; r <= size; ++r) {
+            vec2* vertices = &terrain->vertices[p * terrain->patch_vertices + r * (size + 1)];
+            for (c = 0; c <= size; ++c) {
+                terrain_patch_sample(terrain, p, r, c, &h, &w);
+                /* xy plane heightmap - +z is altitude, +x is east, +y is north */
+                vertices[c][0] = spacing * w - w_offset; /* -x in top left */
+                vertices[c][1] = h_offset - spacing * h; /* +y in top left */
+            }
+        }
+    }
+}
+#endif
+
+double terrain_time(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* cache key - the samples plus everything gen_* depends on */
+uint64_t terrain_cache_key(const hmap_t* hmap, float spacing) {
+    uint32_t params[6] = { TERRAIN_LAYOUT_VERSION, GL_CONTEXT_VERSION_MAJOR, TERRAIN_STRIP_BLOCK, TERRAIN_PATCH_SIZE,
+                           TERRAIN_MAX_LODS, TERRAIN_LOD_MIN_QUADS };
+    uint64_t key = hmap_hash(hmap);
+
+    key = hash64(key, params, sizeof(params));
+    key = hash64(key, &spacing, sizeof(spacing));
+    return key;
+}
+
+/* points every buffer into the arena - the layout only depends on the grid size */
+void terrain_carve(terrain_t* terrain, void* arena) {
+    size_t num_vertices = (size_t) terrain->num_patches * terrain->patch_vertices;
+    uint8_t* cursor = arena;
+
+    terrain->arena = arena;
+    terrain->indices = arena_take(&cursor, terrain->num_indices * sizeof(uint16_t));
+    terrain->patches = arena_take(&cursor, terrain->num_patches * sizeof(terrain_patch_t));
+#ifdef USE_GL1
+    terrain->vertices = arena_take(&cursor, num_vertices * sizeof(vertex_packed_t));
+#endif
+#ifdef USE_GL2
+    terrain->vertices = arena_take(&cursor, num_vertices * sizeof(vec2));
+#endif
+}
+
+/* sizes the grid to the heightmap and maps its arena from the cache, or allocates and generates the mesh */
+int terrain_init(terrain_t* terrain, const hmap_t* hmap, float spacing, float scale) {
+    double start = terrain_time();
+    const void* cached;
+    vcache_stats_t stats;
+    size_t num_vertices;
+    uint64_t key;
+    uint32_t l;
+
+    memset(terrain, 0, sizeof(*terrain));
+    if (hmap->width < 2 || hmap->height < 2) {
+        printf("ERROR terrain needs at least 2x2 samples\n");
+        return -1;
+    }
+#ifdef USE_GL1
+    if (hmap->width > VERTEX_MAX_SAMPLES || hmap->height > VERTEX_MAX_SAMPLES) {
+        printf("ERROR GL1 terrain vertices address at most %ux%u samples\n", VERTEX_MAX_SAMPLES, VERTEX_MAX_SAMPLES);
+        return -1;
+    }
+#endif
+
+    terrain->width = hmap->width;
+    terrain->height = hmap->height;
+    terrain->spacing = spacing;
+
+    /* small maps fit one patch */
+    terrain->patch_size = TERRAIN_PATCH_SIZE;
+    if (terrain->patch_size > terrain->width - 1 && terrain->patch_size > terrain->height - 1)
+        terrain->patch_size = (terrain->width > terrain->height ? terrain->width : terrain->height) - 1;
+    terrain->patch_vertices = (terrain->patch_size + 1) * (terrain->patch_size + 1);
+    terrain->patches_x = (terrain->width - 2) / terrain->patch_size + 1;
+    terrain->patches_y = (terrain->height - 2) / terrain->patch_size + 1;
+    terrain->num_patches = terrain->patches_x * terrain->patches_y;
+    terrain->num_lods = terrain_num_lods(terrain->patch_size);
+    for (l = 0; l < terrain->num_lods; ++l) {
+        uint32_t quads = terrain->patch_size >> l;
+        terrain->lod_first[l] = terrain->num_indices;
+        terrain->lod_indices[l] = strip_blocked_num_indices(quads + 1, quads + 1, TERRAIN_STRIP_BLOCK);
+        terrain->num_indices += TERRAIN_STITCHES * terrain->lod_indices[l];
+    }
+    num_vertices = (size_t) terrain->num_patches * terrain->patch_vertices;
+
+    terrain->draw_list = malloc(terrain->num_patches * sizeof(uint32_t));
+    terrain->boxes = malloc(terrain->num_patches * sizeof(terrain_patch_t));
+    terrain->lods = calloc(terrain->num_patches, sizeof(uint8_t));
+    if (terrain->draw_list == NULL || terrain->boxes == NULL || terrain->lods == NULL) {
+        printf("ERROR could not allocate terrain draw list\n");
+        return -1;
+    }
+
+    /* one allocation for every buffer */
+    terrain->arena_size = arena_align(terrain->num_indices * sizeof(uint16_t));
+    terrain->arena_size += arena_align(terrain->num_patches * sizeof(terrain_patch_t));
+#ifdef USE_GL1
+    terrain->arena_size += arena_align(num_vertices * sizeof(vertex_packed_t));
+#endif
+#ifdef USE_GL2
+    terrain->arena_size += arena_align(num_vertices * sizeof(vec2));
+#endif
+#ifdef USE_GL1
+    terrain->scale = scale;
+#endif
+
+    /* warm start - preprocessing is skipped entirely */
+    key = terrain_cache_key(hmap, spacing);
+    cached = cache_map(key, terrain->arena_size, &terrain->cache_map, &terrain->cache_map_size);
+    if (cached != NULL) {
+        terrain_carve(terrain, (void*) cached);
+        printf("Terrain %ux%u: %u patches of %ux%u quads, %.1f MB arena mapped from cache in %.2f ms\n",
+               terrain->width, terrain->height, terrain->num_patches, terrain->patch_size, terrain->patch_size,
+               terrain->arena_size / (1024.f * 1024.f), (terrain_time() - start) * 1e3);
+        return 0;
+    }
+
+    terrain->arena = aligned_alloc(TERRAIN_ARENA_ALIGN, terrain->arena_size);
+    if (terrain->arena == NULL) {
+        printf("ERROR could not allocate %zu bytes of terrain\n", terrain->arena_size);
+        return -1;
+    }
+    terrain_carve(terrain, terrain->arena);
+
+    /* generates the patch strips shared by every patch, and the patches */
+    gen_indices(terrain);
+    gen_patches(terrain, hmap);
+    gen_vertices(terrain, hmap);
+
+    /* a failed store only costs the next start its warm path */
+    cache_store(key, terrain->arena, terrain->arena_size);
+
+    printf("Terrain %ux%u: %u patches of %ux%u quads in %u levels, %.1f MB arena generated in %.2f ms\n",
+           terrain->width, terrain->height, terrain->num_patches, terrain->patch_size, terrain->patch_size,
+           terrain->num_lods, terrain->arena_size / (1024.f * 1024.f), (terrain_time() - start) * 1e3);
+
+    /* expected vertex shader invocations at full resolution - indexbench compares the orderings */
+    if (vcache_simulate_strip(terrain->indices, terrain->lod_indices[0], VCACHE_SIZE, &stats) == 0) {
+        printf("Terrain strip blocked by %u columns: ACMR %.3f, ATVR %.3f in a %u entry vertex cache\n",
+               TERRAIN_STRIP_BLOCK, stats.acmr, stats.atvr, VCACHE_SIZE);
+    }
+    return 0;
+}
+
+#ifdef USE_GL2
+/* copies the vertices and strips into static buffers - the arena stays for client array draws */
+int terrain_upload(terrain_t* terrain) {
+    size_t num_vertices = (size_t) terrain->num_patches * terrain->patch_vertices;
+
+    if (buffer_create(&terrain->vbo, GL_ARRAY_BUFFER, terrain->vertices, num_vertices * sizeof(vec2)) == -1
+        || buffer_create(&terrain->ibo, GL_ELEMENT_ARRAY_BUFFER, terrain->indices,
+                         terrain->num_indices * sizeof(uint16_t)) == -1)
+        return -1;
+    return 0;
+}
+#endif
+
+/* patch p's neighbour across an edge, or -1 at the edge of the map */
+int32_t terrain_neighbour(const terrain_t* terrain, uint32_t p, uint32_t edge) {
+    uint32_t px = p % terrain->patches_x, py = p / terrain->patches_x;
+
+    switch (edge) {
+    case TERRAIN_EDGE_TOP:    return py > 0 ? (int32_t) (p - terrain->patches_x) : -1;
+    case TERRAIN_EDGE_RIGHT:  return px + 1 < terrain->patches_x ? (int32_t) p + 1 : -1;
+    case TERRAIN_EDGE_BOTTOM: return py + 1 < terrain->patches_y ? (int32_t) (p + terrain->patches_x) : -1;
+    case TERRAIN_EDGE_LEFT:   return px > 0 ? (int32_t) p - 1 : -1;
+    default:                  return -1;
+    }
+}
+
+/* stitch variant of patch p - the edges whose neighbour is drawn coarser */
+uint32_t terrain_stitches(const terrain_t* terrain, uint32_t p) {
+    uint32_t edge, stitches = 0;
+
+    for (edge = TERRAIN_EDGE_TOP; edge < TERRAIN_STITCHES; edge <<= 1) {
+        int32_t q = terrain_neighbour(terrain, p, edge);
+        if (q != -1 && terrain->lods[q] > terrain->lods[p])
+            stitches |= edge;
+    }
+    return stitches;
+}
+
+/* picks the level of every patch by its distance from the camera, then refines patches until
+ * no neighbours are more than one level apart, which the stitches rely on
+ */
+void terrain_select_lods(terrain_t* terrain, vec3 camera) {
+    float range = TERRAIN_LOD_RANGE * terrain->patch_size * terrain->spacing;
+    uint32_t p, edge, i;
+    bool changed;
+
+    for (p = 0; p < terrain->num_patches; ++p) {
+        float d2 = 0.f;
+        uint8_t lod = 0;
+
+        for (i = 0; i < 3; ++i) {
+            const terrain_patch_t* box = &terrain->boxes[p];
+            float d = camera[i] < box->aabb[0][i] ? box->aabb[0][i] - camera[i]
+                    : camera[i] > box->aabb[1][i] ? camera[i] - box->aabb[1][i] : 0.f;
+            d2 += d * d;
+        }
+        while (lod + 1u < terrain->num_lods && d2 > range * range * (1u << lod) * (1u << lod))
+            ++lod;
+        terrain->lods[p] = lod;
+    }
+
+    do {
+        changed = false;
+        for (p = 0; p < terrain->num_patches; ++p) {
+            for (edge = TERRAIN_EDGE_TOP; edge < TERRAIN_STITCHES; edge <<= 1) {
+                int32_t q = terrain_neighbour(terrain, p, edge);
+                if (q != -1 && terrain->lods[p] > terrain->lods[q] + 1) {
+                    terrain->lods[p] = terrain->lods[q] + 1;
+                    changed = true;
+                }
+            }
+        }
+    } while (changed);
+}
+
+/* rebuilds the draw list from the patches inside the frustum planes, and their levels from the distance to camera
+ * x_offset moves the terrain along x, and z_scale takes [0, 1] altitudes to world units -
+ * without patch_heights every patch is assumed to span the full altitude range
+ */
+uint32_t terrain_cull(terrain_t* terrain, vec4 planes[6], vec3 camera, float x_offset, float z_scale,
+                      bool patch_heights) {
+    uint32_t p, quads;
+
+    terrain->num_draws = 0;
+    terrain->num_triangles = 0;
+    for (p = 0; p < terrain->num_patches; ++p) {
+        const terrain_patch_t* patch = &terrain->patches[p];
+        vec3* aabb = terrain->boxes[p].aabb;
+        float low = patch_heights ? patch->aabb[0][2] : 0.f;
+        float high = patch_heights ? patch->aabb[1][2] : 1.f;
+
+        aabb[0][0] = patch->aabb[0][0] + x_offset;
+        aabb[0][1] = patch->aabb[0][1];
+        aabb[1][0] = patch->aabb[1][0] + x_offset;
+        aabb[1][1] = patch->aabb[1][1];
+
+        /* a negative scale flips the terrain */
+        aabb[0][2] = (z_scale < 0.f ? high : low) * z_scale;
+        aabb[1][2] = (z_scale < 0.f ? low : high) * z_scale;
+    }
+
+    terrain_select_lods(terrain, camera);
+
+    for (p = 0; p < terrain->num_patches; ++p) {
+        if (glm_aabb_frustum(terrain->boxes[p].aabb, planes)) {
+            terrain->draw_list[terrain->num_draws++] = p;
+            quads = terrain->patch_size >> terrain->lods[p];
+            terrain->num_triangles += 2 * quads * quads;
+        }
+    }
+
+    return terrain->num_draws;
+}
+
+/* draws the patches of the draw list - there is no base vertex in GL1 or GLES2, so the arrays are offset instead */
+void terrain_draw(const terrain_t* terrain) {
+    uint32_t d;
+
+#ifdef USE_GL1
+    /* packed vertices are in samples and fractions of a step - same mapping as gen_patches, +y is north */
+    glPushMatrix();
+    glTranslatef(-(terrain->width - 1) * terrain->spacing / 2.f, (terrain->height - 1) * terrain->spacing / 2.f, 0.f);
+    glScalef(terrain->spacing, -terrain->spacing, terrain->scale / VERTEX_Z_STEPS);
+#endif
+#ifdef USE_GL2
+    /* heights come from the mip matching each patch's level, see terrain_select_lods */
+    gl_grid_tex(terrain->width, terrain->height, terrain->spacing,
+                TERRAIN_LOD_RANGE * terrain->patch_size * terrain->spacing);
+    buffer_bind(GL_ARRAY_BUFFER, terrain->vbo);
+    buffer_bind(GL_ELEMENT_ARRAY_BUFFER, terrain->ibo);
+#endif
+
+    for (d = 0; d < terrain->num_draws; ++d) {
+        uint32_t p = terrain->draw_list[d], lod = terrain->lods[p];
+        size_t first = (size_t) p * terrain->patch_vertices;
+        size_t first_index = terrain->lod_first[lod] + terrain_stitches(terrain, p) * terrain->lod_indices[lod];
+#ifdef USE_GL1
+        glVertexPointer(3, GL_SHORT, sizeof(vertex_packed_t), &terrain->vertices[first].x);
+        glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(vertex_packed_t), terrain->vertices[first].rgba);
+#endif
+#ifdef USE_GL2
+        gl_set_positions(a_pos, buffer_pointer(terrain->vbo, terrain->vertices, first * sizeof(vec2)));
+        glDrawElements(GL_TRIANGLE_STRIP, terrain->lod_indices[lod], GL_UNSIGNED_SHORT,
+                       buffer_pointer(terrain->ibo, terrain->indices, first_index * sizeof(uint16_t)));
+#else
+        glDrawElements(GL_TRIANGLE_STRIP, terrain->lod_indices[lod], GL_UNSIGNED_SHORT, terrain->indices + first_index);
+#endif
+    }
+#ifdef USE_GL1
+    glPopMatrix();
+#endif
+}
+
+void terrain_free(terrain_t* terrain) {
+#ifdef USE_GL2
+    buffer_delete(&terrain->vbo);
+    buffer_delete(&terrain->ibo);
+#endif
+    if (terrain->cache_map != NULL)
+        munmap(terrain->cache_map, terrain->cache_map_size);
+    else
+        free(terrain->arena);
+    free(terrain->draw_list);
+    free(terrain->boxes);
+    free(terrain->lods);
+    memset(terrain, 0, sizeof(*terrain));
+}
+
+#endif /* _TERRAIN_H_ */
@@ -0,0 +1,603 @@
+#ifndef _TILES_H_
+#define _TILES_H_
+
+#include <fcntl.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "hmap.h"
+
+/*      .hmt tiled heightmap
+ * ---------------------------------
+ * little endian, written by tools/image2tiles.py
+ *
+ *  offset | size | field
+ *  -------+------+----------------------------------------
+ *       0 |    4 | magic "HMT1"
+ *       4 |    2 | version
+ *       6 |    2 | sample type (hmap_type_t)
+ *       8 |    4 | width of level 0 in samples
+ *      12 |    4 | height of level 0 in samples
+ *      16 |    2 | tile size in quads
+ *      18 |    2 | number of levels
+ *      20 |    4 | offset of the tile table
+ *      24 |    4 | number of tiles
+ *      28 |    4 | reserved
+ *
+ * Level l holds every 2^l-th sample of level 0 and levels are added until one
+ * tile covers the map. Tiles are (tile size + 1)^2 samples so neighbours share
+ * their border, and are listed level by level, row by row in the tile table.
+ *
+ * TILE_CODEC_PACKED payloads are the tile's min and max sample (u16 each)
+ * followed by one record per row: a bit width byte, then the zigzagged
+ * prediction residuals of the row packed LSB first at that width, padded to
+ * a whole byte. The prediction is the left sample on the first row, the
+ * sample above in the first column and left + above - above left elsewhere;
+ * the first sample is predicted by the tile's min.
+ */
+#define HMT_MAGIC   "HMT1"
+#define HMT_VERSION 1u
+
+#define TILESET_MAX_LEVELS    16
+#define TILESET_MAX_TILE_SIZE 1024
+#define TILESET_MAX_WORKERS   16
+
+typedef enum {
+    TILE_CODEC_RAW    = 0,
+    TILE_CODEC_PACKED = 1,
+} tile_codec_t;
+
+typedef struct {
+    char     magic[4];
+    uint16_t version;
+    uint16_t type;
+    uint32_t width;
+    uint32_t height;
+    uint16_t tile_size;
+    uint16_t levels;
+    uint32_t table_offset;
+    uint32_t num_tiles;
+    uint32_t reserved;
+} hmt_header_t;
+
+typedef struct {
+    uint64_t offset;
+    uint32_t size;
+    uint16_t codec;
+    uint16_t reserved;
+} hmt_entry_t;
+
+typedef struct {
+    uint32_t tiles_x, tiles_y;
+    uint32_t first; /* index of the level's first tile */
+} hmt_level_t;
+
+typedef enum {
+    SLOT_FREE = 0,
+    SLOT_LOADING,          /* owned by a worker until it is ready */
+    SLOT_READY,
+    SLOT_FAILED,
+} slot_state_t;
+
+typedef struct {
+    int32_t tile;          /* tile held, -1 when free */
+    uint32_t last_used;    /* frame the tile was last in view range */
+    _Atomic uint32_t state;
+    uint8_t* samples;
+    uint8_t* staging;      /* where the worker decodes the tile instead of samples, see tileset_t.stage */
+    bool staged;           /* tile went to staging, samples hold nothing */
+} tile_slot_t;
+
+#define TILE_BROKEN -2     /* tile_slot value of tiles that failed to decode */
+
+typedef struct {
+    int fd;
+    hmap_type_t type;
+    uint32_t width, height;
+    uint32_t tile_size;    /* quads along a tile edge */
+    uint32_t tile_bytes;   /* decoded size of a tile */
+    uint32_t num_levels, num_tiles;
+    hmt_level_t levels[TILESET_MAX_LEVELS];
+    hmt_entry_t* entries;
+    int32_t* tile_slot;    /* slot holding each tile or -1 */
+    /* fixed pool of decoded tiles - sized from the view distance, not the map */
+    tile_slot_t* slots;
+    uint32_t num_slots;
+    uint8_t* slot_memory;
+    float view_distance;   /* level 0 samples around the camera kept at full resolution */
+    uint32_t frame;
+    /* decode workers and their queue of loading slots */
+    pthread_t workers[TILESET_MAX_WORKERS];
+    uint32_t num_workers;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    int32_t* queue;        /* ring of slot indices, one entry per slot at most */
+    uint8_t* scratch;      /* payload buffer for decoding without workers */
+    uint8_t* worker_scratch[TILESET_MAX_WORKERS];   /* one per worker, allocated by tileset_open */
+    uint32_t workers_started;                       /* workers that took their scratch */
+    uint32_t queue_head, queue_count;
+    bool quit;
+    /* called on the updating thread as a slot is queued - returns memory its worker decodes the tile
+     * into in place of the slot's samples, e.g. a mapped pixel buffer (see tiletex.h), or NULL */
+    uint8_t* (*stage)(void* user, int32_t slot);
+    void* stage_user;
+    /* statistics */
+    uint32_t loads, evictions;
+    _Atomic uint64_t bytes_read;
+} tileset_t;
+
+/* closest distance from a point to a tile, all in level 0 samples */
+float tileset_tile_distance(const tileset_t* set, uint32_t level, uint32_t tx, uint32_t ty, float x, float y) {
+    float extent = (float) (set->tile_size << level);
+    float x0 = tx * extent, y0 = ty * extent;
+    float dx = fmaxf(fmaxf(x0 - x, x - (x0 + extent)), 0.f);
+    float dy = fmaxf(fmaxf(y0 - y, y - (y0 + extent)), 0.f);
+    return sqrtf(dx * dx + dy * dy);
+}
+
+/* tiles a level can have within its view range - each level is needed out to view_distance * 2^level */
+uint32_t tileset_tiles_in_range(float view_distance, uint32_t tile_size) {
+    uint32_t span = (uint32_t) ceilf(2.f * view_distance / tile_size) + 1;
+    return span * span;
+}
+
+/* next zigzagged residual of a packed row, refilling the bit buffer a byte at a time -
+ * a row reads exactly its padded byte count */
+static inline int32_t tile_unpack(const uint8_t** in, uint64_t* acc, uint32_t* acc_bits, uint32_t bits) {
+    uint32_t z;
+    while (*acc_bits < bits) {
+        *acc |= (uint64_t) *(*in)++ << *acc_bits;
+        *acc_bits += 8;
+    }
+    z = (uint32_t) (*acc & ((1ull << bits) - 1));
+    *acc >>= bits;
+    *acc_bits -= bits;
+    return (int32_t) ((z >> 1) ^ -(z & 1));
+}
+
+/* decodes a TILE_CODEC_PACKED payload of n x n samples */
+int tile_decode_packed(const uint8_t* in, uint32_t in_size, uint8_t* out, uint32_t n, hmap_type_t type) {
+    const uint8_t* end = in + in_size;
+    int32_t rows[2][TILESET_MAX_TILE_SIZE + 1];
+    int32_t *prev = rows[0], *cur = rows[1], *swap;
+    uint32_t i, j;
+
+    if (in_size < 4 || n > TILESET_MAX_TILE_SIZE + 1)
+        return -1;
+    prev[0] = in[0] | in[1] << 8; /* tile min predicts the first sample */
+    in += 4;
+
+    for (j = 0; j < n; ++j) {
+        uint32_t bits, acc_bits = 0;
+        uint64_t acc = 0;
+
+        if (in >= end)
+            return -1;
+        bits = *in++;
+        if (bits > 24 || in + (n * bits + 7) / 8 > end)
+            return -1;
+
+        /* first column is predicted from above, the first row from the left */
+        cur[0] = prev[0] + tile_unpack(&in, &acc, &acc_bits, bits);
+        if (j == 0) {
+            for (i = 1; i < n; ++i)
+                cur[i] = cur[i - 1] + tile_unpack(&in, &acc, &acc_bits, bits);
+        } else {
+            for (i = 1; i < n; ++i)
+                cur[i] = cur[i - 1] + prev[i] - prev[i - 1] + tile_unpack(&in, &acc, &acc_bits, bits);
+        }
+
+        /* store row */
+        if (type == HMAP_U16) {
+            for (i = 0; i < n; ++i) {
+                out[2 * i] = cur[i] & 0xff;
+                out[2 * i + 1] = cur[i] >> 8;
+            }
+            out += 2 * n;
+        } else {
+            for (i = 0; i < n; ++i)
+                out[i] = cur[i];
+            out += n;
+        }
+
+        swap = prev; prev = cur; cur = swap;
+    }
+
+    return in == end ? 0 : -1;
+}
+
+/* largest payload tile_read accepts - packed rows may grow past the raw size */
+size_t tile_scratch_size(const tileset_t* set) {
+    return set->tile_bytes * 2 + 4 + set->tile_size + 1;
+}
+
+/* reads a tile from disk and decodes it into out - thread safe */
+int tile_read(const tileset_t* set, int32_t tile, uint8_t* out, uint8_t* scratch) {
+    const hmt_entry_t* entry = &set->entries[tile];
+
+    switch (entry->codec) {
+    case TILE_CODEC_RAW:
+        if (entry->size != set->tile_bytes)
+            return -1;
+        return pread(set->fd, out, entry->size, entry->offset) == (ssize_t) entry->size ? 0 : -1;
+    case TILE_CODEC_PACKED:
+        if (entry->size > tile_scratch_size(set))
+            return -1;
+        if (pread(set->fd, scratch, entry->size, entry->offset) != (ssize_t) entry->size)
+            return -1;
+        return tile_decode_packed(scratch, entry->size, out, set->tile_size + 1, set->type);
+    default:
+        return -1;
+    }
+}
+
+/* decodes a slot's tile once, straight into its staging memory when it has some */
+void tileset_load_slot(tileset_t* set, int32_t s, uint8_t* scratch) {
+    tile_slot_t* slot = &set->slots[s];
+
+    if (tile_read(set, slot->tile, slot->staged ? slot->staging : slot->samples, scratch) == -1) {
+        printf("ERROR could not load tile %d\n", slot->tile);
+        atomic_store_explicit(&slot->state, SLOT_FAILED, memory_order_release);
+        return;
+    }
+
+    atomic_fetch_add(&set->bytes_read, set->entries[slot->tile].size);
+    atomic_store_explicit(&slot->state, SLOT_READY, memory_order_release);
+}
+
+void* tileset_worker(void* arg) {
+    tileset_t* set = arg;
+    uint8_t* scratch;
+
+    pthread_mutex_lock(&set->lock);
+    scratch = set->worker_scratch[set->workers_started++];
+    while (!set->quit) {
+        int32_t s;
+
+        if (set->queue_count == 0) {
+            pthread_cond_wait(&set->wake, &set->lock);
+            continue;
+        }
+        s = set->queue[set->queue_head];
+        set->queue_head = (set->queue_head + 1) % set->num_slots;
+        --set->queue_count;
+
+        /* read and decode without holding the queue */
+        pthread_mutex_unlock(&set->lock);
+        tileset_load_slot(set, s, scratch);
+        pthread_mutex_lock(&set->lock);
+    }
+    pthread_mutex_unlock(&set->lock);
+    return NULL;
+}
+
+/* tiles are decoded on num_workers threads, or inline during tileset_update when zero */
+int tileset_open(tileset_t* set, const char* path, float view_distance, uint32_t num_workers) {
+    hmt_header_t header;
+    uint32_t l, i, tiles = 0;
+    size_t table_size;
+
+    memset(set, 0, sizeof(*set));
+    set->fd = open(path, O_RDONLY);
+    if (set->fd == -1) {
+        printf("ERROR could not open tiled heightmap \"%s\"\n", path);
+        return -1;
+    }
+
+    /* validate header */
+    if (pread(set->fd, &header, sizeof(header), 0) != sizeof(header)
+        || memcmp(header.magic, HMT_MAGIC, 4) != 0 || header.version != HMT_VERSION) {
+        printf("ERROR \"%s\" is not a version %u tiled heightmap\n", path, HMT_VERSION);
+        goto fail;
+    }
+    if (hmap_sample_size(header.type) == 0 || header.tile_size == 0 || header.tile_size > TILESET_MAX_TILE_SIZE
+        || header.levels == 0 || header.levels > TILESET_MAX_LEVELS) {
+        printf("ERROR tiled heightmap \"%s\" has an invalid layout\n", path);
+        goto fail;
+    }
+
+    set->type = header.type;
+    set->width = header.width;
+    set->height = header.height;
+    set->tile_size = header.tile_size;
+    set->tile_bytes = (header.tile_size + 1) * (header.tile_size + 1) * hmap_sample_size(header.type);
+    set->num_levels = header.levels;
+    set->num_tiles = header.num_tiles;
+
+    /* tile counts of every level, matching tools/image2tiles.py */
+    for (l = 0; l < set->num_levels; ++l) {
+        uint32_t step = 1u << l;
+        uint32_t quads_x = (set->width - 1 + step - 1) / step;
+        uint32_t quads_y = (set->height - 1 + step - 1) / step;
+        set->levels[l].tiles_x = (quads_x + set->tile_size - 1) / set->tile_size;
+        set->levels[l].tiles_y = (quads_y + set->tile_size - 1) / set->tile_size;
+        set->levels[l].first = tiles;
+        tiles += set->levels[l].tiles_x * set->levels[l].tiles_y;
+    }
+    if (tiles != set->num_tiles) {
+        printf("ERROR tiled heightmap \"%s\" has %u tiles, expected %u\n", path, set->num_tiles, tiles);
+        goto fail;
+    }
+
+    /* the table is small - only tile payloads are streamed */
+    table_size = set->num_tiles * sizeof(hmt_entry_t);
+    set->entries = malloc(table_size);
+    set->tile_slot = malloc(set->num_tiles * sizeof(int32_t));
+    if (set->entries == NULL || set->tile_slot == NULL
+        || pread(set->fd, set->entries, table_size, header.table_offset) != (ssize_t) table_size) {
+        printf("ERROR could not read tile table of \"%s\"\n", path);
+        goto fail;
+    }
+    for (i = 0; i < set->num_tiles; ++i)
+        set->tile_slot[i] = -1;
+
+    /* resident memory is bounded by the view distance */
+    set->view_distance = view_distance;
+    set->num_slots = set->num_levels * tileset_tiles_in_range(view_distance, set->tile_size);
+    if (set->num_slots > set->num_tiles)
+        set->num_slots = set->num_tiles;
+    set->slots = calloc(set->num_slots, sizeof(tile_slot_t));
+    set->slot_memory = malloc((size_t) set->num_slots * set->tile_bytes);
+    if (set->slots == NULL || set->slot_memory == NULL) {
+        printf("ERROR could not allocate %u tile slots\n", set->num_slots);
+        goto fail;
+    }
+    for (i = 0; i < set->num_slots; ++i) {
+        set->slots[i].tile = -1;
+        set->slots[i].samples = set->slot_memory + (size_t) i * set->tile_bytes;
+    }
+
+    /* start decode workers, each with its own payload buffer */
+    if (num_workers > TILESET_MAX_WORKERS)
+        num_workers = TILESET_MAX_WORKERS;
+    set->queue = malloc(set->num_slots * sizeof(int32_t));
+    set->scratch = malloc(tile_scratch_size(set));
+    if (set->queue == NULL || set->scratch == NULL) {
+        printf("ERROR could not allocate the tile queue\n");
+        goto fail;
+    }
+    for (i = 0; i < num_workers; ++i) {
+        set->worker_scratch[i] = malloc(tile_scratch_size(set));
+        if (set->worker_scratch[i] == NULL) {
+            printf("ERROR could not allocate payload buffers for %u decode workers\n", num_workers);
+            goto fail;
+        }
+    }
+    pthread_mutex_init(&set->lock, NULL);
+    pthread_cond_init(&set->wake, NULL);
+    for (i = 0; i < num_workers; ++i) {
+        if (pthread_create(&set->workers[i], NULL, tileset_worker, set) != 0)
+            break;
+    }
+    set->num_workers = i;
+
+    printf("Opened tiled heightmap \"%s\": %ux%u, %u levels, %u tiles, %u slots (%.1f MB), %u decode workers\n", path,
+           set->width, set->height, set->num_levels, set->num_tiles, set->num_slots,
+           set->num_slots * set->tile_bytes / (1024.f * 1024.f), set->num_workers);
+    return 0;
+
+fail:
+    free(set->queue);
+    free(set->scratch);
+    for (i = 0; i < TILESET_MAX_WORKERS; ++i)
+        free(set->worker_scratch[i]);
+    free(set->entries);
+    free(set->tile_slot);
+    free(set->slots);
+    free(set->slot_memory);
+    close(set->fd);
+    memset(set, 0, sizeof(*set));
+    set->fd = -1;
+    return -1;
+}
+
+void tileset_close(tileset_t* set) {
+    uint32_t i;
+
+    /* stop workers - tiles still queued are dropped */
+    if (set->queue != NULL) {
+        pthread_mutex_lock(&set->lock);
+        set->quit = true;
+        pthread_cond_broadcast(&set->wake);
+        pthread_mutex_unlock(&set->lock);
+        for (i = 0; i < set->num_workers; ++i)
+            pthread_join(set->workers[i], NULL);
+        pthread_mutex_destroy(&set->lock);
+        pthread_cond_destroy(&set->wake);
+    }
+
+    if (set->fd != -1)
+        close(set->fd);
+    free(set->queue);
+    free(set->scratch);
+    for (i = 0; i < TILESET_MAX_WORKERS; ++i)
+        free(set->worker_scratch[i]);
+    free(set->entries);
+    free(set->tile_slot);
+    free(set->slots);
+    free(set->slot_memory);
+    memset(set, 0, sizeof(*set));
+    set->fd = -1;
+}
+
+/* picks a free slot, or the least recently used one that is out of range this frame -
+ * slots still owned by a worker are never taken */
+int32_t tileset_find_slot(tileset_t* set) {
+    int32_t i, best = -1;
+
+    for (i = 0; i < (int32_t) set->num_slots; ++i) {
+        tile_slot_t* slot = &set->slots[i];
+        uint32_t state = atomic_load_explicit(&slot->state, memory_order_acquire);
+        if (state == SLOT_FREE)
+            return i;
+        if (state == SLOT_LOADING)
+            continue;
+        if (slot->last_used != set->frame && (best == -1 || slot->last_used < set->slots[best].last_used))
+            best = i;
+    }
+
+    return best;
+}
+
+int tileset_load(tileset_t* set, int32_t tile) {
+    int32_t s = tileset_find_slot(set);
+    tile_slot_t* slot;
+
+    if (s == -1)
+        return -1;
+    slot = &set->slots[s];
+
+    /* evict the previous tile */
+    if (slot->tile != -1) {
+        set->tile_slot[slot->tile] = -1;
+        ++set->evictions;
+    }
+
+    slot->tile = tile;
+    slot->last_used = set->frame;
+    set->tile_slot[tile] = s;
+    ++set->loads;
+    slot->staging = set->stage != NULL ? set->stage(set->stage_user, s) : NULL;
+    slot->staged = slot->staging != NULL;
+    atomic_store_explicit(&slot->state, SLOT_LOADING, memory_order_relaxed);
+
+    /* decode inline without workers */
+    if (set->num_workers == 0) {
+        tileset_load_slot(set, s, set->scratch);
+        return 0;
+    }
+
+    pthread_mutex_lock(&set->lock);
+    set->queue[(set->queue_head + set->queue_count) % set->num_slots] = s;
+    ++set->queue_count;
+    pthread_cond_signal(&set->wake);
+    pthread_mutex_unlock(&set->lock);
+    return 0;
+}
+
+/* loads the tiles in range of (x, y), given in level 0 samples, and marks them in use -
+ * coarse levels first so there is always something to fall back on */
+void tileset_update(tileset_t* set, float x, float y) {
+    int32_t l;
+    ++set->frame;
+
+    for (l = set->num_levels - 1; l >= 0; --l) {
+        const hmt_level_t* level = &set->levels[l];
+        float radius = set->view_distance * (1u << l);
+        float extent = (float) (set->tile_size << l);
+        int32_t tx0 = (int32_t) floorf((x - radius) / extent);
+        int32_t tx1 = (int32_t) floorf((x + radius) / extent);
+        int32_t ty0 = (int32_t) floorf((y - radius) / extent);
+        int32_t ty1 = (int32_t) floorf((y + radius) / extent);
+        int32_t tx, ty;
+
+        /* clamp to the level */
+        if (tx0 < 0) tx0 = 0;
+        if (ty0 < 0) ty0 = 0;
+        if (tx1 >= (int32_t) level->tiles_x) tx1 = level->tiles_x - 1;
+        if (ty1 >= (int32_t) level->tiles_y) ty1 = level->tiles_y - 1;
+
+        for (ty = ty0; ty <= ty1; ++ty) {
+            for (tx = tx0; tx <= tx1; ++tx) {
+                int32_t tile = level->first + ty * level->tiles_x + tx;
+
+                if (set->tile_slot[tile] == TILE_BROKEN || tileset_tile_distance(set, l, tx, ty, x, y) > radius)
+                    continue;
+
+                if (set->tile_slot[tile] == -1) {
+                    tileset_load(set, tile);
+                    continue;
+                }
+
+                /* tiles that failed to decode are not retried */
+                tile_slot_t* slot = &set->slots[set->tile_slot[tile]];
+                if (atomic_load_explicit(&slot->state, memory_order_acquire) == SLOT_FAILED) {
+                    set->tile_slot[tile] = TILE_BROKEN;
+                    slot->tile = -1;
+                    atomic_store_explicit(&slot->state, SLOT_FREE, memory_order_relaxed);
+                    continue;
+                }
+                slot->last_used = set->frame;
+            }
+        }
+    }
+}
+
+/* decoded samples of a tile, NULL when it is not resident, still decoding or was staged */
+const uint8_t* tileset_get(tileset_t* set, uint32_t level, uint32_t tx, uint32_t ty) {
+    const hmt_level_t* lvl = &set->levels[level];
+    int32_t s = set->tile_slot[lvl->first + ty * lvl->tiles_x + tx];
+    if (s < 0 || atomic_load_explicit(&set->slots[s].state, memory_order_acquire) != SLOT_READY)
+        return NULL;
+    /* staged tiles were decoded for the GPU only */
+    if (set->slots[s].staged)
+        return NULL;
+    return set->slots[s].samples;
+}
+
+uint32_t tileset_resident(tileset_t* set) {
+    uint32_t i, count = 0;
+    for (i = 0; i < set->num_slots; ++i)
+        count += atomic_load_explicit(&set->slots[i].state, memory_order_acquire) == SLOT_READY;
+    return count;
+}
+
+/* pages an uploader keeps a slot's tile in, one per slot (see tiletex.h) - a tile evicted and reloaded into
+ * another slot can be uploaded there before its old page is reused, so each tile remembers its current page
+ */
+typedef struct {
+    int32_t* page_tile;    /* tile uploaded to each page, -1 none */
+    int32_t* tile_page;    /* page each tile is drawn from, -1 none */
+} tile_pages_t;
+
+int tile_pages_init(tile_pages_t* pages, uint32_t num_pages, uint32_t num_tiles) {
+    uint32_t i;
+
+    pages->page_tile = malloc(num_pages * sizeof(int32_t));
+    pages->tile_page = malloc(num_tiles * sizeof(int32_t));
+    if (pages->page_tile == NULL || pages->tile_page == NULL) {
+        printf("ERROR could not allocate %u tile pages\n", num_pages);
+        free(pages->page_tile);
+        free(pages->tile_page);
+        memset(pages, 0, sizeof(*pages));
+        return -1;
+    }
+    for (i = 0; i < num_pages; ++i)
+        pages->page_tile[i] = -1;
+    for (i = 0; i < num_tiles; ++i)
+        pages->tile_page[i] = -1;
+    return 0;
+}
+
+void tile_pages_free(tile_pages_t* pages) {
+    free(pages->page_tile);
+    free(pages->tile_page);
+    memset(pages, 0, sizeof(*pages));
+}
+
+/* records tile uploaded to page p, returns the tile that was drawn from p and no longer is, or -1 */
+int32_t tile_pages_assign(tile_pages_t* pages, int32_t p, int32_t tile) {
+    int32_t old = pages->page_tile[p], prev = pages->tile_page[tile], lost = -1;
+
+    /* the old tile may already be drawn from another page */
+    if (old != -1 && old != tile && pages->tile_page[old] == p) {
+        pages->tile_page[old] = -1;
+        lost = old;
+    }
+    /* the tile's previous page still holds it, but is no longer drawn from */
+    if (prev != -1 && prev != p)
+        pages->page_tile[prev] = -1;
+
+    pages->page_tile[p] = tile;
+    pages->tile_page[tile] = p;
+    return lost;
+}
+
+#endif /* _TILES_H_ */
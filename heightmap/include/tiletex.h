@@ -0,0 +1,318 @@
+#ifndef _TILETEX_H_
+#define _TILETEX_H_
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glversion.h"
+#include "tiles.h"
+
+/*      streamed tile textures
+ * ---------------------------------
+ * Each slot of a tileset owns a page of one texture, pages laid out in a
+ * grid, and a tile is uploaded to its slot's page once a worker decoded it.
+ * Pages are (tile size + 1)^2 texels like the tiles, so neighbours keep
+ * their shared border.
+ *
+ * The vertex shader finds a tile's page in a table with a texel per tile
+ * of every level, levels stacked in y, holding the page's grid position
+ * and whether a tile was uploaded to it. A tile's entry is set when it is
+ * uploaded and cleared when another tile is uploaded over the page it is
+ * drawn from, so an evicted tile is drawn until its page is reused - a tile
+ * reloaded into another slot moves to that page (see tile_pages_assign in
+ * tiles.h). Heights come from the
+ * finest level uploaded at the vertex's level of detail or coarser, and
+ * from the heightmap atlas where no level is (see map_height in
+ * glversion.h).
+ *
+ * With ES 3.0 the GL thread maps a pixel buffer from a small pool for each
+ * slot it queues, and the worker decodes the tile straight into it.
+ * The upload is then an unmap and a glTexSubImage2D from the buffer, which
+ * the driver copies to the texture on its own time instead of from client
+ * memory before the call returns. ES 2.0 has no pixel buffers, so tiles go
+ * up from the slot memory, as do tiles queued while the pool is empty.
+ *
+ * At most budget bytes are uploaded a frame, at least one tile - the rest
+ * wait for the next frames, so a burst of loaded tiles is spread out
+ * instead of landing on one frame.
+ */
+#define TILETEX_PBOS 16     /* tiles staged in pixel buffers at once */
+
+#ifdef USE_GL2
+typedef struct {
+    GLuint texture;
+    GLenum format;
+    uint32_t page_size;     /* texels along a page edge */
+    uint32_t pages_x, pages_y;
+    uint32_t width, height;
+    uint32_t tile_bytes;
+    tile_pages_t pages;     /* tile uploaded to each slot's page, and page of each tile */
+    /* page of each tile, see tiletex_set_page */
+    GLuint table;
+    uint32_t table_width, table_rows;   /* texels per row and rows per level, level 0's tile counts */
+    uint32_t tile_size, num_levels;
+    float last_x, last_y;               /* last level 0 sample */
+    /* staging pixel buffers, ES 3.0 only */
+    GLuint pbos[TILETEX_PBOS];
+    uint8_t* pbo_map[TILETEX_PBOS];     /* mapping handed to a worker, NULL when unmapped */
+    int32_t pbo_slot[TILETEX_PBOS];     /* slot staged in the buffer, -1 when free */
+    int32_t* slot_pbo;                  /* buffer staging each slot, -1 none */
+    uint32_t num_pbos;
+    uint32_t budget;        /* bytes uploaded per frame */
+    /* statistics, reset by whoever reports them */
+    uint32_t uploads, staged_uploads, bytes_uploaded, peak_bytes, deferred;
+} tiletex_t;
+
+/* tileset_t.stage - maps a free pixel buffer for slot s, or the one it already has */
+uint8_t* tiletex_stage(void* user, int32_t s) {
+    tiletex_t* tex = user;
+    int32_t p = tex->slot_pbo[s];
+
+    if (p == -1) {
+        for (p = 0; p < (int32_t) tex->num_pbos && tex->pbo_slot[p] != -1; ++p)
+            ;
+        if (p == (int32_t) tex->num_pbos)
+            return NULL;
+    }
+
+    if (tex->pbo_map[p] == NULL) {
+        /* invalidating lets the driver hand out fresh storage if an upload still reads the old one */
+        gl_bind_buffer(GL_PIXEL_UNPACK_BUFFER, tex->pbos[p]);
+        tex->pbo_map[p] = gl_map_buffer_range(GL_PIXEL_UNPACK_BUFFER, 0, tex->tile_bytes,
+                                              GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        gl_bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        if (tex->pbo_map[p] == NULL)
+            return NULL;
+    }
+
+    tex->pbo_slot[p] = s;
+    tex->slot_pbo[s] = p;
+    return tex->pbo_map[p];
+}
+
+/* allocates a page for every slot of set, and stages its tiles in pixel buffers when the context has them */
+int tiletex_init(tiletex_t* tex, tileset_t* set, uint32_t budget) {
+    GLint filter = set->type == HMAP_U16 ? GL_NEAREST : GL_LINEAR; /* as in atlas_upload */
+    GLint max_size, units;
+    uint8_t* table;
+    uint32_t i;
+
+    memset(tex, 0, sizeof(*tex));
+    tex->format = set->type == HMAP_U16 ? GL_RG : GL_RED;
+    tex->page_size = set->tile_size + 1;
+    tex->tile_bytes = set->tile_bytes;
+    tex->budget = budget;
+
+    /* squarest grid of pages */
+    tex->pages_x = (uint32_t) ceilf(sqrtf((float) set->num_slots));
+    tex->pages_y = (set->num_slots + tex->pages_x - 1) / tex->pages_x;
+    tex->tile_size = set->tile_size;
+    tex->num_levels = set->num_levels;
+    tex->last_x = set->width - 1.f;
+    tex->last_y = set->height - 1.f;
+    tex->table_width = set->levels[0].tiles_x;
+    tex->table_rows = set->levels[0].tiles_y;
+    tex->width = tex->pages_x * tex->page_size;
+    tex->height = tex->pages_y * tex->page_size;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &max_size);
+    if (tex->width > (uint32_t) max_size || tex->height > (uint32_t) max_size) {
+        printf("ERROR tile pages of %ux%u exceed the %d texel texture limit\n", tex->width, tex->height, max_size);
+        return -1;
+    }
+    if (tex->table_width > (uint32_t) max_size || tex->table_rows * tex->num_levels > (uint32_t) max_size) {
+        printf("ERROR tile table of %ux%u exceeds the %d texel texture limit\n", tex->table_width,
+               tex->table_rows * tex->num_levels, max_size);
+        return -1;
+    }
+    /* page positions are stored in bytes */
+    if (tex->pages_x > 256 || tex->pages_y > 256) {
+        printf("ERROR %u tile pages exceed the 256x256 page table\n", set->num_slots);
+        return -1;
+    }
+
+    if (tile_pages_init(&tex->pages, set->num_slots, set->num_tiles) == -1)
+        return -1;
+    tex->slot_pbo = malloc(set->num_slots * sizeof(int32_t));
+    if (tex->slot_pbo == NULL) {
+        printf("ERROR could not allocate %u tile pages\n", set->num_slots);
+        return -1;
+    }
+    for (i = 0; i < set->num_slots; ++i)
+        tex->slot_pbo[i] = -1;
+
+    /* a unit of its own, the atlas stays bound to unit 0 */
+    gl_debug_flush();
+    glGenTextures(1, &tex->texture);
+    gl_bind_texture(1, tex->texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+    glTexImage2D(GL_TEXTURE_2D, 0, tex->format, tex->width, tex->height, 0, tex->format, GL_UNSIGNED_BYTE, NULL);
+
+    /* nothing uploaded yet - a zeroed table */
+    table = calloc((size_t) tex->table_width * tex->table_rows * tex->num_levels, 4);
+    if (table == NULL) {
+        printf("ERROR could not allocate the tile table\n");
+        return -1;
+    }
+    glGenTextures(1, &tex->table);
+    gl_bind_texture(2, tex->table);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, tex->table_width, tex->table_rows * tex->num_levels, 0, GL_RGBA,
+                 GL_UNSIGNED_BYTE, table);
+    free(table);
+
+    if (gl_es3) {
+        tex->num_pbos = TILETEX_PBOS < set->num_slots ? TILETEX_PBOS : set->num_slots;
+        glGenBuffers(tex->num_pbos, tex->pbos);
+        for (i = 0; i < tex->num_pbos; ++i) {
+            gl_bind_buffer(GL_PIXEL_UNPACK_BUFFER, tex->pbos[i]);
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, tex->tile_bytes, NULL, GL_STREAM_DRAW);
+            tex->pbo_slot[i] = -1;
+        }
+        gl_bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        set->stage = tiletex_stage;
+        set->stage_user = tex;
+    }
+
+    if (gl_out_of_memory()) {
+        printf("ERROR could not allocate %ux%u tile pages\n", tex->width, tex->height);
+        return -1;
+    }
+
+    /* samplers and sizes the shader looks pages up with, see tile_height in glversion.h */
+    glUniform1i(u_tiles, 1);
+    glUniform1i(u_tile_table, 2);
+    gl_set_uniform3f(u_table, tex->table_rows, 1.f / tex->table_width, 1.f / (tex->table_rows * tex->num_levels));
+    gl_set_uniform2f(u_pages, 1.f / tex->width, 1.f / tex->height);
+    glGetIntegerv(GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS, &units);
+    if (units < 3)
+        printf("WARNING %d vertex texture units, streamed tiles need 3 to be drawn\n", units);
+
+    printf("Tile pages %ux%u for %u slots, %u pixel buffers, %u KB uploaded per frame\n", tex->width, tex->height,
+           set->num_slots, tex->num_pbos, budget / 1024);
+    return 0;
+}
+
+/* points tile's table entry at page s, or clears it with -1 */
+void tiletex_set_page(tiletex_t* tex, const tileset_t* set, int32_t tile, int32_t s) {
+    uint8_t entry[4] = { 0, 0, 0, 0 };
+    uint32_t l = 0, tx, ty;
+
+    while (l + 1 < set->num_levels && (uint32_t) tile >= set->levels[l + 1].first)
+        ++l;
+    tx = (tile - set->levels[l].first) % set->levels[l].tiles_x;
+    ty = (tile - set->levels[l].first) / set->levels[l].tiles_x;
+    if (s != -1) {
+        entry[0] = s % tex->pages_x;
+        entry[1] = s / tex->pages_x;
+        entry[3] = 255;
+    }
+
+    gl_bind_texture(2, tex->table);
+    gl_set_unpack_alignment(1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, tx, l * tex->table_rows + ty, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, entry);
+}
+
+/* uploads tile s to its page, from its pixel buffer if it was staged in one */
+void tiletex_upload(tiletex_t* tex, tileset_t* set, int32_t s) {
+    tile_slot_t* slot = &set->slots[s];
+    int32_t p = tex->slot_pbo[s], lost;
+    GLint x = (s % tex->pages_x) * tex->page_size, y = (s / tex->pages_x) * tex->page_size;
+
+    /* the tile drawn from the page so far is gone - unless it was reloaded and uploaded to another page */
+    lost = tile_pages_assign(&tex->pages, s, slot->tile);
+    if (lost != -1)
+        tiletex_set_page(tex, set, lost, -1);
+
+    gl_bind_texture(1, tex->texture);
+    gl_set_unpack_alignment(1); /* odd rows of 8 bit samples */
+    if (p != -1) {
+        /* pointers are offsets into the bound unpack buffer */
+        gl_bind_buffer(GL_PIXEL_UNPACK_BUFFER, tex->pbos[p]);
+        gl_unmap_buffer(GL_PIXEL_UNPACK_BUFFER);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, tex->page_size, tex->page_size, tex->format, GL_UNSIGNED_BYTE, NULL);
+        gl_bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+        tex->pbo_map[p] = NULL;
+        tex->pbo_slot[p] = tex->slot_pbo[s] = -1;
+        slot->staging = NULL;
+        ++tex->staged_uploads;
+    } else {
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, tex->page_size, tex->page_size, tex->format, GL_UNSIGNED_BYTE,
+                        slot->samples);
+    }
+
+    tiletex_set_page(tex, set, slot->tile, s);
+    ++tex->uploads;
+}
+
+/* uploads tiles decoded since the last frame, within the budget - call after tileset_update */
+void tiletex_update(tiletex_t* tex, tileset_t* set) {
+    uint32_t s, bytes = 0;
+
+    for (s = 0; s < set->num_slots; ++s) {
+        tile_slot_t* slot = &set->slots[s];
+
+        if (atomic_load_explicit(&slot->state, memory_order_acquire) != SLOT_READY || tex->pages.page_tile[s] == slot->tile)
+            continue;
+        if (bytes > 0 && bytes + tex->tile_bytes > tex->budget) {
+            ++tex->deferred;
+            continue;
+        }
+        tiletex_upload(tex, set, s);
+        bytes += tex->tile_bytes;
+    }
+
+    tex->bytes_uploaded += bytes;
+    if (bytes > tex->peak_bytes)
+        tex->peak_bytes = bytes;
+}
+
+/* points the shader at the pages of the map drawn next, or stops fetching them with NULL */
+void tiletex_bind(const tiletex_t* tex) {
+    if (tex == NULL) {
+        gl_set_uniform4f(u_stream, 0.f, 0.f, 0.f, 0.f);
+        return;
+    }
+    gl_bind_texture(1, tex->texture);
+    gl_bind_texture(2, tex->table);
+    gl_set_uniform4f(u_stream, tex->tile_size, tex->num_levels, tex->last_x, tex->last_y);
+}
+
+/* after tileset_close, so no worker is still writing a mapped buffer */
+void tiletex_free(tiletex_t* tex) {
+    uint32_t i;
+
+    for (i = 0; i < tex->num_pbos; ++i) {
+        if (tex->pbo_map[i] != NULL) {
+            gl_bind_buffer(GL_PIXEL_UNPACK_BUFFER, tex->pbos[i]);
+            gl_unmap_buffer(GL_PIXEL_UNPACK_BUFFER);
+        }
+        gl_forget_buffer(tex->pbos[i]);
+    }
+    gl_bind_buffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    if (tex->num_pbos > 0)
+        glDeleteBuffers(tex->num_pbos, tex->pbos);
+    if (tex->texture != 0) {
+        gl_forget_texture(tex->texture);
+        glDeleteTextures(1, &tex->texture);
+    }
+    if (tex->table != 0) {
+        gl_forget_texture(tex->table);
+        glDeleteTextures(1, &tex->table);
+    }
+    tile_pages_free(&tex->pages);
+    free(tex->slot_pbo);
+    memset(tex, 0, sizeof(*tex));
+}
+#endif
+
+#endif /* _TILETEX_H_ */
@@ -0,0 +1,158 @@
+#ifndef _TIN_H_
+#define _TIN_H_
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "glversion.h"
+
+/*      .tin decimated terrain mesh
+ * ---------------------------------
+ * little endian, written by tools/heightmap2tin.py
+ *
+ *  offset | size | field
+ *  -------+------+----------------------------------------
+ *       0 |    4 | magic "HTIN"
+ *       4 |    2 | version
+ *       6 |    2 | reserved
+ *       8 |    4 | width of the source map in samples
+ *      12 |    4 | height of the source map in samples
+ *      16 |    4 | number of vertices
+ *      20 |    4 | number of triangles
+ *      24 |    4 | offset of the vertices from start of file
+ *      28 |    4 | offset of the indices from start of file
+ *      32 |    4 | largest vertical error against every map sample, in altitude steps (float)
+ *
+ * Vertices are tin_vertex_t, in samples (x east, y south) and 8 bit altitude
+ * steps with a grey color, so GL1 draws them from the mapping as they are and
+ * moves them to world units in the modelview. Indices are 32 bit triangles.
+ */
+#define TIN_MAGIC   "HTIN"
+#define TIN_VERSION 1u
+
+typedef struct {
+    char     magic[4];
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t width;
+    uint32_t height;
+    uint32_t num_vertices;
+    uint32_t num_triangles;
+    uint32_t vertex_offset;
+    uint32_t index_offset;
+    float    max_error;
+} tin_header_t;
+
+typedef struct {
+    float x, y, z;
+    uint8_t rgba[4];
+} tin_vertex_t;
+
+typedef struct {
+    uint32_t width, height;
+    uint32_t num_vertices, num_triangles;
+    float max_error;
+    const tin_vertex_t* vertices;
+    const uint32_t* indices;
+    /* mapping of the whole file */
+    void* map;
+    size_t map_size;
+} tin_t;
+
+/* maps a .tin file read only - like the heightmaps, the mesh is drawn in place */
+int tin_open(tin_t* tin, const char* path) {
+    struct stat st;
+    tin_header_t header;
+    const uint32_t* indices;
+    size_t i;
+    int fd;
+
+    memset(tin, 0, sizeof(*tin));
+
+    fd = open(path, O_RDONLY);
+    if (fd == -1) {
+        printf("ERROR could not open mesh \"%s\"\n", path);
+        return -1;
+    }
+    if (fstat(fd, &st) == -1 || (size_t) st.st_size < sizeof(header)) {
+        printf("ERROR mesh \"%s\" is too small\n", path);
+        close(fd);
+        return -1;
+    }
+
+    tin->map_size = st.st_size;
+    tin->map = mmap(NULL, tin->map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); /* mapping holds its own reference */
+    if (tin->map == MAP_FAILED) {
+        printf("ERROR could not map mesh \"%s\"\n", path);
+        tin->map = NULL;
+        return -1;
+    }
+
+    /* validate header */
+    memcpy(&header, tin->map, sizeof(header));
+    if (memcmp(header.magic, TIN_MAGIC, 4) != 0 || header.version != TIN_VERSION) {
+        printf("ERROR \"%s\" is not a version %u mesh\n", path, TIN_VERSION);
+        goto fail;
+    }
+    if (header.num_vertices == 0 || header.num_triangles == 0
+        || header.vertex_offset % sizeof(float) != 0 || header.index_offset % sizeof(uint32_t) != 0
+        || header.vertex_offset + (size_t) header.num_vertices * sizeof(tin_vertex_t) > tin->map_size
+        || header.index_offset + (size_t) header.num_triangles * 3 * sizeof(uint32_t) > tin->map_size) {
+        printf("ERROR mesh \"%s\" has an invalid layout\n", path);
+        goto fail;
+    }
+    /* drawn as is, so an index past the vertices would read past the mapping */
+    indices = (const uint32_t*) ((const uint8_t*) tin->map + header.index_offset);
+    for (i = 0; i < (size_t) header.num_triangles * 3; ++i) {
+        if (indices[i] >= header.num_vertices) {
+            printf("ERROR mesh \"%s\" has index %u of %u vertices\n", path, indices[i], header.num_vertices);
+            goto fail;
+        }
+    }
+
+    tin->width = header.width;
+    tin->height = header.height;
+    tin->num_vertices = header.num_vertices;
+    tin->num_triangles = header.num_triangles;
+    tin->max_error = header.max_error;
+    tin->vertices = (const tin_vertex_t*) ((const uint8_t*) tin->map + header.vertex_offset);
+    tin->indices = indices;
+
+    printf("Mapped mesh \"%s\": %ux%u map, %u vertices, %u triangles within %.2f steps\n", path, tin->width,
+           tin->height, tin->num_vertices, tin->num_triangles, tin->max_error);
+    return 0;
+
+fail:
+    munmap(tin->map, tin->map_size);
+    memset(tin, 0, sizeof(*tin));
+    return -1;
+}
+
+void tin_close(tin_t* tin) {
+    if (tin->map != NULL)
+        munmap(tin->map, tin->map_size);
+    memset(tin, 0, sizeof(*tin));
+}
+
+#ifdef USE_GL1
+/* draws the whole mesh in one call, placed like the terrain grid of the same map */
+void tin_draw(const tin_t* tin, float spacing, float scale) {
+    glPushMatrix();
+    glTranslatef(-(tin->width - 1) * spacing / 2.f, (tin->height - 1) * spacing / 2.f, 0.f);
+    glScalef(spacing, -spacing, scale);
+
+    glVertexPointer(3, GL_FLOAT, sizeof(tin_vertex_t), &tin->vertices[0].x);
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(tin_vertex_t), &tin->vertices[0].rgba[0]);
+    glDrawElements(GL_TRIANGLES, 3 * tin->num_triangles, GL_UNSIGNED_INT, tin->indices);
+
+    glPopMatrix();
+}
+#endif
+
+#endif /* _TIN_H_ */
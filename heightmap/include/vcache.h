@@ -0,0 +1,58 @@
+#ifndef _VCACHE_H_
+#define _VCACHE_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*      post-transform vertex cache
+ * ---------------------------------
+ * Simulates a FIFO cache of transformed vertices over an index stream.
+ * Every miss is one vertex shader invocation (one heightmap fetch on GL2).
+ *   ACMR - misses per triangle, 0.5 is the limit for a large grid
+ *   ATVR - misses per vertex used, 1.0 means every vertex is transformed once
+ */
+
+/* entries assumed when choosing an ordering - small enough for GLES2 class hardware */
+#define VCACHE_SIZE 16u
+
+typedef struct {
+    uint32_t misses;
+    uint32_t triangles;     /* with three distinct indices - includes the zero area turns of a serpentine */
+    uint32_t vertices;      /* distinct vertices referenced */
+    float acmr, atvr;
+} vcache_stats_t;
+
+/* runs a triangle strip through a FIFO cache of cache_size entries */
+int vcache_simulate_strip(const uint16_t* indices, uint32_t num_indices, uint32_t cache_size, vcache_stats_t* stats) {
+    /* number of the miss that brought each vertex into the cache, counting from one - zero if never transformed */
+    uint32_t* inserted = calloc(UINT16_MAX + 1, sizeof(uint32_t));
+    uint32_t i;
+
+    stats->misses = stats->triangles = stats->vertices = 0;
+    if (inserted == NULL) {
+        printf("ERROR could not allocate vertex cache simulator\n");
+        return -1;
+    }
+
+    for (i = 0; i < num_indices; ++i) {
+        uint16_t v = indices[i];
+
+        /* FIFO - an entry is evicted cache_size misses after it was inserted, hits do not refresh it */
+        if (inserted[v] == 0 || stats->misses - inserted[v] >= cache_size) {
+            if (inserted[v] == 0)
+                ++stats->vertices;
+            inserted[v] = ++stats->misses;
+        }
+
+        if (i >= 2 && v != indices[i - 1] && v != indices[i - 2] && indices[i - 1] != indices[i - 2])
+            ++stats->triangles;
+    }
+
+    stats->acmr = stats->triangles ? (float) stats->misses / stats->triangles : 0.f;
+    stats->atvr = stats->vertices ? (float) stats->misses / stats->vertices : 0.f;
+    free(inserted);
+    return 0;
+}
+
+#endif /* _VCACHE_H_ */
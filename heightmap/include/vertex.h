@@ -0,0 +1,44 @@
+#ifndef _VERTEX_H_
+#define _VERTEX_H_
+
+#include <math.h>
+#include <stdint.h>
+
+/*      packed GL1 terrain vertex
+ * ---------------------------------
+ * One 12 byte interleaved record instead of two 12 byte float streams:
+ *
+ *  offset | size | field
+ *  -------+------+----------------------------------------
+ *       0 |    2 | x, sample column (GL_SHORT)
+ *       2 |    2 | y, sample row
+ *       4 |    2 | z, altitude in 1/VERTEX_Z_STEPS of an 8 bit step
+ *       6 |    2 | padding, keeps the color 4 byte aligned
+ *       8 |    4 | rgba (GL_UNSIGNED_BYTE)
+ *
+ * Positions stay in samples and steps - the modelview moves them to world
+ * units, see terrain_draw. Maps are limited to VERTEX_MAX_SAMPLES a side.
+ */
+#define VERTEX_Z_STEPS     128.f
+#define VERTEX_MAX_SAMPLES 32768u
+
+typedef struct {
+    int16_t x, y, z, pad;
+    uint8_t rgba[4];
+} vertex_packed_t;
+
+/* vertex of sample (w, h) at altitude alt in 8 bit steps - 16 bit samples keep 7 bits of their fraction */
+void vertex_pack(vertex_packed_t* vertex, uint32_t w, uint32_t h, float alt) {
+    uint8_t grey = (uint8_t) lrintf(alt);
+
+    vertex->x = (int16_t) w;
+    vertex->y = (int16_t) h;
+    vertex->z = (int16_t) lrintf(alt * VERTEX_Z_STEPS);
+    vertex->pad = 0;
+    vertex->rgba[0] = grey;
+    vertex->rgba[1] = grey;
+    vertex->rgba[2] = grey;
+    vertex->rgba[3] = 255;
+}
+
+#endif /* _VERTEX_H_ */
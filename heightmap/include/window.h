@@ -166,6 +166,10 @@ int window_init(void) {
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, GL_CONTEXT_VERSION_MAJOR);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, GL_CONTEXT_VERSION_MINOR);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_ANY_PROFILE);
+#ifndef NDEBUG
+    /* debug output reports everything, see gldebug.h */
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GLFW_TRUE);
+#endif
 
     /* Create a windowed mode window and its OpenGL context */
     sprintf(title, "OpenGL %d.%d Heightmap Demo", GL_CONTEXT_VERSION_MAJOR, GL_CONTEXT_VERSION_MINOR);
@@ -0,0 +1,152 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "strip.h"
+#include "vcache.h"
+
+/* Checks the closed form strip against the reference state machine and
+ * times both, then checks the blocked orderings draw the same triangles and
+ * reports their post-transform cache behaviour.
+ *
+ * usage: indexbench
+ * every size fits a 16 bit terrain chunk (rows * width <= 65536)
+ */
+
+#define BENCH_MIN_SECONDS 0.25
+
+const uint32_t sizes[][2] = { /* rows, width */
+    { 2, 2 }, { 2, 3 }, { 3, 2 }, { 3, 3 }, { 4, 5 }, { 5, 4 }, { 17, 33 }, { 33, 17 },
+    { 23, 2624 }, { 255, 257 }, { 256, 256 }, { 2, 32768 }, { 32768, 2 }, { 4096, 16 },
+};
+
+/* terrain chunk sizes the orderings are compared on */
+const uint32_t order_sizes[][2] = { { 256, 256 }, { 255, 257 }, { 23, 2624 }, { 129, 508 } };
+const uint32_t order_blocks[] = { 4, 6, 8, 10, 12, 13, 14, 15, 16, 20, 30 };
+
+double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* seconds per call of gen_strip, or of the reference if reference is set */
+double bench_strip(uint16_t* indices, uint32_t rows, uint32_t width, bool reference) {
+    uint32_t num_indices = strip_num_indices(rows, width), calls = 0;
+    double start = bench_now(), elapsed;
+
+    do {
+        if (reference)
+            gen_strip_reference(indices, num_indices, width);
+        else
+            gen_strip(indices, rows, width);
+        ++calls;
+        elapsed = bench_now() - start;
+    } while (elapsed < BENCH_MIN_SECONDS);
+
+    return elapsed / calls;
+}
+
+/* order independent hash of the triangles of a strip - skips degenerate and zero area (one column) triangles */
+uint64_t strip_triangles_hash(const uint16_t* indices, uint32_t num_indices, uint32_t width) {
+    uint64_t hash = 0;
+    uint32_t i;
+
+    for (i = 2; i < num_indices; ++i) {
+        uint32_t a = indices[i - 2], b = indices[i - 1], c = indices[i], t;
+        if (a == b || b == c || a == c || (a % width == b % width && b % width == c % width))
+            continue;
+        if (a > b) { t = a; a = b; b = t; }
+        if (b > c) { t = b; b = c; c = t; }
+        if (a > b) { t = a; a = b; b = t; }
+        hash += (a * 0x9e3779b97f4a7c15ull) ^ (b * 0xc2b2ae3d27d4eb4full) ^ (c * 0x165667b19e3779f9ull);
+    }
+    return hash;
+}
+
+/* one line per ordering - block 0 is the plain serpentine */
+int report_ordering(uint32_t rows, uint32_t width, uint32_t block, uint64_t expected) {
+    uint32_t num_indices = block ? strip_blocked_num_indices(rows, width, block) : strip_num_indices(rows, width);
+    uint16_t* indices = malloc(num_indices * sizeof(uint16_t));
+    vcache_stats_t small, large;
+    char size[32], name[32];
+    int result = 0;
+
+    if (block)
+        gen_strip_blocked(indices, rows, width, block);
+    else
+        gen_strip(indices, rows, width);
+
+    if (strip_triangles_hash(indices, num_indices, width) != expected) {
+        printf("ERROR %ux%u strip blocked by %u draws different triangles\n", rows, width, block);
+        result = -1;
+    }
+    if (vcache_simulate_strip(indices, num_indices, 16, &small) == -1
+        || vcache_simulate_strip(indices, num_indices, 32, &large) == -1)
+        result = -1;
+
+    snprintf(size, sizeof(size), "%ux%u", rows, width);
+    if (block)
+        snprintf(name, sizeof(name), "blocked %u", block);
+    else
+        snprintf(name, sizeof(name), "serpentine");
+    printf("%-12s %-12s %10u %10.3f %10.3f %10.3f %10.3f\n", size, name, num_indices, small.acmr, small.atvr,
+           large.acmr, large.atvr);
+
+    free(indices);
+    return result;
+}
+
+int main(void) {
+    uint32_t s, i;
+    int result = 0;
+
+    printf("%-12s %10s %14s %14s %8s\n", "size", "indices", "reference us", "closed us", "speedup");
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        uint32_t rows = sizes[s][0], width = sizes[s][1];
+        uint32_t num_indices = strip_num_indices(rows, width);
+        uint16_t* expected = malloc(num_indices * sizeof(uint16_t));
+        uint16_t* indices = malloc(num_indices * sizeof(uint16_t));
+        double reference_time, closed_time;
+        char size[32];
+
+        gen_strip_reference(expected, num_indices, width);
+        memset(indices, 0xff, num_indices * sizeof(uint16_t));
+        gen_strip(indices, rows, width);
+        for (i = 0; i < num_indices && indices[i] == expected[i]; ++i)
+            ;
+        if (i < num_indices) {
+            printf("ERROR %ux%u strip differs at index %u: %u, expected %u\n", rows, width, i, indices[i], expected[i]);
+            result = -1;
+        }
+
+        reference_time = bench_strip(expected, rows, width, true);
+        closed_time = bench_strip(indices, rows, width, false);
+        snprintf(size, sizeof(size), "%ux%u", rows, width);
+        printf("%-12s %10u %14.2f %14.2f %7.1fx\n", size, num_indices, reference_time * 1e6, closed_time * 1e6,
+               reference_time / closed_time);
+
+        free(expected);
+        free(indices);
+    }
+
+    printf("\n%-12s %-12s %10s %10s %10s %10s %10s\n", "size", "ordering", "indices", "ACMR 16", "ATVR 16",
+           "ACMR 32", "ATVR 32");
+    for (s = 0; s < sizeof(order_sizes) / sizeof(order_sizes[0]); ++s) {
+        uint32_t rows = order_sizes[s][0], width = order_sizes[s][1];
+        uint32_t num_indices = strip_num_indices(rows, width);
+        uint16_t* indices = malloc(num_indices * sizeof(uint16_t));
+        uint64_t expected;
+
+        gen_strip(indices, rows, width);
+        expected = strip_triangles_hash(indices, num_indices, width);
+        free(indices);
+
+        result |= report_ordering(rows, width, 0, expected);
+        for (i = 0; i < sizeof(order_blocks) / sizeof(order_blocks[0]); ++i)
+            result |= report_ordering(rows, width, order_blocks[i], expected);
+    }
+
+    return result;
+}
@@ -1,179 +1,338 @@
-#include <string.h> /* memset */
-
-#include "heightmap.h"
+#include <string.h>
+
+#include "atlas.h"
+#include "buffers.h"
+#include "cdlod.h"
+#include "clipmap.h"
+#include "hmap.h"
+#include "rtin.h"
+#include "terrain.h"
 #include "test_texture.h"
+#include "tiles.h"
+#include "tiletex.h"
+#include "tin.h"
 #include "window.h"
 
 /*         TODO list
  * -------------------------
  * - add terrain coloring and lighting (normal vectors, altitude map 16x16 texture?)
- * - draw further away locations at lower resolution
- * - draw only chunks of terrain
  * - choose what gets drawn (indices) based off of current location of camera 
  * - only draw triangles that will be seen (based on camera position and direction)
- * - allow for use of multiple heightmaps
  * - speed comparisons of opengl 1 version drawing everything (drawArrays), drawing specific indices (drawElements), and opengl 2 version
  * - make presentation - outline design of modern system and illustrate what is lost with OpenGL versions
  */
 
-#define NUM_INDICES (HEIGHTMAP_NUM_PIXELS + (HEIGHTMAP_HEIGHT-2) * (HEIGHTMAP_WIDTH-1))
-uint32_t indices[NUM_INDICES];
-
-void gen_indices(uint32_t height, uint32_t width) {
-    uint32_t i, h = 0, w = 0, points;
-    int firststep = 1, step = 0, direction = 1;
-
-    /* Clears memory */
-    memset(&indices[0], 0, sizeof(indices));
+/* default dataset, generated with tools/image2header.py -f hmap */
+#define HEIGHTMAP_DEFAULT_PATH "heightmap_256x256.hmap"
+
+/* world units between samples and per altitude step */
+#define TERRAIN_SPACING 0.1f
+#define TERRAIN_SCALE   0.01f
+
+/* level 0 samples around the camera streamed in at full resolution */
+#define TILES_VIEW_DISTANCE 128.f
+/* threads decoding streamed tiles */
+#define TILES_DECODE_WORKERS 2
+/* bytes of streamed tiles uploaded to the GPU per frame */
+#define TILES_UPLOAD_BUDGET (256u << 10)
+
+/* RTIN error tolerance in altitude steps, and its change per frame while [ or ] is held */
+#define RTIN_DEFAULT_ERROR 1.f
+#define RTIN_ERROR_STEP    1.05f
+
+/* heightmaps given on the command line - the terrain grid is sized to the first */
+hmap_t hmaps[ATLAS_MAX_MAPS];
+uint32_t num_hmaps = 0;
+terrain_t terrain;
+tileset_t tileset = { .fd = -1 };
+bool streaming = false;
+bool tiles_drawn = false;   /* the tiles match the first map, which GL2 draws from them */
+
+/* render modes, cycled with M - CDLOD and the clipmap need the GL2 vertex shader, the TIN mesh is GL1 only */
+typedef enum {
+    MODE_PATCHES,
+    MODE_CDLOD,
+    MODE_CLIPMAP,
+    MODE_RTIN,
+    MODE_TIN,
+    NUM_MODES,
+} render_mode_t;
+const char* mode_names[NUM_MODES] = { "patches", "CDLOD", "clipmap", "RTIN", "TIN" };
+render_mode_t mode = MODE_PATCHES;
+bool mode_key_down = false;
+
+/* adaptive mesh of each map RTIN can split, see rtin_supports - others keep the patches */
+rtin_t rtins[ATLAS_MAX_MAPS];
+float rtin_error = RTIN_DEFAULT_ERROR;
+
+/* offline decimated mesh of the first map, see tools/heightmap2tin.py - GL1 only */
+tin_t tin;
+bool tin_loaded = false;
+
+/* CPU time spent issuing draws since the last report */
+double draw_time = 0.;
+
+/* true if path ends with ext */
+bool has_extension(const char* path, const char* ext) {
+    size_t len = strlen(path), ext_len = strlen(ext);
+    return len >= ext_len && strcmp(path + len - ext_len, ext) == 0;
+}
 
-    points = height*width + (height-2)*(width-1);
-    for (i = 0; i < points; ++i) {
-        indices[i] = h * width + w;
+#ifdef USE_GL2
+atlas_t atlas;
+tiletex_t tiletex;
+uint32_t active_map = 0;
+bool draw_all_maps = false;
 
-        if (step == 0) { /* downward motion of triangulation */
-            ++h;
-            step = 1;
-        } else if (step == 1) { /* upward and sideways motion of triangulation */
-            --h;
-            w += direction; /* moves in the current direction */
-            step = 0;
+float alt_scale = 1.f;
+bool buffers_key_down = false;
+
+/* CDLOD quadtree and geometry clipmap per map */
+cdlod_t cdlods[ATLAS_MAX_MAPS];
+clipmap_t clipmaps[ATLAS_MAX_MAPS];
+
+/* selects a map with no upload or regeneration - 1-9 pick one, 0 draws them all side by side */
+void select_map(void) {
+    uint32_t i;
+    if (glfwGetKey(window, GLFW_KEY_0) == GLFW_PRESS)
+        draw_all_maps = true;
+    for (i = 0; i < num_hmaps && i < 9; ++i) {
+        if (glfwGetKey(window, GLFW_KEY_1 + i) == GLFW_PRESS) {
+            active_map = i;
+            draw_all_maps = false;
         }
+    }
+}
 
-        /* if at the endges of the grid */
-        if (w == 0 || w == width - 1) {
-            /* if downward motion was just taken - row was just completed */
-            if (!firststep && step == 1) {
-                step = 0; /* move down again */
-                direction *= -1; /* swap direction */
-                firststep = 1;
-            } else {
-                firststep = 0;
-            }
-        }
+/* points the shader at one map of the atlas, offset along x */
+void use_map(uint32_t map, float x_offset) {
+    vec4 uv;
+    gl_bind_texture(0, atlas.texture);
+    atlas_uv(&atlas, map, uv);
+    gl_set_uniform4f(u_atlas, uv[0], uv[1], uv[2], uv[3]);
+    gl_set_uniform2f(u_offset, x_offset, 0.f);
+    tiletex_bind(tiles_drawn && map == 0 ? &tiletex : NULL);
+}
+
+/* draws map m in the current mode, returns the triangles drawn */
+uint32_t draw_map(uint32_t m, float x_offset, vec4 planes[6]) {
+    use_map(m, x_offset);
+    if (mode == MODE_RTIN && rtins[m].size != 0) {
+        rtin_draw(&rtins[m]);
+        return rtins[m].num_indices / 3;
+    }
+    if (mode == MODE_CLIPMAP) {
+        clipmap_update(&clipmaps[m], camera_pos, x_offset);
+        clipmap_draw(&clipmaps[m], &clipmap_grid);
+        return clipmaps[m].num_triangles;
+    }
+    if (mode == MODE_CDLOD) {
+        cdlod_select(&cdlods[m], planes, camera_pos, x_offset, alt_scale);
+        cdlod_draw(&cdlods[m], &cdlod_grid);
+        return cdlods[m].num_triangles;
     }
+
+    /* patch bounds come from the first map - the others are culled on x and y only */
+    terrain_cull(&terrain, planes, camera_pos, x_offset, alt_scale, m == 0);
+    terrain_draw(&terrain);
+    return terrain.num_triangles;
 }
+#endif
 
+bool mode_available(render_mode_t m) {
 #ifdef USE_GL1
-/* pre allocates memory */
-vec3 vertices[HEIGHTMAP_HEIGHT][HEIGHTMAP_WIDTH];
-vec3 colors[HEIGHTMAP_HEIGHT][HEIGHTMAP_WIDTH];
-
-void gen_vertices(uint32_t height, uint32_t width, float spacing, float scale) {
-    uint32_t h, w;
-    float h_offset = (height - 1) * spacing / 2.0f;
-    float w_offset = (width - 1) * spacing / 2.0f;
-
-    /* Clears memory */
-    memset(&vertices[0][0][0], 0, sizeof(vertices));
-    memset(&colors[0][0][0], 0, sizeof(colors));
-
-    for (h = 0; h < height; ++h) {
-        for (w = 0; w < width; ++w) {
-            uint8_t alt = heightmap_pixels[h][w];
-
-            /* xy plane heightmap - z is altitude, +x is "east", +y is "north" */
-            vertices[h][w][0] = spacing * w - w_offset; /* -x in top left */
-            vertices[h][w][1] = h_offset - spacing * h; /* +y in top left */
-            vertices[h][w][2] = alt * scale;
-
-            colors[h][w][0] = alt / 255.f;
-            colors[h][w][1] = alt / 255.f;
-            colors[h][w][2] = alt / 255.f;
-        }
+    /* CDLOD and the clipmap morph in a vertex shader, and only the first map is drawn */
+    return m == MODE_PATCHES || (m == MODE_RTIN && rtins[0].size != 0) || (m == MODE_TIN && tin_loaded);
+#else
+    uint32_t i;
+    if (m == MODE_TIN)
+        return false;
+    if (m != MODE_RTIN)
+        return true;
+    for (i = 0; i < num_hmaps; ++i) {
+        if (rtins[i].size != 0)
+            return true;
     }
+    return false;
+#endif
 }
+
+/* M cycles through the render modes this build and these maps support */
+void select_mode(void) {
+    bool down = glfwGetKey(window, GLFW_KEY_M) == GLFW_PRESS;
+    if (down && !mode_key_down) {
+        do {
+            mode = (mode + 1) % NUM_MODES;
+        } while (!mode_available(mode));
+        printf("Render mode: %s\n", mode_names[mode]);
+
+#ifdef USE_GL2
+        /* the RTIN mesh is drawn like the patches */
+        gl_set_uniform1f(u_mode, mode == MODE_RTIN ? MODE_PATCHES : mode);
 #endif
+    }
+    mode_key_down = down;
+}
+
 #ifdef USE_GL2
-GLuint texture;
+/* B switches between buffer objects and client arrays, to compare their CPU cost */
+void select_buffers(void) {
+    bool down = glfwGetKey(window, GLFW_KEY_B) == GLFW_PRESS;
+    if (down && !buffers_key_down) {
+        buffers_enabled = !buffers_enabled;
+        draw_time = 0.;
+        printf("Drawing from %s\n", buffers_enabled ? "buffer objects" : "client arrays");
+    }
+    buffers_key_down = down;
+}
+#endif
 
-float alt_scale = 1.f;
+/* rebuilds every RTIN mesh for the current tolerance */
+int extract_meshes(void) {
+    double start = terrain_time();
+    uint32_t i, triangles = 0;
+    int result;
+
+    for (i = 0; i < num_hmaps; ++i) {
+        if (rtins[i].size == 0)
+            continue;
+        if ((result = rtin_extract(&rtins[i], rtin_error)) == -1)
+            return -1;
+        triangles += result;
+    }
+    printf("RTIN tolerance %.2f: %u triangles extracted in %.0f us\n", rtin_error, triangles,
+           (terrain_time() - start) * 1e6);
+    return 0;
+}
 
-vec2 vertices[HEIGHTMAP_HEIGHT][HEIGHTMAP_WIDTH];
-vec2 tex_coords[HEIGHTMAP_HEIGHT][HEIGHTMAP_WIDTH];
+/* [ and ] lower and raise the RTIN tolerance */
+int select_tolerance(void) {
+    float error = rtin_error;
 
-void gen_vertices(uint32_t height, uint32_t width, float spacing) {
-    uint32_t h, w;
-    float h_offset = (height - 1) * spacing / 2.0f;
-    float w_offset = (width - 1) * spacing / 2.0f;
+    if (glfwGetKey(window, GLFW_KEY_LEFT_BRACKET) == GLFW_PRESS && error > 0.05f)
+        error /= RTIN_ERROR_STEP;
+    if (glfwGetKey(window, GLFW_KEY_RIGHT_BRACKET) == GLFW_PRESS && error < 255.f)
+        error *= RTIN_ERROR_STEP;
+    if (error == rtin_error)
+        return 0;
 
-    /* Clears memory */
-    memset(&vertices[0][0][0], 0, sizeof(vertices));
+    rtin_error = error;
+    return extract_meshes();
+}
 
-    for (h = 0; h < height; ++h) {
-        for (w = 0; w < width; ++w) {
-            /* xy plane heightmap - +z is altitude, +x is east, +y is north */
-            vertices[h][w][0] = spacing * w - w_offset; /* -x in top left */
-            vertices[h][w][1] = h_offset - spacing * h; /* +y in top left */
+int main(int argc, char** argv)
+{
+    const char* hmap_paths[ATLAS_MAX_MAPS] = { HEIGHTMAP_DEFAULT_PATH };
+    const char* tiles_path = NULL;
+    const char* tin_path = NULL;
+    uint32_t num_paths = 0;
+    int i;
+
+    /* usage: gl1|gl2 [heightmap.hmap ...] [tiles.hmt] [mesh.tin] */
+    for (i = 1; i < argc; ++i) {
+        if (has_extension(argv[i], ".hmt")) {
+            tiles_path = argv[i];
+        } else if (has_extension(argv[i], ".tin")) {
+            tin_path = argv[i];
+        } else if (num_paths < ATLAS_MAX_MAPS) {
+            hmap_paths[num_paths++] = argv[i];
+        } else {
+            printf("WARNING ignoring \"%s\", at most %u heightmaps\n", argv[i], ATLAS_MAX_MAPS);
         }
     }
-}
-
-void gen_tex_coords(uint32_t height, uint32_t width) {
-    uint32_t h, w;
-    float s_initial = 0.f;
-    float s_scale = 1.f  / ((float) width - 1);
-    float t_initial = 0.f;
-    float t_scale = 1.f  / ((float) height - 1);
+    if (num_paths == 0)
+        num_paths = 1;
 
-    /* Clears memory */
-    memset(&tex_coords[0][0][0], 0, sizeof(tex_coords));
+    /* map heightmap samples from disk */
+    for (num_hmaps = 0; num_hmaps < num_paths; ++num_hmaps) {
+        if (hmap_open(&hmaps[num_hmaps], hmap_paths[num_hmaps]) == -1)
+            return -1;
+    }
 
-    for (h = 0; h < height; ++h) {
-        for (w = 0; w < width; ++w) {
-            tex_coords[h][w][0] = s_initial + w * s_scale; // s
-            tex_coords[h][w][1] = t_initial + h * t_scale; // t
-        }
+    /* open tiled heightmap to stream around the camera */
+    if (tiles_path != NULL) {
+        if (tileset_open(&tileset, tiles_path, TILES_VIEW_DISTANCE, TILES_DECODE_WORKERS) == -1)
+            return -1;
+        streaming = true;
+        tiles_drawn = tileset.width == hmaps[0].width && tileset.height == hmaps[0].height
+                      && tileset.type == hmaps[0].type;
+        if (!tiles_drawn)
+            printf("WARNING tiles \"%s\" are %ux%u of %u bytes, \"%s\" is %ux%u of %u - streamed but not drawn\n",
+                   tiles_path, tileset.width, tileset.height, hmap_sample_size(tileset.type), hmap_paths[0],
+                   hmaps[0].width, hmaps[0].height, hmap_sample_size(hmaps[0].type));
     }
-}
+
+    /* map the decimated mesh, drawn straight from the file */
+    if (tin_path != NULL) {
+#ifdef USE_GL1
+        if (tin_open(&tin, tin_path) == -1)
+            return -1;
+        tin_loaded = true;
+        if (tin.width != hmaps[0].width || tin.height != hmaps[0].height)
+            printf("WARNING mesh \"%s\" is %ux%u, \"%s\" is %ux%u\n", tin_path, tin.width, tin.height,
+                   hmap_paths[0], hmaps[0].width, hmaps[0].height);
+#else
+        printf("WARNING ignoring \"%s\", meshes are drawn by GL1 only\n", tin_path);
 #endif
+    }
 
-int main(void)
-{
     /* init window to draw to */
     if (window_init() == -1) 
         return -1;
 
-    /* generates common triangle strip mesh for terrain */
-    gen_indices(HEIGHTMAP_HEIGHT, HEIGHTMAP_WIDTH);
+    /* generates terrain mesh sized to the heightmap */
+    if (terrain_init(&terrain, &hmaps[0], TERRAIN_SPACING, TERRAIN_SCALE) == -1)
+        return -1;
 
-#ifdef USE_GL1
-    /* Generates vertices and colors to draw */
-    gen_vertices(HEIGHTMAP_HEIGHT, HEIGHTMAP_WIDTH, 0.1f, 0.01f);
+    /* adaptive meshes, for the maps of 2^n + 1 samples */
+    for (i = 0; i < (int) num_hmaps; ++i) {
+        if (rtin_supports(&hmaps[i]) && rtin_init(&rtins[i], &hmaps[i], TERRAIN_SPACING, TERRAIN_SCALE) == -1)
+            return -1;
+    }
+    if (extract_meshes() == -1)
+        return -1;
 
-    /* Setup vertex and color arrays */
-    glVertexPointer(3, GL_FLOAT, 0, &vertices[0][0][0]);
-    glColorPointer(3, GL_FLOAT, 0, &colors[0][0][0]);
+#ifdef USE_GL1
+    /* altitudes are baked into the GL1 vertices - only the first map is drawn */
+    if (num_hmaps > 1)
+        printf("WARNING GL1 draws only \"%s\", multiple heightmaps need GL2\n", hmap_paths[0]);
 #endif
 #ifdef USE_GL2
-    /* generate terrain vertices */
-    gen_vertices(HEIGHTMAP_HEIGHT, HEIGHTMAP_WIDTH, 0.1f);
-
-    /* generate texture coordinates */
-    gen_tex_coords(HEIGHTMAP_HEIGHT, HEIGHTMAP_WIDTH);
-
     /* set altitude scaling */
-    glUniform1f(glGetUniformLocation(shaderProgram, "alt_scale"), alt_scale);
-
-    /* create and fill texture with heightmap data */
-    glActiveTexture(GL_TEXTURE0);
-    glGenTextures(1, &texture);
-    glBindTexture(GL_TEXTURE_2D, texture);
-    glUniform1i(glGetUniformLocation(shaderProgram, "heightmap"), 0); // zero relates to texturing unit
-
-    /* texture params */
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
-    /* fill in texture */
-    /* NOTE: had to be power of two to get a correct texturing */
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, HEIGHTMAP_WIDTH, HEIGHTMAP_HEIGHT, 0, GL_RED, GL_UNSIGNED_BYTE, &heightmap_pixels[0][0]); // not SC - need to replace with glTexStorage2D
+    gl_set_uniform1f(u_alt_scale, alt_scale);
+
+    /* pack every heightmap into one texture, uploaded once */
+    if (atlas_pack(&atlas, hmaps, num_hmaps) == -1 || atlas_upload(&atlas, hmaps) == -1)
+        return -1;
+    gl_set_uniform1f(u_max_lod, atlas_max_lod(&atlas));
+    glUniform1i(u_heightmap, 0); // zero relates to texturing unit
     // glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, TEST_TEXTURE_WIDTH, TEST_TEXTURE_HEIGHT, 0, GL_RED, GL_UNSIGNED_BYTE, &test_texture_pixels[0][0]);
 
-    /* TODO - replace with buffer object */
-    glVertexAttribPointer(a_pos, 2, GL_FLOAT, false, 0, &vertices[0][0][0]);
-    glVertexAttribPointer(a_tex, 2, GL_FLOAT, false, 0, &tex_coords[0][0][0]);
+    /* rebuilds 16 bit samples from the (low, high) byte pairs */
+    if (atlas.type == HMAP_U16) {
+        gl_set_uniform2f(u_height_unpack, 255.f / 65535.f, 255.f * 256.f / 65535.f);
+    } else {
+        gl_set_uniform2f(u_height_unpack, 1.f, 0.f);
+    }
+
+    /* static meshes go to buffer objects once, meshes rebuilt on the CPU through the streams */
+    if (terrain_upload(&terrain) == -1
+        || buffer_stream_init(&stream_vertices, GL_ARRAY_BUFFER, BUFFER_STREAM_SIZE) == -1
+        || buffer_stream_init(&stream_indices, GL_ELEMENT_ARRAY_BUFFER, BUFFER_STREAM_SIZE) == -1)
+        return -1;
+
+    /* quadtrees and clipmaps for distance based level of detail */
+    if (cdlod_grid_init(&cdlod_grid) == -1 || clipmap_grid_init(&clipmap_grid) == -1)
+        return -1;
+    for (i = 0; i < (int) num_hmaps; ++i) {
+        if (cdlod_init(&cdlods[i], &hmaps[i], TERRAIN_SPACING) == -1
+            || clipmap_init(&clipmaps[i], &hmaps[i], TERRAIN_SPACING) == -1)
+            return -1;
+    }
+
+    /* pages for the streamed tiles, filled as workers decode them */
+    if (streaming && tiletex_init(&tiletex, &tileset, TILES_UPLOAD_BUDGET) == -1)
+        return -1;
 #endif
 
     /* starts the window logic */
@@ -184,6 +343,28 @@ int main(void)
         /* updates window size and camera variables */
         window_update();
 
+        /* stream in tiles around the camera - world to level 0 samples, see gen_vertices */
+        if (streaming) {
+            float x = (camera_pos[0] + (tileset.width - 1) * TERRAIN_SPACING / 2.f) / TERRAIN_SPACING;
+            float y = ((tileset.height - 1) * TERRAIN_SPACING / 2.f - camera_pos[1]) / TERRAIN_SPACING;
+            tileset_update(&tileset, x, y);
+#ifdef USE_GL2
+            tiletex_update(&tiletex, &tileset);
+#endif
+        }
+
+        select_mode();
+        if (select_tolerance() == -1)
+            break;
+
+        /* frustum of this frame's camera, to pick the patches to draw */
+        mat4 mvp;
+        vec4 planes[6];
+        uint32_t drawn = 0;
+        double draw_start = terrain_time();
+        glm_mat4_mul(proj, view, mvp);
+        glm_frustum_planes(mvp, planes);
+
 #ifdef USE_GL2
         /* up */
         if (glfwGetKey(window, GLFW_KEY_MINUS) == GLFW_PRESS) {
@@ -195,18 +376,103 @@ int main(void)
         }
 
         /* set altitude scaling */
-        glUniform1f(glGetUniformLocation(shaderProgram, "alt_scale"), alt_scale);
+        gl_set_uniform1f(u_alt_scale, alt_scale);
+
+        /* patches resample every map onto the grid of the first, CDLOD and the clipmap sample each at its own size */
+        select_map();
+        select_buffers();
+        gl_set_uniform3f(u_camera, camera_pos[0], camera_pos[1], camera_pos[2]);
+        if (draw_all_maps) {
+            float extent = 0.f;
+            uint32_t m;
+            for (m = 0; m < num_hmaps; ++m) {
+                if (hmaps[m].width * TERRAIN_SPACING * 1.1f > extent)
+                    extent = hmaps[m].width * TERRAIN_SPACING * 1.1f;
+            }
+            for (m = 0; m < num_hmaps; ++m)
+                drawn += draw_map(m, (m - (num_hmaps - 1) / 2.f) * extent, planes);
+        } else {
+            drawn += draw_map(active_map, 0.f, planes);
+        }
+#endif
+#ifdef USE_GL1
+        /* draw elements - vertex and color arrays are set per patch, RTIN batch or mesh */
+        if (mode == MODE_RTIN) {
+            rtin_draw(&rtins[0]);
+            drawn += rtins[0].num_indices / 3;
+        } else if (mode == MODE_TIN) {
+            tin_draw(&tin, TERRAIN_SPACING, TERRAIN_SCALE);
+            drawn += tin.num_triangles;
+        } else {
+            terrain_cull(&terrain, planes, camera_pos, 0.f, 255.f * TERRAIN_SCALE, true);
+            terrain_draw(&terrain);
+            drawn += terrain.num_triangles;
+        }
 #endif
 
-        /* draw elements */
-        glDrawElements(GL_TRIANGLE_STRIP, NUM_INDICES, GL_UNSIGNED_INT, &indices[0]);
+        draw_time += terrain_time() - draw_start;
 
         /* draws the frame and checks for draw errors */
         if (window_draw_frame() == -1) {
             break;
         }
+
+        if (frames % 100 == 0) {
+            printf("Triangles drawn: %u\n", drawn);
+#ifdef USE_GL2
+            printf("Draw calls from %s: %.3f ms of CPU per frame, %.1f KB streamed\n",
+                   buffers_enabled ? "buffer objects" : "client arrays", draw_time * 1e3 / 100,
+                   (stream_vertices.bytes_written + stream_indices.bytes_written) / 1024.f);
+            stream_vertices.bytes_written = stream_indices.bytes_written = 0;
+#else
+            printf("Draw calls: %.3f ms of CPU per frame\n", draw_time * 1e3 / 100);
+#endif
+            printf("GL state calls: %.1f issued, %.1f filtered per frame\n", gl_state.issued / 100.f,
+                   gl_state.filtered / 100.f);
+            gl_state.issued = gl_state.filtered = 0;
+            draw_time = 0.;
+        }
+#ifdef USE_GL2
+        if (mode == MODE_CLIPMAP && frames % 100 == 0) {
+            printf("Clipmap texels uploaded this frame: %u bytes in %u rectangles\n",
+                   clipmaps[active_map].bytes_uploaded, clipmaps[active_map].uploads);
+        }
+#endif
+        if (streaming && frames % 100 == 0) {
+            printf("Tiles resident: %u/%u, loaded %u, evicted %u, %.1f MB read\n", tileset_resident(&tileset),
+                   tileset.num_slots, tileset.loads, tileset.evictions, tileset.bytes_read / (1024.f * 1024.f));
+#ifdef USE_GL2
+            printf("Tile uploads: %u (%u from pixel buffers), %.1f KB, at most %.1f KB a frame, %u deferred\n",
+                   tiletex.uploads, tiletex.staged_uploads, tiletex.bytes_uploaded / 1024.f,
+                   tiletex.peak_bytes / 1024.f, tiletex.deferred);
+            tiletex.uploads = tiletex.staged_uploads = tiletex.bytes_uploaded = tiletex.peak_bytes = 0;
+            tiletex.deferred = 0;
+#endif
+        }
     }
 
+    if (streaming)
+        tileset_close(&tileset);
+    terrain_free(&terrain);
+    for (i = 0; i < (int) num_hmaps; ++i)
+        rtin_free(&rtins[i]);
+    if (tin_loaded)
+        tin_close(&tin);
+#ifdef USE_GL2
+    for (i = 0; i < (int) num_hmaps; ++i) {
+        cdlod_free(&cdlods[i]);
+        clipmap_free(&clipmaps[i]);
+    }
+    cdlod_grid_free(&cdlod_grid);
+    clipmap_grid_free(&clipmap_grid);
+    buffer_stream_free(&stream_vertices);
+    buffer_stream_free(&stream_indices);
+    if (streaming)
+        tiletex_free(&tiletex);
+#endif
+    /* buffers and textures above are freed while the context is still current */
     glfwTerminate();
+    for (i = 0; i < (int) num_hmaps; ++i)
+        hmap_close(&hmaps[i]);
     return 0;
 }
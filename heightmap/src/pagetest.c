@@ -0,0 +1,85 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "tiles.h"
+
+/* Checks the page bookkeeping tiletex_upload keeps its tile table with.
+ *
+ * usage: pagetest
+ * the table is modelled as the page each tile's entry names, set and
+ * cleared the way tiletex_upload does, and compared with the pages each
+ * tile was last uploaded to
+ */
+
+#define TEST_PAGES 4
+#define TEST_TILES 8
+
+tile_pages_t pages;
+int32_t table[TEST_TILES];     /* page each tile's entry names, -1 cleared */
+int failures = 0;
+
+/* what tiletex_upload does for tile uploaded to page p */
+void test_upload(int32_t p, int32_t tile) {
+    int32_t lost = tile_pages_assign(&pages, p, tile);
+    if (lost != -1)
+        table[lost] = -1;
+    table[tile] = p;
+}
+
+void test_expect(const char* what, int32_t tile, int32_t page) {
+    if (table[tile] != page || pages.tile_page[tile] != page) {
+        printf("FAILED %s: tile %d names page %d, drawn from %d, expected %d\n", what, tile, table[tile],
+               pages.tile_page[tile], page);
+        ++failures;
+    }
+}
+
+/* true if tiletex_update would upload tile held by slot p */
+int test_pending(int32_t p, int32_t tile) {
+    return pages.page_tile[p] != tile;
+}
+
+int main(void) {
+    const int32_t a = 0, b = 1, t = 2, u = 3;
+    uint32_t i;
+
+    if (tile_pages_init(&pages, TEST_PAGES, TEST_TILES) == -1)
+        return 1;
+    for (i = 0; i < TEST_TILES; ++i)
+        table[i] = -1;
+
+    /* a page reused by another tile stops drawing the old one */
+    test_upload(a, t);
+    test_expect("upload", t, a);
+    test_upload(a, u);
+    test_expect("evicted tile", t, -1);
+    test_expect("new tile", u, a);
+
+    /* T uploaded to A, A evicted and queued for U, T reloaded into B and uploaded before U reaches A */
+    tile_pages_free(&pages);
+    tile_pages_init(&pages, TEST_PAGES, TEST_TILES);
+    for (i = 0; i < TEST_TILES; ++i)
+        table[i] = -1;
+    test_upload(a, t);
+    test_upload(b, t);
+    test_expect("reloaded tile", t, b);
+    if (!test_pending(a, u) || test_pending(b, t)) {
+        printf("FAILED reloaded tile: slot A should wait for U and slot B hold T\n");
+        ++failures;
+    }
+    test_upload(a, u);
+    test_expect("reloaded tile after its old page is reused", t, b);
+    test_expect("tile uploaded to the old page", u, a);
+    if (test_pending(b, t)) {
+        printf("FAILED reloaded tile would be uploaded again\n");
+        ++failures;
+    }
+
+    /* uploading a tile again to its own page keeps it */
+    test_upload(b, t);
+    test_expect("same page", t, b);
+
+    tile_pages_free(&pages);
+    printf("%s\n", failures == 0 ? "page bookkeeping passed" : "page bookkeeping FAILED");
+    return failures != 0;
+}
@@ -0,0 +1,119 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "tiles.h"
+
+/* Compares reading raw tiles with reading and decoding packed tiles.
+ *
+ * usage: tilebench [-t threads] tiles.hmt ...
+ * generate inputs with tools/image2tiles.py -c raw|packed, e.g. for
+ * heightmap_256x256.png, heightmap_257x257.png and iceland_heightmap.png
+ */
+
+#define BENCH_MIN_SECONDS 0.5
+
+typedef struct {
+    tileset_t* set;
+    uint32_t first, last;   /* tile range */
+    bool decode;
+    int result;
+} bench_job_t;
+
+double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+void* bench_worker(void* arg) {
+    bench_job_t* job = arg;
+    tileset_t* set = job->set;
+    uint8_t* scratch = malloc(tile_scratch_size(set));
+    uint8_t* out = malloc(set->tile_bytes);
+    uint32_t t;
+
+    job->result = 0;
+    for (t = job->first; t < job->last; ++t) {
+        const hmt_entry_t* entry = &set->entries[t];
+        if (job->decode) {
+            job->result |= tile_read(set, t, out, scratch);
+        } else if (pread(set->fd, scratch, entry->size, entry->offset) != (ssize_t) entry->size) {
+            job->result = -1;
+        }
+    }
+
+    free(scratch);
+    free(out);
+    return NULL;
+}
+
+/* runs passes over every tile on num_threads threads until BENCH_MIN_SECONDS pass, returns seconds per pass */
+double bench_pass(tileset_t* set, bool decode, uint32_t num_threads) {
+    pthread_t threads[TILESET_MAX_WORKERS];
+    bench_job_t jobs[TILESET_MAX_WORKERS];
+    double start = bench_now(), elapsed;
+    uint32_t i, passes = 0;
+
+    do {
+        for (i = 0; i < num_threads; ++i) {
+            jobs[i].set = set;
+            jobs[i].first = set->num_tiles * i / num_threads;
+            jobs[i].last = set->num_tiles * (i + 1) / num_threads;
+            jobs[i].decode = decode;
+            pthread_create(&threads[i], NULL, bench_worker, &jobs[i]);
+        }
+        for (i = 0; i < num_threads; ++i) {
+            pthread_join(threads[i], NULL);
+            if (jobs[i].result != 0) {
+                printf("ERROR tile read failed\n");
+                return -1.0;
+            }
+        }
+        ++passes;
+        elapsed = bench_now() - start;
+    } while (elapsed < BENCH_MIN_SECONDS);
+
+    return elapsed / passes;
+}
+
+int main(int argc, char** argv) {
+    uint32_t num_threads = 4;
+    int i;
+
+    printf("%-32s %10s %10s %12s %12s %12s\n", "file", "disk MB", "tile MB", "read MB/s", "decode MB/s", "threads MB/s");
+    for (i = 1; i < argc; ++i) {
+        tileset_t set;
+        uint64_t disk_bytes = 0, tile_bytes;
+        double read_time, decode_time, threaded_time;
+        uint32_t t;
+
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            num_threads = atoi(argv[++i]);
+            if (num_threads < 1 || num_threads > TILESET_MAX_WORKERS)
+                num_threads = 4;
+            continue;
+        }
+
+        if (tileset_open(&set, argv[i], 0.f, 0) == -1)
+            return -1;
+
+        for (t = 0; t < set.num_tiles; ++t)
+            disk_bytes += set.entries[t].size;
+        tile_bytes = (uint64_t) set.num_tiles * set.tile_bytes;
+
+        /* throughput is in decoded tile bytes so the codecs compare directly */
+        read_time = bench_pass(&set, false, 1);
+        decode_time = bench_pass(&set, true, 1);
+        threaded_time = bench_pass(&set, true, num_threads);
+        if (read_time < 0 || decode_time < 0 || threaded_time < 0)
+            return -1;
+
+        printf("%-32s %10.2f %10.2f %12.1f %12.1f %12.1f\n", argv[i], disk_bytes / 1e6, tile_bytes / 1e6,
+               tile_bytes / 1e6 / read_time, tile_bytes / 1e6 / decode_time, tile_bytes / 1e6 / threaded_time);
+
+        tileset_close(&set);
+    }
+
+    return 0;
+}
@@ -0,0 +1,212 @@
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "strip.h"
+#include "vcache.h"
+#include "vertex.h"
+
+/* Compares the GL1 terrain vertex formats - the float position and color
+ * streams against the packed record of vertex.h. GL1 client arrays are read
+ * by the driver on every draw, so a frame is timed as gathering every vertex
+ * the patch strips index, the way the driver copies them out.
+ *
+ * usage: vertexbench
+ * maps are synthetic at the sizes of the sample heightmaps
+ */
+
+#define BENCH_MIN_SECONDS 0.5
+/* same patches and strip order as terrain.h */
+#define BENCH_PATCH_SIZE  128u
+#define BENCH_STRIP_BLOCK (VCACHE_SIZE / 2 - 2)
+
+const uint32_t sizes[][2] = { /* width, height */
+    { 256, 256 }, { 257, 257 }, { 2624, 1756 },
+};
+
+/* world units between samples and per altitude step, as in main.c */
+#define BENCH_SPACING 0.1f
+#define BENCH_SCALE   0.01f
+
+typedef float vec3_t[3];
+
+typedef struct {
+    uint32_t width, height, patches_x, patches_y, num_patches, patch_vertices;
+    vec3_t* positions;
+    vec3_t* colors;
+    vertex_packed_t* packed;
+    uint16_t* indices;
+    uint32_t num_indices;
+} bench_map_t;
+
+double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* rolling hills with 16 bit detail, in 8 bit steps */
+float bench_altitude(uint32_t w, uint32_t h) {
+    return 127.5f + 60.f * sinf(w * 0.031f) * cosf(h * 0.017f) + 60.f * sinf((w + 2 * h) * 0.0043f) + (w * 7 + h * 13) % 256 / 257.f;
+}
+
+int bench_map_init(bench_map_t* map, uint32_t width, uint32_t height) {
+    uint32_t size = BENCH_PATCH_SIZE, p, r, c;
+    float w_offset = (width - 1) * BENCH_SPACING / 2.f, h_offset = (height - 1) * BENCH_SPACING / 2.f;
+    size_t num_vertices;
+
+    map->width = width;
+    map->height = height;
+    map->patches_x = (width - 2) / size + 1;
+    map->patches_y = (height - 2) / size + 1;
+    map->num_patches = map->patches_x * map->patches_y;
+    map->patch_vertices = (size + 1) * (size + 1);
+    map->num_indices = strip_blocked_num_indices(size + 1, size + 1, BENCH_STRIP_BLOCK);
+    num_vertices = (size_t) map->num_patches * map->patch_vertices;
+
+    map->positions = malloc(num_vertices * sizeof(vec3_t));
+    map->colors = malloc(num_vertices * sizeof(vec3_t));
+    map->packed = malloc(num_vertices * sizeof(vertex_packed_t));
+    map->indices = malloc(map->num_indices * sizeof(uint16_t));
+    if (map->positions == NULL || map->colors == NULL || map->packed == NULL || map->indices == NULL) {
+        printf("ERROR could not allocate %ux%u map\n", width, height);
+        return -1;
+    }
+    gen_strip_blocked(map->indices, size + 1, size + 1, BENCH_STRIP_BLOCK);
+
+    for (p = 0; p < map->num_patches; ++p) {
+        for (r = 0; r <= size; ++r) {
+            for (c = 0; c <= size; ++c) {
+                size_t v = (size_t) p * map->patch_vertices + r * (size + 1) + c;
+                uint32_t h = (p / map->patches_x) * size + r, w = (p % map->patches_x) * size + c;
+                float alt;
+                if (h > height - 1)
+                    h = height - 1;
+                if (w > width - 1)
+                    w = width - 1;
+                alt = bench_altitude(w, h);
+
+                map->positions[v][0] = BENCH_SPACING * w - w_offset;
+                map->positions[v][1] = h_offset - BENCH_SPACING * h;
+                map->positions[v][2] = alt * BENCH_SCALE;
+                map->colors[v][0] = map->colors[v][1] = map->colors[v][2] = alt / 255.f;
+                vertex_pack(&map->packed[v], w, h, alt);
+            }
+        }
+    }
+    return 0;
+}
+
+void bench_map_free(bench_map_t* map) {
+    free(map->positions);
+    free(map->colors);
+    free(map->packed);
+    free(map->indices);
+}
+
+/* largest world space distance between a float vertex and its packed one, through the terrain_draw modelview */
+float bench_max_error(const bench_map_t* map) {
+    size_t v, num_vertices = (size_t) map->num_patches * map->patch_vertices;
+    float w_offset = (map->width - 1) * BENCH_SPACING / 2.f, h_offset = (map->height - 1) * BENCH_SPACING / 2.f;
+    float error = 0.f;
+
+    for (v = 0; v < num_vertices; ++v) {
+        const vertex_packed_t* q = &map->packed[v];
+        float d[3] = {
+            q->x * BENCH_SPACING - w_offset - map->positions[v][0],
+            h_offset - q->y * BENCH_SPACING - map->positions[v][1],
+            q->z * BENCH_SCALE / VERTEX_Z_STEPS - map->positions[v][2],
+        };
+        float e = sqrtf(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+        if (e > error)
+            error = e;
+    }
+    return error;
+}
+
+/* one frame of every patch - returns bytes of vertex data read */
+size_t bench_frame_float(const bench_map_t* map, vec3_t* out) {
+    uint32_t p, i;
+    size_t bytes = 0;
+
+    for (p = 0; p < map->num_patches; ++p) {
+        const vec3_t* positions = map->positions + (size_t) p * map->patch_vertices;
+        const vec3_t* colors = map->colors + (size_t) p * map->patch_vertices;
+        for (i = 0; i < map->num_indices; ++i) {
+            memcpy(out[2 * i], positions[map->indices[i]], sizeof(vec3_t));
+            memcpy(out[2 * i + 1], colors[map->indices[i]], sizeof(vec3_t));
+        }
+        bytes += (size_t) map->num_indices * 2 * sizeof(vec3_t);
+    }
+    return bytes;
+}
+
+size_t bench_frame_packed(const bench_map_t* map, vertex_packed_t* out) {
+    uint32_t p, i;
+    size_t bytes = 0;
+
+    for (p = 0; p < map->num_patches; ++p) {
+        const vertex_packed_t* packed = map->packed + (size_t) p * map->patch_vertices;
+        for (i = 0; i < map->num_indices; ++i)
+            out[i] = packed[map->indices[i]];
+        bytes += (size_t) map->num_indices * sizeof(vertex_packed_t);
+    }
+    return bytes;
+}
+
+/* seconds per frame and bytes read per frame of one format */
+double bench_frames(const bench_map_t* map, bool packed, void* out, size_t* bytes) {
+    uint32_t frames = 0;
+    double start = bench_now(), elapsed;
+
+    do {
+        *bytes = packed ? bench_frame_packed(map, out) : bench_frame_float(map, out);
+        ++frames;
+        elapsed = bench_now() - start;
+    } while (elapsed < BENCH_MIN_SECONDS);
+
+    return elapsed / frames;
+}
+
+int main(void) {
+    uint32_t s;
+    int result = 0;
+
+    printf("%-12s %8s %10s %12s %12s %12s %12s %8s %10s\n", "size", "patches", "vertices", "float MB",
+           "packed MB", "float ms", "packed ms", "speedup", "max error");
+    for (s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        bench_map_t map;
+        size_t float_bytes, packed_bytes;
+        double float_time, packed_time;
+        void* out;
+        char size[32];
+
+        if (bench_map_init(&map, sizes[s][0], sizes[s][1]) == -1)
+            return -1;
+        out = malloc(map.num_indices * 2 * sizeof(vec3_t));
+        if (out == NULL) {
+            printf("ERROR could not allocate gather buffer\n");
+            return -1;
+        }
+
+        float_time = bench_frames(&map, false, out, &float_bytes);
+        packed_time = bench_frames(&map, true, out, &packed_bytes);
+        snprintf(size, sizeof(size), "%ux%u", map.width, map.height);
+        printf("%-12s %8u %10zu %12.2f %12.2f %12.3f %12.3f %7.1fx %10.5f\n", size, map.num_patches,
+               (size_t) map.num_patches * map.patch_vertices, float_bytes / (1024. * 1024.),
+               packed_bytes / (1024. * 1024.), float_time * 1e3, packed_time * 1e3, float_time / packed_time,
+               bench_max_error(&map));
+        if (2 * packed_bytes > float_bytes) {
+            printf("ERROR packed vertices read more than half the bytes of float ones\n");
+            result = -1;
+        }
+
+        free(out);
+        bench_map_free(&map);
+    }
+
+    return result;
+}
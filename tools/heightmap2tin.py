@@ -0,0 +1,290 @@
+#! /usr/bin/python3
+
+import argparse
+import heapq
+import os
+import struct
+import sys
+import numpy as np
+from PIL import Image
+
+from image2header import get_samples, get_samples16
+from image2tiles import get_level
+
+# .tin mesh layout - must match heightmap/include/tin.h
+TIN_MAGIC = b"HTIN"
+TIN_VERSION = 1
+TIN_HEADER_FORMAT = "<4sHHIIIIIIf"
+TIN_ALIGNMENT = 64 # vertex and index arrays start on a cache line
+TIN_VERTEX_FORMAT = np.dtype([("x", "<f4"), ("y", "<f4"), ("z", "<f4"), ("rgba", "u1", 4)])
+
+# tolerance on barycentric coordinates when placing samples in triangles
+BARY_EPSILON = 1e-6
+# (triangle, sample) pairs tested at once when measuring the error of a mesh
+SAMPLE_CHUNK = 1 << 22
+
+# edges of the map a vertex lies on, as bits - a vertex only collapses along the edges it is on
+SIDE_LEFT, SIDE_RIGHT, SIDE_TOP, SIDE_BOTTOM = 1, 2, 4, 8
+
+class Decimator:
+    """greedy half edge collapse of the full sample grid - each vertex is queued with the cheapest collapse onto a
+    neighbour by the summed plane quadrics, and a collapse is only made if it keeps every sample the mesh has dropped
+    within max_error of the surface vertically, and keeps the map outline and every triangle unflipped
+
+    the per vertex bookkeeping is in plain lists, numpy only places the dropped samples - most of the work is small"""
+
+    def __init__(self, heights: np.ndarray, max_error: float):
+        (h,w) = heights.shape
+        self.width, self.height = w, h
+        self.max_error = max_error
+        self.xs = np.tile(np.arange(w, dtype=np.float64), h)
+        self.ys = np.repeat(np.arange(h, dtype=np.float64), w)
+        self.zs = heights.astype(np.float64).ravel()
+        (self.x, self.y, self.z) = (self.xs.tolist(), self.ys.tolist(), self.zs.tolist())
+        self.side = ((self.xs == 0) * SIDE_LEFT + (self.xs == w - 1) * SIDE_RIGHT
+                     + (self.ys == 0) * SIDE_TOP + (self.ys == h - 1) * SIDE_BOTTOM).tolist()
+
+        # two triangles per quad, both with positive area in (column, row)
+        v = np.arange(h * w).reshape(h, w)
+        (a, b, c, d) = (v[:-1, :-1].ravel(), v[:-1, 1:].ravel(), v[1:, :-1].ravel(), v[1:, 1:].ravel())
+        tris = np.concatenate([np.stack([a, b, c], axis=1), np.stack([b, d, c], axis=1)])
+        self.quadrics = self.get_quadrics(tris).tolist()
+        self.tris = tris.tolist()
+        self.alive = [True] * len(self.tris)
+
+        self.vertex_tris = [set() for _ in range(h * w)]
+        for (t, tri) in enumerate(self.tris):
+            for i in tri:
+                self.vertex_tris[i].add(t)
+        self.removed = [False] * (h * w)
+        self.version = [0] * (h * w)
+        # samples dropped from the mesh, by the triangle they lie in
+        self.tri_samples = {}
+
+    def get_quadrics(self, tris: np.ndarray) -> np.ndarray:
+        """per vertex sum of the plane quadrics of its triangles, as the 10 unique terms"""
+        p = np.stack([self.xs, self.ys, self.zs], axis=1)[tris]
+        n = np.cross(p[:, 1] - p[:, 0], p[:, 2] - p[:, 0])
+        n /= np.linalg.norm(n, axis=1, keepdims=True)
+        d = -(n * p[:, 0]).sum(axis=1)
+        (a, b, c) = (n[:, 0], n[:, 1], n[:, 2])
+        k = np.stack([a*a, a*b, a*c, a*d, b*b, b*c, b*d, c*c, c*d, d*d], axis=1)
+        q = np.zeros((len(self.xs), 10))
+        for i in range(3):
+            np.add.at(q, tris[:, i], k)
+        return q
+
+    def cost(self, u: int, v: int) -> float:
+        (a2, ab, ac, ad, b2, bc, bd, c2, cd, d2) = [p + q for (p, q) in zip(self.quadrics[u], self.quadrics[v])]
+        (x, y, z) = (self.x[v], self.y[v], self.z[v])
+        return (a2*x*x + 2*ab*x*y + 2*ac*x*z + 2*ad*x + b2*y*y + 2*bc*y*z + 2*bd*y + c2*z*z + 2*cd*z + d2)
+
+    def neighbours(self, u: int) -> set:
+        tris = self.tris
+        return {i for t in self.vertex_tris[u] for i in tris[t]} - {u}
+
+    def targets(self, u: int) -> list:
+        """(cost, v) of every neighbour u may collapse onto, cheapest first"""
+        side = self.side
+        return sorted((self.cost(u, v), v) for v in self.neighbours(u) if side[u] & ~side[v] == 0)
+
+    def push(self, heap: list, u: int):
+        targets = self.targets(u)
+        if targets:
+            heapq.heappush(heap, (targets[0][0], u, self.version[u]))
+
+    def try_collapse(self, u: int, v: int) -> bool:
+        """moves u onto v if the result is valid, returns False and changes nothing otherwise"""
+        fan = list(self.vertex_tris[u])
+        gone = [t for t in fan if v in self.tris[t]]
+        kept = [t for t in fan if v not in self.tris[t]]
+
+        # a manifold collapse removes one triangle per shared neighbour - two inside, one along the outline
+        shared = self.neighbours(u) & self.neighbours(v)
+        if len(shared) != len(gone) or not gone:
+            return False
+
+        # the triangles that move must keep their winding and some area
+        new = np.array([self.tris[t] for t in kept])
+        new[new == u] = v
+        (px, py) = (self.xs[new], self.ys[new])
+        area = (px[:, 1] - px[:, 0]) * (py[:, 2] - py[:, 0]) - (px[:, 2] - px[:, 0]) * (py[:, 1] - py[:, 0])
+        if (area <= 0).any():
+            return False
+
+        # every dropped sample around u, and u itself, must land in a new triangle within the error
+        samples = np.concatenate([np.array([u])] + [self.tri_samples[t] for t in fan if t in self.tri_samples])
+        (sx, sy) = (self.xs[samples][:, None], self.ys[samples][:, None])
+        l1 = ((py[:, 1] - py[:, 2]) * (sx - px[:, 2]) + (px[:, 2] - px[:, 1]) * (sy - py[:, 2])) / area
+        l2 = ((py[:, 2] - py[:, 0]) * (sx - px[:, 2]) + (px[:, 0] - px[:, 2]) * (sy - py[:, 2])) / area
+        l3 = 1 - l1 - l2
+        inside = (l1 >= -BARY_EPSILON) & (l2 >= -BARY_EPSILON) & (l3 >= -BARY_EPSILON)
+        if not inside.any(axis=1).all():
+            return False
+        owner = inside.argmax(axis=1)
+        rows = np.arange(len(samples))
+        pz = self.zs[new]
+        z = l1[rows, owner] * pz[owner, 0] + l2[rows, owner] * pz[owner, 1] + l3[rows, owner] * pz[owner, 2]
+        if np.abs(z - self.zs[samples]).max() > self.max_error:
+            return False
+
+        # commit
+        for t in fan:
+            self.tri_samples.pop(t, None)
+        for t in gone:
+            self.alive[t] = False
+            for i in self.tris[t]:
+                self.vertex_tris[i].discard(t)
+        for (i, t) in enumerate(kept):
+            self.tris[t] = new[i].tolist()
+            self.vertex_tris[v].add(t)
+            mine = samples[owner == i]
+            if len(mine):
+                self.tri_samples[t] = mine
+        self.vertex_tris[u].clear()
+        self.removed[u] = True
+        self.quadrics[v] = [p + q for (p, q) in zip(self.quadrics[u], self.quadrics[v])]
+        return True
+
+    def run(self):
+        heap = []
+        for u in range(len(self.x)):
+            self.push(heap, u)
+
+        collapses = 0
+        while heap:
+            (_, u, version) = heapq.heappop(heap)
+            if self.removed[u] or version != self.version[u]:
+                continue
+            for (_, v) in self.targets(u):
+                if self.try_collapse(u, v):
+                    break
+            else:
+                continue # stuck until a neighbour's collapse changes its fan
+
+            collapses += 1
+            if collapses % 100000 == 0:
+                print(f"  {collapses} collapses, {len(self.x) - collapses} vertices left")
+            # every vertex whose fan changed is queued again with fresh costs
+            for i in self.neighbours(v) | {v}:
+                self.version[i] += 1
+                self.push(heap, i)
+
+    def get_mesh(self) -> (np.ndarray, np.ndarray):
+        """(kept vertex ids, triangles indexing into them)"""
+        kept = np.flatnonzero(~np.array(self.removed))
+        remap = np.full(len(self.x), -1, dtype=np.int64)
+        remap[kept] = np.arange(len(kept))
+        return (kept, remap[np.array(self.tris)[np.array(self.alive)]])
+
+def get_tin_mesh(decimator: Decimator, step: int, width: int, height: int) -> (np.ndarray, np.ndarray):
+    """(vertices, triangles) in samples of the full (width, height) map - the last row and column of a level always
+    land on the last ones of the map, see get_level"""
+    (kept, tris) = decimator.get_mesh()
+    # positions in samples and altitude steps - tin.h scales them to world units
+    vertices = np.zeros(len(kept), dtype=TIN_VERTEX_FORMAT)
+    vertices["x"] = np.minimum(decimator.xs[kept] * step, width - 1)
+    vertices["y"] = np.minimum(decimator.ys[kept] * step, height - 1)
+    vertices["z"] = decimator.zs[kept]
+    grey = np.clip(np.rint(decimator.zs[kept]), 0, 255).astype(np.uint8)
+    vertices["rgba"] = np.stack([grey, grey, grey, np.full_like(grey, 255)], axis=1)
+    return (vertices, tris)
+
+def get_mesh_error(vertices: np.ndarray, tris: np.ndarray, heights: np.ndarray) -> float:
+    """largest vertical distance between the mesh and any sample of the full resolution map - a mesh decimated from
+    a level only knows that level's samples, the ones it skipped can be anywhere
+
+    every sample in a triangle's bounding box is tested against it, a chunk of triangles at a time"""
+    (px, py, pz) = (vertices["x"].astype(np.float64)[tris], vertices["y"].astype(np.float64)[tris],
+                    vertices["z"].astype(np.float64)[tris])
+    (x0, x1) = (np.floor(px.min(axis=1)).astype(np.int64), np.ceil(px.max(axis=1)).astype(np.int64))
+    (y0, y1) = (np.floor(py.min(axis=1)).astype(np.int64), np.ceil(py.max(axis=1)).astype(np.int64))
+    (bw, counts) = (x1 - x0 + 1, (x1 - x0 + 1) * (y1 - y0 + 1))
+    area = (px[:, 1] - px[:, 0]) * (py[:, 2] - py[:, 0]) - (px[:, 2] - px[:, 0]) * (py[:, 1] - py[:, 0])
+    ends = np.cumsum(counts)
+
+    worst = 0.0
+    covered = np.zeros(heights.shape, dtype=bool)
+    first = 0
+    while first < len(tris):
+        last = max(int(np.searchsorted(ends, ends[first] - counts[first] + SAMPLE_CHUNK, side="right")), first + 1)
+        t = np.repeat(np.arange(first, last), counts[first:last])
+        local = np.arange(len(t)) - np.repeat(ends[first:last] - counts[first:last] - (ends[first] - counts[first]),
+                                              counts[first:last])
+        (sx, sy) = (x0[t] + local % bw[t], y0[t] + local // bw[t])
+        l1 = ((py[t, 1] - py[t, 2]) * (sx - px[t, 2]) + (px[t, 2] - px[t, 1]) * (sy - py[t, 2])) / area[t]
+        l2 = ((py[t, 2] - py[t, 0]) * (sx - px[t, 2]) + (px[t, 0] - px[t, 2]) * (sy - py[t, 2])) / area[t]
+        l3 = 1 - l1 - l2
+        inside = (l1 >= -BARY_EPSILON) & (l2 >= -BARY_EPSILON) & (l3 >= -BARY_EPSILON)
+        (t, sx, sy) = (t[inside], sx[inside], sy[inside])
+        z = l1[inside] * pz[t, 0] + l2[inside] * pz[t, 1] + l3[inside] * pz[t, 2]
+        if len(z):
+            worst = max(worst, float(np.abs(z - heights[sy, sx]).max()))
+        covered[sy, sx] = True
+        first = last
+
+    if not covered.all():
+        print(f"WARNING mesh leaves {np.count_nonzero(~covered)} samples of the map uncovered")
+    return worst
+
+def get_tin_bytes(vertices: np.ndarray, tris: np.ndarray, width: int, height: int, max_error: float) -> bytes:
+    indices = tris.astype("<u4").ravel()
+
+    vertex_offset = TIN_ALIGNMENT
+    index_offset = -(-(vertex_offset + vertices.nbytes) // TIN_ALIGNMENT) * TIN_ALIGNMENT
+    header = struct.pack(TIN_HEADER_FORMAT, TIN_MAGIC, TIN_VERSION, 0, width, height, len(vertices), len(tris),
+                         vertex_offset, index_offset, max_error)
+
+    return (header.ljust(vertex_offset, b"\0") + vertices.tobytes()).ljust(index_offset, b"\0") + indices.tobytes()
+
+if __name__ == "__main__":
+    # parse arguments
+    parser = argparse.ArgumentParser(description="Decimates a heightmap image into a triangulated irregular network")
+    parser.add_argument('image', help="The image file to convert")
+    parser.add_argument('-e', '--error', type=float, default=1.0,
+                        help="largest vertical error allowed, in 8 bit altitude steps")
+    parser.add_argument('-s', '--step', type=int, default=0,
+                        help="decimate every 2^step-th sample, for maps too large to decimate at full resolution - "
+                             "the error bound then only holds for those samples, the mesh records the one measured "
+                             "against every sample")
+    parser.add_argument('-n', '--name', help="The name of the output file")
+    parser.add_argument('-p', '--path', help="The path to the output directory of the mesh")
+    parser.add_argument('-b', '--bits', type=int, choices=[8, 16], default=8,
+                        help="bits per sample read from the image")
+    args = parser.parse_args()
+
+    # get the file's name if no name is provided
+    if args.name is None:
+        args.name = os.path.splitext(os.path.basename(args.image))[0]
+    if args.path is None:
+        args.path = "."
+
+    # get altitudes in 8 bit steps - 16 bit samples keep their precision as a fraction, as hmap_altitude does
+    with Image.open(args.image) as im:
+        (w, h) = im.size
+        print(f'Opened "{args.image}": {im.format}, {w}x{h}, {im.mode}')
+        if args.bits == 16:
+            samples = get_samples16(im) / 257.0
+        else:
+            samples = get_samples(im).astype(np.float64)
+    heights = get_level(samples, args.step)
+
+    (lh,lw) = heights.shape
+    print(f"Decimating {lw}x{lh} samples to within {args.error} altitude steps")
+    decimator = Decimator(heights, args.error)
+    decimator.run()
+    (vertices, tris) = get_tin_mesh(decimator, 1 << args.step, w, h)
+    print(f"{len(vertices)} vertices, {len(tris)} triangles - {100.0 * len(tris) / (2 * (lw - 1) * (lh - 1)):.1f}% of the grid")
+
+    # the header holds the error against the full map, not the bound asked for
+    max_error = get_mesh_error(vertices, tris, samples)
+    print(f"Largest error against all {w}x{h} samples: {max_error:.2f} altitude steps")
+    if max_error > args.error + 1e-3:
+        print(f"WARNING {max_error:.2f} steps is above the {args.error} asked for, from samples the step skipped")
+
+    os.makedirs(args.path, exist_ok=True)
+    out_path = os.path.join(args.path, f"{args.name}.tin")
+    with open(out_path, 'wb') as outfile:
+        print(f'Writing mesh to "{out_path}"')
+        outfile.write(get_tin_bytes(vertices, tris, w, h, max_error))
+    sys.exit(0)
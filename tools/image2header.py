@@ -4,52 +4,50 @@ import argparse
 import math
 import sys
 import os
+import struct
+import numpy as np
 from PIL import Image
 
-def get_pixel_string(image: Image) -> str:
-    pixels = image.load()
-    mode = image.mode
-    (w,h) = image.size
-
-    pixel_str = ""
-    for j in range(h):
-        pixel_str += "\t{ "
-        for i in range(w):
-            pixel = pixels[i,j]
-            if mode == "RGBA":
-                (r, g, b, a) = pixel
-                # pixel_str += f"{{{r}u, {g}u, {b}u, {a}u}}"
-                if r == g and g == b:
-                    lum = r
-                else:
-                    lum = round((r + g + b) / 3)
-                pixel_str += f"{lum}u"
-            elif mode == "RGB":
-                (r, g, b) = pixel
-                # pixel_str += f"{{{r}u, {g}u, {b}u}}"
-                if r == g and g == b:
-                    lum = r
-                else:
-                    lum = round((r + g + b) / 3)
-                pixel_str += f"{lum}u"
-            else:
-                pixel_str += f"{pixel}u"
-            
-            # add bracket at end of line
-            if i == w - 1:
-                pixel_str += " }"
-            # add comma between each pixel
-            if i != w - 1 or j != h - 1:
-                pixel_str += ", "
-        if j != h -1:
-            pixel_str += "\n"
-    
-    return pixel_str
-
-def get_header_string(name: str, image: Image) -> str:
-    (w,h) = image.size
+# .hmap container layout - must match heightmap/include/hmap.h
+HMAP_MAGIC = b"HMAP"
+HMAP_VERSION = 1
+HMAP_U8 = 1
+HMAP_U16 = 2
+HMAP_HEADER_FORMAT = "<4sHHIIII"
+HMAP_ALIGNMENT = 4  # row alignment, default GL_UNPACK_ALIGNMENT
+HMAP_DATA_OFFSET = 64 # keeps the first row cache line aligned
+
+# decimal literal for every byte value, indexed by the sample
+PIXEL_LITERALS = np.array([f"{i}u" for i in range(256)])
+
+def get_samples(image: Image) -> np.ndarray:
+    """returns the image as a (h, w) uint8 array of luminance samples"""
+    pixels = np.asarray(image)
+    if image.mode not in ("RGBA", "RGB"):
+        return pixels.astype(np.uint8)
+
+    rgb = pixels[..., :3].astype(np.uint16)
+    (r, g, b) = (rgb[..., 0], rgb[..., 1], rgb[..., 2])
+    # grey pixels pass through, coloured pixels are averaged
+    # (r + g + b) / 3 never lands on .5 so rounding mode does not matter
+    lum = np.rint(rgb.sum(axis=-1) / 3).astype(np.uint8)
+    grey = (r == g) & (g == b)
+    return np.where(grey, r, lum).astype(np.uint8)
+
+def get_samples16(image: Image) -> np.ndarray:
+    """returns the image as a (h, w) uint16 array, 8 bit sources are stretched to the full range"""
+    if image.mode.startswith("I"):
+        return np.clip(np.asarray(image), 0, 65535).astype(np.uint16)
+    return get_samples(image).astype(np.uint16) * 257
+
+def get_pixel_string(samples: np.ndarray) -> str:
+    # one join per row and one for the whole image - linear in the pixel count
+    rows = [f"\t{{ {', '.join(PIXEL_LITERALS[row])} }}" for row in samples]
+    return ", \n".join(rows)
+
+def get_header_string(name: str, samples: np.ndarray, body: str) -> str:
+    (h,w) = samples.shape
     m_name = name.upper() # macro name
-    v_name = name.lower() # variable name
 
     parr = ""
     bytes_per_pixel = 1
@@ -71,34 +69,113 @@ def get_header_string(name: str, image: Image) -> str:
     f"#define {m_name}_NUM_PIXELS {w*h}u",
     f"#define {m_name}_SIZE_BYTES {w*h*bytes_per_pixel}u",
     "",
-    f"const uint8_t {v_name}_pixels[{h}][{w}]{parr} = {{",
-    get_pixel_string(image),
-    "};",
+    body,
     "",
     f"#endif /* _{m_name}_H_ */"
     ])
 
     return header_string
 
+def get_array_body(name: str, samples: np.ndarray) -> str:
+    (h,w) = samples.shape
+    return "\n".join([
+    f"const uint8_t {name.lower()}_pixels[{h}][{w}] = {{",
+    get_pixel_string(samples),
+    "};"
+    ])
+
+def get_blob_body(name: str, samples: np.ndarray, bin_path: str) -> str:
+    (h,w) = samples.shape
+    m_name = name.upper()
+    v_name = name.lower()
+    # #embed searches next to the header, .incbin relative to where the compiler runs
+    embed_path = os.path.basename(bin_path)
+    return "\n".join([
+    f"/* raw samples are linked in from \"{bin_path}\" (.incbin path is relative to where the compiler runs) */",
+    "#if defined(__has_embed)",
+    f"#if __has_embed(\"{embed_path}\")",
+    f"#define {m_name}_EMBED",
+    f"const uint8_t {v_name}_pixels[{h}][{w}] = {{",
+    f"#embed \"{embed_path}\"",
+    "};",
+    "#endif",
+    "#endif",
+    "",
+    f"#ifndef {m_name}_EMBED",
+    "__asm__(",
+    "    \".section .rodata\\n\"",
+    "    \".balign 64\\n\"",
+    f"    \".global {v_name}_pixels\\n\"",
+    f"    \".type {v_name}_pixels, @object\\n\"",
+    f"    \"{v_name}_pixels:\\n\"",
+    f"    \".incbin \\\"{bin_path}\\\"\\n\"",
+    f"    \".size {v_name}_pixels, .-{v_name}_pixels\\n\"",
+    "    \".previous\\n\"",
+    ");",
+    f"extern const uint8_t {v_name}_pixels[{h}][{w}];",
+    "#endif"
+    ])
+
+def get_hmap_bytes(samples: np.ndarray) -> bytes:
+    (h,w) = samples.shape
+    sample_type = HMAP_U16 if samples.dtype == np.uint16 else HMAP_U8
+
+    row_size = w * samples.itemsize
+    stride = (row_size + HMAP_ALIGNMENT - 1) // HMAP_ALIGNMENT * HMAP_ALIGNMENT
+    header = struct.pack(HMAP_HEADER_FORMAT, HMAP_MAGIC, HMAP_VERSION, sample_type, w, h, stride, HMAP_DATA_OFFSET)
+
+    # samples are little endian on disk
+    rows = np.zeros((h, stride), dtype=np.uint8)
+    rows[:, :row_size] = samples.astype(samples.dtype.newbyteorder("<")).view(np.uint8).reshape(h, row_size)
+
+    return header.ljust(HMAP_DATA_OFFSET, b"\0") + rows.tobytes()
+
 if __name__ == "__main__":
     # parse arguments
     parser = argparse.ArgumentParser()
     parser.add_argument('image', help="The image file to convert")
     parser.add_argument('-n', '--name', help="The name of the output file")
     parser.add_argument('-p', '--path', help="The path to the output directory of the header")
+    parser.add_argument('-f', '--format', choices=["header", "blob", "hmap"], default="header",
+                        help="header: C initializer list, blob: raw .bin linked in by a small header, "
+                             "hmap: binary heightmap loaded at runtime")
+    parser.add_argument('-b', '--bits', type=int, choices=[8, 16], default=8,
+                        help="bits per sample of hmap output")
     args = parser.parse_args()
 
     # get the file's name if no name is provided
     if args.name is None:
-        args.name = args.image.split('.')[0]
+        args.name = os.path.splitext(os.path.basename(args.image))[0]
     if args.path is None:
-        args.path = ""
+        args.path = "."
 
     # get pixel values
     with Image.open(args.image) as im:
         (w, h) = im.size
         print(f'Opened "{args.image}": {im.format}, {w}x{h}, {im.mode}')
-        os.makedirs(args.path, exist_ok=True)
-        with open(f"{args.path}/{args.name}.h", 'w') as outfile:
-            print(f'Writing image header to "{args.path}/{args.name}.h"')
-            print(get_header_string(args.name, im), file=outfile)
+        if args.format == "hmap" and args.bits == 16:
+            samples = get_samples16(im)
+        else:
+            samples = get_samples(im)
+
+    os.makedirs(args.path, exist_ok=True)
+    if args.format == "hmap":
+        out_path = os.path.join(args.path, f"{args.name}.hmap")
+        with open(out_path, 'wb') as outfile:
+            print(f'Writing heightmap to "{out_path}"')
+            outfile.write(get_hmap_bytes(samples))
+        sys.exit(0)
+
+    if args.format == "blob":
+        bin_path = os.path.join(args.path, f"{args.name}.bin")
+        with open(bin_path, 'wb') as outfile:
+            print(f'Writing image samples to "{bin_path}"')
+            outfile.write(samples.tobytes())
+        body = get_blob_body(args.name, samples, bin_path)
+    else:
+        body = get_array_body(args.name, samples)
+
+    out_path = os.path.join(args.path, f"{args.name}.h")
+    with open(out_path, 'w') as outfile:
+        print(f'Writing image header to "{out_path}"')
+        print(get_header_string(args.name, samples, body), file=outfile)
@@ -0,0 +1,135 @@
+#! /usr/bin/python3
+
+import argparse
+import os
+import struct
+import numpy as np
+from PIL import Image
+
+from image2header import get_samples, get_samples16, HMAP_U8, HMAP_U16
+
+# .hmt tiled heightmap layout - must match heightmap/include/tiles.h
+HMT_MAGIC = b"HMT1"
+HMT_VERSION = 1
+HMT_HEADER_FORMAT = "<4sHHIIHHIII"
+HMT_HEADER_SIZE = 32
+HMT_ENTRY_FORMAT = "<QIHH"
+HMT_ALIGNMENT = 64 # tile payloads start on a cache line
+TILE_CODEC_RAW = 0
+TILE_CODEC_PACKED = 1
+CODECS = {"raw": TILE_CODEC_RAW, "packed": TILE_CODEC_PACKED}
+
+def get_level(samples: np.ndarray, level: int) -> np.ndarray:
+    """every 2^level-th sample, keeping the last row and column so the level spans the whole map"""
+    (h,w) = samples.shape
+    step = 1 << level
+    rows = np.minimum(np.arange(-(-(h - 1) // step) + 1) * step, h - 1)
+    cols = np.minimum(np.arange(-(-(w - 1) // step) + 1) * step, w - 1)
+    return samples[np.ix_(rows, cols)]
+
+def get_tiles(samples: np.ndarray, tile_size: int):
+    """yields (level, tx, ty, tile) for every tile, coarsest level last"""
+    level = 0
+    while True:
+        grid = get_level(samples, level)
+        (h,w) = grid.shape
+        tiles_y = -(-(h - 1) // tile_size)
+        tiles_x = -(-(w - 1) // tile_size)
+        for ty in range(tiles_y):
+            for tx in range(tiles_x):
+                # (tile_size + 1)^2 samples - neighbouring tiles share their border row/column
+                tile = grid[ty*tile_size : ty*tile_size + tile_size + 1, tx*tile_size : tx*tile_size + tile_size + 1]
+                pad = ((0, tile_size + 1 - tile.shape[0]), (0, tile_size + 1 - tile.shape[1]))
+                yield (level, tx, ty, np.pad(tile, pad, mode="edge"))
+        if tiles_x == 1 and tiles_y == 1:
+            break
+        level += 1
+
+def encode_tile_packed(tile: np.ndarray) -> bytes:
+    """min/max then per row: bit width byte and LSB first zigzagged prediction residuals"""
+    s = tile.astype(np.int64)
+    (lo, hi) = (int(s.min()), int(s.max()))
+
+    # left on the first row, above in the first column, planar elsewhere
+    pred = np.empty_like(s)
+    pred[0, 0] = lo
+    pred[0, 1:] = s[0, :-1]
+    pred[1:, 0] = s[:-1, 0]
+    pred[1:, 1:] = s[1:, :-1] + s[:-1, 1:] - s[:-1, :-1]
+    r = s - pred
+    z = np.where(r >= 0, 2 * r, -2 * r - 1).astype(np.uint64)
+
+    out = [struct.pack("<HH", lo, hi)]
+    for row in z:
+        bits = int(row.max()).bit_length()
+        out.append(bytes([bits]))
+        if bits:
+            planes = (row[:, None] >> np.arange(bits, dtype=np.uint64)) & 1
+            out.append(np.packbits(planes.astype(np.uint8).ravel(), bitorder="little").tobytes())
+    return b"".join(out)
+
+def encode_tile(tile: np.ndarray, codec: int) -> (int, bytes):
+    if codec == TILE_CODEC_PACKED:
+        return (codec, encode_tile_packed(tile))
+    return (TILE_CODEC_RAW, tile.astype(tile.dtype.newbyteorder("<")).tobytes())
+
+def get_hmt_bytes(samples: np.ndarray, tile_size: int, codec: int) -> bytes:
+    (h,w) = samples.shape
+    sample_type = HMAP_U16 if samples.dtype == np.uint16 else HMAP_U8
+
+    tiles = list(get_tiles(samples, tile_size))
+    levels = tiles[-1][0] + 1
+    table_offset = HMT_HEADER_SIZE
+    offset = table_offset + len(tiles) * struct.calcsize(HMT_ENTRY_FORMAT)
+
+    entries = []
+    payloads = []
+    for (level, tx, ty, tile) in tiles:
+        offset = (offset + HMT_ALIGNMENT - 1) // HMT_ALIGNMENT * HMT_ALIGNMENT
+        (tile_codec, payload) = encode_tile(tile, codec)
+        entries.append(struct.pack(HMT_ENTRY_FORMAT, offset, len(payload), tile_codec, 0))
+        payloads.append((offset, payload))
+        offset += len(payload)
+
+    header = struct.pack(HMT_HEADER_FORMAT, HMT_MAGIC, HMT_VERSION, sample_type, w, h,
+                         tile_size, levels, table_offset, len(tiles), 0)
+    out = bytearray(offset)
+    out[0:HMT_HEADER_SIZE] = header.ljust(HMT_HEADER_SIZE, b"\0")
+    out[table_offset:table_offset + len(entries) * 16] = b"".join(entries)
+    for (payload_offset, payload) in payloads:
+        out[payload_offset:payload_offset + len(payload)] = payload
+
+    raw_size = len(tiles) * (tile_size + 1) ** 2 * samples.itemsize
+    packed_size = sum(len(payload) for (_, payload) in payloads)
+    print(f"{levels} levels, {len(tiles)} tiles of {tile_size + 1}x{tile_size + 1} samples, "
+          f"{packed_size} of {raw_size} bytes ({100 * packed_size / raw_size:.1f}%)")
+    return bytes(out)
+
+if __name__ == "__main__":
+    # parse arguments
+    parser = argparse.ArgumentParser(description="Converts an image to a tiled, mip-pyramided .hmt heightmap")
+    parser.add_argument('image', help="The image file to convert")
+    parser.add_argument('-n', '--name', help="The name of the output file")
+    parser.add_argument('-p', '--path', help="The path to the output directory")
+    parser.add_argument('-b', '--bits', type=int, choices=[8, 16], default=8, help="bits per sample")
+    parser.add_argument('-t', '--tile-size', type=int, default=64, help="quads along a tile edge")
+    parser.add_argument('-c', '--codec', choices=CODECS.keys(), default="packed", help="tile compression")
+    args = parser.parse_args()
+
+    # get the file's name if no name is provided
+    if args.name is None:
+        args.name = os.path.splitext(os.path.basename(args.image))[0]
+    if args.path is None:
+        args.path = "."
+
+    with Image.open(args.image) as im:
+        (w, h) = im.size
+        print(f'Opened "{args.image}": {im.format}, {w}x{h}, {im.mode}')
+        samples = get_samples16(im) if args.bits == 16 else get_samples(im)
+
+    os.makedirs(args.path, exist_ok=True)
+    out_path = os.path.join(args.path, f"{args.name}.hmt")
+    data = get_hmt_bytes(samples, args.tile_size, CODECS[args.codec])
+    with open(out_path, 'wb') as outfile:
+        print(f'Writing tiled heightmap to "{out_path}"')
+        outfile.write(data)
@@ -0,0 +1,176 @@
+#ifndef _RING_H_
+#define _RING_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <glad/glad.h>
+
+/*      streaming ring buffer
+ * ---------------------------------
+ * One buffer split into RING_FRAMES regions. A frame writes its dynamic
+ * data into the next region and fences it once the draws reading it are
+ * issued - the region is only written again after that fence signals, so
+ * the CPU runs up to RING_FRAMES - 1 frames ahead of the GPU and never
+ * waits on a draw still reading.
+ *
+ * With GL 4.4 or ARB_buffer_storage the buffer is mapped once, persistent
+ * and coherent, and writes go straight to memory the GPU reads - there is
+ * no copy in the driver. Otherwise each write maps its range with
+ * GL_MAP_UNSYNCHRONIZED_BIT, which the fences make safe.
+ *
+ * Only GL 3.2 entry points are used outside of buffer storage, so the same
+ * ring works on any core context - ring_load must run after the loader.
+ *
+ *   ring_begin(&ring);
+ *   Vertex* v = ring_map(&ring, n * sizeof(Vertex), &offset);
+ *   ... fill v ...
+ *   ring_unmap(&ring);
+ *   ... draw from offset ...
+ *   ring_end(&ring);
+ */
+#define RING_FRAMES 3
+#define RING_ALIGN 64                   /* offsets handed out start on a cache line */
+#define RING_WAIT_NS 1000000000ull      /* per glClientWaitSync, retried until the fence signals */
+
+/* GL 4.4 buffer storage - not in the generated 3.3 loader */
+#ifndef GL_MAP_PERSISTENT_BIT
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT   0x0080
+#endif
+typedef void (APIENTRYP PFNRINGBUFFERSTORAGEPROC)(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+PFNRINGBUFFERSTORAGEPROC ring_glBufferStorage = NULL;
+
+typedef struct {
+    GLuint buffer;
+    GLenum target;
+    GLsizeiptr size;                /* bytes per region */
+    uint8_t* map;                   /* persistent mapping of every region, NULL when mapping per write */
+    bool mapped;                    /* a per write mapping is open */
+    GLsync fences[RING_FRAMES];
+    uint32_t frame;                 /* region written this frame */
+    GLsizeiptr head;                /* bytes of it handed out */
+    uint32_t waits;                 /* frames that found their region still in use */
+} ring_t;
+
+/* true if the context lists extension name */
+bool ring_has_extension(const char* name) {
+    GLint i, count = 0;
+
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (i = 0; i < count; ++i) {
+        if (strcmp((const char*) glGetStringi(GL_EXTENSIONS, i), name) == 0)
+            return true;
+    }
+    return false;
+}
+
+/* looks up glBufferStorage - rings fall back to unsynchronised mapping if the context has none */
+void ring_load(GLADloadproc load) {
+    ring_glBufferStorage = NULL;
+    if (GLVersion.major > 4 || (GLVersion.major == 4 && GLVersion.minor >= 4))
+        ring_glBufferStorage = (PFNRINGBUFFERSTORAGEPROC) load("glBufferStorage");
+    else if (ring_has_extension("GL_ARB_buffer_storage"))
+        ring_glBufferStorage = (PFNRINGBUFFERSTORAGEPROC) load("glBufferStorageARB");
+}
+
+/* creates a ring of RING_FRAMES regions of size bytes, persistent if allowed and supported */
+int ring_init(ring_t* ring, GLenum target, GLsizeiptr size, bool persistent) {
+    GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    memset(ring, 0, sizeof(*ring));
+    ring->target = target;
+    ring->size = (size + RING_ALIGN - 1) / RING_ALIGN * RING_ALIGN;
+
+    glGenBuffers(1, &ring->buffer);
+    glBindBuffer(target, ring->buffer);
+    if (persistent && ring_glBufferStorage != NULL) {
+        ring_glBufferStorage(target, RING_FRAMES * ring->size, NULL, flags);
+        ring->map = glMapBufferRange(target, 0, RING_FRAMES * ring->size, flags);
+        if (ring->map == NULL) {
+            printf("ERROR could not map a %ld byte persistent ring\n", (long) (RING_FRAMES * ring->size));
+            return -1;
+        }
+    } else {
+        glBufferData(target, RING_FRAMES * ring->size, NULL, GL_STREAM_DRAW);
+    }
+
+    if (glGetError() != GL_NO_ERROR) {
+        printf("ERROR could not create a %ld byte ring\n", (long) (RING_FRAMES * ring->size));
+        return -1;
+    }
+    printf("Ring of %d x %ld bytes, %s\n", RING_FRAMES, (long) ring->size,
+           ring->map != NULL ? "persistent mapped" : "mapped per write");
+    return 0;
+}
+
+/* starts a frame in the next region, waiting for the GPU to finish with it */
+void ring_begin(ring_t* ring) {
+    GLsync fence = ring->fences[ring->frame];
+
+    ring->head = 0;
+    if (fence == NULL)
+        return;
+
+    if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+        ++ring->waits;
+        while (glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, RING_WAIT_NS) == GL_TIMEOUT_EXPIRED)
+            ;
+    }
+    glDeleteSync(fence);
+    ring->fences[ring->frame] = NULL;
+}
+
+/* size bytes to write this frame, or NULL if the region is full - offset is their place in the buffer */
+void* ring_map(ring_t* ring, GLsizeiptr size, GLintptr* offset) {
+    GLsizeiptr head = (ring->head + RING_ALIGN - 1) / RING_ALIGN * RING_ALIGN;
+
+    if (head + size > ring->size) {
+        printf("ERROR ring region of %ld bytes is full\n", (long) ring->size);
+        return NULL;
+    }
+    ring->head = head + size;
+    *offset = ring->frame * ring->size + head;
+    if (ring->map != NULL)
+        return ring->map + *offset;
+
+    /* the fences already keep the GPU off this range */
+    glBindBuffer(ring->target, ring->buffer);
+    ring->mapped = true;
+    return glMapBufferRange(ring->target, *offset, size,
+                            GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+}
+
+/* ends the last ring_map - persistent writes are coherent and need nothing */
+void ring_unmap(ring_t* ring) {
+    if (!ring->mapped)
+        return;
+    glBindBuffer(ring->target, ring->buffer);
+    glUnmapBuffer(ring->target);
+    ring->mapped = false;
+}
+
+/* fences the region once every draw reading it is issued, and moves on */
+void ring_end(ring_t* ring) {
+    ring->fences[ring->frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    ring->frame = (ring->frame + 1) % RING_FRAMES;
+}
+
+void ring_free(ring_t* ring) {
+    uint32_t i;
+
+    for (i = 0; i < RING_FRAMES; ++i) {
+        if (ring->fences[i] != NULL)
+            glDeleteSync(ring->fences[i]);
+    }
+    if (ring->map != NULL) {
+        glBindBuffer(ring->target, ring->buffer);
+        glUnmapBuffer(ring->target);
+    }
+    glDeleteBuffers(1, &ring->buffer);
+    memset(ring, 0, sizeof(*ring));
+}
+
+#endif /* _RING_H_ */
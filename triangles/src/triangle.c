@@ -1,11 +1,19 @@
+#include <math.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "linmath.h"
 
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
 
+#include "ring.h"
+
+/* bytes of dynamic vertices a frame may write */
+#define FRAME_VERTEX_BYTES 4096
+
 typedef struct Vertex {
     vec2 pos;
     vec3 col;
@@ -49,9 +57,12 @@ static void key_callback(GLFWwindow* window, int key, int scancode, int action,
         glfwSetWindowShouldClose(window, GLFW_TRUE);
 }
 
-int main(void)
+int main(int argc, char** argv)
 {
     GLFWwindow* window;
+    ring_t ring;
+    /* usage: triangle.exe [-u] - -u maps every write unsynchronised instead of persistently */
+    bool persistent = !(argc > 1 && strcmp(argv[1], "-u") == 0);
 
     /* error callback for glfw issues */
     glfwSetErrorCallback(error_callback);
@@ -90,10 +101,12 @@ int main(void)
     /* set clear color */
     glClearColor(0.5, 0.5, 0.5, 1.0);
 
-    GLuint vertex_buffer;
-    glGenBuffers(1, &vertex_buffer);
-    glBindBuffer(GL_ARRAY_BUFFER, vertex_buffer);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+    /* vertices are rewritten every frame into a ring instead of being uploaded once */
+    ring_load((GLADloadproc) glfwGetProcAddress);
+    if (ring_init(&ring, GL_ARRAY_BUFFER, FRAME_VERTEX_BYTES, persistent) == -1) {
+        glfwTerminate();
+        return -1;
+    }
  
     const GLuint vertex_shader = glCreateShader(GL_VERTEX_SHADER);
     glShaderSource(vertex_shader, 1, &vertex_shader_text, NULL);
@@ -116,11 +129,7 @@ int main(void)
     glGenVertexArrays(1, &vertex_array);
     glBindVertexArray(vertex_array);
     glEnableVertexAttribArray(vpos_location);
-    glVertexAttribPointer(vpos_location, 2, GL_FLOAT, GL_FALSE,
-                          sizeof(Vertex), (void*) offsetof(Vertex, pos));
     glEnableVertexAttribArray(vcol_location);
-    glVertexAttribPointer(vcol_location, 3, GL_FLOAT, GL_FALSE,
-                          sizeof(Vertex), (void*) offsetof(Vertex, col));
 
     /* Loop until the user closes the window */
     while (!glfwWindowShouldClose(window)) {
@@ -137,15 +146,36 @@ int main(void)
         mat4x4_ortho(p, -ratio, ratio, -1.f, 1.f, 1.f, -1.f);
         mat4x4_mul(mvp, p, m);
  
+        /* per frame geometry - the triangle pulses */
+        GLintptr offset;
+        const float pulse = 1.f + 0.2f * sinf(3.f * (float) glfwGetTime());
+        ring_begin(&ring);
+        Vertex* frame_vertices = ring_map(&ring, sizeof(vertices), &offset);
+        if (frame_vertices == NULL)
+            break;
+        for (int i = 0; i < 3; ++i) {
+            frame_vertices[i] = vertices[i];
+            vec2_scale(frame_vertices[i].pos, vertices[i].pos, pulse);
+        }
+        ring_unmap(&ring);
+
         glUseProgram(program);
         glUniformMatrix4fv(mvp_location, 1, GL_FALSE, (const GLfloat*) &mvp);
         glBindVertexArray(vertex_array);
+        glBindBuffer(GL_ARRAY_BUFFER, ring.buffer);
+        glVertexAttribPointer(vpos_location, 2, GL_FLOAT, GL_FALSE,
+                              sizeof(Vertex), (void*) (offset + offsetof(Vertex, pos)));
+        glVertexAttribPointer(vcol_location, 3, GL_FLOAT, GL_FALSE,
+                              sizeof(Vertex), (void*) (offset + offsetof(Vertex, col)));
         glDrawArrays(GL_TRIANGLES, 0, 3);
+        ring_end(&ring);
  
         glfwSwapBuffers(window);
         glfwPollEvents();
     }
 
+    printf("Frames that waited on the GPU: %u\n", ring.waits);
+    ring_free(&ring);
     glfwTerminate();
     return 0;
 }